@@ -21,6 +21,14 @@ AC_DEFUN([AX_LIBREGF_CHECK_LOCAL],
       [Missing function: towupper],
       [1])
     ])
+
+  dnl Headers and functions used in libregf/libregf_file_mapping.c
+  AS_IF(
+    [test "x$ac_cv_enable_winapi" = xno],
+    [AC_CHECK_HEADERS([errno.h fcntl.h sys/mman.h sys/stat.h unistd.h])
+
+    AC_CHECK_FUNCS([fstat mmap munmap])
+  ])
   ])
 
 dnl Function to detect if regftools dependencies are available
@@ -0,0 +1,399 @@
+/*
+ * Arena allocator functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libregf_arena.h"
+#include "libregf_libcerror.h"
+
+/* The size of the block header, which is rounded up to the alignment
+ */
+#define LIBREGF_ARENA_BLOCK_HEADER_SIZE \
+	LIBREGF_ARENA_ALIGNED_SIZE( sizeof( libregf_arena_block_t ) )
+
+/* Creates an arena
+ * The blocks are allocated on demand
+ * Make sure the value arena is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_arena_initialize(
+     libregf_arena_t **arena,
+     size_t block_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_arena_initialize";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arena != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid arena value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size == 0 )
+	 || ( block_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - LIBREGF_ARENA_BLOCK_HEADER_SIZE ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*arena = memory_allocate_structure(
+	          libregf_arena_t );
+
+	if( *arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create arena.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *arena,
+	     0,
+	     sizeof( libregf_arena_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear arena.",
+		 function );
+
+		goto on_error;
+	}
+	( *arena )->block_size = block_size;
+
+	return( 1 );
+
+on_error:
+	if( *arena != NULL )
+	{
+		memory_free(
+		 *arena );
+
+		*arena = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an arena including all the memory allocated from it
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_arena_free(
+     libregf_arena_t **arena,
+     libcerror_error_t **error )
+{
+	libregf_arena_block_t *block      = NULL;
+	libregf_arena_block_t *next_block = NULL;
+	static char *function             = "libregf_arena_free";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arena != NULL )
+	{
+		block = ( *arena )->first_block;
+
+		while( block != NULL )
+		{
+			next_block = block->next_block;
+
+			memory_free(
+			 block );
+
+			block = next_block;
+		}
+		memory_free(
+		 *arena );
+
+		*arena = NULL;
+	}
+	return( 1 );
+}
+
+/* Allocates memory from the arena
+ * The memory is aligned to LIBREGF_ARENA_ALIGNMENT and is not cleared
+ * The memory remains valid until the arena is rewound, reset or freed
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_arena_allocate(
+     libregf_arena_t *arena,
+     size_t size,
+     intptr_t **data,
+     libcerror_error_t **error )
+{
+	libregf_arena_block_t *block = NULL;
+	static char *function        = "libregf_arena_allocate";
+	size_t aligned_size          = 0;
+	size_t block_data_size       = 0;
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - LIBREGF_ARENA_BLOCK_HEADER_SIZE ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	aligned_size = LIBREGF_ARENA_ALIGNED_SIZE( size );
+
+	/* Blocks that were retained by a rewind or reset are reused before
+	 * new blocks are allocated
+	 */
+	while( arena->current_block != NULL )
+	{
+		if( aligned_size <= ( arena->current_block->data_size - arena->current_offset ) )
+		{
+			break;
+		}
+		if( arena->current_block->next_block == NULL )
+		{
+			break;
+		}
+		arena->current_block_offset += arena->current_block->data_size;
+		arena->current_block         = arena->current_block->next_block;
+		arena->current_offset        = 0;
+	}
+	if( ( arena->current_block == NULL )
+	 || ( aligned_size > ( arena->current_block->data_size - arena->current_offset ) ) )
+	{
+		block_data_size = arena->block_size;
+
+		if( block_data_size < aligned_size )
+		{
+			block_data_size = aligned_size;
+		}
+		block = (libregf_arena_block_t *) memory_allocate(
+		                                   LIBREGF_ARENA_BLOCK_HEADER_SIZE + block_data_size );
+
+		if( block == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create block.",
+			 function );
+
+			return( -1 );
+		}
+		block->next_block = NULL;
+		block->data       = &( ( (uint8_t *) block )[ LIBREGF_ARENA_BLOCK_HEADER_SIZE ] );
+		block->data_size  = block_data_size;
+
+		if( arena->current_block == NULL )
+		{
+			arena->first_block = block;
+		}
+		else
+		{
+			arena->current_block->next_block = block;
+			arena->current_block_offset     += arena->current_block->data_size;
+		}
+		arena->current_block  = block;
+		arena->current_offset = 0;
+	}
+	*data = (intptr_t *) &( arena->current_block->data[ arena->current_offset ] );
+
+	arena->current_offset += aligned_size;
+
+	return( 1 );
+}
+
+/* Retrieves a mark of the current position in the arena
+ * Rewinding the arena to the mark releases the memory allocated after it
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_arena_get_mark(
+     libregf_arena_t *arena,
+     size_t *mark,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_arena_get_mark";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( mark == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mark.",
+		 function );
+
+		return( -1 );
+	}
+	*mark = arena->current_block_offset + arena->current_offset;
+
+	return( 1 );
+}
+
+/* Rewinds the arena to a mark
+ * The blocks are retained for reuse
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_arena_rewind(
+     libregf_arena_t *arena,
+     size_t mark,
+     libcerror_error_t **error )
+{
+	libregf_arena_block_t *block = NULL;
+	static char *function        = "libregf_arena_rewind";
+	size_t block_offset          = 0;
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( mark > ( arena->current_block_offset + arena->current_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid mark value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( mark < arena->current_block_offset )
+	{
+		block = arena->first_block;
+
+		while( ( block != NULL )
+		    && ( mark > ( block_offset + block->data_size ) ) )
+		{
+			block_offset += block->data_size;
+			block         = block->next_block;
+		}
+		arena->current_block        = block;
+		arena->current_block_offset = block_offset;
+	}
+	arena->current_offset = mark - arena->current_block_offset;
+
+	return( 1 );
+}
+
+/* Resets the arena, which releases all the memory allocated from it
+ * The blocks are retained for reuse
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_arena_reset(
+     libregf_arena_t *arena,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_arena_reset";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	arena->current_block        = arena->first_block;
+	arena->current_block_offset = 0;
+	arena->current_offset       = 0;
+
+	return( 1 );
+}
+
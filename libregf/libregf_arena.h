@@ -0,0 +1,119 @@
+/*
+ * Arena allocator functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBREGF_ARENA_H )
+#define _LIBREGF_ARENA_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libregf_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The alignment of the allocations, which is sufficient for the structures allocated from an arena
+ */
+#define LIBREGF_ARENA_ALIGNMENT		8
+
+/* The size of an allocation rounded up to the alignment
+ */
+#define LIBREGF_ARENA_ALIGNED_SIZE( size ) \
+	( ( ( size ) + ( LIBREGF_ARENA_ALIGNMENT - 1 ) ) & ~( (size_t) LIBREGF_ARENA_ALIGNMENT - 1 ) )
+
+typedef struct libregf_arena_block libregf_arena_block_t;
+
+struct libregf_arena_block
+{
+	/* The next block
+	 */
+	libregf_arena_block_t *next_block;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+};
+
+typedef struct libregf_arena libregf_arena_t;
+
+struct libregf_arena
+{
+	/* The minimum size of a block
+	 */
+	size_t block_size;
+
+	/* The first block
+	 */
+	libregf_arena_block_t *first_block;
+
+	/* The current block
+	 */
+	libregf_arena_block_t *current_block;
+
+	/* The offset of the first unused byte in the current block
+	 */
+	size_t current_offset;
+
+	/* The offset of the current block, which is the sum of the sizes of the preceding blocks
+	 */
+	size_t current_block_offset;
+};
+
+int libregf_arena_initialize(
+     libregf_arena_t **arena,
+     size_t block_size,
+     libcerror_error_t **error );
+
+int libregf_arena_free(
+     libregf_arena_t **arena,
+     libcerror_error_t **error );
+
+int libregf_arena_allocate(
+     libregf_arena_t *arena,
+     size_t size,
+     intptr_t **data,
+     libcerror_error_t **error );
+
+int libregf_arena_get_mark(
+     libregf_arena_t *arena,
+     size_t *mark,
+     libcerror_error_t **error );
+
+int libregf_arena_rewind(
+     libregf_arena_t *arena,
+     size_t mark,
+     libcerror_error_t **error );
+
+int libregf_arena_reset(
+     libregf_arena_t *arena,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBREGF_ARENA_H ) */
+
@@ -0,0 +1,1176 @@
+/*
+ * Cell iterator functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libregf_cell_iterator.h"
+#include "libregf_definitions.h"
+#include "libregf_hive_bin.h"
+#include "libregf_hive_bin_cell.h"
+#include "libregf_hive_bin_header.h"
+#include "libregf_hive_bins_list.h"
+#include "libregf_io_handle.h"
+#include "libregf_libbfio.h"
+#include "libregf_libcerror.h"
+#include "libregf_libcthreads.h"
+
+#include "regf_hive_bin.h"
+
+/* Creates a cell iterator
+ * Make sure the value cell_iterator is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_cell_iterator_initialize(
+     libregf_cell_iterator_t **cell_iterator,
+     libregf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     libcerror_error_t **error )
+{
+	libregf_internal_cell_iterator_t *internal_cell_iterator = NULL;
+	static char *function                                    = "libregf_cell_iterator_initialize";
+
+	if( cell_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cell iterator.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cell_iterator != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid cell iterator value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( hive_bins_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bins list.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cell_iterator = memory_allocate_structure(
+	                          libregf_internal_cell_iterator_t );
+
+	if( internal_cell_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cell iterator.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_cell_iterator,
+	     0,
+	     sizeof( libregf_internal_cell_iterator_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear cell iterator.",
+		 function );
+
+		memory_free(
+		 internal_cell_iterator );
+
+		return( -1 );
+	}
+	/* The cell iterator needs all the hive bins, read those that have not been read yet
+	 */
+	if( libregf_hive_bins_list_read_bins_file_io_handle(
+	     hive_bins_list,
+	     file_io_handle,
+	     -1,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read hive bins.",
+		 function );
+
+		goto on_error;
+	}
+	internal_cell_iterator->number_of_hive_bins = hive_bins_list->number_of_hive_bins;
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_cell_iterator->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_cell_iterator->io_handle      = io_handle;
+	internal_cell_iterator->file_io_handle = file_io_handle;
+	internal_cell_iterator->hive_bins_list = hive_bins_list;
+	internal_cell_iterator->hive_bin_index = -1;
+	internal_cell_iterator->cell_index     = -1;
+
+	*cell_iterator = (libregf_cell_iterator_t *) internal_cell_iterator;
+
+	return( 1 );
+
+on_error:
+	if( internal_cell_iterator != NULL )
+	{
+		memory_free(
+		 internal_cell_iterator );
+	}
+	return( -1 );
+}
+
+/* Frees a cell iterator
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_cell_iterator_free(
+     libregf_cell_iterator_t **cell_iterator,
+     libcerror_error_t **error )
+{
+	libregf_internal_cell_iterator_t *internal_cell_iterator = NULL;
+	static char *function                                    = "libregf_cell_iterator_free";
+	int result                                               = 1;
+
+	if( cell_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cell iterator.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cell_iterator != NULL )
+	{
+		internal_cell_iterator = (libregf_internal_cell_iterator_t *) *cell_iterator;
+		*cell_iterator         = NULL;
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_cell_iterator->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		/* The io_handle, file_io_handle and hive_bins_list references are freed elsewhere
+		 * The hive bin cell is managed by the hive bin
+		 */
+		if( internal_cell_iterator->hive_bin != NULL )
+		{
+			if( libregf_hive_bin_free(
+			     &( internal_cell_iterator->hive_bin ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free hive bin.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_cell_iterator->hive_bin_data != NULL )
+		{
+			memory_free(
+			 internal_cell_iterator->hive_bin_data );
+		}
+		memory_free(
+		 internal_cell_iterator );
+	}
+	return( result );
+}
+
+/* Reads a specific hive bin and its cells
+ * When the file is memory mapped the cells reference the mapped data directly,
+ * otherwise the hive bin is read into the hive bin data, which is reused
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_internal_cell_iterator_read_hive_bin(
+     libregf_internal_cell_iterator_t *internal_cell_iterator,
+     int hive_bin_index,
+     libcerror_error_t **error )
+{
+	libregf_hive_bin_header_t *hive_bin_header = NULL;
+	const uint8_t *hive_bin_data               = NULL;
+	uint8_t *reallocation                      = NULL;
+	static char *function                      = "libregf_internal_cell_iterator_read_hive_bin";
+	ssize_t read_count                         = 0;
+	off64_t element_offset                     = 0;
+	uint32_t element_size                      = 0;
+
+	if( internal_cell_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cell iterator.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cell_iterator->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cell iterator - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cell_iterator->hive_bins_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cell iterator - missing hive bins list.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_cell_iterator->hive_bin != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid cell iterator - hive bin already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libregf_hive_bins_list_get_hive_bin_range_by_index(
+	     internal_cell_iterator->hive_bins_list,
+	     hive_bin_index,
+	     &element_offset,
+	     &element_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve hive bin: %d.",
+		 function,
+		 hive_bin_index );
+
+		goto on_error;
+	}
+	if( ( element_offset < 0 )
+	 || ( element_size <= sizeof( regf_hive_bin_header_t ) )
+	 || ( (size64_t) element_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid hive bin: %d - range value out of bounds.",
+		 function,
+		 hive_bin_index );
+
+		goto on_error;
+	}
+	if( ( internal_cell_iterator->io_handle->mapped_data != NULL )
+	 && ( (size64_t) element_offset <= internal_cell_iterator->io_handle->mapped_data_size )
+	 && ( (size64_t) element_size <= ( internal_cell_iterator->io_handle->mapped_data_size - (size64_t) element_offset ) ) )
+	{
+		hive_bin_data = &( ( internal_cell_iterator->io_handle->mapped_data )[ element_offset ] );
+	}
+	else
+	{
+		if( (size_t) element_size > internal_cell_iterator->hive_bin_data_size )
+		{
+			reallocation = (uint8_t *) memory_reallocate(
+			                            internal_cell_iterator->hive_bin_data,
+			                            sizeof( uint8_t ) * (size_t) element_size );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize hive bin data.",
+				 function );
+
+				goto on_error;
+			}
+			internal_cell_iterator->hive_bin_data      = reallocation;
+			internal_cell_iterator->hive_bin_data_size = (size_t) element_size;
+		}
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              internal_cell_iterator->file_io_handle,
+		              internal_cell_iterator->hive_bin_data,
+		              (size_t) element_size,
+		              element_offset,
+		              error );
+
+		if( read_count != (ssize_t) element_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read hive bin: %d data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 hive_bin_index,
+			 element_offset,
+			 element_offset );
+
+			goto on_error;
+		}
+		hive_bin_data = internal_cell_iterator->hive_bin_data;
+	}
+	if( libregf_hive_bin_header_initialize(
+	     &hive_bin_header,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create hive bin header.",
+		 function );
+
+		goto on_error;
+	}
+	if( libregf_hive_bin_header_read_data(
+	     hive_bin_header,
+	     hive_bin_data,
+	     sizeof( regf_hive_bin_header_t ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read hive bin: %d header.",
+		 function,
+		 hive_bin_index );
+
+		goto on_error;
+	}
+	if( hive_bin_header->size != element_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: mismatch in hive bin: %d size (stored: %" PRIu32 " != calculated: %" PRIu32 ").",
+		 function,
+		 hive_bin_index,
+		 hive_bin_header->size,
+		 element_size );
+
+		goto on_error;
+	}
+	if( libregf_hive_bin_initialize(
+	     &( internal_cell_iterator->hive_bin ),
+	     hive_bin_header->offset,
+	     hive_bin_header->size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create hive bin.",
+		 function );
+
+		goto on_error;
+	}
+	if( libregf_hive_bin_header_free(
+	     &hive_bin_header,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free hive bin header.",
+		 function );
+
+		goto on_error;
+	}
+	/* The cells reference the hive bin data, which is not owned by the hive bin
+	 */
+	if( libregf_hive_bin_read_cells_data(
+	     internal_cell_iterator->hive_bin,
+	     &( hive_bin_data[ sizeof( regf_hive_bin_header_t ) ] ),
+	     (size_t) element_size - sizeof( regf_hive_bin_header_t ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read hive bin: %d cells.",
+		 function,
+		 hive_bin_index );
+
+		goto on_error;
+	}
+	if( libregf_hive_bin_get_number_of_cells(
+	     internal_cell_iterator->hive_bin,
+	     &( internal_cell_iterator->number_of_cells ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of cells of hive bin: %d.",
+		 function,
+		 hive_bin_index );
+
+		goto on_error;
+	}
+	internal_cell_iterator->hive_bin_index = hive_bin_index;
+	internal_cell_iterator->cell_index     = -1;
+
+	return( 1 );
+
+on_error:
+	if( internal_cell_iterator->hive_bin != NULL )
+	{
+		libregf_hive_bin_free(
+		 &( internal_cell_iterator->hive_bin ),
+		 NULL );
+	}
+	if( hive_bin_header != NULL )
+	{
+		libregf_hive_bin_header_free(
+		 &hive_bin_header,
+		 NULL );
+	}
+	internal_cell_iterator->number_of_cells = 0;
+
+	return( -1 );
+}
+
+/* Moves the cell iterator to the next cell
+ * Returns 1 if successful, 0 if no more cells are available or -1 on error
+ */
+int libregf_internal_cell_iterator_next_cell(
+     libregf_internal_cell_iterator_t *internal_cell_iterator,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_internal_cell_iterator_next_cell";
+
+	if( internal_cell_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cell iterator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cell_iterator->hive_bin_cell = NULL;
+
+	while( ( internal_cell_iterator->hive_bin == NULL )
+	    || ( ( internal_cell_iterator->cell_index + 1 ) >= (int) internal_cell_iterator->number_of_cells ) )
+	{
+		if( internal_cell_iterator->hive_bin != NULL )
+		{
+			if( libregf_hive_bin_free(
+			     &( internal_cell_iterator->hive_bin ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free hive bin.",
+				 function );
+
+				return( -1 );
+			}
+			internal_cell_iterator->number_of_cells = 0;
+		}
+		if( ( internal_cell_iterator->hive_bin_index + 1 ) >= internal_cell_iterator->number_of_hive_bins )
+		{
+			internal_cell_iterator->hive_bin_index = internal_cell_iterator->number_of_hive_bins;
+
+			return( 0 );
+		}
+		if( libregf_internal_cell_iterator_read_hive_bin(
+		     internal_cell_iterator,
+		     internal_cell_iterator->hive_bin_index + 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read hive bin: %d.",
+			 function,
+			 internal_cell_iterator->hive_bin_index + 1 );
+
+			return( -1 );
+		}
+	}
+	if( libregf_hive_bin_get_cell(
+	     internal_cell_iterator->hive_bin,
+	     (uint16_t) ( internal_cell_iterator->cell_index + 1 ),
+	     &( internal_cell_iterator->hive_bin_cell ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cell: %d of hive bin: %d.",
+		 function,
+		 internal_cell_iterator->cell_index + 1,
+		 internal_cell_iterator->hive_bin_index );
+
+		return( -1 );
+	}
+	internal_cell_iterator->cell_index += 1;
+
+	return( 1 );
+}
+
+/* Moves the cell iterator to the next cell
+ * The cells are returned in file order, including the unallocated cells
+ * Returns 1 if successful, 0 if no more cells are available or -1 on error
+ */
+int libregf_cell_iterator_next_cell(
+     libregf_cell_iterator_t *cell_iterator,
+     libcerror_error_t **error )
+{
+	libregf_internal_cell_iterator_t *internal_cell_iterator = NULL;
+	static char *function                                    = "libregf_cell_iterator_next_cell";
+	int result                                               = 0;
+
+	if( cell_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cell iterator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cell_iterator = (libregf_internal_cell_iterator_t *) cell_iterator;
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_cell_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libregf_internal_cell_iterator_next_cell(
+	          internal_cell_iterator,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve next cell.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_cell_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the file offset of the current cell data
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_cell_iterator_get_offset(
+     libregf_cell_iterator_t *cell_iterator,
+     off64_t *offset,
+     libcerror_error_t **error )
+{
+	libregf_internal_cell_iterator_t *internal_cell_iterator = NULL;
+	static char *function                                    = "libregf_cell_iterator_get_offset";
+	int result                                               = 1;
+
+	if( cell_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cell iterator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cell_iterator = (libregf_internal_cell_iterator_t *) cell_iterator;
+
+	if( internal_cell_iterator->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cell iterator - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_cell_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_cell_iterator->hive_bin_cell == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cell iterator - missing current cell.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		/* The cell offset is relative from the start of the hive bins list
+		 * and points to the cell size value
+		 */
+		*offset = (off64_t) internal_cell_iterator->hive_bin_cell->offset + internal_cell_iterator->io_handle->hive_bins_list_offset + 4;
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_cell_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the type of the current cell
+ * The type is determined from the signature of the cell data
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_cell_iterator_get_type(
+     libregf_cell_iterator_t *cell_iterator,
+     int *cell_type,
+     libcerror_error_t **error )
+{
+	libregf_internal_cell_iterator_t *internal_cell_iterator = NULL;
+	const uint8_t *cell_data                                 = NULL;
+	static char *function                                    = "libregf_cell_iterator_get_type";
+	int result                                               = 1;
+
+	if( cell_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cell iterator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cell_iterator = (libregf_internal_cell_iterator_t *) cell_iterator;
+
+	if( cell_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cell type.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_cell_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_cell_iterator->hive_bin_cell == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cell iterator - missing current cell.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		*cell_type = LIBREGF_CELL_TYPE_UNKNOWN;
+
+		if( internal_cell_iterator->hive_bin_cell->size >= 2 )
+		{
+			cell_data = internal_cell_iterator->hive_bin_cell->data;
+
+			if( ( cell_data[ 0 ] == (uint8_t) 'n' )
+			 && ( cell_data[ 1 ] == (uint8_t) 'k' ) )
+			{
+				*cell_type = LIBREGF_CELL_TYPE_NAMED_KEY;
+			}
+			else if( ( cell_data[ 0 ] == (uint8_t) 'v' )
+			      && ( cell_data[ 1 ] == (uint8_t) 'k' ) )
+			{
+				*cell_type = LIBREGF_CELL_TYPE_VALUE_KEY;
+			}
+			else if( ( cell_data[ 0 ] == (uint8_t) 's' )
+			      && ( cell_data[ 1 ] == (uint8_t) 'k' ) )
+			{
+				*cell_type = LIBREGF_CELL_TYPE_SECURITY_KEY;
+			}
+			else if( ( ( cell_data[ 0 ] == (uint8_t) 'l' )
+			        && ( ( cell_data[ 1 ] == (uint8_t) 'f' )
+			          || ( cell_data[ 1 ] == (uint8_t) 'h' )
+			          || ( cell_data[ 1 ] == (uint8_t) 'i' ) ) )
+			      || ( ( cell_data[ 0 ] == (uint8_t) 'r' )
+			        && ( cell_data[ 1 ] == (uint8_t) 'i' ) ) )
+			{
+				*cell_type = LIBREGF_CELL_TYPE_SUB_KEY_LIST;
+			}
+			else if( ( cell_data[ 0 ] == (uint8_t) 'd' )
+			      && ( cell_data[ 1 ] == (uint8_t) 'b' ) )
+			{
+				*cell_type = LIBREGF_CELL_TYPE_DATA_BLOCK_KEY;
+			}
+		}
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_cell_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Determines if the current cell is allocated
+ * Returns 1 if allocated, 0 if not or -1 on error
+ */
+int libregf_cell_iterator_is_allocated(
+     libregf_cell_iterator_t *cell_iterator,
+     libcerror_error_t **error )
+{
+	libregf_internal_cell_iterator_t *internal_cell_iterator = NULL;
+	static char *function                                    = "libregf_cell_iterator_is_allocated";
+	int result                                               = 0;
+
+	if( cell_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cell iterator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cell_iterator = (libregf_internal_cell_iterator_t *) cell_iterator;
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_cell_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_cell_iterator->hive_bin_cell == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cell iterator - missing current cell.",
+		 function );
+
+		result = -1;
+	}
+	else if( ( internal_cell_iterator->hive_bin_cell->flags & LIBREGF_HIVE_BIN_CELL_FLAG_UNALLOCATED ) == 0 )
+	{
+		result = 1;
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_cell_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the data size of the current cell
+ * The data size does not include the cell size value
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_cell_iterator_get_data_size(
+     libregf_cell_iterator_t *cell_iterator,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libregf_internal_cell_iterator_t *internal_cell_iterator = NULL;
+	static char *function                                    = "libregf_cell_iterator_get_data_size";
+	int result                                               = 1;
+
+	if( cell_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cell iterator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cell_iterator = (libregf_internal_cell_iterator_t *) cell_iterator;
+
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_cell_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_cell_iterator->hive_bin_cell == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cell iterator - missing current cell.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		*data_size = (size_t) internal_cell_iterator->hive_bin_cell->size;
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_cell_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the data of the current cell
+ * The data does not include the cell size value
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_cell_iterator_get_data(
+     libregf_cell_iterator_t *cell_iterator,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libregf_internal_cell_iterator_t *internal_cell_iterator = NULL;
+	static char *function                                    = "libregf_cell_iterator_get_data";
+	int result                                               = 1;
+
+	if( cell_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cell iterator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_cell_iterator = (libregf_internal_cell_iterator_t *) cell_iterator;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_cell_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_cell_iterator->hive_bin_cell == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid cell iterator - missing current cell.",
+		 function );
+
+		result = -1;
+	}
+	else if( data_size < (size_t) internal_cell_iterator->hive_bin_cell->size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		result = -1;
+	}
+	else if( memory_copy(
+	          data,
+	          internal_cell_iterator->hive_bin_cell->data,
+	          (size_t) internal_cell_iterator->hive_bin_cell->size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy cell data.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_cell_iterator->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
@@ -0,0 +1,158 @@
+/*
+ * Cell iterator functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBREGF_CELL_ITERATOR_H )
+#define _LIBREGF_CELL_ITERATOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libregf_extern.h"
+#include "libregf_hive_bin.h"
+#include "libregf_hive_bin_cell.h"
+#include "libregf_hive_bins_list.h"
+#include "libregf_io_handle.h"
+#include "libregf_libbfio.h"
+#include "libregf_libcerror.h"
+#include "libregf_libcthreads.h"
+#include "libregf_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libregf_internal_cell_iterator libregf_internal_cell_iterator_t;
+
+struct libregf_internal_cell_iterator
+{
+	/* The IO handle
+	 */
+	libregf_io_handle_t *io_handle;
+
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The hive bins list
+	 */
+	libregf_hive_bins_list_t *hive_bins_list;
+
+	/* The number of hive bins
+	 */
+	int number_of_hive_bins;
+
+	/* The current hive bin index
+	 */
+	int hive_bin_index;
+
+	/* The current hive bin
+	 */
+	libregf_hive_bin_t *hive_bin;
+
+	/* The number of cells in the current hive bin
+	 */
+	uint16_t number_of_cells;
+
+	/* The current cell index
+	 */
+	int cell_index;
+
+	/* The current cell
+	 */
+	libregf_hive_bin_cell_t *hive_bin_cell;
+
+	/* The hive bin data, which is reused for every hive bin
+	 */
+	uint8_t *hive_bin_data;
+
+	/* The hive bin data size
+	 */
+	size_t hive_bin_data_size;
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+int libregf_cell_iterator_initialize(
+     libregf_cell_iterator_t **cell_iterator,
+     libregf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     libcerror_error_t **error );
+
+LIBREGF_EXTERN \
+int libregf_cell_iterator_free(
+     libregf_cell_iterator_t **cell_iterator,
+     libcerror_error_t **error );
+
+int libregf_internal_cell_iterator_read_hive_bin(
+     libregf_internal_cell_iterator_t *internal_cell_iterator,
+     int hive_bin_index,
+     libcerror_error_t **error );
+
+int libregf_internal_cell_iterator_next_cell(
+     libregf_internal_cell_iterator_t *internal_cell_iterator,
+     libcerror_error_t **error );
+
+LIBREGF_EXTERN \
+int libregf_cell_iterator_next_cell(
+     libregf_cell_iterator_t *cell_iterator,
+     libcerror_error_t **error );
+
+LIBREGF_EXTERN \
+int libregf_cell_iterator_get_offset(
+     libregf_cell_iterator_t *cell_iterator,
+     off64_t *offset,
+     libcerror_error_t **error );
+
+LIBREGF_EXTERN \
+int libregf_cell_iterator_get_type(
+     libregf_cell_iterator_t *cell_iterator,
+     int *cell_type,
+     libcerror_error_t **error );
+
+LIBREGF_EXTERN \
+int libregf_cell_iterator_is_allocated(
+     libregf_cell_iterator_t *cell_iterator,
+     libcerror_error_t **error );
+
+LIBREGF_EXTERN \
+int libregf_cell_iterator_get_data_size(
+     libregf_cell_iterator_t *cell_iterator,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+LIBREGF_EXTERN \
+int libregf_cell_iterator_get_data(
+     libregf_cell_iterator_t *cell_iterator,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBREGF_CELL_ITERATOR_H ) */
+
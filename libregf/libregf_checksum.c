@@ -26,16 +26,45 @@
 #include "libregf_checksum.h"
 #include "libregf_libcerror.h"
 
+#if defined( LIBREGF_CHECKSUM_HAVE_SSE2 )
+#include <emmintrin.h>
+#endif
+
+#if defined( LIBREGF_CHECKSUM_HAVE_AVX2 )
+#include <immintrin.h>
+#endif
+
+#if defined( LIBREGF_CHECKSUM_HAVE_NEON )
+#include <arm_neon.h>
+#endif
+
 /* The largest primary (or scalar) available
  * supported by a single load and store instruction
  */
 typedef unsigned long int libregf_aligned_t;
 
-/* Calculates the little-endian XOR-32 of a buffer
+/* Rotates a 32-bit value to the left
+ */
+#define LIBREGF_CHECKSUM_MARVIN32_ROTATE_LEFT( value, number_of_bits ) \
+	( ( ( value ) << ( number_of_bits ) ) | ( ( value ) >> ( 32 - ( number_of_bits ) ) ) )
+
+/* Mixes a block of the Marvin32 hash
+ */
+#define LIBREGF_CHECKSUM_MARVIN32_BLOCK( lower_32bit, upper_32bit ) \
+	upper_32bit ^= lower_32bit; \
+	lower_32bit  = LIBREGF_CHECKSUM_MARVIN32_ROTATE_LEFT( lower_32bit, 20 ); \
+	lower_32bit += upper_32bit; \
+	upper_32bit  = LIBREGF_CHECKSUM_MARVIN32_ROTATE_LEFT( upper_32bit, 9 ); \
+	upper_32bit ^= lower_32bit; \
+	lower_32bit  = LIBREGF_CHECKSUM_MARVIN32_ROTATE_LEFT( lower_32bit, 27 ); \
+	lower_32bit += upper_32bit; \
+	upper_32bit  = LIBREGF_CHECKSUM_MARVIN32_ROTATE_LEFT( upper_32bit, 19 );
+
+/* Calculates the little-endian XOR-32 of a buffer using 32-bit or 64-bit scalar values
  * It uses the initial value to calculate a new XOR-32
  * Returns 1 if successful or -1 on error
  */
-int libregf_checksum_calculate_little_endian_xor32(
+int libregf_checksum_calculate_little_endian_xor32_scalar(
      uint32_t *checksum_value,
      const uint8_t *buffer,
      size_t size,
@@ -44,13 +73,11 @@ int libregf_checksum_calculate_little_endian_xor32(
 {
 	libregf_aligned_t *aligned_buffer_iterator = NULL;
 	uint8_t *buffer_iterator                   = NULL;
-	static char *function                      = "libregf_checksum_calculate_little_endian_xor32";
+	static char *function                      = "libregf_checksum_calculate_little_endian_xor32_scalar";
 	libregf_aligned_t value_aligned            = 0;
 	uint32_t big_endian_value_32bit            = 0;
 	uint32_t safe_checksum_value               = 0;
 	uint32_t value_32bit                       = 0;
-	uint8_t alignment_count                    = 0;
-	uint8_t alignment_size                     = 0;
 	uint8_t byte_count                         = 0;
 	uint8_t byte_order                         = 0;
 	uint8_t byte_size                          = 0;
@@ -93,56 +120,13 @@ int libregf_checksum_calculate_little_endian_xor32(
 	buffer_iterator = (uint8_t *) buffer;
 
 	/* Only optimize when there is the alignment is a multitude of 32-bit
-	 * and for buffers larger than the alignment
+	 * for buffers larger than the alignment and that are aligned, since
+	 * an unaligned start would shift the 32-bit values within the aligned values
 	 */
 	if( ( ( sizeof( libregf_aligned_t ) % 4 ) == 0 )
-	 && ( size > ( 2 * sizeof( libregf_aligned_t ) ) ) )
+	 && ( size > ( 2 * sizeof( libregf_aligned_t ) ) )
+	 && ( ( (intptr_t) buffer_iterator % sizeof( libregf_aligned_t ) ) == 0 ) )
 	{
-		/* Align the buffer iterator
-		 */
-		alignment_size = (uint8_t) ( (intptr_t) buffer_iterator % sizeof( libregf_aligned_t ) );
-
-		if( alignment_size > 0 )
-		{
-			byte_size = sizeof( libregf_aligned_t ) - alignment_size;
-
-			/* Align the buffer iterator in 4-byte steps
-			 */
-			while( byte_size != 0 )
-			{
-				value_32bit = 0;
-				byte_count  = 1;
-
-				if( byte_size >= 4 )
-				{
-					value_32bit |= buffer_iterator[ 3 ];
-					value_32bit <<= 8;
-
-					byte_count++;
-				}
-				if( byte_size >= 3 )
-				{
-					value_32bit |= buffer_iterator[ 2 ];
-					value_32bit <<= 8;
-
-					byte_count++;
-				}
-				if( byte_size >= 2 )
-				{
-					value_32bit |= buffer_iterator[ 1 ];
-					value_32bit <<= 8;
-
-					byte_count++;
-				}
-				value_32bit |= buffer_iterator[ 0 ];
-
-				buffer_iterator += byte_count;
-				byte_size       -= byte_count;
-
-				safe_checksum_value ^= value_32bit;
-			}
-			size -= byte_count;
-		}
 		aligned_buffer_iterator = (libregf_aligned_t *) buffer_iterator;
 
 		if( *buffer_iterator != (uint8_t) ( *aligned_buffer_iterator & 0xff ) )
@@ -163,40 +147,6 @@ int libregf_checksum_calculate_little_endian_xor32(
 
 			size -= sizeof( libregf_aligned_t );
 		}
-		/* Align the aligned XOR value with the 32-bit XOR value
-		 */
-		if( alignment_size > 0 )
-		{
-			byte_count      = ( alignment_size % 4 ) * 8;
-			alignment_count = ( sizeof( libregf_aligned_t ) - alignment_size ) * 8;
-
-			if( byte_order == _BYTE_STREAM_ENDIAN_BIG )
-			{
-				/* Shift twice to set unused bytes to 0
-				 */
-				big_endian_value_32bit = (uint32_t) ( ( value_aligned >> alignment_count ) << byte_count );
-
-				/* Change big-endian into little-endian
-				 */
-				value_32bit = ( ( big_endian_value_32bit & 0x000000ffUL ) << 24 )
-				            | ( ( big_endian_value_32bit & 0x0000ff00UL ) << 8 )
-				            | ( ( big_endian_value_32bit >> 8 ) & 0x0000ff00UL )
-				            | ( ( big_endian_value_32bit >> 24 ) & 0x000000ffUL );
-
-				/* Strip-off the used part of the aligned value
-				 */
-				value_aligned <<= alignment_count;
-			}
-			else if( byte_order == _BYTE_STREAM_ENDIAN_LITTLE )
-			{
-				value_32bit = (uint32_t) ( value_aligned << byte_count );
-
-				/* Strip-off the used part of the aligned value
-				 */
-				value_aligned >>= alignment_count;
-			}
-			safe_checksum_value ^= value_32bit;
-		}
 		/* Update the 32-bit XOR value with the aligned XOR value
 		 */
 		byte_size = (uint8_t) sizeof( libregf_aligned_t );
@@ -226,66 +176,35 @@ int libregf_checksum_calculate_little_endian_xor32(
 
 			safe_checksum_value ^= value_32bit;
 		}
-		/* Re-align the buffer iterator
-		 */
 		buffer_iterator = (uint8_t *) aligned_buffer_iterator;
+	}
+	while( size >= 4 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 buffer_iterator,
+		 value_32bit );
 
-		byte_size = 4 - ( alignment_size % 4 );
-
-		if( byte_size != 4 )
-		{
-			value_32bit   = buffer_iterator[ 0 ];
-			value_32bit <<= 8;
-
-			if( byte_size >= 2 )
-			{
-				value_32bit |= buffer_iterator[ 1 ];
-			}
-			value_32bit <<= 8;
-
-			if( byte_size >= 3 )
-			{
-				value_32bit |= buffer_iterator[ 2 ];
-			}
-			value_32bit <<= 8;
-
-			buffer_iterator += byte_size;
-			size            -= byte_size;
+		buffer_iterator += 4;
+		size            -= 4;
 
-			safe_checksum_value ^= value_32bit;
-		}
+		safe_checksum_value ^= value_32bit;
 	}
-	while( size > 0 )
+	if( size > 0 )
 	{
 		value_32bit = 0;
-		byte_count  = 1;
-
-		if( size >= 4 )
-		{
-			value_32bit |= buffer_iterator[ 3 ];
-			value_32bit <<= 8;
 
-			byte_count++;
-		}
 		if( size >= 3 )
 		{
 			value_32bit |= buffer_iterator[ 2 ];
 			value_32bit <<= 8;
-
-			byte_count++;
 		}
 		if( size >= 2 )
 		{
 			value_32bit |= buffer_iterator[ 1 ];
 			value_32bit <<= 8;
-
-			byte_count++;
 		}
 		value_32bit |= buffer_iterator[ 0 ];
 
-		buffer_iterator += byte_count;
-		size            -= byte_count;
-
 		safe_checksum_value ^= value_32bit;
 	}
 	*checksum_value = safe_checksum_value;
@@ -293,3 +212,531 @@ int libregf_checksum_calculate_little_endian_xor32(
 	return( 1 );
 }
 
+#if defined( LIBREGF_CHECKSUM_HAVE_SSE2 )
+
+/* Calculates the little-endian XOR-32 of a buffer using SSE2 128-bit values
+ * It uses the initial value to calculate a new XOR-32
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_checksum_calculate_little_endian_xor32_sse2(
+     uint32_t *checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     libcerror_error_t **error )
+{
+	uint32_t values_32bit[ 4 ];
+
+	static char *function = "libregf_checksum_calculate_little_endian_xor32_sse2";
+	size_t buffer_offset  = 0;
+	__m128i xor_value1    = _mm_setzero_si128();
+	__m128i xor_value2    = _mm_setzero_si128();
+	__m128i xor_value3    = _mm_setzero_si128();
+	__m128i xor_value4    = _mm_setzero_si128();
+
+	if( checksum_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum value.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Use multiple independent XOR values to hide the load latency
+	 */
+	while( ( size - buffer_offset ) >= 64 )
+	{
+		xor_value1 = _mm_xor_si128(
+		              xor_value1,
+		              _mm_loadu_si128( (const __m128i *) &( buffer[ buffer_offset ] ) ) );
+		xor_value2 = _mm_xor_si128(
+		              xor_value2,
+		              _mm_loadu_si128( (const __m128i *) &( buffer[ buffer_offset + 16 ] ) ) );
+		xor_value3 = _mm_xor_si128(
+		              xor_value3,
+		              _mm_loadu_si128( (const __m128i *) &( buffer[ buffer_offset + 32 ] ) ) );
+		xor_value4 = _mm_xor_si128(
+		              xor_value4,
+		              _mm_loadu_si128( (const __m128i *) &( buffer[ buffer_offset + 48 ] ) ) );
+
+		buffer_offset += 64;
+	}
+	while( ( size - buffer_offset ) >= 16 )
+	{
+		xor_value1 = _mm_xor_si128(
+		              xor_value1,
+		              _mm_loadu_si128( (const __m128i *) &( buffer[ buffer_offset ] ) ) );
+
+		buffer_offset += 16;
+	}
+	xor_value1 = _mm_xor_si128(
+	              _mm_xor_si128(
+	               xor_value1,
+	               xor_value2 ),
+	              _mm_xor_si128(
+	               xor_value3,
+	               xor_value4 ) );
+
+	/* SSE2 is only available on little-endian x86 hence the 32-bit values are in little-endian
+	 */
+	_mm_storeu_si128(
+	 (__m128i *) values_32bit,
+	 xor_value1 );
+
+	initial_value ^= values_32bit[ 0 ] ^ values_32bit[ 1 ] ^ values_32bit[ 2 ] ^ values_32bit[ 3 ];
+
+	/* The number of bytes processed is a multitude of 4, hence the remaining bytes
+	 * start at a 32-bit value boundary
+	 */
+	return( libregf_checksum_calculate_little_endian_xor32_scalar(
+	         checksum_value,
+	         &( buffer[ buffer_offset ] ),
+	         size - buffer_offset,
+	         initial_value,
+	         error ) );
+}
+
+#endif /* defined( LIBREGF_CHECKSUM_HAVE_SSE2 ) */
+
+#if defined( LIBREGF_CHECKSUM_HAVE_AVX2 )
+
+/* Calculates the little-endian XOR-32 of a buffer using AVX2 256-bit values
+ * This function should only be called when the CPU supports AVX2
+ * It uses the initial value to calculate a new XOR-32
+ * Returns 1 if successful or -1 on error
+ */
+__attribute__((target("avx2")))
+int libregf_checksum_calculate_little_endian_xor32_avx2(
+     uint32_t *checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     libcerror_error_t **error )
+{
+	uint32_t values_32bit[ 4 ];
+
+	static char *function = "libregf_checksum_calculate_little_endian_xor32_avx2";
+	size_t buffer_offset  = 0;
+	__m256i xor_value1    = _mm256_setzero_si256();
+	__m256i xor_value2    = _mm256_setzero_si256();
+	__m256i xor_value3    = _mm256_setzero_si256();
+	__m256i xor_value4    = _mm256_setzero_si256();
+	__m128i xor_value_128bit;
+
+	if( checksum_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum value.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Use multiple independent XOR values to hide the load latency
+	 */
+	while( ( size - buffer_offset ) >= 128 )
+	{
+		xor_value1 = _mm256_xor_si256(
+		              xor_value1,
+		              _mm256_loadu_si256( (const __m256i *) &( buffer[ buffer_offset ] ) ) );
+		xor_value2 = _mm256_xor_si256(
+		              xor_value2,
+		              _mm256_loadu_si256( (const __m256i *) &( buffer[ buffer_offset + 32 ] ) ) );
+		xor_value3 = _mm256_xor_si256(
+		              xor_value3,
+		              _mm256_loadu_si256( (const __m256i *) &( buffer[ buffer_offset + 64 ] ) ) );
+		xor_value4 = _mm256_xor_si256(
+		              xor_value4,
+		              _mm256_loadu_si256( (const __m256i *) &( buffer[ buffer_offset + 96 ] ) ) );
+
+		buffer_offset += 128;
+	}
+	while( ( size - buffer_offset ) >= 32 )
+	{
+		xor_value1 = _mm256_xor_si256(
+		              xor_value1,
+		              _mm256_loadu_si256( (const __m256i *) &( buffer[ buffer_offset ] ) ) );
+
+		buffer_offset += 32;
+	}
+	xor_value1 = _mm256_xor_si256(
+	              _mm256_xor_si256(
+	               xor_value1,
+	               xor_value2 ),
+	              _mm256_xor_si256(
+	               xor_value3,
+	               xor_value4 ) );
+
+	xor_value_128bit = _mm_xor_si128(
+	                    _mm256_castsi256_si128(
+	                     xor_value1 ),
+	                    _mm256_extracti128_si256(
+	                     xor_value1,
+	                     1 ) );
+
+	_mm_storeu_si128(
+	 (__m128i *) values_32bit,
+	 xor_value_128bit );
+
+	initial_value ^= values_32bit[ 0 ] ^ values_32bit[ 1 ] ^ values_32bit[ 2 ] ^ values_32bit[ 3 ];
+
+	/* Avoid mixing AVX and SSE register state with the caller
+	 */
+	_mm256_zeroupper();
+
+	return( libregf_checksum_calculate_little_endian_xor32_scalar(
+	         checksum_value,
+	         &( buffer[ buffer_offset ] ),
+	         size - buffer_offset,
+	         initial_value,
+	         error ) );
+}
+
+#endif /* defined( LIBREGF_CHECKSUM_HAVE_AVX2 ) */
+
+#if defined( LIBREGF_CHECKSUM_HAVE_NEON )
+
+/* Calculates the little-endian XOR-32 of a buffer using NEON 128-bit values
+ * It uses the initial value to calculate a new XOR-32
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_checksum_calculate_little_endian_xor32_neon(
+     uint32_t *checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_checksum_calculate_little_endian_xor32_neon";
+	size_t buffer_offset  = 0;
+	uint32x4_t xor_value1 = vdupq_n_u32( 0 );
+	uint32x4_t xor_value2 = vdupq_n_u32( 0 );
+	uint32x4_t xor_value3 = vdupq_n_u32( 0 );
+	uint32x4_t xor_value4 = vdupq_n_u32( 0 );
+
+	if( checksum_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum value.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Use multiple independent XOR values to hide the load latency
+	 */
+	while( ( size - buffer_offset ) >= 64 )
+	{
+		xor_value1 = veorq_u32(
+		              xor_value1,
+		              vreinterpretq_u32_u8( vld1q_u8( &( buffer[ buffer_offset ] ) ) ) );
+		xor_value2 = veorq_u32(
+		              xor_value2,
+		              vreinterpretq_u32_u8( vld1q_u8( &( buffer[ buffer_offset + 16 ] ) ) ) );
+		xor_value3 = veorq_u32(
+		              xor_value3,
+		              vreinterpretq_u32_u8( vld1q_u8( &( buffer[ buffer_offset + 32 ] ) ) ) );
+		xor_value4 = veorq_u32(
+		              xor_value4,
+		              vreinterpretq_u32_u8( vld1q_u8( &( buffer[ buffer_offset + 48 ] ) ) ) );
+
+		buffer_offset += 64;
+	}
+	while( ( size - buffer_offset ) >= 16 )
+	{
+		xor_value1 = veorq_u32(
+		              xor_value1,
+		              vreinterpretq_u32_u8( vld1q_u8( &( buffer[ buffer_offset ] ) ) ) );
+
+		buffer_offset += 16;
+	}
+	xor_value1 = veorq_u32(
+	              veorq_u32(
+	               xor_value1,
+	               xor_value2 ),
+	              veorq_u32(
+	               xor_value3,
+	               xor_value4 ) );
+
+	/* NEON is only used on little-endian ARM hence the 32-bit values are in little-endian
+	 */
+	initial_value ^= vgetq_lane_u32( xor_value1, 0 )
+	               ^ vgetq_lane_u32( xor_value1, 1 )
+	               ^ vgetq_lane_u32( xor_value1, 2 )
+	               ^ vgetq_lane_u32( xor_value1, 3 );
+
+	return( libregf_checksum_calculate_little_endian_xor32_scalar(
+	         checksum_value,
+	         &( buffer[ buffer_offset ] ),
+	         size - buffer_offset,
+	         initial_value,
+	         error ) );
+}
+
+#endif /* defined( LIBREGF_CHECKSUM_HAVE_NEON ) */
+
+/* Calculates the little-endian XOR-32 of a buffer
+ * It uses the widest variant supported by the compiler and CPU
+ * It uses the initial value to calculate a new XOR-32
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_checksum_calculate_little_endian_xor32(
+     uint32_t *checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_checksum_calculate_little_endian_xor32";
+	int result            = 0;
+
+	if( checksum_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checksum value.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( LIBREGF_CHECKSUM_HAVE_AVX2 )
+	/* __builtin_cpu_supports caches the CPUID result hence is cheap to call
+	 */
+	if( __builtin_cpu_supports( "avx2" ) != 0 )
+	{
+		result = libregf_checksum_calculate_little_endian_xor32_avx2(
+		          checksum_value,
+		          buffer,
+		          size,
+		          initial_value,
+		          error );
+	}
+	else
+#endif
+	{
+#if defined( LIBREGF_CHECKSUM_HAVE_SSE2 )
+		result = libregf_checksum_calculate_little_endian_xor32_sse2(
+		          checksum_value,
+		          buffer,
+		          size,
+		          initial_value,
+		          error );
+#elif defined( LIBREGF_CHECKSUM_HAVE_NEON )
+		result = libregf_checksum_calculate_little_endian_xor32_neon(
+		          checksum_value,
+		          buffer,
+		          size,
+		          initial_value,
+		          error );
+#else
+		result = libregf_checksum_calculate_little_endian_xor32_scalar(
+		          checksum_value,
+		          buffer,
+		          size,
+		          initial_value,
+		          error );
+#endif
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate XOR-32.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Calculates the Marvin32 hash of a buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_checksum_calculate_marvin32(
+     uint64_t *hash_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint64_t seed,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_checksum_calculate_marvin32";
+	size_t buffer_offset  = 0;
+	uint32_t value_32bit  = 0;
+	uint32_t lower_32bit  = 0;
+	uint32_t upper_32bit  = 0;
+
+	if( hash_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash value.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	lower_32bit = (uint32_t) ( seed & 0xffffffffUL );
+	upper_32bit = (uint32_t) ( seed >> 32 );
+
+	while( ( size - buffer_offset ) >= 4 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( buffer[ buffer_offset ] ),
+		 value_32bit );
+
+		buffer_offset += 4;
+
+		lower_32bit += value_32bit;
+
+		LIBREGF_CHECKSUM_MARVIN32_BLOCK(
+		 lower_32bit,
+		 upper_32bit );
+	}
+	/* The remaining bytes are padded with 0x80
+	 */
+	value_32bit = 0x00000080UL;
+
+	while( size > buffer_offset )
+	{
+		size -= 1;
+
+		value_32bit <<= 8;
+		value_32bit  |= buffer[ size ];
+	}
+	lower_32bit += value_32bit;
+
+	LIBREGF_CHECKSUM_MARVIN32_BLOCK(
+	 lower_32bit,
+	 upper_32bit );
+
+	LIBREGF_CHECKSUM_MARVIN32_BLOCK(
+	 lower_32bit,
+	 upper_32bit );
+
+	*hash_value = ( (uint64_t) upper_32bit << 32 ) | lower_32bit;
+
+	return( 1 );
+}
+
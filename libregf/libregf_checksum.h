@@ -31,6 +31,66 @@
 extern "C" {
 #endif
 
+/* SSE2 is part of the x86-64 baseline and optional on x86
+ */
+#if defined( __SSE2__ ) || defined( _M_X64 ) || ( defined( _M_IX86_FP ) && ( _M_IX86_FP >= 2 ) )
+#define LIBREGF_CHECKSUM_HAVE_SSE2
+#endif
+
+/* AVX2 is detected at run-time, which requires the GCC or Clang
+ * target function attribute and __builtin_cpu_supports
+ */
+#if defined( LIBREGF_CHECKSUM_HAVE_SSE2 ) && ( defined( __x86_64__ ) || defined( __i386__ ) ) \
+ && ( defined( __clang__ ) || ( defined( __GNUC__ ) && ( ( __GNUC__ > 4 ) || ( ( __GNUC__ == 4 ) && ( __GNUC_MINOR__ >= 9 ) ) ) ) )
+#define LIBREGF_CHECKSUM_HAVE_AVX2
+#endif
+
+/* NEON is part of the AArch64 baseline, only little-endian is supported
+ */
+#if ( defined( __ARM_NEON ) && !defined( __ARM_BIG_ENDIAN ) ) || defined( _M_ARM64 )
+#define LIBREGF_CHECKSUM_HAVE_NEON
+#endif
+
+int libregf_checksum_calculate_little_endian_xor32_scalar(
+     uint32_t *checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     libcerror_error_t **error );
+
+#if defined( LIBREGF_CHECKSUM_HAVE_SSE2 )
+
+int libregf_checksum_calculate_little_endian_xor32_sse2(
+     uint32_t *checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     libcerror_error_t **error );
+
+#endif /* defined( LIBREGF_CHECKSUM_HAVE_SSE2 ) */
+
+#if defined( LIBREGF_CHECKSUM_HAVE_AVX2 )
+
+int libregf_checksum_calculate_little_endian_xor32_avx2(
+     uint32_t *checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     libcerror_error_t **error );
+
+#endif /* defined( LIBREGF_CHECKSUM_HAVE_AVX2 ) */
+
+#if defined( LIBREGF_CHECKSUM_HAVE_NEON )
+
+int libregf_checksum_calculate_little_endian_xor32_neon(
+     uint32_t *checksum_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint32_t initial_value,
+     libcerror_error_t **error );
+
+#endif /* defined( LIBREGF_CHECKSUM_HAVE_NEON ) */
+
 int libregf_checksum_calculate_little_endian_xor32(
      uint32_t *checksum_value,
      const uint8_t *buffer,
@@ -38,6 +98,13 @@ int libregf_checksum_calculate_little_endian_xor32(
      uint32_t initial_value,
      libcerror_error_t **error );
 
+int libregf_checksum_calculate_marvin32(
+     uint64_t *hash_value,
+     const uint8_t *buffer,
+     size_t size,
+     uint64_t seed,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
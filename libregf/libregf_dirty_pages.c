@@ -0,0 +1,450 @@
+/*
+ * Dirty pages functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libregf_definitions.h"
+#include "libregf_dirty_pages.h"
+#include "libregf_libcerror.h"
+
+/* Creates dirty pages
+ * Make sure the value dirty_pages is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_dirty_pages_initialize(
+     libregf_dirty_pages_t **dirty_pages,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_dirty_pages_initialize";
+
+	if( dirty_pages == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid dirty pages.",
+		 function );
+
+		return( -1 );
+	}
+	if( *dirty_pages != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid dirty pages value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*dirty_pages = memory_allocate_structure(
+	                libregf_dirty_pages_t );
+
+	if( *dirty_pages == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create dirty pages.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *dirty_pages,
+	     0,
+	     sizeof( libregf_dirty_pages_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear dirty pages.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *dirty_pages != NULL )
+	{
+		memory_free(
+		 *dirty_pages );
+
+		*dirty_pages = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees dirty pages
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_dirty_pages_free(
+     libregf_dirty_pages_t **dirty_pages,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_dirty_pages_free";
+	uint32_t page_index   = 0;
+
+	if( dirty_pages == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid dirty pages.",
+		 function );
+
+		return( -1 );
+	}
+	if( *dirty_pages != NULL )
+	{
+		if( ( *dirty_pages )->pages != NULL )
+		{
+			for( page_index = 0;
+			     page_index < ( *dirty_pages )->number_of_pages;
+			     page_index++ )
+			{
+				if( ( *dirty_pages )->pages[ page_index ] != NULL )
+				{
+					memory_free(
+					 ( *dirty_pages )->pages[ page_index ] );
+				}
+			}
+			memory_free(
+			 ( *dirty_pages )->pages );
+		}
+		memory_free(
+		 *dirty_pages );
+
+		*dirty_pages = NULL;
+	}
+	return( 1 );
+}
+
+/* Resizes the dirty pages to a specific hive bins size
+ * Dirty pages beyond the hive bins size are discarded
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_dirty_pages_resize(
+     libregf_dirty_pages_t *dirty_pages,
+     uint32_t hive_bins_size,
+     libcerror_error_t **error )
+{
+	uint8_t **reallocation   = NULL;
+	static char *function    = "libregf_dirty_pages_resize";
+	size_t pages_size        = 0;
+	uint32_t number_of_pages = 0;
+	uint32_t page_index      = 0;
+
+	if( dirty_pages == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid dirty pages.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_pages = hive_bins_size / LIBREGF_DIRTY_PAGE_SIZE;
+
+	if( ( hive_bins_size % LIBREGF_DIRTY_PAGE_SIZE ) != 0 )
+	{
+		number_of_pages += 1;
+	}
+	for( page_index = number_of_pages;
+	     page_index < dirty_pages->number_of_pages;
+	     page_index++ )
+	{
+		if( dirty_pages->pages[ page_index ] != NULL )
+		{
+			memory_free(
+			 dirty_pages->pages[ page_index ] );
+
+			dirty_pages->pages[ page_index ] = NULL;
+
+			dirty_pages->number_of_dirty_pages -= 1;
+		}
+	}
+	if( number_of_pages > dirty_pages->number_of_pages )
+	{
+		pages_size = sizeof( uint8_t * ) * number_of_pages;
+
+		if( pages_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid pages size value exceeds maximum allocation size.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = (uint8_t **) memory_reallocate(
+		                             dirty_pages->pages,
+		                             pages_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize pages.",
+			 function );
+
+			return( -1 );
+		}
+		dirty_pages->pages = reallocation;
+
+		for( page_index = dirty_pages->number_of_pages;
+		     page_index < number_of_pages;
+		     page_index++ )
+		{
+			dirty_pages->pages[ page_index ] = NULL;
+		}
+	}
+	dirty_pages->hive_bins_size  = hive_bins_size;
+	dirty_pages->number_of_pages = number_of_pages;
+
+	return( 1 );
+}
+
+/* Sets the data of dirty pages
+ * The offset is relative to the start of the hive bins
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_dirty_pages_set_data(
+     libregf_dirty_pages_t *dirty_pages,
+     uint32_t offset,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_dirty_pages_set_data";
+	size_t data_offset    = 0;
+	uint32_t page_index   = 0;
+
+	if( dirty_pages == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid dirty pages.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( offset % LIBREGF_DIRTY_PAGE_SIZE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported offset: %" PRIu32 " value not a multitude of page size.",
+		 function,
+		 offset );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size > (size_t) SSIZE_MAX )
+	 || ( ( data_size % LIBREGF_DIRTY_PAGE_SIZE ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( offset >= dirty_pages->hive_bins_size )
+	 || ( data_size > (size_t) ( dirty_pages->hive_bins_size - offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset: %" PRIu32 " and data size: %" PRIzd " value out of bounds.",
+		 function,
+		 offset,
+		 data_size );
+
+		return( -1 );
+	}
+	page_index = offset / LIBREGF_DIRTY_PAGE_SIZE;
+
+	while( data_offset < data_size )
+	{
+		if( dirty_pages->pages[ page_index ] == NULL )
+		{
+			dirty_pages->pages[ page_index ] = (uint8_t *) memory_allocate(
+			                                                sizeof( uint8_t ) * LIBREGF_DIRTY_PAGE_SIZE );
+
+			if( dirty_pages->pages[ page_index ] == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create page: %" PRIu32 ".",
+				 function,
+				 page_index );
+
+				return( -1 );
+			}
+			dirty_pages->number_of_dirty_pages += 1;
+		}
+		if( memory_copy(
+		     dirty_pages->pages[ page_index ],
+		     &( data[ data_offset ] ),
+		     LIBREGF_DIRTY_PAGE_SIZE ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy page: %" PRIu32 ".",
+			 function,
+			 page_index );
+
+			return( -1 );
+		}
+		data_offset += LIBREGF_DIRTY_PAGE_SIZE;
+		page_index  += 1;
+	}
+	return( 1 );
+}
+
+/* Copies the dirty pages that overlap with a specific range into a buffer
+ * The offset is relative to the start of the hive bins and the buffer contains
+ * the data of the range, parts of the buffer that are not dirty are left unchanged
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_dirty_pages_apply_to_buffer(
+     libregf_dirty_pages_t *dirty_pages,
+     uint32_t offset,
+     uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_dirty_pages_apply_to_buffer";
+	size_t buffer_offset  = 0;
+	size_t copy_size      = 0;
+	uint32_t page_index   = 0;
+	uint32_t page_offset  = 0;
+
+	if( dirty_pages == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid dirty pages.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( dirty_pages->number_of_dirty_pages == 0 )
+	{
+		return( 1 );
+	}
+	page_index  = offset / LIBREGF_DIRTY_PAGE_SIZE;
+	page_offset = offset % LIBREGF_DIRTY_PAGE_SIZE;
+
+	while( ( buffer_offset < size )
+	    && ( page_index < dirty_pages->number_of_pages ) )
+	{
+		copy_size = LIBREGF_DIRTY_PAGE_SIZE - page_offset;
+
+		if( copy_size > ( size - buffer_offset ) )
+		{
+			copy_size = size - buffer_offset;
+		}
+		if( dirty_pages->pages[ page_index ] != NULL )
+		{
+			if( memory_copy(
+			     &( buffer[ buffer_offset ] ),
+			     &( ( dirty_pages->pages[ page_index ] )[ page_offset ] ),
+			     copy_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy page: %" PRIu32 ".",
+				 function,
+				 page_index );
+
+				return( -1 );
+			}
+		}
+		buffer_offset += copy_size;
+		page_index    += 1;
+		page_offset    = 0;
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,88 @@
+/*
+ * Dirty pages functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBREGF_DIRTY_PAGES_H )
+#define _LIBREGF_DIRTY_PAGES_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libregf_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libregf_dirty_pages libregf_dirty_pages_t;
+
+struct libregf_dirty_pages
+{
+	/* The hive bins size
+	 */
+	uint32_t hive_bins_size;
+
+	/* The number of pages
+	 */
+	uint32_t number_of_pages;
+
+	/* The pages, where each page contains 512 bytes of the hive bins
+	 * or is NULL if the page is not dirty
+	 */
+	uint8_t **pages;
+
+	/* The number of dirty pages
+	 */
+	uint32_t number_of_dirty_pages;
+};
+
+int libregf_dirty_pages_initialize(
+     libregf_dirty_pages_t **dirty_pages,
+     libcerror_error_t **error );
+
+int libregf_dirty_pages_free(
+     libregf_dirty_pages_t **dirty_pages,
+     libcerror_error_t **error );
+
+int libregf_dirty_pages_resize(
+     libregf_dirty_pages_t *dirty_pages,
+     uint32_t hive_bins_size,
+     libcerror_error_t **error );
+
+int libregf_dirty_pages_set_data(
+     libregf_dirty_pages_t *dirty_pages,
+     uint32_t offset,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libregf_dirty_pages_apply_to_buffer(
+     libregf_dirty_pages_t *dirty_pages,
+     uint32_t offset,
+     uint8_t *buffer,
+     size_t size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBREGF_DIRTY_PAGES_H ) */
+
@@ -127,6 +127,11 @@ int libregf_dirty_vector_free(
 	}
 	if( *dirty_vector != NULL )
 	{
+		if( ( *dirty_vector )->dirty_page_bitmap != NULL )
+		{
+			memory_free(
+			 ( *dirty_vector )->dirty_page_bitmap );
+		}
 		memory_free(
 		 *dirty_vector );
 
@@ -181,7 +186,18 @@ int libregf_dirty_vector_read_data(
 
 		return( -1 );
 	}
-	if( dirty_page_bitmap_size > data_size )
+	if( dirty_vector->dirty_page_bitmap != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid dirty vector - dirty page bitmap value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( dirty_page_bitmap_size > ( data_size - 4 ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -250,6 +266,82 @@ int libregf_dirty_vector_read_data(
 	}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
+	if( dirty_page_bitmap_size > 0 )
+	{
+		dirty_vector->dirty_page_bitmap = (uint8_t *) memory_allocate(
+		                                               sizeof( uint8_t ) * dirty_page_bitmap_size );
+
+		if( dirty_vector->dirty_page_bitmap == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create dirty page bitmap.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     dirty_vector->dirty_page_bitmap,
+		     &( data[ 4 ] ),
+		     dirty_page_bitmap_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy dirty page bitmap.",
+			 function );
+
+			memory_free(
+			 dirty_vector->dirty_page_bitmap );
+
+			dirty_vector->dirty_page_bitmap = NULL;
+
+			return( -1 );
+		}
+	}
+	dirty_vector->dirty_page_bitmap_size = dirty_page_bitmap_size;
+	dirty_vector->data_size              = data_size;
+
+	return( 1 );
+}
+
+/* Determines if a page is dirty
+ * A page is 512 bytes of the hive bins
+ * Returns 1 if the page is dirty, 0 if not or -1 on error
+ */
+int libregf_dirty_vector_page_is_dirty(
+     libregf_dirty_vector_t *dirty_vector,
+     uint32_t page_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_dirty_vector_page_is_dirty";
+	size_t bitmap_index   = 0;
+
+	if( dirty_vector == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid dirty vector.",
+		 function );
+
+		return( -1 );
+	}
+	bitmap_index = (size_t) ( page_index / 8 );
+
+	if( ( dirty_vector->dirty_page_bitmap == NULL )
+	 || ( bitmap_index >= dirty_vector->dirty_page_bitmap_size ) )
+	{
+		return( 0 );
+	}
+	if( ( dirty_vector->dirty_page_bitmap[ bitmap_index ] & ( 1 << ( page_index % 8 ) ) ) == 0 )
+	{
+		return( 0 );
+	}
 	return( 1 );
 }
 
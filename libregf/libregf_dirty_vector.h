@@ -39,6 +39,18 @@ struct libregf_dirty_vector
 	/* The major format version
 	 */
 	uint32_t major_format_version;
+
+	/* The dirty page bitmap, which contains a bit per 512 bytes of the hive bins
+	 */
+	uint8_t *dirty_page_bitmap;
+
+	/* The dirty page bitmap size
+	 */
+	size_t dirty_page_bitmap_size;
+
+	/* The data size, which includes the padding after the dirty page bitmap
+	 */
+	size_t data_size;
 };
 
 int libregf_dirty_vector_initialize(
@@ -56,6 +68,11 @@ int libregf_dirty_vector_read_data(
      size_t dirty_page_bitmap_size,
      libcerror_error_t **error );
 
+int libregf_dirty_vector_page_is_dirty(
+     libregf_dirty_vector_t *dirty_vector,
+     uint32_t page_index,
+     libcerror_error_t **error );
+
 int libregf_dirty_vector_read_file_io_handle(
      libregf_dirty_vector_t *dirty_vector,
      libbfio_handle_t *file_io_handle,
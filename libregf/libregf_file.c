@@ -25,23 +25,31 @@
 #include <types.h>
 #include <wide_string.h>
 
+#include "libregf_cell_iterator.h"
 #include "libregf_codepage.h"
 #include "libregf_debug.h"
 #include "libregf_definitions.h"
+#include "libregf_dirty_pages.h"
 #include "libregf_file.h"
 #include "libregf_file_header.h"
+#include "libregf_file_mapping.h"
 #include "libregf_hive_bin.h"
 #include "libregf_hive_bins_list.h"
+#include "libregf_index.h"
 #include "libregf_io_handle.h"
 #include "libregf_key.h"
 #include "libregf_key_item.h"
+#include "libregf_key_path_trie.h"
 #include "libregf_key_tree.h"
+#include "libregf_key_walker.h"
 #include "libregf_libbfio.h"
 #include "libregf_libcerror.h"
 #include "libregf_libcnotify.h"
 #include "libregf_libfcache.h"
 #include "libregf_libfdata.h"
 #include "libregf_libuna.h"
+#include "libregf_overlay_io_handle.h"
+#include "libregf_transaction_log.h"
 
 /* Creates a file
  * Make sure the value file is referencing, is set to NULL
@@ -427,6 +435,223 @@ on_error:
 	return( -1 );
 }
 
+/* Opens a file read-only using a memory mapping of the file
+ * The hive bin cells reference the mapped data directly instead of copies
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_file_open_mmap(
+     libregf_file_t *file,
+     const char *filename,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle       = NULL;
+	libregf_file_mapping_t *file_mapping   = NULL;
+	libregf_internal_file_t *internal_file = NULL;
+	static char *function                  = "libregf_file_open_mmap";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libregf_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBREGF_ACCESS_FLAG_READ ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBREGF_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access not supported for a memory mapped file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libregf_file_mapping_initialize(
+	     &file_mapping,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file mapping.",
+		 function );
+
+		goto on_error;
+	}
+	if( libregf_file_mapping_open(
+	     file_mapping,
+	     filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to map file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_memory_range_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_memory_range_set(
+	     file_io_handle,
+	     file_mapping->data,
+	     (size_t) file_mapping->data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set memory range in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	/* The file is not open yet so the mapped data can be set without the lock
+	 */
+	internal_file->io_handle->mapped_data      = file_mapping->data;
+	internal_file->io_handle->mapped_data_size = file_mapping->data_size;
+
+	if( libregf_file_open_file_io_handle(
+	     file,
+	     file_io_handle,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	internal_file->file_io_handle_created_in_library = 1;
+	internal_file->file_mapping                      = file_mapping;
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		internal_file->file_io_handle_created_in_library = 0;
+		internal_file->file_mapping                      = NULL;
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( file_mapping != NULL )
+	{
+		internal_file->io_handle->mapped_data      = NULL;
+		internal_file->io_handle->mapped_data_size = 0;
+
+		libregf_file_mapping_free(
+		 &file_mapping,
+		 NULL );
+	}
+	return( -1 );
+}
+
 #if defined( HAVE_WIDE_CHARACTER_TYPE )
 
 /* Opens a file
@@ -711,6 +936,16 @@ int libregf_file_open_file_io_handle(
 		}
 		file_io_handle_opened_in_library = 1;
 	}
+	/* The file is not open yet so the IO handle flags can be set without the lock
+	 */
+	if( ( access_flags & LIBREGF_ACCESS_FLAG_READ_HIVE_BINS_ON_DEMAND ) != 0 )
+	{
+		internal_file->io_handle->flags |= LIBREGF_IO_HANDLE_FLAG_READ_HIVE_BINS_ON_DEMAND;
+	}
+	else
+	{
+		internal_file->io_handle->flags &= ~( LIBREGF_IO_HANDLE_FLAG_READ_HIVE_BINS_ON_DEMAND );
+	}
 	if( libregf_internal_file_open_read(
 	     internal_file,
 	     file_io_handle,
@@ -823,6 +1058,26 @@ int libregf_file_close(
 		return( -1 );
 	}
 #endif
+	/* The overlay file IO handle is replaced by the file IO handle of the hive
+	 */
+	if( internal_file->hive_file_io_handle != NULL )
+	{
+		if( libbfio_handle_free(
+		     &( internal_file->file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free overlay file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		internal_file->file_io_handle      = internal_file->hive_file_io_handle;
+		internal_file->hive_file_io_handle = NULL;
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -923,6 +1178,22 @@ int libregf_file_close(
 			result = -1;
 		}
 	}
+	if( internal_file->index != NULL )
+	{
+		if( libregf_index_free(
+		     &( internal_file->index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free index.",
+			 function );
+
+			result = -1;
+		}
+	}
 	if( internal_file->hive_bins_list != NULL )
 	{
 		if( libregf_hive_bins_list_free(
@@ -939,6 +1210,40 @@ int libregf_file_close(
 			result = -1;
 		}
 	}
+	if( internal_file->dirty_pages != NULL )
+	{
+		if( libregf_dirty_pages_free(
+		     &( internal_file->dirty_pages ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free dirty pages.",
+			 function );
+
+			result = -1;
+		}
+	}
+	/* The file mapping is freed last since the hive bin cells reference the mapped data
+	 */
+	if( internal_file->file_mapping != NULL )
+	{
+		if( libregf_file_mapping_free(
+		     &( internal_file->file_mapping ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file mapping.",
+			 function );
+
+			result = -1;
+		}
+	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
 	     internal_file->read_write_lock,
@@ -1186,13 +1491,41 @@ int libregf_internal_file_read_hive_bins(
 
 		goto on_error;
 	}
-	result = libregf_hive_bins_list_read_file_io_handle(
-		  internal_file->hive_bins_list,
-		  file_io_handle,
-		  internal_file->io_handle->hive_bins_list_offset,
-		  internal_file->file_header->hive_bins_size,
-		  error );
+	if( ( internal_file->io_handle->flags & LIBREGF_IO_HANDLE_FLAG_READ_HIVE_BINS_ON_DEMAND ) != 0 )
+	{
+		/* Only the first hive bin is read, the other hive bins are read
+		 * when a cell beyond the hive bins read so far is requested
+		 */
+		if( libregf_hive_bins_list_set_data_range(
+		     internal_file->hive_bins_list,
+		     internal_file->io_handle->hive_bins_list_offset,
+		     internal_file->file_header->hive_bins_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set hive bins data range.",
+			 function );
 
+			goto on_error;
+		}
+		result = libregf_hive_bins_list_read_bins_file_io_handle(
+			  internal_file->hive_bins_list,
+			  file_io_handle,
+			  0,
+			  error );
+	}
+	else
+	{
+		result = libregf_hive_bins_list_read_file_io_handle(
+			  internal_file->hive_bins_list,
+			  file_io_handle,
+			  internal_file->io_handle->hive_bins_list_offset,
+			  internal_file->file_header->hive_bins_size,
+			  error );
+	}
 	if( result == -1 )
 	{
 		libcerror_error_set(
@@ -1204,6 +1537,37 @@ int libregf_internal_file_read_hive_bins(
 
 		goto on_error;
 	}
+	/* Share key items between keys so that frequently used keys are not re-read
+	 */
+	if( libregf_hive_bins_list_enable_key_item_cache(
+	     internal_file->hive_bins_list,
+	     LIBREGF_MAXIMUM_CACHE_ENTRIES_KEYS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to enable key item cache.",
+		 function );
+
+		goto on_error;
+	}
+	/* Share security keys between keys since a hive contains few distinct security keys
+	 */
+	if( libregf_hive_bins_list_enable_security_key_cache(
+	     internal_file->hive_bins_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to enable security key cache.",
+		 function );
+
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
@@ -1300,6 +1664,269 @@ on_error:
 	return( -1 );
 }
 
+/* Applies a transaction log
+ * Returns 1 if successful, 0 if no log entries were applied or -1 on error
+ */
+int libregf_internal_file_apply_transaction_log(
+     libregf_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *overlay_file_io_handle   = NULL;
+	libregf_transaction_log_t *transaction_log = NULL;
+	static char *function                      = "libregf_internal_file_apply_transaction_log";
+	uint32_t hive_bins_size                    = 0;
+	uint32_t root_key_offset                   = 0;
+	uint32_t sequence_number                   = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->dirty_pages == NULL )
+	{
+		/* The sequence numbers only match when the hive was written completely
+		 */
+		if( internal_file->file_header->primary_sequence_number == internal_file->file_header->secondary_sequence_number )
+		{
+			return( 0 );
+		}
+		if( libregf_dirty_pages_initialize(
+		     &( internal_file->dirty_pages ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create dirty pages.",
+			 function );
+
+			goto on_error;
+		}
+		if( libregf_dirty_pages_resize(
+		     internal_file->dirty_pages,
+		     internal_file->file_header->hive_bins_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize dirty pages.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libregf_transaction_log_initialize(
+	     &transaction_log,
+	     internal_file->file_header->secondary_sequence_number,
+	     internal_file->dirty_pages->hive_bins_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create transaction log.",
+		 function );
+
+		goto on_error;
+	}
+	if( libregf_transaction_log_read_file_io_handle(
+	     transaction_log,
+	     internal_file->dirty_pages,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read transaction log.",
+		 function );
+
+		goto on_error;
+	}
+	if( transaction_log->number_of_applied_entries == 0 )
+	{
+		if( libregf_transaction_log_free(
+		     &transaction_log,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free transaction log.",
+			 function );
+
+			goto on_error;
+		}
+		return( 0 );
+	}
+	hive_bins_size  = transaction_log->hive_bins_size;
+	root_key_offset = transaction_log->file_header->root_key_offset;
+	sequence_number = transaction_log->sequence_number;
+
+	if( libregf_transaction_log_free(
+	     &transaction_log,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free transaction log.",
+		 function );
+
+		goto on_error;
+	}
+	/* The hive file is not modified, instead it is read through an overlay
+	 * that contains the dirty pages
+	 */
+	if( internal_file->hive_file_io_handle == NULL )
+	{
+		if( libregf_overlay_initialize(
+		     &overlay_file_io_handle,
+		     internal_file->file_io_handle,
+		     internal_file->dirty_pages,
+		     internal_file->io_handle->hive_bins_list_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create overlay file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( libbfio_handle_open(
+		     overlay_file_io_handle,
+		     LIBBFIO_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open overlay file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		internal_file->hive_file_io_handle = internal_file->file_io_handle;
+		internal_file->file_io_handle      = overlay_file_io_handle;
+		overlay_file_io_handle             = NULL;
+	}
+	/* The memory mapped data does not contain the dirty pages
+	 */
+	internal_file->io_handle->mapped_data      = NULL;
+	internal_file->io_handle->mapped_data_size = 0;
+
+	internal_file->file_header->primary_sequence_number   = sequence_number;
+	internal_file->file_header->secondary_sequence_number = sequence_number;
+	internal_file->file_header->root_key_offset           = root_key_offset;
+	internal_file->file_header->hive_bins_size            = hive_bins_size;
+
+	/* The index was written for the hive bins before the log entries were applied
+	 */
+	if( internal_file->index != NULL )
+	{
+		if( libregf_index_free(
+		     &( internal_file->index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free index.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( internal_file->hive_bins_list != NULL )
+	{
+		if( libregf_hive_bins_list_free(
+		     &( internal_file->hive_bins_list ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free hive bins list.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libregf_internal_file_read_hive_bins(
+	     internal_file,
+	     internal_file->file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read hive bins.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( overlay_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &overlay_file_io_handle,
+		 NULL );
+	}
+	if( transaction_log != NULL )
+	{
+		libregf_transaction_log_free(
+		 &transaction_log,
+		 NULL );
+	}
+	return( -1 );
+}
+
 /* Determine if the file corrupted
  * Returns 1 if corrupted, 0 if not or -1 on error
  */
@@ -1783,7 +2410,7 @@ int libregf_file_get_root_key(
 		return( -1 );
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1791,7 +2418,7 @@ int libregf_file_get_root_key(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -1805,6 +2432,7 @@ int libregf_file_get_root_key(
 		          internal_file->io_handle,
 		          internal_file->file_io_handle,
 		          internal_file->file_header->root_key_offset,
+		          0,
 		          internal_file->hive_bins_list,
 		          error );
 
@@ -1821,7 +2449,7 @@ int libregf_file_get_root_key(
 		}
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1829,7 +2457,7 @@ int libregf_file_get_root_key(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -1838,20 +2466,20 @@ int libregf_file_get_root_key(
 	return( result );
 }
 
-/* Retrieves the key for the specific UTF-8 encoded path
- * The path separator is the \ character
+/* Retrieves the key at a specific offset
+ * The offset is the file offset as returned by libregf_key_get_offset
  * Creates a new key
  * Returns 1 if successful, 0 if no such key or -1 on error
  */
-int libregf_file_get_key_by_utf8_path(
+int libregf_file_get_key_by_offset(
      libregf_file_t *file,
-     const uint8_t *utf8_string,
-     size_t utf8_string_length,
+     off64_t key_offset,
      libregf_key_t **key,
      libcerror_error_t **error )
 {
 	libregf_internal_file_t *internal_file = NULL;
-	static char *function                  = "libregf_file_get_key_by_utf8_path";
+	static char *function                  = "libregf_file_get_key_by_offset";
+	off64_t hive_bins_offset               = 0;
 	int result                             = 0;
 
 	if( file == NULL )
@@ -1878,24 +2506,24 @@ int libregf_file_get_key_by_utf8_path(
 
 		return( -1 );
 	}
-	if( utf8_string == NULL )
+	if( internal_file->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid UTF-8 string.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( utf8_string_length > (size_t) SSIZE_MAX )
+	if( key_offset < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid key offset value less than zero.",
 		 function );
 
 		return( -1 );
@@ -1922,8 +2550,19 @@ int libregf_file_get_key_by_utf8_path(
 
 		return( -1 );
 	}
+	/* The key offset points to the start of the corresponding hive bin cell
+	 * and is relative from the start of the hive bins list
+	 */
+	hive_bins_offset = internal_file->io_handle->hive_bins_list_offset + 4;
+
+	if( ( internal_file->file_header->file_type != LIBREGF_FILE_TYPE_REGISTRY )
+	 || ( key_offset < hive_bins_offset )
+	 || ( ( key_offset - hive_bins_offset ) >= (off64_t) internal_file->file_header->hive_bins_size ) )
+	{
+		return( 0 );
+	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1931,38 +2570,205 @@ int libregf_file_get_key_by_utf8_path(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( internal_file->file_header->file_type == LIBREGF_FILE_TYPE_REGISTRY )
+	result = libregf_key_initialize(
+	          key,
+	          internal_file->io_handle,
+	          internal_file->file_io_handle,
+	          (uint32_t) ( key_offset - hive_bins_offset ),
+	          0,
+	          internal_file->hive_bins_list,
+	          error );
+
+	if( result != 1 )
 	{
-		result = libregf_key_tree_get_sub_key_by_utf8_path(
-		          internal_file->io_handle,
-		          internal_file->file_io_handle,
-		          internal_file->hive_bins_list,
-		          internal_file->file_header->root_key_offset,
-		          utf8_string,
-		          utf8_string_length,
-		          key,
-			  error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create key at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 key_offset,
+		 key_offset );
 
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve key by UTF-8 path.",
-			 function );
+		result = -1;
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the key for the specific UTF-8 encoded path
+ * The path separator is the \ character
+ * Creates a new key
+ * Returns 1 if successful, 0 if no such key or -1 on error
+ */
+int libregf_file_get_key_by_utf8_path(
+     libregf_file_t *file,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libregf_key_t **key,
+     libcerror_error_t **error )
+{
+	libregf_internal_file_t *internal_file = NULL;
+	static char *function                  = "libregf_file_get_key_by_utf8_path";
+	uint32_t key_offset                    = 0;
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libregf_internal_file_t *) file;
+
+	if( internal_file->file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( *key != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: key already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file->file_header->file_type == LIBREGF_FILE_TYPE_REGISTRY )
+	{
+		/* The paths in the index are only valid for the codepage the index was built with
+		 */
+		if( ( internal_file->index != NULL )
+		 && ( internal_file->index->ascii_codepage == internal_file->io_handle->ascii_codepage ) )
+		{
+			result = libregf_index_get_key_offset_by_utf8_path(
+			          internal_file->index,
+			          utf8_string,
+			          utf8_string_length,
+			          &key_offset,
+			          error );
+
+			if( result == 1 )
+			{
+				result = libregf_key_initialize(
+				          key,
+				          internal_file->io_handle,
+				          internal_file->file_io_handle,
+				          key_offset,
+				          0,
+				          internal_file->hive_bins_list,
+				          error );
+			}
+		}
+		else
+		{
+			result = libregf_key_tree_get_sub_key_by_utf8_path(
+			          internal_file->io_handle,
+			          internal_file->file_io_handle,
+			          internal_file->hive_bins_list,
+			          internal_file->file_header->root_key_offset,
+			          utf8_string,
+			          utf8_string_length,
+			          key,
+				  error );
+		}
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key by UTF-8 path.",
+			 function );
 
 			result = -1;
 		}
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1970,7 +2776,7 @@ int libregf_file_get_key_by_utf8_path(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -1993,6 +2799,7 @@ int libregf_file_get_key_by_utf16_path(
 {
 	libregf_internal_file_t *internal_file = NULL;
 	static char *function                  = "libregf_file_get_key_by_utf16_path";
+	uint32_t key_offset                    = 0;
 	int result                             = 0;
 
 	if( file == NULL )
@@ -2064,7 +2871,7 @@ int libregf_file_get_key_by_utf16_path(
 		return( -1 );
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2072,7 +2879,7 @@ int libregf_file_get_key_by_utf16_path(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -2080,15 +2887,42 @@ int libregf_file_get_key_by_utf16_path(
 #endif
 	if( internal_file->file_header->file_type == LIBREGF_FILE_TYPE_REGISTRY )
 	{
-		result = libregf_key_tree_get_sub_key_by_utf16_path(
-		          internal_file->io_handle,
-		          internal_file->file_io_handle,
-		          internal_file->hive_bins_list,
-		          internal_file->file_header->root_key_offset,
-		          utf16_string,
-		          utf16_string_length,
-		          key,
-			  error );
+		/* The paths in the index are only valid for the codepage the index was built with
+		 */
+		if( ( internal_file->index != NULL )
+		 && ( internal_file->index->ascii_codepage == internal_file->io_handle->ascii_codepage ) )
+		{
+			result = libregf_index_get_key_offset_by_utf16_path(
+			          internal_file->index,
+			          utf16_string,
+			          utf16_string_length,
+			          &key_offset,
+			          error );
+
+			if( result == 1 )
+			{
+				result = libregf_key_initialize(
+				          key,
+				          internal_file->io_handle,
+				          internal_file->file_io_handle,
+				          key_offset,
+				          0,
+				          internal_file->hive_bins_list,
+				          error );
+			}
+		}
+		else
+		{
+			result = libregf_key_tree_get_sub_key_by_utf16_path(
+			          internal_file->io_handle,
+			          internal_file->file_io_handle,
+			          internal_file->hive_bins_list,
+			          internal_file->file_header->root_key_offset,
+			          utf16_string,
+			          utf16_string_length,
+			          key,
+				  error );
+		}
 
 		if( result == -1 )
 		{
@@ -2103,7 +2937,7 @@ int libregf_file_get_key_by_utf16_path(
 		}
 	}
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2111,7 +2945,7 @@ int libregf_file_get_key_by_utf16_path(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -2120,3 +2954,2196 @@ int libregf_file_get_key_by_utf16_path(
 	return( result );
 }
 
+/* Retrieves the keys for specific UTF-8 encoded paths
+ * The path separator is the \ character
+ * The paths are resolved in a single traversal of the key tree, where
+ * keys that are shared by multiple paths are read only once
+ * Creates a new key for every path that refers to a key, the key is set
+ * to NULL if there is no such key
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_file_get_keys_by_utf8_paths(
+     libregf_file_t *file,
+     const uint8_t **utf8_strings,
+     const size_t *utf8_string_lengths,
+     int number_of_paths,
+     libregf_key_t **keys,
+     libcerror_error_t **error )
+{
+	libregf_internal_file_t *internal_file = NULL;
+	libregf_key_path_trie_t *key_path_trie = NULL;
+	static char *function                  = "libregf_file_get_keys_by_utf8_paths";
+	uint32_t key_offset                    = 0;
+	int path_index                         = 0;
+	int result                             = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libregf_internal_file_t *) file;
+
+	if( internal_file->file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_lengths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string lengths.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_paths < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of paths value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid keys.",
+		 function );
+
+		return( -1 );
+	}
+	for( path_index = 0;
+	     path_index < number_of_paths;
+	     path_index++ )
+	{
+		if( utf8_strings[ path_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid UTF-8 string: %d.",
+			 function,
+			 path_index );
+
+			return( -1 );
+		}
+		if( keys[ path_index ] != NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: key: %d already set.",
+			 function,
+			 path_index );
+
+			return( -1 );
+		}
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file->file_header->file_type != LIBREGF_FILE_TYPE_REGISTRY )
+	{
+		/* Only a registry file contains keys, hence all keys remain NULL
+		 */
+	}
+	/* The index already maps every path directly onto its key
+	 */
+	else if( ( internal_file->index != NULL )
+	      && ( internal_file->index->ascii_codepage == internal_file->io_handle->ascii_codepage ) )
+	{
+		for( path_index = 0;
+		     path_index < number_of_paths;
+		     path_index++ )
+		{
+			result = libregf_index_get_key_offset_by_utf8_path(
+			          internal_file->index,
+			          utf8_strings[ path_index ],
+			          utf8_string_lengths[ path_index ],
+			          &key_offset,
+			          error );
+
+			if( result == 1 )
+			{
+				result = libregf_key_initialize(
+				          &( keys[ path_index ] ),
+				          internal_file->io_handle,
+				          internal_file->file_io_handle,
+				          key_offset,
+				          0,
+				          internal_file->hive_bins_list,
+				          error );
+			}
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve key: %d by UTF-8 path.",
+				 function,
+				 path_index );
+
+				break;
+			}
+			result = 1;
+		}
+	}
+	else
+	{
+		result = libregf_key_path_trie_initialize(
+		          &key_path_trie,
+		          number_of_paths,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create key path trie.",
+			 function );
+		}
+		for( path_index = 0;
+		     ( result != -1 ) && ( path_index < number_of_paths );
+		     path_index++ )
+		{
+			result = libregf_key_path_trie_insert_utf8_path(
+			          key_path_trie,
+			          path_index,
+			          utf8_strings[ path_index ],
+			          utf8_string_lengths[ path_index ],
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to insert UTF-8 path: %d into key path trie.",
+				 function,
+				 path_index );
+			}
+		}
+		if( result != -1 )
+		{
+			result = libregf_key_path_trie_resolve(
+			          key_path_trie,
+			          internal_file->io_handle,
+			          internal_file->file_io_handle,
+			          internal_file->hive_bins_list,
+			          internal_file->file_header->root_key_offset,
+			          keys,
+			          number_of_paths,
+			          error );
+
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to resolve key paths.",
+				 function );
+			}
+		}
+		if( key_path_trie != NULL )
+		{
+			if( libregf_key_path_trie_free(
+			     &key_path_trie,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free key path trie.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+	if( result == -1 )
+	{
+		for( path_index = 0;
+		     path_index < number_of_paths;
+		     path_index++ )
+		{
+			if( keys[ path_index ] != NULL )
+			{
+				libregf_key_free(
+				 &( keys[ path_index ] ),
+				 NULL );
+			}
+		}
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the keys for specific UTF-16 encoded paths
+ * The path separator is the \ character
+ * The paths are resolved in a single traversal of the key tree, where
+ * keys that are shared by multiple paths are read only once
+ * Creates a new key for every path that refers to a key, the key is set
+ * to NULL if there is no such key
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_file_get_keys_by_utf16_paths(
+     libregf_file_t *file,
+     const uint16_t **utf16_strings,
+     const size_t *utf16_string_lengths,
+     int number_of_paths,
+     libregf_key_t **keys,
+     libcerror_error_t **error )
+{
+	libregf_internal_file_t *internal_file = NULL;
+	libregf_key_path_trie_t *key_path_trie = NULL;
+	static char *function                  = "libregf_file_get_keys_by_utf16_paths";
+	uint32_t key_offset                    = 0;
+	int path_index                         = 0;
+	int result                             = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libregf_internal_file_t *) file;
+
+	if( internal_file->file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 strings.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_lengths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string lengths.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_paths < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of paths value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid keys.",
+		 function );
+
+		return( -1 );
+	}
+	for( path_index = 0;
+	     path_index < number_of_paths;
+	     path_index++ )
+	{
+		if( utf16_strings[ path_index ] == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+			 "%s: invalid UTF-16 string: %d.",
+			 function,
+			 path_index );
+
+			return( -1 );
+		}
+		if( keys[ path_index ] != NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: key: %d already set.",
+			 function,
+			 path_index );
+
+			return( -1 );
+		}
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file->file_header->file_type != LIBREGF_FILE_TYPE_REGISTRY )
+	{
+		/* Only a registry file contains keys, hence all keys remain NULL
+		 */
+	}
+	/* The index already maps every path directly onto its key
+	 */
+	else if( ( internal_file->index != NULL )
+	      && ( internal_file->index->ascii_codepage == internal_file->io_handle->ascii_codepage ) )
+	{
+		for( path_index = 0;
+		     path_index < number_of_paths;
+		     path_index++ )
+		{
+			result = libregf_index_get_key_offset_by_utf16_path(
+			          internal_file->index,
+			          utf16_strings[ path_index ],
+			          utf16_string_lengths[ path_index ],
+			          &key_offset,
+			          error );
+
+			if( result == 1 )
+			{
+				result = libregf_key_initialize(
+				          &( keys[ path_index ] ),
+				          internal_file->io_handle,
+				          internal_file->file_io_handle,
+				          key_offset,
+				          0,
+				          internal_file->hive_bins_list,
+				          error );
+			}
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve key: %d by UTF-16 path.",
+				 function,
+				 path_index );
+
+				break;
+			}
+			result = 1;
+		}
+	}
+	else
+	{
+		result = libregf_key_path_trie_initialize(
+		          &key_path_trie,
+		          number_of_paths,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create key path trie.",
+			 function );
+		}
+		for( path_index = 0;
+		     ( result != -1 ) && ( path_index < number_of_paths );
+		     path_index++ )
+		{
+			result = libregf_key_path_trie_insert_utf16_path(
+			          key_path_trie,
+			          path_index,
+			          utf16_strings[ path_index ],
+			          utf16_string_lengths[ path_index ],
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to insert UTF-16 path: %d into key path trie.",
+				 function,
+				 path_index );
+			}
+		}
+		if( result != -1 )
+		{
+			result = libregf_key_path_trie_resolve(
+			          key_path_trie,
+			          internal_file->io_handle,
+			          internal_file->file_io_handle,
+			          internal_file->hive_bins_list,
+			          internal_file->file_header->root_key_offset,
+			          keys,
+			          number_of_paths,
+			          error );
+
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to resolve key paths.",
+				 function );
+			}
+		}
+		if( key_path_trie != NULL )
+		{
+			if( libregf_key_path_trie_free(
+			     &key_path_trie,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free key path trie.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+	if( result == -1 )
+	{
+		for( path_index = 0;
+		     path_index < number_of_paths;
+		     path_index++ )
+		{
+			if( keys[ path_index ] != NULL )
+			{
+				libregf_key_free(
+				 &( keys[ path_index ] ),
+				 NULL );
+			}
+		}
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Walks all the keys in the file starting with the root key
+ * The callback function is called for every key and should return 1 to continue,
+ * 0 to stop the walk or -1 on error
+ * The keys are distributed over the threads, where every thread uses its own
+ * file IO handle and hive bins list, hence the callback function is called
+ * concurrently and must be thread-safe when number_of_threads is more than 1
+ * The key and any value or sub key retrieved from it are only valid until
+ * the callback function returns, the key is freed by the walk
+ * Returns 1 if successful, 0 if no root key or -1 on error
+ */
+int libregf_file_walk(
+     libregf_file_t *file,
+     int (*callback_function)(
+            libregf_key_t *key,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libregf_internal_file_t *internal_file = NULL;
+	libregf_key_walker_t *key_walker       = NULL;
+	static char *function                  = "libregf_file_walk";
+	int result                             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libregf_internal_file_t *) file;
+
+	if( internal_file->file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > LIBREGF_MAXIMUM_NUMBER_OF_WALK_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( internal_file->file_header->file_type == LIBREGF_FILE_TYPE_REGISTRY )
+	 && ( internal_file->file_header->root_key_offset != 0 ) )
+	{
+		result = libregf_key_walker_initialize(
+		          &key_walker,
+		          internal_file->io_handle,
+		          internal_file->file_io_handle,
+		          internal_file->hive_bins_list,
+		          number_of_threads,
+		          callback_function,
+		          callback_data,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create key walker.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			result = libregf_key_walker_walk(
+			          key_walker,
+			          internal_file->file_header->root_key_offset,
+			          error );
+
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to walk keys.",
+				 function );
+
+				result = -1;
+			}
+			if( libregf_key_walker_free(
+			     &key_walker,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free key walker.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a cell iterator
+ * The cell iterator reads the hive bins sequentially in file order
+ * Creates a new cell iterator
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_file_get_cell_iterator(
+     libregf_file_t *file,
+     libregf_cell_iterator_t **cell_iterator,
+     libcerror_error_t **error )
+{
+	libregf_internal_file_t *internal_file = NULL;
+	static char *function                  = "libregf_file_get_cell_iterator";
+	int result                             = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libregf_internal_file_t *) file;
+
+	if( internal_file->hive_bins_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing hive bins list.",
+		 function );
+
+		return( -1 );
+	}
+	if( cell_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cell iterator.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cell_iterator != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: cell iterator already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libregf_cell_iterator_initialize(
+	     cell_iterator,
+	     internal_file->io_handle,
+	     internal_file->file_io_handle,
+	     internal_file->hive_bins_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create cell iterator.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads an index file previously written by libregf_file_write_index
+ * Returns 1 if successful, 0 if the index does not match the file or -1 on error
+ */
+int libregf_file_read_index(
+     libregf_file_t *file,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libregf_file_read_index";
+	size_t filename_length           = 0;
+	int result                       = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	result = libregf_file_read_index_file_io_handle(
+	          file,
+	          file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Reads an index file previously written by libregf_file_write_index
+ * Returns 1 if successful, 0 if the index does not match the file or -1 on error
+ */
+int libregf_file_read_index_wide(
+     libregf_file_t *file,
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libregf_file_read_index_wide";
+	size_t filename_length           = 0;
+	int result                       = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	result = libregf_file_read_index_file_io_handle(
+	          file,
+	          file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index file: %ls.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Reads an index file using a Basic File IO (bfio) handle
+ * The index is only used when it was written for the same version of the file
+ * and the same codepage
+ * Returns 1 if successful, 0 if the index does not match the file or -1 on error
+ */
+int libregf_file_read_index_file_io_handle(
+     libregf_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libregf_index_t *index                   = NULL;
+	libregf_internal_file_t *internal_file   = NULL;
+	static char *function                    = "libregf_file_read_index_file_io_handle";
+	uint8_t file_io_handle_opened_in_library = 0;
+	int file_io_handle_is_open               = 0;
+	int result                               = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libregf_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->hive_bins_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing hive bins list.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open index file.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     LIBBFIO_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		file_io_handle_opened_in_library = 1;
+	}
+	if( libregf_index_initialize(
+	     &index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index.",
+		 function );
+
+		goto on_error;
+	}
+	if( libregf_index_read_file_io_handle(
+	     index,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_io_handle_opened_in_library != 0 )
+	{
+		file_io_handle_opened_in_library = 0;
+
+		if( libbfio_handle_close(
+		     file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	result = libregf_index_matches_file_header(
+	          index,
+	          internal_file->file_header,
+	          internal_file->io_handle->ascii_codepage,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to determine if index matches file header.",
+		 function );
+	}
+	else if( result != 0 )
+	{
+		if( libregf_index_read_hive_bins(
+		     index,
+		     internal_file->hive_bins_list,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read hive bins from index.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			if( internal_file->index != NULL )
+			{
+				libregf_index_free(
+				 &( internal_file->index ),
+				 NULL );
+			}
+			internal_file->index = index;
+			index                = NULL;
+		}
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( result == -1 )
+	{
+		goto on_error;
+	}
+	if( index != NULL )
+	{
+		if( libregf_index_free(
+		     &index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free index.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( result );
+
+on_error:
+	if( index != NULL )
+	{
+		libregf_index_free(
+		 &index,
+		 NULL );
+	}
+	if( file_io_handle_opened_in_library != 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Writes an index file of the key paths and hive bins
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_file_write_index(
+     libregf_file_t *file,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libregf_file_write_index";
+	size_t filename_length           = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libregf_file_write_index_file_io_handle(
+	     file,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write index file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Writes an index file of the key paths and hive bins
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_file_write_index_wide(
+     libregf_file_t *file,
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libregf_file_write_index_wide";
+	size_t filename_length           = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libregf_file_write_index_file_io_handle(
+	     file,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write index file: %ls.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Writes an index file using a Basic File IO (bfio) handle
+ * The index is built from the file if no index was read
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_file_write_index_file_io_handle(
+     libregf_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libregf_internal_file_t *internal_file   = NULL;
+	static char *function                    = "libregf_file_write_index_file_io_handle";
+	uint8_t file_io_handle_opened_in_library = 0;
+	int file_io_handle_is_open               = 0;
+	int result                               = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libregf_internal_file_t *) file;
+
+	if( internal_file->file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file->file_header->file_type != LIBREGF_FILE_TYPE_REGISTRY )
+	 || ( internal_file->file_header->root_key_offset == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported file - file has no root key.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* An index that was read for a different codepage is rebuilt
+	 */
+	if( ( internal_file->index != NULL )
+	 && ( internal_file->index->ascii_codepage != internal_file->io_handle->ascii_codepage ) )
+	{
+		if( libregf_index_free(
+		     &( internal_file->index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free index.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( ( result == 1 )
+	 && ( internal_file->index == NULL ) )
+	{
+		if( libregf_index_initialize(
+		     &( internal_file->index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create index.",
+			 function );
+
+			result = -1;
+		}
+		else if( libregf_index_build(
+		          internal_file->index,
+		          internal_file->io_handle,
+		          internal_file->file_io_handle,
+		          internal_file->hive_bins_list,
+		          internal_file->file_header,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to build index.",
+			 function );
+
+			libregf_index_free(
+			 &( internal_file->index ),
+			 NULL );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		file_io_handle_is_open = libbfio_handle_is_open(
+		                          file_io_handle,
+		                          error );
+
+		if( file_io_handle_is_open == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open index file.",
+			 function );
+
+			result = -1;
+		}
+		else if( file_io_handle_is_open == 0 )
+		{
+			if( libbfio_handle_open(
+			     file_io_handle,
+			     LIBBFIO_OPEN_WRITE_TRUNCATE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open file IO handle.",
+				 function );
+
+				result = -1;
+			}
+			else
+			{
+				file_io_handle_opened_in_library = 1;
+			}
+		}
+	}
+	if( result == 1 )
+	{
+		if( libregf_index_write_file_io_handle(
+		     internal_file->index,
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write index.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( file_io_handle_opened_in_library != 0 )
+	{
+		if( libbfio_handle_close(
+		     file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Applies a transaction log
+ * Returns 1 if successful, 0 if no log entries were applied or -1 on error
+ */
+int libregf_file_apply_transaction_log(
+     libregf_file_t *file,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libregf_file_apply_transaction_log";
+	size_t filename_length           = 0;
+	int result                       = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	result = libregf_file_apply_transaction_log_file_io_handle(
+	          file,
+	          file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to apply transaction log: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Applies a transaction log
+ * Returns 1 if successful, 0 if no log entries were applied or -1 on error
+ */
+int libregf_file_apply_transaction_log_wide(
+     libregf_file_t *file,
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libregf_file_apply_transaction_log_wide";
+	size_t filename_length           = 0;
+	int result                       = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	result = libregf_file_apply_transaction_log_file_io_handle(
+	          file,
+	          file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to apply transaction log: %ls.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Applies a transaction log using a Basic File IO (bfio) handle
+ * The dirty pages of the log entries that were not yet written to the hive
+ * are read through an overlay, the file itself is not modified
+ * When a hive has multiple transaction logs the log with the lowest sequence
+ * number should be applied first
+ * Keys retrieved before the transaction log was applied are no longer valid
+ * Returns 1 if successful, 0 if no log entries were applied or -1 on error
+ */
+int libregf_file_apply_transaction_log_file_io_handle(
+     libregf_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libregf_internal_file_t *internal_file   = NULL;
+	static char *function                    = "libregf_file_apply_transaction_log_file_io_handle";
+	uint8_t file_io_handle_opened_in_library = 0;
+	int file_io_handle_is_open               = 0;
+	int result                               = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libregf_internal_file_t *) file;
+
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_header->file_type != LIBREGF_FILE_TYPE_REGISTRY )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported file type: 0x%08" PRIx32 ".",
+		 function,
+		 internal_file->file_header->file_type );
+
+		return( -1 );
+	}
+	if( internal_file->hive_bins_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing hive bins list.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open transaction log.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     LIBBFIO_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		file_io_handle_opened_in_library = 1;
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	result = libregf_internal_file_apply_transaction_log(
+	          internal_file,
+	          file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to apply transaction log.",
+		 function );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( result == -1 )
+	{
+		goto on_error;
+	}
+	if( file_io_handle_opened_in_library != 0 )
+	{
+		file_io_handle_opened_in_library = 0;
+
+		if( libbfio_handle_close(
+		     file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( result );
+
+on_error:
+	if( file_io_handle_opened_in_library != 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
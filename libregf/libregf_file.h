@@ -26,9 +26,12 @@
 #include <types.h>
 
 #include "libregf_extern.h"
+#include "libregf_dirty_pages.h"
 #include "libregf_dirty_vector.h"
 #include "libregf_file_header.h"
+#include "libregf_file_mapping.h"
 #include "libregf_hive_bins_list.h"
+#include "libregf_index.h"
 #include "libregf_io_handle.h"
 #include "libregf_libbfio.h"
 #include "libregf_libcerror.h"
@@ -65,6 +68,23 @@ struct libregf_internal_file
 	 */
 	libregf_hive_bins_list_t *hive_bins_list;
 
+	/* The file mapping, which is set when the file was opened memory mapped
+	 */
+	libregf_file_mapping_t *file_mapping;
+
+	/* The index, which is set when an index was read or written
+	 */
+	libregf_index_t *index;
+
+	/* The dirty pages, which are set when a transaction log was applied
+	 */
+	libregf_dirty_pages_t *dirty_pages;
+
+	/* The file IO handle of the hive, which is set when a transaction log was applied
+	 * and the file IO handle was replaced by an overlay that contains the dirty pages
+	 */
+	libbfio_handle_t *hive_file_io_handle;
+
 	/* Value to indicate if the file IO handle was created inside the library
 	 */
 	uint8_t file_io_handle_created_in_library;
@@ -106,6 +126,13 @@ int libregf_file_open(
      int access_flags,
      libcerror_error_t **error );
 
+LIBREGF_EXTERN \
+int libregf_file_open_mmap(
+     libregf_file_t *file,
+     const char *filename,
+     int access_flags,
+     libcerror_error_t **error );
+
 #if defined( HAVE_WIDE_CHARACTER_TYPE )
 
 LIBREGF_EXTERN \
@@ -144,6 +171,11 @@ int libregf_internal_file_read_dirty_vector(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+int libregf_internal_file_apply_transaction_log(
+     libregf_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
 LIBREGF_EXTERN \
 int libregf_file_is_corrupted(
      libregf_file_t *file,
@@ -180,6 +212,13 @@ int libregf_file_get_root_key(
      libregf_key_t **key,
      libcerror_error_t **error );
 
+LIBREGF_EXTERN \
+int libregf_file_get_key_by_offset(
+     libregf_file_t *file,
+     off64_t key_offset,
+     libregf_key_t **key,
+     libcerror_error_t **error );
+
 LIBREGF_EXTERN \
 int libregf_file_get_key_by_utf8_path(
      libregf_file_t *file,
@@ -196,6 +235,107 @@ int libregf_file_get_key_by_utf16_path(
      libregf_key_t **key,
      libcerror_error_t **error );
 
+LIBREGF_EXTERN \
+int libregf_file_get_keys_by_utf8_paths(
+     libregf_file_t *file,
+     const uint8_t **utf8_strings,
+     const size_t *utf8_string_lengths,
+     int number_of_paths,
+     libregf_key_t **keys,
+     libcerror_error_t **error );
+
+LIBREGF_EXTERN \
+int libregf_file_get_keys_by_utf16_paths(
+     libregf_file_t *file,
+     const uint16_t **utf16_strings,
+     const size_t *utf16_string_lengths,
+     int number_of_paths,
+     libregf_key_t **keys,
+     libcerror_error_t **error );
+
+LIBREGF_EXTERN \
+int libregf_file_walk(
+     libregf_file_t *file,
+     int (*callback_function)(
+            libregf_key_t *key,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+LIBREGF_EXTERN \
+int libregf_file_get_cell_iterator(
+     libregf_file_t *file,
+     libregf_cell_iterator_t **cell_iterator,
+     libcerror_error_t **error );
+
+LIBREGF_EXTERN \
+int libregf_file_read_index(
+     libregf_file_t *file,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBREGF_EXTERN \
+int libregf_file_read_index_wide(
+     libregf_file_t *file,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBREGF_EXTERN \
+int libregf_file_read_index_file_io_handle(
+     libregf_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+LIBREGF_EXTERN \
+int libregf_file_write_index(
+     libregf_file_t *file,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBREGF_EXTERN \
+int libregf_file_write_index_wide(
+     libregf_file_t *file,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBREGF_EXTERN \
+int libregf_file_write_index_file_io_handle(
+     libregf_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+LIBREGF_EXTERN \
+int libregf_file_apply_transaction_log(
+     libregf_file_t *file,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBREGF_EXTERN \
+int libregf_file_apply_transaction_log_wide(
+     libregf_file_t *file,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBREGF_EXTERN \
+int libregf_file_apply_transaction_log_file_io_handle(
+     libregf_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
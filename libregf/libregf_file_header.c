@@ -247,6 +247,14 @@ int libregf_file_header_read_data(
 
 		return( -1 );
 	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (regf_file_header_t *) data )->primary_sequence_number,
+	 file_header->primary_sequence_number );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (regf_file_header_t *) data )->secondary_sequence_number,
+	 file_header->secondary_sequence_number );
+
 	byte_stream_copy_to_uint32_little_endian(
 	 ( (regf_file_header_t *) data )->major_format_version,
 	 file_header->major_format_version );
@@ -267,6 +275,8 @@ int libregf_file_header_read_data(
 	 ( (regf_file_header_t *) data )->hive_bins_size,
 	 file_header->hive_bins_size );
 
+	file_header->checksum = stored_xor32_checksum;
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -278,20 +288,15 @@ int libregf_file_header_read_data(
 		 ( (regf_file_header_t *) data )->signature[ 2 ],
 		 ( (regf_file_header_t *) data )->signature[ 3 ] );
 
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (regf_file_header_t *) data )->primary_sequence_number,
-		 value_32bit );
 		libcnotify_printf(
 		 "%s: primary sequence number\t\t\t: %" PRIu32 "\n",
 		 function,
-		 value_32bit );
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (regf_file_header_t *) data )->secondary_sequence_number,
-		 value_32bit );
+		 file_header->primary_sequence_number );
+
 		libcnotify_printf(
 		 "%s: secondary sequence number\t\t: %" PRIu32 "\n",
 		 function,
-		 value_32bit );
+		 file_header->secondary_sequence_number );
 
 		if( libregf_debug_print_filetime_value(
 		     function,
@@ -0,0 +1,79 @@
+/*
+ * File mapping functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBREGF_FILE_MAPPING_H )
+#define _LIBREGF_FILE_MAPPING_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libregf_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libregf_file_mapping libregf_file_mapping_t;
+
+struct libregf_file_mapping
+{
+	/* The mapped data
+	 */
+	uint8_t *data;
+
+	/* The mapped data size
+	 */
+	size64_t data_size;
+
+#if defined( WINAPI )
+	/* The file handle
+	 */
+	HANDLE file_handle;
+
+	/* The file mapping handle
+	 */
+	HANDLE mapping_handle;
+#endif
+};
+
+int libregf_file_mapping_initialize(
+     libregf_file_mapping_t **file_mapping,
+     libcerror_error_t **error );
+
+int libregf_file_mapping_free(
+     libregf_file_mapping_t **file_mapping,
+     libcerror_error_t **error );
+
+int libregf_file_mapping_open(
+     libregf_file_mapping_t *file_mapping,
+     const char *filename,
+     libcerror_error_t **error );
+
+int libregf_file_mapping_close(
+     libregf_file_mapping_t *file_mapping,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBREGF_FILE_MAPPING_H ) */
+
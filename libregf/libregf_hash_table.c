@@ -0,0 +1,695 @@
+/*
+ * Hash table functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libregf_hash_table.h"
+#include "libregf_libcerror.h"
+
+/* Determines the bucket index of a key
+ * The key is folded so that keys that are 8-byte aligned offsets
+ * and keys that only differ in their upper bits still use all buckets
+ */
+#define libregf_hash_table_get_bucket_index( key, number_of_buckets ) \
+	( ( ( key ) ^ ( ( key ) >> 3 ) ^ ( ( key ) >> 16 ) ) & ( ( number_of_buckets ) - 1 ) )
+
+/* Creates a hash table
+ * Make sure the value hash_table is referencing, is set to NULL
+ * The number of values is the number of values that can be inserted
+ * before the hash table needs to be resized
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_hash_table_initialize(
+     libregf_hash_table_t **hash_table,
+     int number_of_values,
+     libcerror_error_t **error )
+{
+	static char *function      = "libregf_hash_table_initialize";
+	uint32_t number_of_buckets = 1;
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *hash_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid hash table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_values <= 0 )
+	 || ( number_of_values > ( INT_MAX / 2 ) )
+	 || ( (size_t) number_of_values > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libregf_hash_table_entry_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of values value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Use at least as many buckets as values to keep the chains short
+	 */
+	while( number_of_buckets < (uint32_t) number_of_values )
+	{
+		number_of_buckets <<= 1;
+	}
+	*hash_table = memory_allocate_structure(
+	               libregf_hash_table_t );
+
+	if( *hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *hash_table,
+	     0,
+	     sizeof( libregf_hash_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash table.",
+		 function );
+
+		memory_free(
+		 *hash_table );
+
+		*hash_table = NULL;
+
+		return( -1 );
+	}
+	if( libregf_hash_table_resize_buckets(
+	     *hash_table,
+	     number_of_buckets,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize buckets.",
+		 function );
+
+		goto on_error;
+	}
+	( *hash_table )->entries = (libregf_hash_table_entry_t *) memory_allocate(
+	                                                           sizeof( libregf_hash_table_entry_t ) * (size_t) number_of_values );
+
+	if( ( *hash_table )->entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		goto on_error;
+	}
+	( *hash_table )->number_of_allocated_entries = number_of_values;
+
+	return( 1 );
+
+on_error:
+	if( *hash_table != NULL )
+	{
+		if( ( *hash_table )->buckets != NULL )
+		{
+			memory_free(
+			 ( *hash_table )->buckets );
+		}
+		memory_free(
+		 *hash_table );
+
+		*hash_table = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a hash table
+ * The value free function, if not NULL, is called for every value in the hash table
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_hash_table_free(
+     libregf_hash_table_t **hash_table,
+     int (*value_free_function)(
+            intptr_t *value,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_hash_table_free";
+	uint32_t bucket_index = 0;
+	int entry_index       = 0;
+	int result            = 1;
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *hash_table != NULL )
+	{
+		if( value_free_function != NULL )
+		{
+			for( bucket_index = 0;
+			     bucket_index < ( *hash_table )->number_of_buckets;
+			     bucket_index++ )
+			{
+				entry_index = ( *hash_table )->buckets[ bucket_index ];
+
+				while( entry_index != 0 )
+				{
+					if( value_free_function(
+					     &( ( *hash_table )->entries[ entry_index - 1 ].value ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free value.",
+						 function );
+
+						result = -1;
+					}
+					entry_index = ( *hash_table )->entries[ entry_index - 1 ].next_entry;
+				}
+			}
+		}
+		if( ( *hash_table )->entries != NULL )
+		{
+			memory_free(
+			 ( *hash_table )->entries );
+		}
+		if( ( *hash_table )->buckets != NULL )
+		{
+			memory_free(
+			 ( *hash_table )->buckets );
+		}
+		memory_free(
+		 *hash_table );
+
+		*hash_table = NULL;
+	}
+	return( result );
+}
+
+/* Resizes the buckets
+ * The order of the values with the same key is preserved
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_hash_table_resize_buckets(
+     libregf_hash_table_t *hash_table,
+     uint32_t number_of_buckets,
+     libcerror_error_t **error )
+{
+	int *buckets          = NULL;
+	int *last_entry       = NULL;
+	static char *function = "libregf_hash_table_resize_buckets";
+	uint32_t bucket_index = 0;
+	int entry_index       = 0;
+	int next_entry_index  = 0;
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_buckets == 0 )
+	 || ( ( number_of_buckets & ( number_of_buckets - 1 ) ) != 0 )
+	 || ( (size_t) number_of_buckets > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( int ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of buckets value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	buckets = (int *) memory_allocate(
+	                   sizeof( int ) * (size_t) number_of_buckets );
+
+	if( buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     buckets,
+	     0,
+	     sizeof( int ) * (size_t) number_of_buckets ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buckets.",
+		 function );
+
+		memory_free(
+		 buckets );
+
+		return( -1 );
+	}
+	for( bucket_index = 0;
+	     bucket_index < hash_table->number_of_buckets;
+	     bucket_index++ )
+	{
+		entry_index = hash_table->buckets[ bucket_index ];
+
+		while( entry_index != 0 )
+		{
+			next_entry_index = hash_table->entries[ entry_index - 1 ].next_entry;
+
+			/* Append the entry so that entries with the same key keep their order
+			 */
+			last_entry = &( buckets[ libregf_hash_table_get_bucket_index( hash_table->entries[ entry_index - 1 ].key, number_of_buckets ) ] );
+			hash_table->entries[ entry_index - 1 ].next_entry = 0;
+
+			while( *last_entry != 0 )
+			{
+				last_entry = &( hash_table->entries[ *last_entry - 1 ].next_entry );
+			}
+			*last_entry = entry_index;
+
+			entry_index = next_entry_index;
+		}
+	}
+	if( hash_table->buckets != NULL )
+	{
+		memory_free(
+		 hash_table->buckets );
+	}
+	hash_table->buckets           = buckets;
+	hash_table->number_of_buckets = number_of_buckets;
+
+	return( 1 );
+}
+
+/* Retrieves the number of values
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_hash_table_get_number_of_values(
+     libregf_hash_table_t *hash_table,
+     int *number_of_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_hash_table_get_number_of_values";
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of values.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_values = hash_table->number_of_values;
+
+	return( 1 );
+}
+
+/* Inserts a value with a specific key
+ * The value is added after the other values with the same key
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_hash_table_insert_value(
+     libregf_hash_table_t *hash_table,
+     uint32_t key,
+     intptr_t value,
+     libcerror_error_t **error )
+{
+	libregf_hash_table_entry_t *entries = NULL;
+	int *last_entry                     = NULL;
+	static char *function               = "libregf_hash_table_insert_value";
+	size_t entries_size                 = 0;
+	int entry_index                     = 0;
+	int number_of_allocated_entries     = 0;
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_table->number_of_values >= ( INT_MAX / 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid hash table - number of values value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Keep the average chain length at 1 or less
+	 */
+	if( (uint32_t) hash_table->number_of_values >= hash_table->number_of_buckets )
+	{
+		if( libregf_hash_table_resize_buckets(
+		     hash_table,
+		     hash_table->number_of_buckets * 2,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize buckets.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( hash_table->first_free_entry != 0 )
+	{
+		entry_index = hash_table->first_free_entry - 1;
+
+		hash_table->first_free_entry = hash_table->entries[ entry_index ].next_entry;
+	}
+	else
+	{
+		if( hash_table->number_of_used_entries >= hash_table->number_of_allocated_entries )
+		{
+			number_of_allocated_entries = hash_table->number_of_allocated_entries * 2;
+			entries_size                = sizeof( libregf_hash_table_entry_t ) * (size_t) number_of_allocated_entries;
+
+			if( entries_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid entries size value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			entries = (libregf_hash_table_entry_t *) memory_reallocate(
+			                                          hash_table->entries,
+			                                          entries_size );
+
+			if( entries == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize entries.",
+				 function );
+
+				return( -1 );
+			}
+			hash_table->entries                     = entries;
+			hash_table->number_of_allocated_entries = number_of_allocated_entries;
+		}
+		entry_index = hash_table->number_of_used_entries;
+
+		hash_table->number_of_used_entries += 1;
+	}
+	hash_table->entries[ entry_index ].key        = key;
+	hash_table->entries[ entry_index ].value      = value;
+	hash_table->entries[ entry_index ].next_entry = 0;
+
+	last_entry = &( hash_table->buckets[ libregf_hash_table_get_bucket_index( key, hash_table->number_of_buckets ) ] );
+
+	while( *last_entry != 0 )
+	{
+		last_entry = &( hash_table->entries[ *last_entry - 1 ].next_entry );
+	}
+	*last_entry = entry_index + 1;
+
+	hash_table->number_of_values += 1;
+
+	return( 1 );
+}
+
+/* Removes a value with a specific key
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libregf_hash_table_remove_value(
+     libregf_hash_table_t *hash_table,
+     uint32_t key,
+     intptr_t value,
+     libcerror_error_t **error )
+{
+	int *bucket_entry     = NULL;
+	static char *function = "libregf_hash_table_remove_value";
+	int entry_index       = 0;
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash table.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_entry = &( hash_table->buckets[ libregf_hash_table_get_bucket_index( key, hash_table->number_of_buckets ) ] );
+
+	while( *bucket_entry != 0 )
+	{
+		entry_index = *bucket_entry - 1;
+
+		if( ( hash_table->entries[ entry_index ].key == key )
+		 && ( hash_table->entries[ entry_index ].value == value ) )
+		{
+			*bucket_entry = hash_table->entries[ entry_index ].next_entry;
+
+			hash_table->entries[ entry_index ].value      = 0;
+			hash_table->entries[ entry_index ].next_entry = hash_table->first_free_entry;
+			hash_table->first_free_entry                  = entry_index + 1;
+
+			hash_table->number_of_values -= 1;
+
+			return( 1 );
+		}
+		bucket_entry = &( hash_table->entries[ entry_index ].next_entry );
+	}
+	return( 0 );
+}
+
+/* Retrieves the first value with a specific key
+ * The entry index is used to retrieve the next value with the same key
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libregf_hash_table_get_first_value(
+     libregf_hash_table_t *hash_table,
+     uint32_t key,
+     int *entry_index,
+     intptr_t *value,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_hash_table_get_first_value";
+	int safe_entry_index  = 0;
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	safe_entry_index = hash_table->buckets[ libregf_hash_table_get_bucket_index( key, hash_table->number_of_buckets ) ];
+
+	while( safe_entry_index != 0 )
+	{
+		if( hash_table->entries[ safe_entry_index - 1 ].key == key )
+		{
+			*entry_index = safe_entry_index - 1;
+			*value       = hash_table->entries[ safe_entry_index - 1 ].value;
+
+			return( 1 );
+		}
+		safe_entry_index = hash_table->entries[ safe_entry_index - 1 ].next_entry;
+	}
+	return( 0 );
+}
+
+/* Retrieves the value with a specific key that follows the entry index
+ * The entry index is updated to retrieve the next value with the same key
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libregf_hash_table_get_next_value(
+     libregf_hash_table_t *hash_table,
+     uint32_t key,
+     int *entry_index,
+     intptr_t *value,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_hash_table_get_next_value";
+	int safe_entry_index  = 0;
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( *entry_index < 0 )
+	 || ( *entry_index >= hash_table->number_of_used_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	safe_entry_index = hash_table->entries[ *entry_index ].next_entry;
+
+	while( safe_entry_index != 0 )
+	{
+		if( hash_table->entries[ safe_entry_index - 1 ].key == key )
+		{
+			*entry_index = safe_entry_index - 1;
+			*value       = hash_table->entries[ safe_entry_index - 1 ].value;
+
+			return( 1 );
+		}
+		safe_entry_index = hash_table->entries[ safe_entry_index - 1 ].next_entry;
+	}
+	return( 0 );
+}
+
@@ -0,0 +1,137 @@
+/*
+ * Hash table functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBREGF_HASH_TABLE_H )
+#define _LIBREGF_HASH_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libregf_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libregf_hash_table_entry libregf_hash_table_entry_t;
+
+struct libregf_hash_table_entry
+{
+	/* The key
+	 */
+	uint32_t key;
+
+	/* The value
+	 */
+	intptr_t value;
+
+	/* The next entry index + 1 in the same bucket or of the free entries, or 0 if last
+	 */
+	int next_entry;
+};
+
+typedef struct libregf_hash_table libregf_hash_table_t;
+
+struct libregf_hash_table
+{
+	/* The number of buckets, which is a power of 2
+	 */
+	uint32_t number_of_buckets;
+
+	/* The buckets, which contain the first entry index + 1 or 0 if empty
+	 */
+	int *buckets;
+
+	/* The entries
+	 */
+	libregf_hash_table_entry_t *entries;
+
+	/* The number of allocated entries
+	 */
+	int number_of_allocated_entries;
+
+	/* The number of entries that have been used, the entries beyond have never been used
+	 */
+	int number_of_used_entries;
+
+	/* The first removed entry index + 1 that can be reused or 0 if none
+	 */
+	int first_free_entry;
+
+	/* The number of values
+	 */
+	int number_of_values;
+};
+
+int libregf_hash_table_initialize(
+     libregf_hash_table_t **hash_table,
+     int number_of_values,
+     libcerror_error_t **error );
+
+int libregf_hash_table_free(
+     libregf_hash_table_t **hash_table,
+     int (*value_free_function)(
+            intptr_t *value,
+            libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+int libregf_hash_table_resize_buckets(
+     libregf_hash_table_t *hash_table,
+     uint32_t number_of_buckets,
+     libcerror_error_t **error );
+
+int libregf_hash_table_get_number_of_values(
+     libregf_hash_table_t *hash_table,
+     int *number_of_values,
+     libcerror_error_t **error );
+
+int libregf_hash_table_insert_value(
+     libregf_hash_table_t *hash_table,
+     uint32_t key,
+     intptr_t value,
+     libcerror_error_t **error );
+
+int libregf_hash_table_remove_value(
+     libregf_hash_table_t *hash_table,
+     uint32_t key,
+     intptr_t value,
+     libcerror_error_t **error );
+
+int libregf_hash_table_get_first_value(
+     libregf_hash_table_t *hash_table,
+     uint32_t key,
+     int *entry_index,
+     intptr_t *value,
+     libcerror_error_t **error );
+
+int libregf_hash_table_get_next_value(
+     libregf_hash_table_t *hash_table,
+     uint32_t key,
+     int *entry_index,
+     intptr_t *value,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBREGF_HASH_TABLE_H ) */
+
@@ -419,11 +419,14 @@ on_error:
 }
 
 /* Reads a hive bin and determines its cells
+ * The file offset is that of the hive bin header, the cells data is read at
+ * a specific offset so that the file IO handle can be shared between threads
  * Returns 1 if successful or -1 on error
  */
 int libregf_hive_bin_read_cells_file_io_handle(
      libregf_hive_bin_t *hive_bin,
      libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
      libcerror_error_t **error )
 {
 	static char *function = "libregf_hive_bin_read_cells_file_io_handle";
@@ -474,6 +477,17 @@ int libregf_hive_bin_read_cells_file_io_handle(
 
 		return( -1 );
 	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
 	hive_bin->data_size = (size_t) hive_bin->size - sizeof( regf_hive_bin_header_t );
 
 	hive_bin->data = (uint8_t *) memory_allocate(
@@ -490,10 +504,15 @@ int libregf_hive_bin_read_cells_file_io_handle(
 
 		goto on_error;
 	}
-	read_count = libbfio_handle_read_buffer(
+	/* The cells data directly follows the hive bin header
+	 */
+	file_offset += sizeof( regf_hive_bin_header_t );
+
+	read_count = libbfio_handle_read_buffer_at_offset(
 	              file_io_handle,
 	              hive_bin->data,
 	              hive_bin->data_size,
+	              file_offset,
 	              error );
 
 	if( read_count != (ssize_t) hive_bin->data_size )
@@ -502,8 +521,10 @@ int libregf_hive_bin_read_cells_file_io_handle(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read hive bin cells data.",
-		 function );
+		 "%s: unable to read hive bin cells data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
 
 		goto on_error;
 	}
@@ -642,6 +663,8 @@ int libregf_hive_bin_get_cell(
 }
 
 /* Retrieves the hive bin cell at the offset
+ * The cells are stored in the cells array in order of their offset,
+ * hence a binary search is used to find the cell
  * Returns 1 if successful, 0 if not available or -1 on error
  */
 int libregf_hive_bin_get_cell_at_offset(
@@ -650,9 +673,12 @@ int libregf_hive_bin_get_cell_at_offset(
      libregf_hive_bin_cell_t **hive_bin_cell,
      libcerror_error_t **error )
 {
-	static char *function = "libregf_hive_bin_get_cell_at_offset";
-	int entry_index       = 0;
-	int number_of_entries = 0;
+	libregf_hive_bin_cell_t *safe_hive_bin_cell = NULL;
+	static char *function                       = "libregf_hive_bin_get_cell_at_offset";
+	int entry_index                             = 0;
+	int first_entry_index                       = 0;
+	int last_entry_index                        = 0;
+	int number_of_entries                       = 0;
 
 	if( hive_bin == NULL )
 	{
@@ -701,14 +727,26 @@ int libregf_hive_bin_get_cell_at_offset(
 
 		return( -1 );
 	}
-	for( entry_index = 0;
-	     entry_index < number_of_entries;
-	     entry_index++ )
+	*hive_bin_cell = NULL;
+
+	/* Cells are at least 8 bytes in size and start after the hive bin header
+	 */
+	if( ( cell_offset < ( hive_bin->offset + sizeof( regf_hive_bin_header_t ) ) )
+	 || ( ( cell_offset - hive_bin->offset ) >= hive_bin->size )
+	 || ( ( ( cell_offset - hive_bin->offset ) % 8 ) != 0 ) )
+	{
+		return( 0 );
+	}
+	last_entry_index = number_of_entries - 1;
+
+	while( first_entry_index <= last_entry_index )
 	{
+		entry_index = first_entry_index + ( ( last_entry_index - first_entry_index ) / 2 );
+
 		if( libcdata_array_get_entry_by_index(
 		     hive_bin->cells_array,
 		     entry_index,
-		     (intptr_t **) hive_bin_cell,
+		     (intptr_t **) &safe_hive_bin_cell,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -721,13 +759,33 @@ int libregf_hive_bin_get_cell_at_offset(
 
 			return( -1 );
 		}
-		if( ( *hive_bin_cell )->offset == cell_offset )
+		if( safe_hive_bin_cell == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing hive bin cell: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( safe_hive_bin_cell->offset == cell_offset )
 		{
+			*hive_bin_cell = safe_hive_bin_cell;
+
 			return( 1 );
 		}
+		else if( safe_hive_bin_cell->offset < cell_offset )
+		{
+			first_entry_index = entry_index + 1;
+		}
+		else
+		{
+			last_entry_index = entry_index - 1;
+		}
 	}
-	*hive_bin_cell = NULL;
-
 	return( 0 );
 }
 
@@ -78,6 +78,7 @@ int libregf_hive_bin_read_cells_data(
 int libregf_hive_bin_read_cells_file_io_handle(
      libregf_hive_bin_t *hive_bin,
      libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
      libcerror_error_t **error );
 
 int libregf_hive_bin_get_number_of_cells(
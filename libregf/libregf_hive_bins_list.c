@@ -29,12 +29,14 @@
 #include "libregf_hive_bin_header.h"
 #include "libregf_hive_bins_list.h"
 #include "libregf_io_handle.h"
+#include "libregf_key_item_cache.h"
 #include "libregf_libbfio.h"
 #include "libregf_libcerror.h"
 #include "libregf_libcnotify.h"
-#include "libregf_libfcache.h"
-#include "libregf_libfdata.h"
-#include "libregf_unused.h"
+#include "libregf_libcthreads.h"
+#include "libregf_security_key_cache.h"
+
+#include "regf_hive_bin.h"
 
 /* Creates a hive bins list
  * Make sure the value hive_bins_list is referencing, is set to NULL
@@ -46,6 +48,7 @@ int libregf_hive_bins_list_initialize(
      libcerror_error_t **error )
 {
 	static char *function = "libregf_hive_bins_list_initialize";
+	int shard_index       = 0;
 
 	if( hive_bins_list == NULL )
 	{
@@ -113,52 +116,74 @@ int libregf_hive_bins_list_initialize(
 
 		return( -1 );
 	}
-	if( libfdata_list_initialize(
-	     &( ( *hive_bins_list )->data_list ),
-	     NULL,
-	     NULL,
-	     NULL,
-	     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libregf_hive_bins_list_read_element_data,
-	     NULL,
-	     0,
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *hive_bins_list )->read_mutex ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create data list.",
+		 "%s: unable to create read mutex.",
 		 function );
 
 		goto on_error;
 	}
-	if( libfcache_cache_initialize(
-	     &( ( *hive_bins_list )->data_cache ),
-	     LIBREGF_MAXIMUM_CACHE_ENTRIES_HIVE_BINS,
-	     error ) != 1 )
+	for( shard_index = 0;
+	     shard_index < LIBREGF_NUMBER_OF_HIVE_BINS_LIST_SHARDS;
+	     shard_index++ )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create data cache.",
-		 function );
+		if( libcthreads_mutex_initialize(
+		     &( ( *hive_bins_list )->shard_mutexes[ shard_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create shard: %d mutex.",
+			 function,
+			 shard_index );
 
-		goto on_error;
+			goto on_error;
+		}
+	}
+#endif
+	for( shard_index = 0;
+	     shard_index < LIBREGF_NUMBER_OF_HIVE_BINS_LIST_SHARDS;
+	     shard_index++ )
+	{
+		( *hive_bins_list )->most_recently_used_entry_index[ shard_index ]  = -1;
+		( *hive_bins_list )->least_recently_used_entry_index[ shard_index ] = -1;
 	}
-	( *hive_bins_list )->io_handle = io_handle;
+	( *hive_bins_list )->io_handle                          = io_handle;
+	( *hive_bins_list )->maximum_number_of_cached_hive_bins = LIBREGF_MAXIMUM_CACHE_ENTRIES_HIVE_BINS / LIBREGF_NUMBER_OF_HIVE_BINS_LIST_SHARDS;
 
 	return( 1 );
 
 on_error:
 	if( *hive_bins_list != NULL )
 	{
-		if( ( *hive_bins_list )->data_list != NULL )
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+		for( shard_index = 0;
+		     shard_index < LIBREGF_NUMBER_OF_HIVE_BINS_LIST_SHARDS;
+		     shard_index++ )
+		{
+			if( ( *hive_bins_list )->shard_mutexes[ shard_index ] != NULL )
+			{
+				libcthreads_mutex_free(
+				 &( ( *hive_bins_list )->shard_mutexes[ shard_index ] ),
+				 NULL );
+			}
+		}
+		if( ( *hive_bins_list )->read_mutex != NULL )
 		{
-			libfdata_list_free(
-			 &( ( *hive_bins_list )->data_list ),
+			libcthreads_mutex_free(
+			 &( ( *hive_bins_list )->read_mutex ),
 			 NULL );
 		}
+#endif
 		memory_free(
 		 *hive_bins_list );
 
@@ -175,8 +200,13 @@ int libregf_hive_bins_list_free(
      libcerror_error_t **error )
 {
 	static char *function = "libregf_hive_bins_list_free";
+	int entry_index       = 0;
 	int result            = 1;
 
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	int shard_index       = 0;
+#endif
+
 	if( hive_bins_list == NULL )
 	{
 		libcerror_error_set(
@@ -192,38 +222,105 @@ int libregf_hive_bins_list_free(
 	{
 		/* The io_handle reference is freed elsewhere
 		 */
-		if( ( *hive_bins_list )->data_list != NULL )
+		if( ( *hive_bins_list )->key_item_cache != NULL )
 		{
-			if( libfdata_list_free(
-			     &( ( *hive_bins_list )->data_list ),
+			if( libregf_key_item_cache_free(
+			     (libregf_key_item_cache_t **) &( ( *hive_bins_list )->key_item_cache ),
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free data list.",
+				 "%s: unable to free key item cache.",
 				 function );
 
 				result = -1;
 			}
 		}
-		if( ( *hive_bins_list )->data_cache != NULL )
+		if( ( ( *hive_bins_list )->security_key_cache != NULL )
+		 && ( ( *hive_bins_list )->security_key_cache_is_shared == 0 ) )
 		{
-			if( libfcache_cache_free(
-			     &( ( *hive_bins_list )->data_cache ),
+			if( libregf_security_key_cache_free(
+			     (libregf_security_key_cache_t **) &( ( *hive_bins_list )->security_key_cache ),
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free data cache.",
+				 "%s: unable to free security key cache.",
 				 function );
 
 				result = -1;
 			}
 		}
+		if( ( *hive_bins_list )->entries != NULL )
+		{
+			for( entry_index = 0;
+			     entry_index < ( *hive_bins_list )->number_of_hive_bins;
+			     entry_index++ )
+			{
+				if( ( *hive_bins_list )->entries[ entry_index ].hive_bin != NULL )
+				{
+					if( libregf_hive_bin_free(
+					     &( ( *hive_bins_list )->entries[ entry_index ].hive_bin ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free hive bin: %d.",
+						 function,
+						 entry_index );
+
+						result = -1;
+					}
+				}
+			}
+			memory_free(
+			 ( *hive_bins_list )->entries );
+		}
+		if( ( *hive_bins_list )->sorted_entry_indexes != NULL )
+		{
+			memory_free(
+			 ( *hive_bins_list )->sorted_entry_indexes );
+		}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+		for( shard_index = 0;
+		     shard_index < LIBREGF_NUMBER_OF_HIVE_BINS_LIST_SHARDS;
+		     shard_index++ )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *hive_bins_list )->shard_mutexes[ shard_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free shard: %d mutex.",
+				 function,
+				 shard_index );
+
+				result = -1;
+			}
+		}
+		if( libcthreads_mutex_free(
+		     &( ( *hive_bins_list )->read_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		memory_free(
 		 *hive_bins_list );
 
@@ -232,14 +329,15 @@ int libregf_hive_bins_list_free(
 	return( result );
 }
 
-/* Empties the cache of a hive bins list
+/* Enables sharing key items between the keys that use the hive bins list
  * Returns 1 if successful or -1 on error
  */
-int libregf_hive_bins_list_empty_cache(
+int libregf_hive_bins_list_enable_key_item_cache(
      libregf_hive_bins_list_t *hive_bins_list,
+     int maximum_number_of_entries,
      libcerror_error_t **error )
 {
-	static char *function = "libregf_hive_bins_list_empty_cache";
+	static char *function = "libregf_hive_bins_list_enable_key_item_cache";
 
 	if( hive_bins_list == NULL )
 	{
@@ -252,15 +350,27 @@ int libregf_hive_bins_list_empty_cache(
 
 		return( -1 );
 	}
-	if( libfcache_cache_empty(
-	     hive_bins_list->data_cache,
+	if( hive_bins_list->key_item_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid hive bins list - key item cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libregf_key_item_cache_initialize(
+	     (libregf_key_item_cache_t **) &( hive_bins_list->key_item_cache ),
+	     maximum_number_of_entries,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to empty data cache.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create key item cache.",
 		 function );
 
 		return( -1 );
@@ -268,21 +378,15 @@ int libregf_hive_bins_list_empty_cache(
 	return( 1 );
 }
 
-/* Reads the hive bins
- * Returns 1 if successful, 0 if no hive bin signature was found or -1 on error
+/* Enables sharing security keys between the keys that use the hive bins list
+ * and the hive bins lists cloned from it
+ * Returns 1 if successful or -1 on error
  */
-int libregf_hive_bins_list_read_file_io_handle(
+int libregf_hive_bins_list_enable_security_key_cache(
      libregf_hive_bins_list_t *hive_bins_list,
-     libbfio_handle_t *file_io_handle,
-     off64_t file_offset,
-     uint32_t hive_bins_size,
      libcerror_error_t **error )
 {
-	libregf_hive_bin_header_t *hive_bin_header = NULL;
-	static char *function                      = "libregf_hive_bins_list_read_file_io_handle";
-	off64_t alignment_size                     = 0;
-	int hive_bin_index                         = 0;
-	int result                                 = 0;
+	static char *function = "libregf_hive_bins_list_enable_security_key_cache";
 
 	if( hive_bins_list == NULL )
 	{
@@ -295,296 +399,1805 @@ int libregf_hive_bins_list_read_file_io_handle(
 
 		return( -1 );
 	}
-	if( hive_bins_list->io_handle == NULL )
+	if( hive_bins_list->security_key_cache != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid hive bins list - missing IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid hive bins list - security key cache value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( libregf_hive_bin_header_initialize(
-	     &hive_bin_header,
+	if( libregf_security_key_cache_initialize(
+	     (libregf_security_key_cache_t **) &( hive_bins_list->security_key_cache ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create hive bin header.",
+		 "%s: unable to create security key cache.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	while( hive_bins_size > 0 )
+	hive_bins_list->security_key_cache_is_shared = 0;
+
+	return( 1 );
+}
+
+/* Empties the cache of a hive bins list
+ * The hive bins that were read are freed and read again when needed,
+ * hive bins with cells that have not been released are kept
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_hive_bins_list_empty_cache(
+     libregf_hive_bins_list_t *hive_bins_list,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_hive_bins_list_empty_cache";
+	int entry_index       = 0;
+	int result            = 1;
+
+	if( hive_bins_list == NULL )
 	{
-		result = libregf_hive_bin_header_read_file_io_handle(
-		          hive_bin_header,
-		          file_io_handle,
-		          file_offset,
-		          error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bins list.",
+		 function );
 
-		if( result == -1 )
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < hive_bins_list->number_of_hive_bins;
+	     entry_index++ )
+	{
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     hive_bins_list->shard_mutexes[ entry_index % LIBREGF_NUMBER_OF_HIVE_BINS_LIST_SHARDS ],
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read hive bin: %d header at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-			 function,
-			 hive_bin_index,
-			 file_offset,
-			 file_offset );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab shard mutex.",
+			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( ( result == 0 )
-		 || ( hive_bin_header->size == 0 ) )
-		{
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: invalid hive bin: %d header at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
-				 function,
-				 hive_bin_index,
-				 file_offset,
-				 file_offset );
-			}
 #endif
-			hive_bins_list->flags |= LIBREGF_HIVE_BINS_FLAG_IS_CORRUPTED;
-
-			alignment_size += 512;
-			file_offset    += 512;
-			hive_bins_size -= 512;
-
-			continue;
-		}
-		if( hive_bin_header->offset != ( file_offset - ( 4096 + alignment_size ) ) )
+		if( ( hive_bins_list->entries[ entry_index ].hive_bin != NULL )
+		 && ( hive_bins_list->entries[ entry_index ].reference_count == 0 ) )
 		{
-			if( ( hive_bins_list->flags & LIBREGF_HIVE_BINS_FLAG_IS_CORRUPTED ) == 0 )
+			if( libregf_hive_bins_list_remove_entry_from_shard(
+			     hive_bins_list,
+			     entry_index,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-				 "%s: mismatch in hive bin offset (stored: %" PRIu32 " != calculated: %" PRIi64 ").",
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove entry: %d from shard.",
 				 function,
-				 hive_bin_header->offset,
-				 file_offset - ( 4096 + alignment_size ) );
+				 entry_index );
 
-				goto on_error;
+				result = -1;
 			}
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
+			else if( libregf_hive_bin_free(
+			          &( hive_bins_list->entries[ entry_index ].hive_bin ),
+			          error ) != 1 )
 			{
-				libcnotify_printf(
-				 "%s: mismatch in hive bin offset (stored: %" PRIu32 " != calculated: %" PRIi64 ") difference: %" PRIi64 ".\n",
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free hive bin: %d.",
 				 function,
-				 hive_bin_header->offset,
-				 file_offset - ( 4096 + alignment_size ),
-				 file_offset - ( 4096 + hive_bin_header->offset ) );
+				 entry_index );
+
+				result = -1;
 			}
-#endif
-			alignment_size = file_offset - ( 4096 + hive_bin_header->offset );
 		}
-		if( libregf_hive_bins_list_append_bin(
-		     hive_bins_list,
-		     file_offset,
-		     hive_bin_header->size,
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_release(
+		     hive_bins_list->shard_mutexes[ entry_index % LIBREGF_NUMBER_OF_HIVE_BINS_LIST_SHARDS ],
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append hive bin: %d.",
-			 function,
-			 hive_bin_index );
-
-			goto on_error;
-		}
-		file_offset    += hive_bin_header->size;
-		hive_bins_size -= hive_bin_header->size;
-
-		hive_bin_index++;
-	}
-	if( libregf_hive_bin_header_free(
-	     &hive_bin_header,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free hive bin header.",
-		 function );
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release shard mutex.",
+			 function );
 
-		return( -1 );
-	}
-	if( result == 0 )
-	{
-		if( hive_bin_index == 0 )
-		{
-			return( 0 );
+			return( -1 );
 		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+#endif
+		if( result != 1 )
 		{
-			libcnotify_printf(
-			 "%s: missing hive bin at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
-			 function,
-			 file_offset,
-			 file_offset );
+			break;
 		}
-#endif
-		hive_bins_list->flags |= LIBREGF_HIVE_BINS_FLAG_IS_CORRUPTED;
-	}
-	if( ( hive_bins_list->flags & LIBREGF_HIVE_BINS_FLAG_IS_CORRUPTED ) != 0 )
-	{
-		hive_bins_list->io_handle->flags |= LIBREGF_IO_HANDLE_FLAG_IS_CORRUPTED;
-	}
-	return( 1 );
-
-on_error:
-	if( hive_bin_header != NULL )
-	{
-		libregf_hive_bin_header_free(
-		 &hive_bin_header,
-		 NULL );
 	}
-	return( -1 );
+	return( result );
 }
 
-/* Retrieves the hive bin index for a specific offset
- * Returns 1 if successful, 0 if not or -1 on error
+/* Clones a hive bins list
+ * The clone shares the IO handle but has its own entries and hive bins
+ * The key item cache is not cloned, key items are bound to the hive bins list they were read with
+ * The security key cache is shared with the clone, which must be freed before the source
+ * Returns 1 if successful or -1 on error
  */
-int libregf_hive_bins_list_get_index_at_offset(
-     libregf_hive_bins_list_t *hive_bins_list,
-     off64_t offset,
-     int *hive_bin_index,
+int libregf_hive_bins_list_clone(
+     libregf_hive_bins_list_t **destination_hive_bins_list,
+     libregf_hive_bins_list_t *source_hive_bins_list,
      libcerror_error_t **error )
 {
-	static char *function       = "libregf_hive_bins_list_get_index_at_offset";
-	off64_t element_data_offset = 0;
-	int result                  = 0;
+	libregf_hive_bins_list_entry_t *entry = NULL;
+	static char *function                 = "libregf_hive_bins_list_clone";
+	int result                            = 1;
+	int sorted_index                      = 0;
 
-	if( hive_bins_list == NULL )
+	if( destination_hive_bins_list == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid hive bins list.",
+		 "%s: invalid destination hive bins list.",
 		 function );
 
 		return( -1 );
 	}
-	result = libfdata_list_get_element_index_at_offset(
-	          hive_bins_list->data_list,
-	          offset,
-	          hive_bin_index,
-	          &element_data_offset,
-	          error );
-
-	if( result == -1 )
+	if( *destination_hive_bins_list != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve data list element index at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 offset,
-		 offset );
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination hive bins list value already set.",
+		 function );
 
 		return( -1 );
 	}
-	return( result );
-}
-
-/* Retrives a hive bin cell at a specific offset
- * Returns 1 if successful or -1 on error
- */
-int libregf_hive_bins_list_get_cell_at_offset(
-     libregf_hive_bins_list_t *hive_bins_list,
-     libbfio_handle_t *file_io_handle,
-     uint32_t hive_bin_cell_offset,
-     libregf_hive_bin_cell_t **hive_bin_cell,
-     libcerror_error_t **error )
-{
-	libregf_hive_bin_t *hive_bin = NULL;
-	static char *function        = "libregf_hive_bins_list_get_cell_at_offset";
-	off64_t hive_bin_data_offset = 0;
-	int hive_bin_index           = 0;
-
-	if( hive_bins_list == NULL )
+	if( source_hive_bins_list == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid hive bins list.",
+		 "%s: invalid source hive bins list.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfdata_list_get_element_value_at_offset(
-	     hive_bins_list->data_list,
-	     (intptr_t *) file_io_handle,
-	     (libfdata_cache_t *) hive_bins_list->data_cache,
-	     (off64_t) hive_bin_cell_offset,
-	     &hive_bin_index,
-	     &hive_bin_data_offset,
-	     (intptr_t **) &hive_bin,
-	     0,
+	if( libregf_hive_bins_list_initialize(
+	     destination_hive_bins_list,
+	     source_hive_bins_list->io_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve hive bin at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 hive_bin_cell_offset,
-		 hive_bin_cell_offset );
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination hive bins list.",
+		 function );
 
-		return( -1 );
+		goto on_error;
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     source_hive_bins_list->read_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab source read mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	/* The entries are inserted in offset order
+	 */
+	for( sorted_index = 0;
+	     sorted_index < source_hive_bins_list->number_of_hive_bins;
+	     sorted_index++ )
+	{
+		entry = &( source_hive_bins_list->entries[ source_hive_bins_list->sorted_entry_indexes[ sorted_index ] ] );
+
+		if( libregf_hive_bins_list_insert_bin(
+		     *destination_hive_bins_list,
+		     sorted_index,
+		     entry->offset,
+		     entry->file_offset,
+		     entry->size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert hive bin: %d.",
+			 function,
+			 sorted_index );
+
+			result = -1;
+
+			break;
+		}
+	}
+	/* The clone reads the remaining hive bins on demand with its own file IO handle
+	 */
+	( *destination_hive_bins_list )->number_of_sequential_hive_bins     = source_hive_bins_list->number_of_sequential_hive_bins;
+	( *destination_hive_bins_list )->hive_bins_size                     = source_hive_bins_list->hive_bins_size;
+	( *destination_hive_bins_list )->next_hive_bin_offset               = source_hive_bins_list->next_hive_bin_offset;
+	( *destination_hive_bins_list )->remaining_hive_bins_size           = source_hive_bins_list->remaining_hive_bins_size;
+	( *destination_hive_bins_list )->alignment_size                     = source_hive_bins_list->alignment_size;
+	( *destination_hive_bins_list )->flags                              = source_hive_bins_list->flags;
+	( *destination_hive_bins_list )->maximum_number_of_cached_hive_bins = source_hive_bins_list->maximum_number_of_cached_hive_bins;
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     source_hive_bins_list->read_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release source read mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	if( source_hive_bins_list->security_key_cache != NULL )
+	{
+		( *destination_hive_bins_list )->security_key_cache           = source_hive_bins_list->security_key_cache;
+		( *destination_hive_bins_list )->security_key_cache_is_shared = 1;
+	}
+
+	return( 1 );
+
+on_error:
+	if( *destination_hive_bins_list != NULL )
+	{
+		libregf_hive_bins_list_free(
+		 destination_hive_bins_list,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Sets the data range of the hive bins that remain to be read
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_hive_bins_list_set_data_range(
+     libregf_hive_bins_list_t *hive_bins_list,
+     off64_t file_offset,
+     uint32_t hive_bins_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_hive_bins_list_set_data_range";
+
+	if( hive_bins_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bins list.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	hive_bins_list->next_hive_bin_offset     = file_offset;
+	hive_bins_list->remaining_hive_bins_size = hive_bins_size;
+	hive_bins_list->alignment_size           = 0;
+	hive_bins_list->flags                   |= LIBREGF_HIVE_BINS_FLAG_READ_ON_DEMAND;
+
+	return( 1 );
+}
+
+/* Reads the hive bin that contains a specific offset
+ * The hive bin is read directly when possible, otherwise the hive bins are read up to and including it
+ * The offset is relative to the start of the hive bins, an offset of -1 reads all the remaining hive bins
+ * Returns 1 if successful, 0 if no hive bin signature was found or -1 on error
+ */
+int libregf_hive_bins_list_read_bins_file_io_handle(
+     libregf_hive_bins_list_t *hive_bins_list,
+     libbfio_handle_t *file_io_handle,
+     off64_t offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_hive_bins_list_read_bins_file_io_handle";
+	int result            = 0;
+
+	if( hive_bins_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bins list.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     hive_bins_list->read_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libregf_internal_hive_bins_list_read_bins_file_io_handle(
+	          hive_bins_list,
+	          file_io_handle,
+	          offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read hive bins.",
+		 function );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     hive_bins_list->read_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads the hive bin that contains a specific offset
+ * The hive bin is read directly when possible, otherwise the hive bins are read up to and including it
+ * The caller must hold the read mutex
+ * Returns 1 if successful, 0 if no hive bin signature was found or -1 on error
+ */
+int libregf_internal_hive_bins_list_read_bins_file_io_handle(
+     libregf_hive_bins_list_t *hive_bins_list,
+     libbfio_handle_t *file_io_handle,
+     off64_t offset,
+     libcerror_error_t **error )
+{
+	libregf_hive_bin_header_t *hive_bin_header = NULL;
+	static char *function                      = "libregf_internal_hive_bins_list_read_bins_file_io_handle";
+	off64_t file_offset                        = 0;
+	int result                                 = 1;
+
+	if( hive_bins_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bins list.",
+		 function );
+
+		return( -1 );
+	}
+	if( hive_bins_list->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid hive bins list - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( hive_bins_list->remaining_hive_bins_size == 0 )
+	 || ( ( offset >= 0 )
+	  &&  ( (size64_t) offset < hive_bins_list->hive_bins_size ) ) )
+	{
+		return( 1 );
+	}
+	/* The hive bin that contains the offset is read directly when possible
+	 * otherwise the hive bins are read sequentially up to the offset
+	 */
+	if( offset >= 0 )
+	{
+		result = libregf_internal_hive_bins_list_read_bin_at_offset(
+		          hive_bins_list,
+		          file_io_handle,
+		          offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read hive bin at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			return( 1 );
+		}
+	}
+	if( libregf_hive_bin_header_initialize(
+	     &hive_bin_header,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create hive bin header.",
+		 function );
+
+		goto on_error;
+	}
+	while( hive_bins_list->remaining_hive_bins_size > 0 )
+	{
+		if( ( offset >= 0 )
+		 && ( (size64_t) offset < hive_bins_list->hive_bins_size ) )
+		{
+			break;
+		}
+		file_offset = hive_bins_list->next_hive_bin_offset;
+
+		result = libregf_hive_bins_list_read_hive_bin_header(
+		          hive_bins_list,
+		          file_io_handle,
+		          file_offset,
+		          hive_bin_header,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read hive bin: %d header at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 hive_bins_list->number_of_hive_bins,
+			 file_offset,
+			 file_offset );
+
+			goto on_error;
+		}
+		if( ( result == 0 )
+		 || ( hive_bin_header->size == 0 ) )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: invalid hive bin: %d header at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
+				 function,
+				 hive_bins_list->number_of_hive_bins,
+				 file_offset,
+				 file_offset );
+			}
+#endif
+			hive_bins_list->flags |= LIBREGF_HIVE_BINS_FLAG_IS_CORRUPTED;
+
+			hive_bins_list->alignment_size           += 512;
+			hive_bins_list->next_hive_bin_offset     += 512;
+			hive_bins_list->remaining_hive_bins_size -= 512;
+
+			continue;
+		}
+		if( hive_bin_header->offset != ( file_offset - ( 4096 + hive_bins_list->alignment_size ) ) )
+		{
+			if( ( hive_bins_list->flags & LIBREGF_HIVE_BINS_FLAG_IS_CORRUPTED ) == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: mismatch in hive bin offset (stored: %" PRIu32 " != calculated: %" PRIi64 ").",
+				 function,
+				 hive_bin_header->offset,
+				 file_offset - ( 4096 + hive_bins_list->alignment_size ) );
+
+				goto on_error;
+			}
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: mismatch in hive bin offset (stored: %" PRIu32 " != calculated: %" PRIi64 ") difference: %" PRIi64 ".\n",
+				 function,
+				 hive_bin_header->offset,
+				 file_offset - ( 4096 + hive_bins_list->alignment_size ),
+				 file_offset - ( 4096 + hive_bin_header->offset ) );
+			}
+#endif
+			hive_bins_list->alignment_size = file_offset - ( 4096 + hive_bin_header->offset );
+		}
+		if( libregf_hive_bins_list_append_bin(
+		     hive_bins_list,
+		     file_offset,
+		     hive_bin_header->size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append hive bin: %d.",
+			 function,
+			 hive_bins_list->number_of_hive_bins );
+
+			goto on_error;
+		}
+		hive_bins_list->next_hive_bin_offset     += hive_bin_header->size;
+		hive_bins_list->remaining_hive_bins_size -= hive_bin_header->size;
+	}
+	if( libregf_hive_bin_header_free(
+	     &hive_bin_header,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free hive bin header.",
+		 function );
+
+		return( -1 );
+	}
+	if( result == 0 )
+	{
+		if( hive_bins_list->number_of_hive_bins == 0 )
+		{
+			return( 0 );
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: missing hive bin at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
+			 function,
+			 file_offset,
+			 file_offset );
+		}
+#endif
+		hive_bins_list->flags |= LIBREGF_HIVE_BINS_FLAG_IS_CORRUPTED;
+	}
+	if( ( hive_bins_list->flags & LIBREGF_HIVE_BINS_FLAG_IS_CORRUPTED ) != 0 )
+	{
+		hive_bins_list->io_handle->flags |= LIBREGF_IO_HANDLE_FLAG_IS_CORRUPTED;
+	}
+	return( 1 );
+
+on_error:
+	if( hive_bin_header != NULL )
+	{
+		libregf_hive_bin_header_free(
+		 &hive_bin_header,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the hive bin that contains a specific offset without reading the hive bins before it
+ * The offset is relative to the start of the hive bins and must be beyond the hive bins read sequentially
+ * The hive bin header is searched for at the 4096 byte aligned offsets at or before the offset
+ * The caller must hold the read mutex
+ * Returns 1 if successful, 0 if the hive bin could not be read directly or -1 on error
+ */
+int libregf_internal_hive_bins_list_read_bin_at_offset(
+     libregf_hive_bins_list_t *hive_bins_list,
+     libbfio_handle_t *file_io_handle,
+     off64_t offset,
+     libcerror_error_t **error )
+{
+	libregf_hive_bin_header_t *hive_bin_header = NULL;
+	libregf_hive_bins_list_entry_t *entry      = NULL;
+	static char *function                      = "libregf_internal_hive_bins_list_read_bin_at_offset";
+	size64_t hive_bin_offset                   = 0;
+	size64_t maximum_offset                    = 0;
+	size64_t minimum_offset                    = 0;
+	off64_t file_offset                        = 0;
+	int first_sorted_index                     = 0;
+	int last_sorted_index                      = 0;
+	int probe_index                            = 0;
+	int result                                 = 0;
+	int sorted_index                           = 0;
+
+	if( hive_bins_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bins list.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( offset < 0 )
+	 || ( (size64_t) offset < hive_bins_list->hive_bins_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The hive bin offsets beyond a corruption cannot be determined without
+	 * reading the hive bins before them
+	 */
+	if( ( hive_bins_list->flags & LIBREGF_HIVE_BINS_FLAG_IS_CORRUPTED ) != 0 )
+	{
+		return( 0 );
+	}
+	hive_bin_offset = ( (size64_t) offset / 4096 ) * 4096;
+	maximum_offset  = hive_bins_list->hive_bins_size + hive_bins_list->remaining_hive_bins_size;
+
+	/* An offset in the next hive bin is read sequentially
+	 */
+	if( ( hive_bin_offset <= hive_bins_list->hive_bins_size )
+	 || ( (size64_t) offset >= maximum_offset ) )
+	{
+		return( 0 );
+	}
+	/* Determine if a hive bin that was read directly before contains the offset
+	 * otherwise determine where the hive bin is inserted
+	 */
+	first_sorted_index = hive_bins_list->number_of_sequential_hive_bins;
+	last_sorted_index  = hive_bins_list->number_of_hive_bins;
+
+	while( first_sorted_index < last_sorted_index )
+	{
+		sorted_index = first_sorted_index + ( ( last_sorted_index - first_sorted_index ) / 2 );
+
+		entry = &( hive_bins_list->entries[ hive_bins_list->sorted_entry_indexes[ sorted_index ] ] );
+
+		if( (size64_t) offset < entry->offset )
+		{
+			last_sorted_index = sorted_index;
+		}
+		else if( ( (size64_t) offset - entry->offset ) >= (size64_t) entry->size )
+		{
+			first_sorted_index = sorted_index + 1;
+		}
+		else
+		{
+			return( 1 );
+		}
+	}
+	minimum_offset = hive_bins_list->hive_bins_size;
+
+	if( first_sorted_index > hive_bins_list->number_of_sequential_hive_bins )
+	{
+		entry = &( hive_bins_list->entries[ hive_bins_list->sorted_entry_indexes[ first_sorted_index - 1 ] ] );
+
+		minimum_offset = entry->offset + entry->size;
+	}
+	if( first_sorted_index < hive_bins_list->number_of_hive_bins )
+	{
+		entry = &( hive_bins_list->entries[ hive_bins_list->sorted_entry_indexes[ first_sorted_index ] ] );
+
+		maximum_offset = entry->offset;
+	}
+	if( libregf_hive_bin_header_initialize(
+	     &hive_bin_header,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create hive bin header.",
+		 function );
+
+		goto on_error;
+	}
+	for( probe_index = 0;
+	     probe_index < LIBREGF_MAXIMUM_NUMBER_OF_HIVE_BIN_HEADER_PROBES;
+	     probe_index++ )
+	{
+		if( hive_bin_offset < minimum_offset )
+		{
+			break;
+		}
+		file_offset = hive_bins_list->next_hive_bin_offset + (off64_t) ( hive_bin_offset - hive_bins_list->hive_bins_size );
+
+		result = libregf_hive_bins_list_read_hive_bin_header(
+		          hive_bins_list,
+		          file_io_handle,
+		          file_offset,
+		          hive_bin_header,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read hive bin header at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			goto on_error;
+		}
+		/* A hive bin header is only used when its stored offset matches
+		 * the offset it was read from
+		 */
+		if( ( result != 0 )
+		 && ( (size64_t) hive_bin_header->offset == hive_bin_offset )
+		 && ( hive_bin_header->size != 0 ) )
+		{
+			/* The search stops at the first hive bin found, if it does not contain
+			 * the offset or overlaps with the next hive bin the hive bins are read
+			 * sequentially instead
+			 */
+			result = 0;
+
+			if( ( ( (size64_t) offset - hive_bin_offset ) < (size64_t) hive_bin_header->size )
+			 && ( (size64_t) hive_bin_header->size <= ( maximum_offset - hive_bin_offset ) ) )
+			{
+				if( libregf_hive_bins_list_insert_bin(
+				     hive_bins_list,
+				     first_sorted_index,
+				     hive_bin_offset,
+				     file_offset,
+				     hive_bin_header->size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to insert hive bin at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+					 function,
+					 file_offset,
+					 file_offset );
+
+					goto on_error;
+				}
+				result = 1;
+			}
+			break;
+		}
+		result = 0;
+
+		if( hive_bin_offset < ( minimum_offset + 4096 ) )
+		{
+			break;
+		}
+		hive_bin_offset -= 4096;
+	}
+	if( libregf_hive_bin_header_free(
+	     &hive_bin_header,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free hive bin header.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+
+on_error:
+	if( hive_bin_header != NULL )
+	{
+		libregf_hive_bin_header_free(
+		 &hive_bin_header,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the hive bins
+ * Returns 1 if successful, 0 if no hive bin signature was found or -1 on error
+ */
+int libregf_hive_bins_list_read_file_io_handle(
+     libregf_hive_bins_list_t *hive_bins_list,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     uint32_t hive_bins_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_hive_bins_list_read_file_io_handle";
+	int result            = 0;
+
+	if( libregf_hive_bins_list_set_data_range(
+	     hive_bins_list,
+	     file_offset,
+	     hive_bins_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set hive bins data range.",
+		 function );
+
+		return( -1 );
+	}
+	result = libregf_hive_bins_list_read_bins_file_io_handle(
+	          hive_bins_list,
+	          file_io_handle,
+	          -1,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read hive bins.",
+		 function );
+
+		return( -1 );
+	}
+	/* All the hive bins have been read, hence the entries no longer change
+	 * and can be looked up without grabbing the read mutex
+	 */
+	hive_bins_list->flags &= ~( LIBREGF_HIVE_BINS_FLAG_READ_ON_DEMAND );
+
+	return( result );
+}
+
+/* Retrieves the hive bin index for a specific offset
+ * The hive bin that contains the offset is read if it has not been read yet
+ * The hive bin index is the entry index, which does not change when more hive bins are read
+ * Returns 1 if successful, 0 if not or -1 on error
+ */
+int libregf_hive_bins_list_get_index_at_offset(
+     libregf_hive_bins_list_t *hive_bins_list,
+     libbfio_handle_t *file_io_handle,
+     off64_t offset,
+     int *hive_bin_index,
+     libcerror_error_t **error )
+{
+	libregf_hive_bins_list_entry_t *entry = NULL;
+	static char *function                 = "libregf_hive_bins_list_get_index_at_offset";
+	int entry_index                       = 0;
+	int first_sorted_index                = 0;
+	int last_sorted_index                 = 0;
+	int result                            = 0;
+	int sorted_index                      = 0;
+	uint8_t read_on_demand                = 0;
+
+	if( hive_bins_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bins list.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( hive_bin_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bin index.",
+		 function );
+
+		return( -1 );
+	}
+	/* When the hive bins are read on demand the entries can change, otherwise
+	 * they are only read and no lock is needed
+	 */
+	if( ( hive_bins_list->flags & LIBREGF_HIVE_BINS_FLAG_READ_ON_DEMAND ) != 0 )
+	{
+		read_on_demand = 1;
+	}
+	if( read_on_demand != 0 )
+	{
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     hive_bins_list->read_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read mutex.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		if( libregf_internal_hive_bins_list_read_bins_file_io_handle(
+		     hive_bins_list,
+		     file_io_handle,
+		     offset,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read hive bins up to offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
+
+			result = -1;
+		}
+	}
+	if( result != -1 )
+	{
+		first_sorted_index = 0;
+		last_sorted_index  = hive_bins_list->number_of_hive_bins;
+
+		while( first_sorted_index < last_sorted_index )
+		{
+			sorted_index = first_sorted_index + ( ( last_sorted_index - first_sorted_index ) / 2 );
+			entry_index  = hive_bins_list->sorted_entry_indexes[ sorted_index ];
+
+			entry = &( hive_bins_list->entries[ entry_index ] );
+
+			if( (size64_t) offset < entry->offset )
+			{
+				last_sorted_index = sorted_index;
+			}
+			else if( ( (size64_t) offset - entry->offset ) >= (size64_t) entry->size )
+			{
+				first_sorted_index = sorted_index + 1;
+			}
+			else
+			{
+				*hive_bin_index = entry_index;
+
+				result = 1;
+
+				break;
+			}
+		}
+	}
+	if( read_on_demand != 0 )
+	{
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_release(
+		     hive_bins_list->read_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read mutex.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+	}
+	return( result );
+}
+
+/* Retrieves the file offset and size of a specific hive bin
+ * The hive bin index is the index of the hive bin in offset order
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_hive_bins_list_get_hive_bin_range_by_index(
+     libregf_hive_bins_list_t *hive_bins_list,
+     int hive_bin_index,
+     off64_t *file_offset,
+     uint32_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_hive_bins_list_get_hive_bin_range_by_index";
+	int entry_index       = 0;
+	int result            = 1;
+
+	if( hive_bins_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bins list.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     hive_bins_list->read_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( hive_bin_index < 0 )
+	 || ( hive_bin_index >= hive_bins_list->number_of_hive_bins ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid hive bin index value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		entry_index = hive_bins_list->sorted_entry_indexes[ hive_bin_index ];
+
+		*file_offset = hive_bins_list->entries[ entry_index ].file_offset;
+		*size        = hive_bins_list->entries[ entry_index ].size;
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     hive_bins_list->read_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrives a hive bin cell at a specific offset
+ * The hive bin that contains the offset is read if it has not been read yet
+ * The hive bin that contains the cell is not evicted from the cache until
+ * the cell is released with libregf_hive_bins_list_release_cell_at_offset,
+ * hence the cell remains valid when other threads retrieve cells concurrently
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_hive_bins_list_get_cell_at_offset(
+     libregf_hive_bins_list_t *hive_bins_list,
+     libbfio_handle_t *file_io_handle,
+     uint32_t hive_bin_cell_offset,
+     libregf_hive_bin_cell_t **hive_bin_cell,
+     libcerror_error_t **error )
+{
+	libregf_hive_bins_list_entry_t *entry = NULL;
+	libregf_hive_bin_t *hive_bin          = NULL;
+	static char *function                 = "libregf_hive_bins_list_get_cell_at_offset";
+	int hive_bin_index                    = 0;
+	int result                            = 0;
+	int shard_index                       = 0;
+
+	if( hive_bins_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bins list.",
+		 function );
+
+		return( -1 );
+	}
+	result = libregf_hive_bins_list_get_index_at_offset(
+	          hive_bins_list,
+	          file_io_handle,
+	          (off64_t) hive_bin_cell_offset,
+	          &hive_bin_index,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve hive bin index at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 function,
+		 hive_bin_cell_offset,
+		 hive_bin_cell_offset );
+
+		return( -1 );
+	}
+	shard_index = hive_bin_index % LIBREGF_NUMBER_OF_HIVE_BINS_LIST_SHARDS;
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     hive_bins_list->shard_mutexes[ shard_index ],
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab shard mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	entry = &( hive_bins_list->entries[ hive_bin_index ] );
+
+	if( entry->hive_bin == NULL )
+	{
+		result = libregf_hive_bins_list_read_hive_bin(
+		          hive_bins_list,
+		          file_io_handle,
+		          entry->file_offset,
+		          (size64_t) entry->size,
+		          &hive_bin,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read hive bin: %d.",
+			 function,
+			 hive_bin_index );
+
+			result = -1;
+		}
+		else
+		{
+			entry->hive_bin = hive_bin;
+		}
+	}
+	else
+	{
+		result = libregf_hive_bins_list_remove_entry_from_shard(
+		          hive_bins_list,
+		          hive_bin_index,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove entry: %d from shard.",
+			 function,
+			 hive_bin_index );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		if( libregf_hive_bins_list_prepend_entry_to_shard(
+		     hive_bins_list,
+		     hive_bin_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to prepend entry: %d to shard.",
+			 function,
+			 hive_bin_index );
+
+			result = -1;
+		}
 	}
-	if( libregf_hive_bin_get_cell_at_offset(
-	     hive_bin,
-	     hive_bin_cell_offset,
-	     hive_bin_cell,
+	if( result == 1 )
+	{
+		if( libregf_hive_bin_get_cell_at_offset(
+		     entry->hive_bin,
+		     hive_bin_cell_offset,
+		     hive_bin_cell,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve hive bin cell at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+			 function,
+			 hive_bin_cell_offset,
+			 hive_bin_cell_offset );
+
+			result = -1;
+		}
+		else
+		{
+			entry->reference_count += 1;
+		}
+	}
+	/* The hive bin that was just read is referenced, or is the most recently used
+	 * hence it is not evicted here
+	 */
+	if( result == 1 )
+	{
+		if( libregf_hive_bins_list_evict_hive_bins(
+		     hive_bins_list,
+		     shard_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to evict hive bins.",
+			 function );
+
+			entry->reference_count -= 1;
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     hive_bins_list->shard_mutexes[ shard_index ],
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release shard mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Releases a hive bin cell at a specific offset that was retrieved with
+ * libregf_hive_bins_list_get_cell_at_offset
+ * Once all its cells are released the hive bin can be evicted from the cache
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_hive_bins_list_release_cell_at_offset(
+     libregf_hive_bins_list_t *hive_bins_list,
+     libbfio_handle_t *file_io_handle,
+     uint32_t hive_bin_cell_offset,
+     libcerror_error_t **error )
+{
+	libregf_hive_bins_list_entry_t *entry = NULL;
+	static char *function                 = "libregf_hive_bins_list_release_cell_at_offset";
+	int hive_bin_index                    = 0;
+	int result                            = 0;
+	int shard_index                       = 0;
+
+	if( hive_bins_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bins list.",
+		 function );
+
+		return( -1 );
+	}
+	result = libregf_hive_bins_list_get_index_at_offset(
+	          hive_bins_list,
+	          file_io_handle,
+	          (off64_t) hive_bin_cell_offset,
+	          &hive_bin_index,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve hive bin index at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 function,
+		 hive_bin_cell_offset,
+		 hive_bin_cell_offset );
+
+		return( -1 );
+	}
+	shard_index = hive_bin_index % LIBREGF_NUMBER_OF_HIVE_BINS_LIST_SHARDS;
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     hive_bins_list->shard_mutexes[ shard_index ],
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab shard mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	entry = &( hive_bins_list->entries[ hive_bin_index ] );
+
+	if( ( entry->hive_bin == NULL )
+	 || ( entry->reference_count == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid hive bin: %d - reference count value out of bounds.",
+		 function,
+		 hive_bin_index );
+
+		result = -1;
+	}
+	else
+	{
+		entry->reference_count -= 1;
+
+		/* A hive bin that could not be evicted before is evicted
+		 * when its last cell is released
+		 */
+		if( entry->reference_count == 0 )
+		{
+			if( libregf_hive_bins_list_evict_hive_bins(
+			     hive_bins_list,
+			     shard_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to evict hive bins.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     hive_bins_list->shard_mutexes[ shard_index ],
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve hive bin cell at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 hive_bin_cell_offset,
-		 hive_bin_cell_offset );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release shard mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Evicts the least recently used hive bins of a shard that are not referenced
+ * until the number of hive bins kept in the shard no longer exceeds the maximum
+ * The caller must hold the shard mutex
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_hive_bins_list_evict_hive_bins(
+     libregf_hive_bins_list_t *hive_bins_list,
+     int shard_index,
+     libcerror_error_t **error )
+{
+	libregf_hive_bins_list_entry_t *entry = NULL;
+	static char *function                 = "libregf_hive_bins_list_evict_hive_bins";
+	int entry_index                       = 0;
+	int previous_entry_index              = 0;
+
+	if( hive_bins_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bins list.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( shard_index < 0 )
+	 || ( shard_index >= LIBREGF_NUMBER_OF_HIVE_BINS_LIST_SHARDS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid shard index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	entry_index = hive_bins_list->least_recently_used_entry_index[ shard_index ];
+
+	while( ( entry_index != -1 )
+	    && ( hive_bins_list->number_of_cached_hive_bins[ shard_index ] > hive_bins_list->maximum_number_of_cached_hive_bins ) )
+	{
+		entry                = &( hive_bins_list->entries[ entry_index ] );
+		previous_entry_index = entry->previous_entry_index;
+
+		if( entry->reference_count == 0 )
+		{
+			if( libregf_hive_bins_list_remove_entry_from_shard(
+			     hive_bins_list,
+			     entry_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to remove entry: %d from shard.",
+				 function,
+				 entry_index );
+
+				return( -1 );
+			}
+			if( libregf_hive_bin_free(
+			     &( entry->hive_bin ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free hive bin: %d.",
+				 function,
+				 entry_index );
+
+				return( -1 );
+			}
+		}
+		entry_index = previous_entry_index;
+	}
+	return( 1 );
+}
+
+/* Removes an entry from the most recently used order of its shard
+ * The caller must hold the shard mutex
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_hive_bins_list_remove_entry_from_shard(
+     libregf_hive_bins_list_t *hive_bins_list,
+     int entry_index,
+     libcerror_error_t **error )
+{
+	libregf_hive_bins_list_entry_t *entry = NULL;
+	static char *function                 = "libregf_hive_bins_list_remove_entry_from_shard";
+	int shard_index                       = 0;
+
+	if( hive_bins_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bins list.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= hive_bins_list->number_of_hive_bins ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	shard_index = entry_index % LIBREGF_NUMBER_OF_HIVE_BINS_LIST_SHARDS;
+	entry       = &( hive_bins_list->entries[ entry_index ] );
+
+	if( entry->previous_entry_index != -1 )
+	{
+		hive_bins_list->entries[ entry->previous_entry_index ].next_entry_index = entry->next_entry_index;
+	}
+	else if( hive_bins_list->most_recently_used_entry_index[ shard_index ] == entry_index )
+	{
+		hive_bins_list->most_recently_used_entry_index[ shard_index ] = entry->next_entry_index;
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry: %d - not in shard.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	if( entry->next_entry_index != -1 )
+	{
+		hive_bins_list->entries[ entry->next_entry_index ].previous_entry_index = entry->previous_entry_index;
+	}
+	else
+	{
+		hive_bins_list->least_recently_used_entry_index[ shard_index ] = entry->previous_entry_index;
+	}
+	entry->previous_entry_index = -1;
+	entry->next_entry_index     = -1;
+
+	hive_bins_list->number_of_cached_hive_bins[ shard_index ] -= 1;
+
+	return( 1 );
+}
+
+/* Prepends an entry to the most recently used order of its shard
+ * The caller must hold the shard mutex
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_hive_bins_list_prepend_entry_to_shard(
+     libregf_hive_bins_list_t *hive_bins_list,
+     int entry_index,
+     libcerror_error_t **error )
+{
+	libregf_hive_bins_list_entry_t *entry = NULL;
+	static char *function                 = "libregf_hive_bins_list_prepend_entry_to_shard";
+	int shard_index                       = 0;
+
+	if( hive_bins_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bins list.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= hive_bins_list->number_of_hive_bins ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	shard_index = entry_index % LIBREGF_NUMBER_OF_HIVE_BINS_LIST_SHARDS;
+	entry       = &( hive_bins_list->entries[ entry_index ] );
+
+	entry->previous_entry_index = -1;
+	entry->next_entry_index     = hive_bins_list->most_recently_used_entry_index[ shard_index ];
+
+	if( entry->next_entry_index != -1 )
+	{
+		hive_bins_list->entries[ entry->next_entry_index ].previous_entry_index = entry_index;
+	}
+	else
+	{
+		hive_bins_list->least_recently_used_entry_index[ shard_index ] = entry_index;
+	}
+	hive_bins_list->most_recently_used_entry_index[ shard_index ] = entry_index;
+
+	hive_bins_list->number_of_cached_hive_bins[ shard_index ] += 1;
+
+	return( 1 );
+}
+
+/* Appends a hive bin that was read sequentially to the list
+ * A hive bin that was read directly before is not inserted again
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_hive_bins_list_append_bin(
+     libregf_hive_bins_list_t *hive_bins_list,
+     off64_t offset,
+     uint32_t size,
+     libcerror_error_t **error )
+{
+	libregf_hive_bins_list_entry_t *entry = NULL;
+	static char *function                 = "libregf_hive_bins_list_append_bin";
+	int sorted_index                      = 0;
+
+	if( hive_bins_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bins list.",
+		 function );
 
 		return( -1 );
 	}
+	sorted_index = hive_bins_list->number_of_sequential_hive_bins;
+
+	if( sorted_index < hive_bins_list->number_of_hive_bins )
+	{
+		entry = &( hive_bins_list->entries[ hive_bins_list->sorted_entry_indexes[ sorted_index ] ] );
+
+		if( ( entry->offset != hive_bins_list->hive_bins_size )
+		 || ( entry->file_offset != offset )
+		 || ( entry->size != size ) )
+		{
+			if( ( hive_bins_list->hive_bins_size + size ) > entry->offset )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid hive bin at offset: %" PRIi64 " (0x%08" PRIx64 ") overlaps with hive bin read directly.",
+				 function,
+				 offset,
+				 offset );
+
+				return( -1 );
+			}
+			entry = NULL;
+		}
+	}
+	if( entry == NULL )
+	{
+		if( libregf_hive_bins_list_insert_bin(
+		     hive_bins_list,
+		     sorted_index,
+		     hive_bins_list->hive_bins_size,
+		     offset,
+		     size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert hive bin.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	hive_bins_list->number_of_sequential_hive_bins += 1;
+	hive_bins_list->hive_bins_size                 += size;
+
 	return( 1 );
 }
 
-/* Appends a hive bin to the list
+/* Inserts a hive bin into the list
+ * The hive bin is added as the last entry and its entry index is inserted
+ * at a specific index in the entry indexes sorted by offset
  * Returns 1 if successful or -1 on error
  */
-int libregf_hive_bins_list_append_bin(
+int libregf_hive_bins_list_insert_bin(
      libregf_hive_bins_list_t *hive_bins_list,
-     off64_t offset,
+     int sorted_index,
+     size64_t offset,
+     off64_t file_offset,
      uint32_t size,
      libcerror_error_t **error )
 {
-	static char *function = "libregf_hive_bins_list_append_bin";
-	int element_index     = 0;
+	libregf_hive_bins_list_entry_t *entries = NULL;
+	libregf_hive_bins_list_entry_t *entry   = NULL;
+	static char *function                   = "libregf_hive_bins_list_insert_bin";
+	size_t entries_size                     = 0;
+	int *sorted_entry_indexes               = NULL;
+	int entry_index                         = 0;
+	int number_of_allocated_entries         = 0;
+	int result                              = 1;
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	int number_of_grabbed_shards            = 0;
+	int shard_index                         = 0;
+#endif
 
 	if( hive_bins_list == NULL )
 	{
@@ -597,52 +2210,314 @@ int libregf_hive_bins_list_append_bin(
 
 		return( -1 );
 	}
-	if( libfdata_list_append_element(
-	     hive_bins_list->data_list,
-	     &element_index,
-	     0,
-	     offset,
-	     (size64_t) size,
-	     0,
-	     error ) != 1 )
+	if( ( sorted_index < 0 )
+	 || ( sorted_index > hive_bins_list->number_of_hive_bins ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append hive bin to data list.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid sorted index value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
+	if( hive_bins_list->number_of_hive_bins >= hive_bins_list->number_of_allocated_entries )
+	{
+		if( hive_bins_list->number_of_allocated_entries == 0 )
+		{
+			number_of_allocated_entries = 64;
+		}
+		else if( hive_bins_list->number_of_allocated_entries <= ( INT_MAX / 2 ) )
+		{
+			number_of_allocated_entries = hive_bins_list->number_of_allocated_entries * 2;
+		}
+		entries_size = sizeof( libregf_hive_bins_list_entry_t ) * number_of_allocated_entries;
+
+		if( ( number_of_allocated_entries == 0 )
+		 || ( entries_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid entries size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+		/* Other threads access the hive bins of the entries while holding
+		 * a shard mutex, hence all the shards are grabbed to move the entries
+		 */
+		for( shard_index = 0;
+		     shard_index < LIBREGF_NUMBER_OF_HIVE_BINS_LIST_SHARDS;
+		     shard_index++ )
+		{
+			if( libcthreads_mutex_grab(
+			     hive_bins_list->shard_mutexes[ shard_index ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab shard: %d mutex.",
+				 function,
+				 shard_index );
+
+				result = -1;
+
+				break;
+			}
+			number_of_grabbed_shards++;
+		}
+		if( result == 1 )
+#endif
+		{
+			entries = (libregf_hive_bins_list_entry_t *) memory_reallocate(
+			                                              hive_bins_list->entries,
+			                                              entries_size );
+
+			if( entries == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize entries.",
+				 function );
+
+				result = -1;
+			}
+			else
+			{
+				hive_bins_list->entries = entries;
+
+				sorted_entry_indexes = (int *) memory_reallocate(
+				                                hive_bins_list->sorted_entry_indexes,
+				                                sizeof( int ) * number_of_allocated_entries );
+
+				if( sorted_entry_indexes == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to resize sorted entry indexes.",
+					 function );
+
+					result = -1;
+				}
+				else
+				{
+					hive_bins_list->sorted_entry_indexes        = sorted_entry_indexes;
+					hive_bins_list->number_of_allocated_entries = number_of_allocated_entries;
+				}
+			}
+		}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+		for( shard_index = 0;
+		     shard_index < number_of_grabbed_shards;
+		     shard_index++ )
+		{
+			if( libcthreads_mutex_release(
+			     hive_bins_list->shard_mutexes[ shard_index ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release shard: %d mutex.",
+				 function,
+				 shard_index );
+
+				result = -1;
+			}
+		}
+#endif
+		if( result != 1 )
+		{
+			return( -1 );
+		}
+	}
+	entry_index = hive_bins_list->number_of_hive_bins;
+
+	entry = &( hive_bins_list->entries[ entry_index ] );
+
+	entry->offset               = offset;
+	entry->file_offset          = file_offset;
+	entry->size                 = size;
+	entry->hive_bin             = NULL;
+	entry->reference_count      = 0;
+	entry->previous_entry_index = -1;
+	entry->next_entry_index     = -1;
+
+	while( entry_index > sorted_index )
+	{
+		hive_bins_list->sorted_entry_indexes[ entry_index ] = hive_bins_list->sorted_entry_indexes[ entry_index - 1 ];
+
+		entry_index--;
+	}
+	hive_bins_list->sorted_entry_indexes[ sorted_index ] = hive_bins_list->number_of_hive_bins;
+
+	hive_bins_list->number_of_hive_bins += 1;
+
 	return( 1 );
 }
 
+/* Reads a hive bin header
+ * When the file is memory mapped the hive bin header is read from the mapped data
+ * Returns 1 if successful, 0 if no hive bin signature was found or -1 on error
+ */
+int libregf_hive_bins_list_read_hive_bin_header(
+     libregf_hive_bins_list_t *hive_bins_list,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libregf_hive_bin_header_t *hive_bin_header,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_hive_bins_list_read_hive_bin_header";
+	int result            = 0;
+
+	if( hive_bins_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bins list.",
+		 function );
+
+		return( -1 );
+	}
+	if( hive_bins_list->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid hive bins list - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( hive_bins_list->io_handle->mapped_data != NULL )
+	 && ( (size64_t) file_offset <= hive_bins_list->io_handle->mapped_data_size )
+	 && ( sizeof( regf_hive_bin_header_t ) <= ( hive_bins_list->io_handle->mapped_data_size - (size64_t) file_offset ) ) )
+	{
+		result = libregf_hive_bin_header_read_data(
+		          hive_bin_header,
+		          &( ( hive_bins_list->io_handle->mapped_data )[ file_offset ] ),
+		          sizeof( regf_hive_bin_header_t ),
+		          error );
+	}
+	else
+	{
+		result = libregf_hive_bin_header_read_file_io_handle(
+		          hive_bin_header,
+		          file_io_handle,
+		          file_offset,
+		          error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read hive bin header at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		return( -1 );
+	}
+	return( result );
+}
+
 /* Reads a hive bin
- * Callback function for the data list
  * Returns 1 if successful or -1 on error
  */
-int libregf_hive_bins_list_read_element_data(
-     intptr_t *data_handle LIBREGF_ATTRIBUTE_UNUSED,
+int libregf_hive_bins_list_read_hive_bin(
+     libregf_hive_bins_list_t *hive_bins_list,
      libbfio_handle_t *file_io_handle,
-     libfdata_list_element_t *element,
-     libfdata_cache_t *cache,
-     int data_range_file_index LIBREGF_ATTRIBUTE_UNUSED,
-     off64_t data_range_offset,
-     size64_t data_range_size,
-     uint32_t data_range_flags LIBREGF_ATTRIBUTE_UNUSED,
-     uint8_t read_flags LIBREGF_ATTRIBUTE_UNUSED,
+     off64_t file_offset,
+     size64_t size,
+     libregf_hive_bin_t **hive_bin,
      libcerror_error_t **error )
 {
-	libregf_hive_bin_t *hive_bin               = NULL;
 	libregf_hive_bin_header_t *hive_bin_header = NULL;
-	static char *function                      = "libregf_hive_bins_list_read_element_data";
+	const uint8_t *mapped_data                 = NULL;
+	static char *function                      = "libregf_hive_bins_list_read_hive_bin";
+	int result                                 = 0;
+
+	if( hive_bins_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bins list.",
+		 function );
+
+		return( -1 );
+	}
+	if( hive_bins_list->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid hive bins list - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( hive_bin == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bin.",
+		 function );
 
-	LIBREGF_UNREFERENCED_PARAMETER( data_handle )
-	LIBREGF_UNREFERENCED_PARAMETER( data_range_file_index )
-	LIBREGF_UNREFERENCED_PARAMETER( data_range_flags )
-	LIBREGF_UNREFERENCED_PARAMETER( read_flags )
+		return( -1 );
+	}
+	if( *hive_bin != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid hive bin value already set.",
+		 function );
 
+		return( -1 );
+	}
+	/* When the file is memory mapped the cells reference the mapped data directly
+	 */
+	if( ( hive_bins_list->io_handle->mapped_data != NULL )
+	 && ( file_offset >= 0 )
+	 && ( size >= sizeof( regf_hive_bin_header_t ) )
+	 && ( (size64_t) file_offset <= hive_bins_list->io_handle->mapped_data_size )
+	 && ( size <= ( hive_bins_list->io_handle->mapped_data_size - (size64_t) file_offset ) ) )
+	{
+		mapped_data = &( ( hive_bins_list->io_handle->mapped_data )[ file_offset ] );
+	}
 	if( libregf_hive_bin_header_initialize(
 	     &hive_bin_header,
 	     error ) != 1 )
@@ -656,11 +2531,23 @@ int libregf_hive_bins_list_read_element_data(
 
 		goto on_error;
 	}
-	if( libregf_hive_bin_header_read_file_io_handle(
-	     hive_bin_header,
-	     file_io_handle,
-	     data_range_offset,
-	     error ) != 1 )
+	if( mapped_data != NULL )
+	{
+		result = libregf_hive_bin_header_read_data(
+		          hive_bin_header,
+		          mapped_data,
+		          sizeof( regf_hive_bin_header_t ),
+		          error );
+	}
+	else
+	{
+		result = libregf_hive_bin_header_read_file_io_handle(
+		          hive_bin_header,
+		          file_io_handle,
+		          file_offset,
+		          error );
+	}
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -668,12 +2555,12 @@ int libregf_hive_bins_list_read_element_data(
 		 LIBCERROR_IO_ERROR_READ_FAILED,
 		 "%s: unable to read hive bin header at offset: %" PRIi64 " (0x%08" PRIx64 ").",
 		 function,
-		 data_range_offset,
-		 data_range_offset );
+		 file_offset,
+		 file_offset );
 
 		goto on_error;
 	}
-	if( (size64_t) hive_bin_header->size != data_range_size )
+	if( (size64_t) hive_bin_header->size != size )
 	{
 		libcerror_error_set(
 		 error,
@@ -682,12 +2569,12 @@ int libregf_hive_bins_list_read_element_data(
 		 "%s: mismatch in hive bin size (stored: %" PRIu32 " != calculated: %" PRIu64 ").",
 		 function,
 		 hive_bin_header->size,
-		 data_range_size );
+		 size );
 
 		goto on_error;
 	}
 	if( libregf_hive_bin_initialize(
-	     &hive_bin,
+	     hive_bin,
 	     hive_bin_header->offset,
 	     hive_bin_header->size,
 	     error ) != 1 )
@@ -701,10 +2588,23 @@ int libregf_hive_bins_list_read_element_data(
 
 		goto on_error;
 	}
-	if( libregf_hive_bin_read_cells_file_io_handle(
-	     hive_bin,
-	     file_io_handle,
-	     error ) != 1 )
+	if( mapped_data != NULL )
+	{
+		result = libregf_hive_bin_read_cells_data(
+		          *hive_bin,
+		          &( mapped_data[ sizeof( regf_hive_bin_header_t ) ] ),
+		          (size_t) size - sizeof( regf_hive_bin_header_t ),
+		          error );
+	}
+	else
+	{
+		result = libregf_hive_bin_read_cells_file_io_handle(
+		          *hive_bin,
+		          file_io_handle,
+		          file_offset,
+		          error );
+	}
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -715,24 +2615,6 @@ int libregf_hive_bins_list_read_element_data(
 
 		goto on_error;
 	}
-	if( libfdata_list_element_set_element_value(
-	     element,
-	     (intptr_t *) file_io_handle,
-	     cache,
-	     (intptr_t *) hive_bin,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libregf_hive_bin_free,
-	     LIBFDATA_LIST_ELEMENT_VALUE_FLAG_MANAGED,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set hive bin as element value.",
-		 function );
-
-		goto on_error;
-	}
 	if( libregf_hive_bin_header_free(
 	     &hive_bin_header,
 	     error ) != 1 )
@@ -749,10 +2631,10 @@ int libregf_hive_bins_list_read_element_data(
 	return( 1 );
 
 on_error:
-	if( hive_bin != NULL )
+	if( *hive_bin != NULL )
 	{
 		libregf_hive_bin_free(
-		 &hive_bin,
+		 hive_bin,
 		 NULL );
 	}
 	if( hive_bin_header != NULL )
@@ -763,4 +2645,3 @@ on_error:
 	}
 	return( -1 );
 }
-
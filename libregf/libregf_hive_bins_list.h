@@ -25,17 +25,53 @@
 #include <common.h>
 #include <types.h>
 
+#include "libregf_definitions.h"
+#include "libregf_hive_bin.h"
 #include "libregf_hive_bin_cell.h"
+#include "libregf_hive_bin_header.h"
 #include "libregf_io_handle.h"
 #include "libregf_libbfio.h"
 #include "libregf_libcerror.h"
-#include "libregf_libfcache.h"
-#include "libregf_libfdata.h"
+#include "libregf_libcthreads.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+typedef struct libregf_hive_bins_list_entry libregf_hive_bins_list_entry_t;
+
+struct libregf_hive_bins_list_entry
+{
+	/* The offset of the hive bin relative to the start of the hive bins
+	 */
+	size64_t offset;
+
+	/* The file offset of the hive bin
+	 */
+	off64_t file_offset;
+
+	/* The size of the hive bin
+	 */
+	uint32_t size;
+
+	/* The hive bin or NULL if not read yet or evicted
+	 */
+	libregf_hive_bin_t *hive_bin;
+
+	/* The number of cells retrieved from the hive bin that have not been released
+	 * a hive bin that is referenced is not evicted
+	 */
+	uint32_t reference_count;
+
+	/* The index of the previous, more recently used, entry in the same shard or -1
+	 */
+	int previous_entry_index;
+
+	/* The index of the next, less recently used, entry in the same shard or -1
+	 */
+	int next_entry_index;
+};
+
 typedef struct libregf_hive_bins_list libregf_hive_bins_list_t;
 
 struct libregf_hive_bins_list
@@ -44,17 +80,90 @@ struct libregf_hive_bins_list
 	 */
 	libregf_io_handle_t *io_handle;
 
-	/* The data list
+	/* The entries, in the order the hive bins were read
+	 */
+	libregf_hive_bins_list_entry_t *entries;
+
+	/* The entry indexes sorted by offset, which are used to look up the hive bins by offset
+	 */
+	int *sorted_entry_indexes;
+
+	/* The number of allocated entries
 	 */
-	libfdata_list_t *data_list;
+	int number_of_allocated_entries;
 
-	/* The data cache
+	/* The key item cache, which is a libregf_key_item_cache_t
+	 * or NULL if key items are not shared
 	 */
-	libfcache_cache_t *data_cache;
+	intptr_t *key_item_cache;
+
+	/* The security key cache, which is a libregf_security_key_cache_t
+	 * or NULL if security keys are not shared
+	 */
+	intptr_t *security_key_cache;
+
+	/* Value to indicate the security key cache is owned by the hive bins list
+	 * the hive bins list was cloned from
+	 */
+	uint8_t security_key_cache_is_shared;
+
+	/* The number of hive bins read
+	 */
+	int number_of_hive_bins;
+
+	/* The number of hive bins read sequentially from the start of the hive bins
+	 * the hive bins read directly at an offset beyond these follow in offset order
+	 */
+	int number_of_sequential_hive_bins;
+
+	/* The size of the hive bins read sequentially
+	 */
+	size64_t hive_bins_size;
+
+	/* The file offset of the next hive bin to read
+	 */
+	off64_t next_hive_bin_offset;
+
+	/* The size of the hive bins that remain to be read
+	 */
+	uint32_t remaining_hive_bins_size;
+
+	/* The alignment size of the hive bins read
+	 */
+	off64_t alignment_size;
 
 	/* Various flags
 	 */
 	uint8_t flags;
+
+	/* The maximum number of hive bins kept per shard
+	 */
+	int maximum_number_of_cached_hive_bins;
+
+	/* The number of hive bins kept per shard
+	 */
+	int number_of_cached_hive_bins[ LIBREGF_NUMBER_OF_HIVE_BINS_LIST_SHARDS ];
+
+	/* The index of the most recently used entry per shard or -1
+	 */
+	int most_recently_used_entry_index[ LIBREGF_NUMBER_OF_HIVE_BINS_LIST_SHARDS ];
+
+	/* The index of the least recently used entry per shard or -1
+	 */
+	int least_recently_used_entry_index[ LIBREGF_NUMBER_OF_HIVE_BINS_LIST_SHARDS ];
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	/* The mutex that serializes reading the hive bins on demand
+	 */
+	libcthreads_mutex_t *read_mutex;
+
+	/* The shard mutexes, which protect the hive bins of the entries
+	 * and the most recently used order of a shard
+	 * the entry index of a hive bin modulo the number of shards
+	 * determines its shard
+	 */
+	libcthreads_mutex_t *shard_mutexes[ LIBREGF_NUMBER_OF_HIVE_BINS_LIST_SHARDS ];
+#endif
 };
 
 int libregf_hive_bins_list_initialize(
@@ -66,10 +175,48 @@ int libregf_hive_bins_list_free(
      libregf_hive_bins_list_t **hive_bins_list,
      libcerror_error_t **error );
 
+int libregf_hive_bins_list_enable_key_item_cache(
+     libregf_hive_bins_list_t *hive_bins_list,
+     int maximum_number_of_entries,
+     libcerror_error_t **error );
+
+int libregf_hive_bins_list_enable_security_key_cache(
+     libregf_hive_bins_list_t *hive_bins_list,
+     libcerror_error_t **error );
+
 int libregf_hive_bins_list_empty_cache(
      libregf_hive_bins_list_t *hive_bins_list,
      libcerror_error_t **error );
 
+int libregf_hive_bins_list_clone(
+     libregf_hive_bins_list_t **destination_hive_bins_list,
+     libregf_hive_bins_list_t *source_hive_bins_list,
+     libcerror_error_t **error );
+
+int libregf_hive_bins_list_set_data_range(
+     libregf_hive_bins_list_t *hive_bins_list,
+     off64_t file_offset,
+     uint32_t hive_bins_size,
+     libcerror_error_t **error );
+
+int libregf_hive_bins_list_read_bins_file_io_handle(
+     libregf_hive_bins_list_t *hive_bins_list,
+     libbfio_handle_t *file_io_handle,
+     off64_t offset,
+     libcerror_error_t **error );
+
+int libregf_internal_hive_bins_list_read_bins_file_io_handle(
+     libregf_hive_bins_list_t *hive_bins_list,
+     libbfio_handle_t *file_io_handle,
+     off64_t offset,
+     libcerror_error_t **error );
+
+int libregf_internal_hive_bins_list_read_bin_at_offset(
+     libregf_hive_bins_list_t *hive_bins_list,
+     libbfio_handle_t *file_io_handle,
+     off64_t offset,
+     libcerror_error_t **error );
+
 int libregf_hive_bins_list_read_file_io_handle(
      libregf_hive_bins_list_t *hive_bins_list,
      libbfio_handle_t *file_io_handle,
@@ -79,10 +226,18 @@ int libregf_hive_bins_list_read_file_io_handle(
 
 int libregf_hive_bins_list_get_index_at_offset(
      libregf_hive_bins_list_t *hive_bins_list,
+     libbfio_handle_t *file_io_handle,
      off64_t offset,
      int *hive_bin_index,
      libcerror_error_t **error );
 
+int libregf_hive_bins_list_get_hive_bin_range_by_index(
+     libregf_hive_bins_list_t *hive_bins_list,
+     int hive_bin_index,
+     off64_t *file_offset,
+     uint32_t *size,
+     libcerror_error_t **error );
+
 int libregf_hive_bins_list_get_cell_at_offset(
      libregf_hive_bins_list_t *hive_bins_list,
      libbfio_handle_t *file_io_handle,
@@ -90,22 +245,54 @@ int libregf_hive_bins_list_get_cell_at_offset(
      libregf_hive_bin_cell_t **hive_bin_cell,
      libcerror_error_t **error );
 
+int libregf_hive_bins_list_release_cell_at_offset(
+     libregf_hive_bins_list_t *hive_bins_list,
+     libbfio_handle_t *file_io_handle,
+     uint32_t hive_bin_cell_offset,
+     libcerror_error_t **error );
+
+int libregf_hive_bins_list_evict_hive_bins(
+     libregf_hive_bins_list_t *hive_bins_list,
+     int shard_index,
+     libcerror_error_t **error );
+
+int libregf_hive_bins_list_remove_entry_from_shard(
+     libregf_hive_bins_list_t *hive_bins_list,
+     int entry_index,
+     libcerror_error_t **error );
+
+int libregf_hive_bins_list_prepend_entry_to_shard(
+     libregf_hive_bins_list_t *hive_bins_list,
+     int entry_index,
+     libcerror_error_t **error );
+
+int libregf_hive_bins_list_read_hive_bin_header(
+     libregf_hive_bins_list_t *hive_bins_list,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libregf_hive_bin_header_t *hive_bin_header,
+     libcerror_error_t **error );
+
+int libregf_hive_bins_list_read_hive_bin(
+     libregf_hive_bins_list_t *hive_bins_list,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     size64_t size,
+     libregf_hive_bin_t **hive_bin,
+     libcerror_error_t **error );
+
 int libregf_hive_bins_list_append_bin(
      libregf_hive_bins_list_t *hive_bins_list,
      off64_t offset,
      uint32_t size,
      libcerror_error_t **error );
 
-int libregf_hive_bins_list_read_element_data(
-     intptr_t *data_handle,
-     libbfio_handle_t *file_io_handle,
-     libfdata_list_element_t *element,
-     libfdata_cache_t *cache,
-     int data_range_file_index,
-     off64_t data_range_offset,
-     size64_t data_range_size,
-     uint32_t data_range_flags,
-     uint8_t read_flags,
+int libregf_hive_bins_list_insert_bin(
+     libregf_hive_bins_list_t *hive_bins_list,
+     int sorted_index,
+     size64_t offset,
+     off64_t file_offset,
+     uint32_t size,
      libcerror_error_t **error );
 
 #if defined( __cplusplus )
@@ -0,0 +1,2027 @@
+/*
+ * Index functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_WCTYPE_H )
+#include <wctype.h>
+#endif
+
+#include "libregf_checksum.h"
+#include "libregf_definitions.h"
+#include "libregf_file_header.h"
+#include "libregf_hive_bins_list.h"
+#include "libregf_index.h"
+#include "libregf_io_handle.h"
+#include "libregf_key_descriptor.h"
+#include "libregf_key_item.h"
+#include "libregf_libbfio.h"
+#include "libregf_libcerror.h"
+#include "libregf_libuna.h"
+
+#include "regf_index.h"
+
+const uint8_t regf_index_file_signature[ 8 ] = {
+	'r', 'e', 'g', 'f', 'i', 'd', 'x', 0 };
+
+/* Creates an index
+ * Make sure the value index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_index_initialize(
+     libregf_index_t **index,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_index_initialize";
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*index = memory_allocate_structure(
+	          libregf_index_t );
+
+	if( *index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *index,
+	     0,
+	     sizeof( libregf_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear index.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *index != NULL )
+	{
+		memory_free(
+		 *index );
+
+		*index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an index
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_index_free(
+     libregf_index_t **index,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_index_free";
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index != NULL )
+	{
+		if( ( *index )->data != NULL )
+		{
+			memory_free(
+			 ( *index )->data );
+		}
+		memory_free(
+		 *index );
+
+		*index = NULL;
+	}
+	return( 1 );
+}
+
+/* Compares two key entries by path hash and path offset
+ * Callback function for qsort
+ * Returns -1 if the first entry sorts before the second, 0 if equal or 1 if after
+ */
+int libregf_index_key_entry_compare(
+     const void *first_key_entry,
+     const void *second_key_entry )
+{
+	const libregf_index_key_entry_t *first_entry  = (const libregf_index_key_entry_t *) first_key_entry;
+	const libregf_index_key_entry_t *second_entry = (const libregf_index_key_entry_t *) second_key_entry;
+
+	if( first_entry->path_hash < second_entry->path_hash )
+	{
+		return( -1 );
+	}
+	if( first_entry->path_hash > second_entry->path_hash )
+	{
+		return( 1 );
+	}
+	if( first_entry->path_offset < second_entry->path_offset )
+	{
+		return( -1 );
+	}
+	if( first_entry->path_offset > second_entry->path_offset )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Retrieves the hash of an UTF-8 encoded path
+ * The hash is calculated the same way as the key name hash, including the path separators
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_index_get_utf8_path_hash(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint32_t *path_hash,
+     libcerror_error_t **error )
+{
+	static char *function                        = "libregf_index_get_utf8_path_hash";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t utf8_string_index                     = 0;
+	uint32_t safe_path_hash                      = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path hash.",
+		 function );
+
+		return( -1 );
+	}
+	while( utf8_string_index < utf8_string_length )
+	{
+		if( libuna_unicode_character_copy_from_utf8(
+		     &unicode_character,
+		     utf8_string,
+		     utf8_string_length,
+		     &utf8_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-8 string to Unicode character.",
+			 function );
+
+			return( -1 );
+		}
+		safe_path_hash *= 37;
+		safe_path_hash += (uint32_t) towupper( (wint_t) unicode_character );
+	}
+	*path_hash = safe_path_hash;
+
+	return( 1 );
+}
+
+/* Retrieves the hash of an UTF-16 encoded path
+ * The hash is calculated the same way as the key name hash, including the path separators
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_index_get_utf16_path_hash(
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint32_t *path_hash,
+     libcerror_error_t **error )
+{
+	static char *function                        = "libregf_index_get_utf16_path_hash";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t utf16_string_index                    = 0;
+	uint32_t safe_path_hash                      = 0;
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path hash.",
+		 function );
+
+		return( -1 );
+	}
+	while( utf16_string_index < utf16_string_length )
+	{
+		if( libuna_unicode_character_copy_from_utf16(
+		     &unicode_character,
+		     utf16_string,
+		     utf16_string_length,
+		     &utf16_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-16 string to Unicode character.",
+			 function );
+
+			return( -1 );
+		}
+		safe_path_hash *= 37;
+		safe_path_hash += (uint32_t) towupper( (wint_t) unicode_character );
+	}
+	*path_hash = safe_path_hash;
+
+	return( 1 );
+}
+
+/* Compares an UTF-8 encoded path of the index with an UTF-8 or UTF-16 encoded string
+ * The comparison is case insensitive
+ * Returns 1 if equal, 0 if not or -1 on error
+ */
+int libregf_index_compare_path_with_string(
+     const uint8_t *path,
+     size_t path_size,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcerror_error_t **error )
+{
+	static char *function                               = "libregf_index_compare_path_with_string";
+	libuna_unicode_character_t path_unicode_character   = 0;
+	libuna_unicode_character_t string_unicode_character = 0;
+	size_t path_index                                   = 0;
+	size_t string_index                                 = 0;
+	size_t string_length                                = 0;
+	int result                                          = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string == NULL )
+	 && ( utf16_string == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string != NULL )
+	{
+		string_length = utf8_string_length;
+	}
+	else
+	{
+		string_length = utf16_string_length;
+	}
+	while( ( path_index < path_size )
+	    && ( string_index < string_length ) )
+	{
+		if( libuna_unicode_character_copy_from_utf8(
+		     &path_unicode_character,
+		     path,
+		     path_size,
+		     &path_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy path to Unicode character.",
+			 function );
+
+			return( -1 );
+		}
+		if( utf8_string != NULL )
+		{
+			result = libuna_unicode_character_copy_from_utf8(
+			          &string_unicode_character,
+			          utf8_string,
+			          utf8_string_length,
+			          &string_index,
+			          error );
+		}
+		else
+		{
+			result = libuna_unicode_character_copy_from_utf16(
+			          &string_unicode_character,
+			          utf16_string,
+			          utf16_string_length,
+			          &string_index,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy string to Unicode character.",
+			 function );
+
+			return( -1 );
+		}
+		if( towupper( (wint_t) path_unicode_character ) != towupper( (wint_t) string_unicode_character ) )
+		{
+			return( 0 );
+		}
+	}
+	if( ( path_index < path_size )
+	 || ( string_index < string_length ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Builds an index from the keys of the file
+ * All the hive bins are read
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_index_build(
+     libregf_index_t *index,
+     libregf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     libregf_file_header_t *file_header,
+     libcerror_error_t **error )
+{
+	libregf_index_key_entry_t *key_entries       = NULL;
+	libregf_index_key_entry_t *key_entry         = NULL;
+	libregf_key_descriptor_t *sub_key_descriptor = NULL;
+	libregf_key_item_t *key_item                 = NULL;
+	uint8_t *data                                = NULL;
+	uint8_t *data_iterator                       = NULL;
+	uint8_t *paths_data                          = NULL;
+	uint8_t *visited_keys                        = NULL;
+	void *reallocation                           = NULL;
+	static char *function                        = "libregf_index_build";
+	size_t data_size                             = 0;
+	size_t maximum_paths_data_size               = 0;
+	size_t name_size                             = 0;
+	size_t paths_data_size                       = 0;
+	size_t required_paths_data_size              = 0;
+	size_t visited_keys_size                     = 0;
+	off64_t element_offset                       = 0;
+	uint32_t checksum                            = 0;
+	uint32_t element_size                        = 0;
+	uint32_t key_entry_index                     = 0;
+	uint32_t maximum_number_of_key_entries       = 0;
+	uint32_t number_of_key_entries               = 0;
+	uint32_t parent_key_entry_index              = 0;
+	uint32_t sub_key_offset                      = 0;
+	int hive_bin_index                           = 0;
+	int number_of_sub_key_descriptors            = 0;
+	int sub_key_descriptor_index                 = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( index->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( hive_bins_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bins list.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( libregf_hive_bins_list_read_bins_file_io_handle(
+	     hive_bins_list,
+	     file_io_handle,
+	     -1,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read hive bins.",
+		 function );
+
+		goto on_error;
+	}
+	/* Keys are marked as visited by their 8-byte aligned offset, which protects
+	 * against sub keys that are referenced more than once in a corrupted file
+	 */
+	visited_keys_size = (size_t) ( hive_bins_list->hive_bins_size / 64 ) + 1;
+
+	if( visited_keys_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid visited keys size value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	visited_keys = (uint8_t *) memory_allocate(
+	                            sizeof( uint8_t ) * visited_keys_size );
+
+	if( visited_keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create visited keys.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     visited_keys,
+	     0,
+	     sizeof( uint8_t ) * visited_keys_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear visited keys.",
+		 function );
+
+		goto on_error;
+	}
+	maximum_number_of_key_entries = 1024;
+
+	key_entries = (libregf_index_key_entry_t *) memory_allocate(
+	                                             sizeof( libregf_index_key_entry_t ) * maximum_number_of_key_entries );
+
+	if( key_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create key entries.",
+		 function );
+
+		goto on_error;
+	}
+	maximum_paths_data_size = 64 * 1024;
+
+	paths_data = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * maximum_paths_data_size );
+
+	if( paths_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create paths data.",
+		 function );
+
+		goto on_error;
+	}
+	/* The key entries are filled in breadth-first order, the path of a key entry
+	 * is determined when it is processed, at which time the path of its parent is known
+	 * Until then the path size contains the index of the parent key entry
+	 */
+	key_entries[ 0 ].path_hash   = 0;
+	key_entries[ 0 ].key_offset  = file_header->root_key_offset;
+	key_entries[ 0 ].path_offset = 0;
+	key_entries[ 0 ].path_size   = 0;
+
+	if( (size64_t) file_header->root_key_offset < hive_bins_list->hive_bins_size )
+	{
+		visited_keys[ file_header->root_key_offset / 64 ] |= (uint8_t) ( 1 << ( ( file_header->root_key_offset / 8 ) % 8 ) );
+	}
+	number_of_key_entries = 1;
+
+	for( key_entry_index = 0;
+	     key_entry_index < number_of_key_entries;
+	     key_entry_index++ )
+	{
+		key_entry = &( key_entries[ key_entry_index ] );
+
+		if( libregf_key_item_initialize(
+		     &key_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create key item.",
+			 function );
+
+			goto on_error;
+		}
+		if( libregf_key_item_read(
+		     key_item,
+		     file_io_handle,
+		     hive_bins_list,
+		     (off64_t) key_entry->key_offset,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read key item at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+			 function,
+			 key_entry->key_offset,
+			 key_entry->key_offset );
+
+			goto on_error;
+		}
+		if( key_entry_index > 0 )
+		{
+			parent_key_entry_index = key_entry->path_size;
+
+			if( libregf_key_item_get_utf8_name_size(
+			     key_item,
+			     &name_size,
+			     io_handle->ascii_codepage,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve key: %" PRIu32 " UTF-8 name size.",
+				 function,
+				 key_entry_index );
+
+				goto on_error;
+			}
+			/* The parent path, a separator and the name including the end of string character
+			 */
+			required_paths_data_size = paths_data_size + key_entries[ parent_key_entry_index ].path_size + 1 + name_size;
+
+			if( required_paths_data_size > (size_t) UINT32_MAX )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid paths data size value exceeds maximum.",
+				 function );
+
+				goto on_error;
+			}
+			if( required_paths_data_size > maximum_paths_data_size )
+			{
+				while( maximum_paths_data_size < required_paths_data_size )
+				{
+					maximum_paths_data_size *= 2;
+				}
+				if( maximum_paths_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+					 "%s: invalid maximum paths data size value exceeds maximum.",
+					 function );
+
+					goto on_error;
+				}
+				reallocation = memory_reallocate(
+				                paths_data,
+				                sizeof( uint8_t ) * maximum_paths_data_size );
+
+				if( reallocation == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to resize paths data.",
+					 function );
+
+					goto on_error;
+				}
+				paths_data = (uint8_t *) reallocation;
+			}
+			/* The keys directly below the root key have no leading separator
+			 */
+			if( parent_key_entry_index > 0 )
+			{
+				if( memory_copy(
+				     &( paths_data[ paths_data_size ] ),
+				     &( paths_data[ key_entries[ parent_key_entry_index ].path_offset ] ),
+				     key_entries[ parent_key_entry_index ].path_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy parent path.",
+					 function );
+
+					goto on_error;
+				}
+				key_entry->path_offset = (uint32_t) paths_data_size;
+
+				paths_data_size += key_entries[ parent_key_entry_index ].path_size;
+
+				paths_data[ paths_data_size++ ] = (uint8_t) LIBREGF_SEPARATOR;
+			}
+			else
+			{
+				key_entry->path_offset = (uint32_t) paths_data_size;
+			}
+			if( libregf_key_item_get_utf8_name(
+			     key_item,
+			     &( paths_data[ paths_data_size ] ),
+			     name_size,
+			     io_handle->ascii_codepage,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve key: %" PRIu32 " UTF-8 name.",
+				 function,
+				 key_entry_index );
+
+				goto on_error;
+			}
+			/* The end of string character is not stored
+			 */
+			if( name_size > 0 )
+			{
+				paths_data_size += name_size - 1;
+			}
+			key_entry->path_size = (uint32_t) ( paths_data_size - key_entry->path_offset );
+
+			if( libregf_index_get_utf8_path_hash(
+			     &( paths_data[ key_entry->path_offset ] ),
+			     (size_t) key_entry->path_size,
+			     &( key_entry->path_hash ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve key: %" PRIu32 " path hash.",
+				 function,
+				 key_entry_index );
+
+				goto on_error;
+			}
+		}
+		if( libregf_key_item_get_number_of_sub_key_descriptors(
+		     key_item,
+		     &number_of_sub_key_descriptors,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key: %" PRIu32 " number of sub key descriptors.",
+			 function,
+			 key_entry_index );
+
+			goto on_error;
+		}
+		for( sub_key_descriptor_index = 0;
+		     sub_key_descriptor_index < number_of_sub_key_descriptors;
+		     sub_key_descriptor_index++ )
+		{
+			if( libregf_key_item_get_sub_key_descriptor_by_index(
+			     key_item,
+			     sub_key_descriptor_index,
+			     &sub_key_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve key: %" PRIu32 " sub key descriptor: %d.",
+				 function,
+				 key_entry_index,
+				 sub_key_descriptor_index );
+
+				goto on_error;
+			}
+			if( sub_key_descriptor == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing key: %" PRIu32 " sub key descriptor: %d.",
+				 function,
+				 key_entry_index,
+				 sub_key_descriptor_index );
+
+				goto on_error;
+			}
+			sub_key_offset = sub_key_descriptor->key_offset;
+
+			if( (size64_t) sub_key_offset >= hive_bins_list->hive_bins_size )
+			{
+				continue;
+			}
+			if( ( visited_keys[ sub_key_offset / 64 ] & (uint8_t) ( 1 << ( ( sub_key_offset / 8 ) % 8 ) ) ) != 0 )
+			{
+				continue;
+			}
+			visited_keys[ sub_key_offset / 64 ] |= (uint8_t) ( 1 << ( ( sub_key_offset / 8 ) % 8 ) );
+
+			if( number_of_key_entries >= maximum_number_of_key_entries )
+			{
+				if( maximum_number_of_key_entries >= ( (uint32_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( libregf_index_key_entry_t ) ) ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+					 "%s: invalid maximum number of key entries value exceeds maximum.",
+					 function );
+
+					goto on_error;
+				}
+				maximum_number_of_key_entries *= 2;
+
+				reallocation = memory_reallocate(
+				                key_entries,
+				                sizeof( libregf_index_key_entry_t ) * maximum_number_of_key_entries );
+
+				if( reallocation == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to resize key entries.",
+					 function );
+
+					goto on_error;
+				}
+				key_entries = (libregf_index_key_entry_t *) reallocation;
+				key_entry   = &( key_entries[ key_entry_index ] );
+			}
+			key_entries[ number_of_key_entries ].path_hash   = 0;
+			key_entries[ number_of_key_entries ].key_offset  = sub_key_offset;
+			key_entries[ number_of_key_entries ].path_offset = 0;
+			key_entries[ number_of_key_entries ].path_size   = key_entry_index;
+
+			number_of_key_entries++;
+		}
+		if( libregf_key_item_free(
+		     &key_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free key item.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 visited_keys );
+
+	visited_keys = NULL;
+
+	qsort(
+	 key_entries,
+	 (size_t) number_of_key_entries,
+	 sizeof( libregf_index_key_entry_t ),
+	 &libregf_index_key_entry_compare );
+
+	data_size = sizeof( regf_index_file_header_t )
+	          + ( sizeof( regf_index_hive_bin_entry_t ) * (size_t) hive_bins_list->number_of_hive_bins )
+	          + ( sizeof( regf_index_key_entry_t ) * (size_t) number_of_key_entries )
+	          + paths_data_size;
+
+	if( ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	 || ( data_size > (size_t) UINT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	data_iterator = &( data[ sizeof( regf_index_file_header_t ) ] );
+
+	for( hive_bin_index = 0;
+	     hive_bin_index < hive_bins_list->number_of_hive_bins;
+	     hive_bin_index++ )
+	{
+		if( libregf_hive_bins_list_get_hive_bin_range_by_index(
+		     hive_bins_list,
+		     hive_bin_index,
+		     &element_offset,
+		     &element_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve hive bin: %d.",
+			 function,
+			 hive_bin_index );
+
+			goto on_error;
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (regf_index_hive_bin_entry_t *) data_iterator )->file_offset,
+		 (uint32_t) element_offset );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (regf_index_hive_bin_entry_t *) data_iterator )->size,
+		 element_size );
+
+		data_iterator += sizeof( regf_index_hive_bin_entry_t );
+	}
+	for( key_entry_index = 0;
+	     key_entry_index < number_of_key_entries;
+	     key_entry_index++ )
+	{
+		key_entry = &( key_entries[ key_entry_index ] );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (regf_index_key_entry_t *) data_iterator )->path_hash,
+		 key_entry->path_hash );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (regf_index_key_entry_t *) data_iterator )->key_offset,
+		 key_entry->key_offset );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (regf_index_key_entry_t *) data_iterator )->path_offset,
+		 key_entry->path_offset );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (regf_index_key_entry_t *) data_iterator )->path_size,
+		 key_entry->path_size );
+
+		data_iterator += sizeof( regf_index_key_entry_t );
+	}
+	if( paths_data_size > 0 )
+	{
+		if( memory_copy(
+		     data_iterator,
+		     paths_data,
+		     paths_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy paths data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 paths_data );
+
+	paths_data = NULL;
+
+	memory_free(
+	 key_entries );
+
+	key_entries = NULL;
+
+	if( libregf_checksum_calculate_little_endian_xor32(
+	     &checksum,
+	     &( data[ sizeof( regf_index_file_header_t ) ] ),
+	     data_size - sizeof( regf_index_file_header_t ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate XOR-32 checksum.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     ( (regf_index_file_header_t *) data )->signature,
+	     regf_index_file_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (regf_index_file_header_t *) data )->format_version,
+	 LIBREGF_INDEX_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (regf_index_file_header_t *) data )->primary_sequence_number,
+	 file_header->primary_sequence_number );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (regf_index_file_header_t *) data )->secondary_sequence_number,
+	 file_header->secondary_sequence_number );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (regf_index_file_header_t *) data )->file_header_checksum,
+	 file_header->checksum );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (regf_index_file_header_t *) data )->hive_bins_size,
+	 file_header->hive_bins_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (regf_index_file_header_t *) data )->root_key_offset,
+	 file_header->root_key_offset );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (regf_index_file_header_t *) data )->ascii_codepage,
+	 (uint32_t) io_handle->ascii_codepage );
+
+	if( ( hive_bins_list->flags & LIBREGF_HIVE_BINS_FLAG_IS_CORRUPTED ) != 0 )
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (regf_index_file_header_t *) data )->flags,
+		 LIBREGF_INDEX_FLAG_HIVE_BINS_ARE_CORRUPTED );
+	}
+	else
+	{
+		byte_stream_copy_from_uint32_little_endian(
+		 ( (regf_index_file_header_t *) data )->flags,
+		 0 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (regf_index_file_header_t *) data )->number_of_hive_bins,
+	 (uint32_t) hive_bins_list->number_of_hive_bins );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (regf_index_file_header_t *) data )->number_of_keys,
+	 number_of_key_entries );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (regf_index_file_header_t *) data )->paths_data_size,
+	 (uint32_t) paths_data_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (regf_index_file_header_t *) data )->checksum,
+	 checksum );
+
+	if( libregf_index_read_data(
+	     index,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index data.",
+		 function );
+
+		goto on_error;
+	}
+	index->data      = data;
+	index->data_size = data_size;
+
+	return( 1 );
+
+on_error:
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	if( key_item != NULL )
+	{
+		libregf_key_item_free(
+		 &key_item,
+		 NULL );
+	}
+	if( paths_data != NULL )
+	{
+		memory_free(
+		 paths_data );
+	}
+	if( key_entries != NULL )
+	{
+		memory_free(
+		 key_entries );
+	}
+	if( visited_keys != NULL )
+	{
+		memory_free(
+		 visited_keys );
+	}
+	return( -1 );
+}
+
+/* Reads the index data
+ * The data is referenced by the index and must remain available while the index is used
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_index_read_data(
+     libregf_index_t *index,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function       = "libregf_index_read_data";
+	size64_t required_data_size = 0;
+	uint32_t calculated_checksum = 0;
+	uint32_t format_version     = 0;
+	uint32_t stored_checksum    = 0;
+	uint32_t value_32bit        = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( regf_index_file_header_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     ( (regf_index_file_header_t *) data )->signature,
+	     regf_index_file_signature,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (regf_index_file_header_t *) data )->format_version,
+	 format_version );
+
+	if( format_version != LIBREGF_INDEX_FORMAT_VERSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (regf_index_file_header_t *) data )->primary_sequence_number,
+	 index->primary_sequence_number );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (regf_index_file_header_t *) data )->secondary_sequence_number,
+	 index->secondary_sequence_number );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (regf_index_file_header_t *) data )->file_header_checksum,
+	 index->file_header_checksum );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (regf_index_file_header_t *) data )->hive_bins_size,
+	 index->hive_bins_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (regf_index_file_header_t *) data )->root_key_offset,
+	 index->root_key_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (regf_index_file_header_t *) data )->ascii_codepage,
+	 value_32bit );
+
+	index->ascii_codepage = (int) value_32bit;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (regf_index_file_header_t *) data )->flags,
+	 index->flags );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (regf_index_file_header_t *) data )->number_of_hive_bins,
+	 index->number_of_hive_bins );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (regf_index_file_header_t *) data )->number_of_keys,
+	 index->number_of_keys );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (regf_index_file_header_t *) data )->paths_data_size,
+	 index->paths_data_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (regf_index_file_header_t *) data )->checksum,
+	 stored_checksum );
+
+	required_data_size = (size64_t) sizeof( regf_index_file_header_t )
+	                   + ( (size64_t) sizeof( regf_index_hive_bin_entry_t ) * index->number_of_hive_bins )
+	                   + ( (size64_t) sizeof( regf_index_key_entry_t ) * index->number_of_keys )
+	                   + index->paths_data_size;
+
+	if( required_data_size != (size64_t) data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value does not match the number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( libregf_checksum_calculate_little_endian_xor32(
+	     &calculated_checksum,
+	     &( data[ sizeof( regf_index_file_header_t ) ] ),
+	     data_size - sizeof( regf_index_file_header_t ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate XOR-32 checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( stored_checksum != calculated_checksum )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_CHECKSUM_MISMATCH,
+		 "%s: mismatch in checksum ( 0x%08" PRIx32 " != 0x%08" PRIx32 " ).",
+		 function,
+		 stored_checksum,
+		 calculated_checksum );
+
+		return( -1 );
+	}
+	index->hive_bin_entries_data = &( data[ sizeof( regf_index_file_header_t ) ] );
+	index->key_entries_data      = &( index->hive_bin_entries_data[ sizeof( regf_index_hive_bin_entry_t ) * index->number_of_hive_bins ] );
+	index->paths_data            = &( index->key_entries_data[ sizeof( regf_index_key_entry_t ) * index->number_of_keys ] );
+
+	return( 1 );
+}
+
+/* Reads the index
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_index_read_file_io_handle(
+     libregf_index_t *index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	uint8_t *data         = NULL;
+	static char *function = "libregf_index_read_file_io_handle";
+	size64_t file_size    = 0;
+	ssize_t read_count    = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( index->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( file_size < (size64_t) sizeof( regf_index_file_header_t ) )
+	 || ( file_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * (size_t) file_size );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              data,
+	              (size_t) file_size,
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) file_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index data at offset: 0 (0x00000000).",
+		 function );
+
+		goto on_error;
+	}
+	if( libregf_index_read_data(
+	     index,
+	     data,
+	     (size_t) file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index data.",
+		 function );
+
+		goto on_error;
+	}
+	index->data      = data;
+	index->data_size = (size_t) file_size;
+
+	return( 1 );
+
+on_error:
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
+/* Writes the index
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_index_write_file_io_handle(
+     libregf_index_t *index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_index_write_file_io_handle";
+	ssize_t write_count   = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( index->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	write_count = libbfio_handle_write_buffer(
+	               file_io_handle,
+	               index->data,
+	               index->data_size,
+	               error );
+
+	if( write_count != (ssize_t) index->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write index data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Determines if the index was built from a file with a specific file header
+ * The sequence numbers and checksum of the file header change when the file is modified
+ * Returns 1 if the index matches the file header, 0 if not or -1 on error
+ */
+int libregf_index_matches_file_header(
+     libregf_index_t *index,
+     libregf_file_header_t *file_header,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_index_matches_file_header";
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( index->primary_sequence_number != file_header->primary_sequence_number )
+	 || ( index->secondary_sequence_number != file_header->secondary_sequence_number )
+	 || ( index->file_header_checksum != file_header->checksum )
+	 || ( index->hive_bins_size != file_header->hive_bins_size )
+	 || ( index->root_key_offset != file_header->root_key_offset )
+	 || ( index->ascii_codepage != ascii_codepage ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Reads the hive bins that were not read yet from the hive bin entries of the index
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_index_read_hive_bins(
+     libregf_index_t *index,
+     libregf_hive_bins_list_t *hive_bins_list,
+     libcerror_error_t **error )
+{
+	const uint8_t *hive_bin_entry_data = NULL;
+	static char *function              = "libregf_index_read_hive_bins";
+	uint32_t file_offset               = 0;
+	uint32_t hive_bin_index            = 0;
+	uint32_t size                      = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( index->hive_bin_entries_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index - missing hive bin entries data.",
+		 function );
+
+		return( -1 );
+	}
+	if( hive_bins_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bins list.",
+		 function );
+
+		return( -1 );
+	}
+	if( hive_bins_list->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid hive bins list - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( hive_bins_list->remaining_hive_bins_size == 0 )
+	{
+		return( 1 );
+	}
+	for( hive_bin_index = (uint32_t) hive_bins_list->number_of_sequential_hive_bins;
+	     hive_bin_index < index->number_of_hive_bins;
+	     hive_bin_index++ )
+	{
+		hive_bin_entry_data = &( index->hive_bin_entries_data[ sizeof( regf_index_hive_bin_entry_t ) * hive_bin_index ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (regf_index_hive_bin_entry_t *) hive_bin_entry_data )->file_offset,
+		 file_offset );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (regf_index_hive_bin_entry_t *) hive_bin_entry_data )->size,
+		 size );
+
+		if( ( (off64_t) file_offset < hive_bins_list->next_hive_bin_offset )
+		 || ( size == 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid hive bin: %" PRIu32 " entry value out of bounds.",
+			 function,
+			 hive_bin_index );
+
+			return( -1 );
+		}
+		if( libregf_hive_bins_list_append_bin(
+		     hive_bins_list,
+		     (off64_t) file_offset,
+		     size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append hive bin: %" PRIu32 ".",
+			 function,
+			 hive_bin_index );
+
+			return( -1 );
+		}
+		hive_bins_list->next_hive_bin_offset = (off64_t) file_offset + size;
+	}
+	hive_bins_list->remaining_hive_bins_size = 0;
+
+	if( ( index->flags & LIBREGF_INDEX_FLAG_HIVE_BINS_ARE_CORRUPTED ) != 0 )
+	{
+		hive_bins_list->flags            |= LIBREGF_HIVE_BINS_FLAG_IS_CORRUPTED;
+		hive_bins_list->io_handle->flags |= LIBREGF_IO_HANDLE_FLAG_IS_CORRUPTED;
+	}
+	return( 1 );
+}
+
+/* Retrieves the named key offset for a specific UTF-8 or UTF-16 encoded path
+ * Returns 1 if successful, 0 if no such key or -1 on error
+ */
+int libregf_index_get_key_offset_by_path(
+     libregf_index_t *index,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint32_t *key_offset,
+     libcerror_error_t **error )
+{
+	const uint8_t *key_entry_data = NULL;
+	static char *function         = "libregf_index_get_key_offset_by_path";
+	uint32_t entry_path_hash      = 0;
+	uint32_t entry_path_offset    = 0;
+	uint32_t entry_path_size      = 0;
+	uint32_t key_entry_index      = 0;
+	uint32_t lower_index          = 0;
+	uint32_t path_hash            = 0;
+	uint32_t upper_index          = 0;
+	int result                    = 0;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( index->key_entries_data == NULL )
+	 || ( index->paths_data == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid index - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string != NULL )
+	{
+		result = libregf_index_get_utf8_path_hash(
+		          utf8_string,
+		          utf8_string_length,
+		          &path_hash,
+		          error );
+	}
+	else
+	{
+		result = libregf_index_get_utf16_path_hash(
+		          utf16_string,
+		          utf16_string_length,
+		          &path_hash,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve path hash.",
+		 function );
+
+		return( -1 );
+	}
+	/* Find the first key entry with the path hash
+	 */
+	lower_index = 0;
+	upper_index = index->number_of_keys;
+
+	while( lower_index < upper_index )
+	{
+		key_entry_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+		key_entry_data  = &( index->key_entries_data[ sizeof( regf_index_key_entry_t ) * key_entry_index ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (regf_index_key_entry_t *) key_entry_data )->path_hash,
+		 entry_path_hash );
+
+		if( entry_path_hash < path_hash )
+		{
+			lower_index = key_entry_index + 1;
+		}
+		else
+		{
+			upper_index = key_entry_index;
+		}
+	}
+	for( key_entry_index = lower_index;
+	     key_entry_index < index->number_of_keys;
+	     key_entry_index++ )
+	{
+		key_entry_data = &( index->key_entries_data[ sizeof( regf_index_key_entry_t ) * key_entry_index ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (regf_index_key_entry_t *) key_entry_data )->path_hash,
+		 entry_path_hash );
+
+		if( entry_path_hash != path_hash )
+		{
+			break;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (regf_index_key_entry_t *) key_entry_data )->path_offset,
+		 entry_path_offset );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (regf_index_key_entry_t *) key_entry_data )->path_size,
+		 entry_path_size );
+
+		if( ( entry_path_offset > index->paths_data_size )
+		 || ( entry_path_size > ( index->paths_data_size - entry_path_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid key entry: %" PRIu32 " path value out of bounds.",
+			 function,
+			 key_entry_index );
+
+			return( -1 );
+		}
+		result = libregf_index_compare_path_with_string(
+		          &( index->paths_data[ entry_path_offset ] ),
+		          (size_t) entry_path_size,
+		          utf8_string,
+		          utf8_string_length,
+		          utf16_string,
+		          utf16_string_length,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare key entry: %" PRIu32 " path.",
+			 function,
+			 key_entry_index );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 ( (regf_index_key_entry_t *) key_entry_data )->key_offset,
+			 *key_offset );
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Retrieves the named key offset for a specific UTF-8 encoded path
+ * The path separator is the \ character, a leading and a trailing separator are ignored
+ * Returns 1 if successful, 0 if no such key or -1 on error
+ */
+int libregf_index_get_key_offset_by_utf8_path(
+     libregf_index_t *index,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint32_t *key_offset,
+     libcerror_error_t **error )
+{
+	static char *function    = "libregf_index_get_key_offset_by_utf8_path";
+	size_t utf8_string_end   = 0;
+	size_t utf8_string_start = 0;
+	int result               = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( utf8_string_end < utf8_string_length )
+	    && ( utf8_string[ utf8_string_end ] != 0 ) )
+	{
+		utf8_string_end++;
+	}
+	if( ( utf8_string_end > 0 )
+	 && ( utf8_string[ 0 ] == (uint8_t) LIBREGF_SEPARATOR ) )
+	{
+		utf8_string_start++;
+	}
+	if( ( utf8_string_end > utf8_string_start )
+	 && ( utf8_string[ utf8_string_end - 1 ] == (uint8_t) LIBREGF_SEPARATOR ) )
+	{
+		utf8_string_end--;
+	}
+	result = libregf_index_get_key_offset_by_path(
+	          index,
+	          &( utf8_string[ utf8_string_start ] ),
+	          utf8_string_end - utf8_string_start,
+	          NULL,
+	          0,
+	          key_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve key offset by path.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the named key offset for a specific UTF-16 encoded path
+ * The path separator is the \ character, a leading and a trailing separator are ignored
+ * Returns 1 if successful, 0 if no such key or -1 on error
+ */
+int libregf_index_get_key_offset_by_utf16_path(
+     libregf_index_t *index,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint32_t *key_offset,
+     libcerror_error_t **error )
+{
+	static char *function     = "libregf_index_get_key_offset_by_utf16_path";
+	size_t utf16_string_end   = 0;
+	size_t utf16_string_start = 0;
+	int result                = 0;
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( utf16_string_end < utf16_string_length )
+	    && ( utf16_string[ utf16_string_end ] != 0 ) )
+	{
+		utf16_string_end++;
+	}
+	if( ( utf16_string_end > 0 )
+	 && ( utf16_string[ 0 ] == (uint16_t) LIBREGF_SEPARATOR ) )
+	{
+		utf16_string_start++;
+	}
+	if( ( utf16_string_end > utf16_string_start )
+	 && ( utf16_string[ utf16_string_end - 1 ] == (uint16_t) LIBREGF_SEPARATOR ) )
+	{
+		utf16_string_end--;
+	}
+	result = libregf_index_get_key_offset_by_path(
+	          index,
+	          NULL,
+	          0,
+	          &( utf16_string[ utf16_string_start ] ),
+	          utf16_string_end - utf16_string_start,
+	          key_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve key offset by path.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
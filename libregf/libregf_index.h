@@ -0,0 +1,221 @@
+/*
+ * Index functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBREGF_INDEX_H )
+#define _LIBREGF_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libregf_file_header.h"
+#include "libregf_hive_bins_list.h"
+#include "libregf_io_handle.h"
+#include "libregf_libbfio.h"
+#include "libregf_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libregf_index_key_entry libregf_index_key_entry_t;
+
+struct libregf_index_key_entry
+{
+	/* The hash of the upper case path
+	 */
+	uint32_t path_hash;
+
+	/* The offset of the named key
+	 */
+	uint32_t key_offset;
+
+	/* The offset of the path relative to the start of the paths data
+	 */
+	uint32_t path_offset;
+
+	/* The size of the path
+	 */
+	uint32_t path_size;
+};
+
+typedef struct libregf_index libregf_index_t;
+
+struct libregf_index
+{
+	/* The primary sequence number of the file header
+	 */
+	uint32_t primary_sequence_number;
+
+	/* The secondary sequence number of the file header
+	 */
+	uint32_t secondary_sequence_number;
+
+	/* The checksum of the file header
+	 */
+	uint32_t file_header_checksum;
+
+	/* The hive bins size of the file header
+	 */
+	uint32_t hive_bins_size;
+
+	/* The root key offset of the file header
+	 */
+	uint32_t root_key_offset;
+
+	/* The codepage used to convert the key names to UTF-8
+	 */
+	int ascii_codepage;
+
+	/* The flags
+	 */
+	uint32_t flags;
+
+	/* The number of hive bins
+	 */
+	uint32_t number_of_hive_bins;
+
+	/* The number of keys
+	 */
+	uint32_t number_of_keys;
+
+	/* The paths data size
+	 */
+	uint32_t paths_data_size;
+
+	/* The data, which contains the index file header, the hive bin entries,
+	 * the key entries sorted by path hash and the paths data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The hive bin entries data
+	 */
+	const uint8_t *hive_bin_entries_data;
+
+	/* The key entries data
+	 */
+	const uint8_t *key_entries_data;
+
+	/* The paths data
+	 */
+	const uint8_t *paths_data;
+};
+
+int libregf_index_initialize(
+     libregf_index_t **index,
+     libcerror_error_t **error );
+
+int libregf_index_free(
+     libregf_index_t **index,
+     libcerror_error_t **error );
+
+int libregf_index_key_entry_compare(
+     const void *first_key_entry,
+     const void *second_key_entry );
+
+int libregf_index_get_utf8_path_hash(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint32_t *path_hash,
+     libcerror_error_t **error );
+
+int libregf_index_get_utf16_path_hash(
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint32_t *path_hash,
+     libcerror_error_t **error );
+
+int libregf_index_compare_path_with_string(
+     const uint8_t *path,
+     size_t path_size,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcerror_error_t **error );
+
+int libregf_index_build(
+     libregf_index_t *index,
+     libregf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     libregf_file_header_t *file_header,
+     libcerror_error_t **error );
+
+int libregf_index_read_data(
+     libregf_index_t *index,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libregf_index_read_file_io_handle(
+     libregf_index_t *index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libregf_index_write_file_io_handle(
+     libregf_index_t *index,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libregf_index_matches_file_header(
+     libregf_index_t *index,
+     libregf_file_header_t *file_header,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+int libregf_index_read_hive_bins(
+     libregf_index_t *index,
+     libregf_hive_bins_list_t *hive_bins_list,
+     libcerror_error_t **error );
+
+int libregf_index_get_key_offset_by_path(
+     libregf_index_t *index,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint32_t *key_offset,
+     libcerror_error_t **error );
+
+int libregf_index_get_key_offset_by_utf8_path(
+     libregf_index_t *index,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint32_t *key_offset,
+     libcerror_error_t **error );
+
+int libregf_index_get_key_offset_by_utf16_path(
+     libregf_index_t *index,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint32_t *key_offset,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBREGF_INDEX_H ) */
+
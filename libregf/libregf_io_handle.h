@@ -60,6 +60,14 @@ struct libregf_io_handle
 	/* The codepage of the extended ASCII strings
 	 */
 	int ascii_codepage;
+
+	/* The memory mapped file data, which is NULL if the file is not memory mapped
+	 */
+	const uint8_t *mapped_data;
+
+	/* The memory mapped file data size
+	 */
+	size64_t mapped_data_size;
 };
 
 int libregf_io_handle_initialize(
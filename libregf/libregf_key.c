@@ -28,6 +28,7 @@
 #endif
 
 #include "libregf_definitions.h"
+#include "libregf_hash_table.h"
 #include "libregf_io_handle.h"
 #include "libregf_key.h"
 #include "libregf_key_item.h"
@@ -42,6 +43,7 @@
 
 /* Creates a key
  * Make sure the value key is referencing, is set to NULL
+ * The named key hash is used to validate the named key, where 0 represents not known
  * Returns 1 if successful or -1 on error
  */
 int libregf_key_initialize(
@@ -49,6 +51,7 @@ int libregf_key_initialize(
      libregf_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      uint32_t key_offset,
+     uint32_t named_key_hash,
      libregf_hive_bins_list_t *hive_bins_list,
      libcerror_error_t **error )
 {
@@ -119,52 +122,72 @@ int libregf_key_initialize(
 
 		return( -1 );
 	}
-	if( libregf_key_item_initialize(
-	     &( internal_key->key_item ),
-	     error ) != 1 )
+	if( hive_bins_list != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create key item.",
-		 function );
-
-		goto on_error;
+		internal_key->key_item_cache = (libregf_key_item_cache_t *) hive_bins_list->key_item_cache;
 	}
-	if( libregf_key_item_read(
-	     internal_key->key_item,
-	     file_io_handle,
-	     hive_bins_list,
-	     key_offset,
-	     (uint32_t) 0, /* TODO pass hash or key descriptor */
-	     error ) != 1 )
+	if( internal_key->key_item_cache != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read key item at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 key_offset,
-		 key_offset );
+		if( libregf_key_item_cache_get_key_item(
+		     internal_key->key_item_cache,
+		     file_io_handle,
+		     hive_bins_list,
+		     key_offset,
+		     named_key_hash,
+		     &( internal_key->key_item ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key item at offset: %" PRIu32 " (0x%08" PRIx32 ") from cache.",
+			 function,
+			 key_offset,
+			 key_offset );
 
-		goto on_error;
+			goto on_error;
+		}
 	}
-#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_initialize(
-	     &( internal_key->read_write_lock ),
-	     error ) != 1 )
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to initialize read/write lock.",
-		 function );
+		if( libregf_key_item_initialize(
+		     &( internal_key->key_item ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create key item.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
+		if( libregf_key_item_read(
+		     internal_key->key_item,
+		     file_io_handle,
+		     hive_bins_list,
+		     key_offset,
+		     named_key_hash,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read key item at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 key_offset,
+			 key_offset );
+
+			goto on_error;
+		}
 	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	/* Keys that share a key item also share its read/write lock
+	 */
+	internal_key->read_write_lock = internal_key->key_item->read_write_lock;
 #endif
 	internal_key->file_io_handle = file_io_handle;
 	internal_key->io_handle      = io_handle;
@@ -180,9 +203,19 @@ on_error:
 	{
 		if( internal_key->key_item != NULL )
 		{
-			libregf_key_item_free(
-			 &( internal_key->key_item ),
-			 NULL );
+			if( internal_key->key_item_cache != NULL )
+			{
+				libregf_key_item_cache_release_key_item(
+				 internal_key->key_item_cache,
+				 key_offset,
+				 NULL );
+			}
+			else
+			{
+				libregf_key_item_free(
+				 &( internal_key->key_item ),
+				 NULL );
+			}
 		}
 		memory_free(
 		 internal_key );
@@ -217,26 +250,29 @@ int libregf_key_free(
 		internal_key = (libregf_internal_key_t *) *key;
 		*key         = NULL;
 
-#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-		if( libcthreads_read_write_lock_free(
-		     &( internal_key->read_write_lock ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free read/write lock.",
-			 function );
-
-			result = -1;
-		}
-#endif
 		/* The io_handle, file_io_handle and hive_bins_list references are freed elsewhere
+		 * The read/write lock is freed together with the key item
 		 */
-		if( libregf_key_item_free(
-		     &( internal_key->key_item ),
-		     error ) != 1 )
+		if( internal_key->key_item_cache != NULL )
+		{
+			if( libregf_key_item_cache_release_key_item(
+			     internal_key->key_item_cache,
+			     internal_key->key_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release key item.",
+				 function );
+
+				result = -1;
+			}
+		}
+		else if( libregf_key_item_free(
+		          &( internal_key->key_item ),
+		          error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -1478,6 +1514,81 @@ int libregf_key_get_last_written_time(
 	return( result );
 }
 
+/* Retrieves the security key offset
+ * Keys with the same security key offset share the same security descriptor
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libregf_key_get_security_key_offset(
+     libregf_key_t *key,
+     uint32_t *security_key_offset,
+     libcerror_error_t **error )
+{
+	libregf_internal_key_t *internal_key = NULL;
+	static char *function                = "libregf_key_get_security_key_offset";
+	int result                           = 0;
+
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	internal_key = (libregf_internal_key_t *) key;
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_key->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libregf_key_item_get_security_key_offset(
+	          internal_key->key_item,
+	          security_key_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve security key offset.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_key->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
 /* Retrieves the security descriptor size
  * Returns 1 if successful, 0 if no such value or -1 on error
  */
@@ -1762,6 +1873,20 @@ int libregf_internal_key_get_value(
 
 		return( -1 );
 	}
+	if( libregf_key_item_read_parts(
+	     internal_key->key_item,
+	     LIBREGF_KEY_ITEM_READ_FLAG_VALUES_LIST,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read values list.",
+		 function );
+
+		return( -1 );
+	}
 	if( libfdata_list_get_list_element_by_index(
 	     internal_key->key_item->values_list,
 	     value_index,
@@ -2046,15 +2171,18 @@ int libregf_internal_key_get_value_by_utf8_name(
      libcerror_error_t **error )
 {
 	libfdata_list_element_t *values_list_element = NULL;
+	libregf_hash_table_t *name_hash_table        = NULL;
 	libregf_value_item_t *value_item             = NULL;
 	static char *function                        = "libregf_internal_key_get_value_by_utf8_name";
 	libuna_unicode_character_t unicode_character = 0;
+	intptr_t hash_table_value                    = 0;
 	size64_t size                                = 0;
 	size_t utf8_string_index                     = 0;
 	off64_t offset                               = 0;
 	uint32_t flags                               = 0;
 	uint32_t name_hash                           = 0;
 	int file_index                               = 0;
+	int hash_table_entry_index                   = 0;
 	int number_of_values                         = 0;
 	int result                                   = 0;
 	int value_index                              = 0;
@@ -2176,9 +2304,44 @@ int libregf_internal_key_get_value_by_utf8_name(
 		name_hash *= 37;
 		name_hash += (uint32_t) towupper( (wint_t) unicode_character );
 	}
-	for( value_index = 0;
-	     value_index < number_of_values;
-	     value_index++ )
+	result = libregf_key_item_get_values_name_hash_table(
+	          internal_key->key_item,
+	          internal_key->file_io_handle,
+	          &name_hash_table,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve values name hash table.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		/* Only the values with a matching name hash need to be compared
+		 */
+		result = libregf_hash_table_get_first_value(
+		          name_hash_table,
+		          name_hash,
+		          &hash_table_entry_index,
+		          &hash_table_value,
+		          error );
+
+		if( result == 1 )
+		{
+			value_index = (int) hash_table_value;
+		}
+	}
+	else
+	{
+		result = 1;
+	}
+	while( result == 1 )
 	{
 		if( libfdata_list_get_list_element_by_index(
 		     internal_key->key_item->values_list,
@@ -2237,8 +2400,42 @@ int libregf_internal_key_get_value_by_utf8_name(
 		{
 			break;
 		}
+		if( name_hash_table != NULL )
+		{
+			result = libregf_hash_table_get_next_value(
+			          name_hash_table,
+			          name_hash,
+			          &hash_table_entry_index,
+			          &hash_table_value,
+			          error );
+
+			if( result == 1 )
+			{
+				value_index = (int) hash_table_value;
+			}
+		}
+		else
+		{
+			value_index++;
+
+			if( value_index < number_of_values )
+			{
+				result = 1;
+			}
+		}
 	}
-	if( value_index >= number_of_values )
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value index by name hash.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
 	{
 		return( 0 );
 	}
@@ -2377,15 +2574,18 @@ int libregf_internal_key_get_value_by_utf16_name(
      libcerror_error_t **error )
 {
 	libfdata_list_element_t *values_list_element = NULL;
+	libregf_hash_table_t *name_hash_table        = NULL;
 	libregf_value_item_t *value_item             = NULL;
 	static char *function                        = "libregf_internal_key_get_value_by_utf16_name";
 	libuna_unicode_character_t unicode_character = 0;
+	intptr_t hash_table_value                    = 0;
 	size64_t size                                = 0;
 	size_t utf16_string_index                    = 0;
 	off64_t offset                               = 0;
 	uint32_t flags                               = 0;
 	uint32_t name_hash                           = 0;
 	int file_index                               = 0;
+	int hash_table_entry_index                   = 0;
 	int number_of_values                         = 0;
 	int result                                   = 0;
 	int value_index                              = 0;
@@ -2507,9 +2707,44 @@ int libregf_internal_key_get_value_by_utf16_name(
 		name_hash *= 37;
 		name_hash += (uint32_t) towupper( (wint_t) unicode_character );
 	}
-	for( value_index = 0;
-	     value_index < number_of_values;
-	     value_index++ )
+	result = libregf_key_item_get_values_name_hash_table(
+	          internal_key->key_item,
+	          internal_key->file_io_handle,
+	          &name_hash_table,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve values name hash table.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		/* Only the values with a matching name hash need to be compared
+		 */
+		result = libregf_hash_table_get_first_value(
+		          name_hash_table,
+		          name_hash,
+		          &hash_table_entry_index,
+		          &hash_table_value,
+		          error );
+
+		if( result == 1 )
+		{
+			value_index = (int) hash_table_value;
+		}
+	}
+	else
+	{
+		result = 1;
+	}
+	while( result == 1 )
 	{
 		if( libfdata_list_get_list_element_by_index(
 		     internal_key->key_item->values_list,
@@ -2568,8 +2803,42 @@ int libregf_internal_key_get_value_by_utf16_name(
 		{
 			break;
 		}
+		if( name_hash_table != NULL )
+		{
+			result = libregf_hash_table_get_next_value(
+			          name_hash_table,
+			          name_hash,
+			          &hash_table_entry_index,
+			          &hash_table_value,
+			          error );
+
+			if( result == 1 )
+			{
+				value_index = (int) hash_table_value;
+			}
+		}
+		else
+		{
+			value_index++;
+
+			if( value_index < number_of_values )
+			{
+				result = 1;
+			}
+		}
 	}
-	if( value_index >= number_of_values )
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value index by name hash.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
 	{
 		return( 0 );
 	}
@@ -2695,6 +2964,240 @@ int libregf_key_get_value_by_utf16_name(
 	return( result );
 }
 
+/* Retrieves the value at a specific offset
+ * The offset is the file offset as returned by libregf_value_get_offset
+ * Creates a new value
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libregf_internal_key_get_value_by_offset(
+     libregf_internal_key_t *internal_key,
+     off64_t value_offset,
+     libregf_value_t **value,
+     libcerror_error_t **error )
+{
+	libfdata_list_element_t *values_list_element = NULL;
+	static char *function                        = "libregf_internal_key_get_value_by_offset";
+	size64_t size                                = 0;
+	off64_t offset                               = 0;
+	uint32_t flags                               = 0;
+	int file_index                               = 0;
+	int number_of_values                         = 0;
+	int value_index                              = 0;
+
+	if( internal_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_key->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_key->key_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key - missing key item.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( *value != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libregf_key_item_get_number_of_values(
+	     internal_key->key_item,
+	     &number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of values.",
+		 function );
+
+		return( -1 );
+	}
+	/* Only the values list of the key is searched, the value cells are not read
+	 */
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		if( libfdata_list_get_list_element_by_index(
+		     internal_key->key_item->values_list,
+		     value_index,
+		     &values_list_element,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d.",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+		if( libfdata_list_element_get_data_range(
+		     values_list_element,
+		     &file_index,
+		     &offset,
+		     &size,
+		     &flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d data range.",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+		offset += internal_key->io_handle->hive_bins_list_offset + 4;
+
+		if( offset != value_offset )
+		{
+			continue;
+		}
+		if( libregf_internal_key_get_value(
+		     internal_key,
+		     value_index,
+		     value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d.",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Retrieves the value at a specific offset
+ * The offset is the file offset as returned by libregf_value_get_offset
+ * Creates a new value
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libregf_key_get_value_by_offset(
+     libregf_key_t *key,
+     off64_t value_offset,
+     libregf_value_t **value,
+     libcerror_error_t **error )
+{
+	libregf_internal_key_t *internal_key = NULL;
+	static char *function                = "libregf_key_get_value_by_offset";
+	int result                           = 0;
+
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	internal_key = (libregf_internal_key_t *) key;
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_key->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libregf_internal_key_get_value_by_offset(
+	          internal_key,
+	          value_offset,
+	          value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value by offset.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_key->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
 /* Retrieves the number of sub keys
  * Returns 1 if successful or -1 on error
  */
@@ -2865,6 +3368,7 @@ int libregf_key_get_sub_key(
 	          internal_key->io_handle,
 	          internal_key->file_io_handle,
 	          sub_key_descriptor->key_offset,
+	          sub_key_descriptor->name_hash,
 	          internal_key->hive_bins_list,
 	          error ) != 1 )
 	{
@@ -2994,6 +3498,7 @@ int libregf_key_get_sub_key_by_index(
 	          internal_key->io_handle,
 	          internal_key->file_io_handle,
 	          sub_key_descriptor->key_offset,
+	          sub_key_descriptor->name_hash,
 	          internal_key->hive_bins_list,
 	          error ) != 1 )
 	{
@@ -3158,6 +3663,7 @@ int libregf_internal_key_get_sub_key_by_utf8_name(
 		     internal_key->io_handle,
 		     internal_key->file_io_handle,
 		     sub_key_descriptor->key_offset,
+		     sub_key_descriptor->name_hash,
 		     internal_key->hive_bins_list,
 		     error ) != 1 )
 		{
@@ -3282,21 +3788,9 @@ int libregf_key_get_sub_key_by_utf8_path(
 	}
 	internal_key = (libregf_internal_key_t *) key;
 
-#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_key->read_write_lock,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
-		 function );
-
-		return( -1 );
-	}
-#endif
+	/* The read/write lock is not grabbed here since it is shared with the key item
+	 * and the key tree grabs the lock of every key item it traverses
+	 */
 	result = libregf_key_tree_get_sub_key_by_utf8_path(
 	          internal_key->io_handle,
 	          internal_key->file_io_handle,
@@ -3305,7 +3799,7 @@ int libregf_key_get_sub_key_by_utf8_path(
 	          utf8_string,
 	          utf8_string_length,
 	          sub_key,
-		  error );
+	          error );
 
 	if( result == -1 )
 	{
@@ -3318,21 +3812,6 @@ int libregf_key_get_sub_key_by_utf8_path(
 
 		result = -1;
 	}
-#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_key->read_write_lock,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
-		 function );
-
-		return( -1 );
-	}
-#endif
 	return( result );
 }
 
@@ -3480,6 +3959,7 @@ int libregf_internal_key_get_sub_key_by_utf16_name(
 		     internal_key->io_handle,
 		     internal_key->file_io_handle,
 		     sub_key_descriptor->key_offset,
+		     sub_key_descriptor->name_hash,
 		     internal_key->hive_bins_list,
 		     error ) != 1 )
 		{
@@ -3604,21 +4084,9 @@ int libregf_key_get_sub_key_by_utf16_path(
 	}
 	internal_key = (libregf_internal_key_t *) key;
 
-#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_key->read_write_lock,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
-		 function );
-
-		return( -1 );
-	}
-#endif
+	/* The read/write lock is not grabbed here since it is shared with the key item
+	 * and the key tree grabs the lock of every key item it traverses
+	 */
 	result = libregf_key_tree_get_sub_key_by_utf16_path(
 	          internal_key->io_handle,
 	          internal_key->file_io_handle,
@@ -3627,7 +4095,7 @@ int libregf_key_get_sub_key_by_utf16_path(
 	          utf16_string,
 	          utf16_string_length,
 	          sub_key,
-		  error );
+	          error );
 
 	if( result == -1 )
 	{
@@ -3640,21 +4108,6 @@ int libregf_key_get_sub_key_by_utf16_path(
 
 		result = -1;
 	}
-#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_key->read_write_lock,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
-		 function );
-
-		return( -1 );
-	}
-#endif
 	return( result );
 }
 
@@ -29,6 +29,7 @@
 #include "libregf_hive_bins_list.h"
 #include "libregf_io_handle.h"
 #include "libregf_key_item.h"
+#include "libregf_key_item_cache.h"
 #include "libregf_libbfio.h"
 #include "libregf_libcerror.h"
 #include "libregf_libcthreads.h"
@@ -62,8 +63,12 @@ struct libregf_internal_key
 	 */
 	libregf_key_item_t *key_item;
 
+	/* The key item cache, which is set when the key item is shared
+	 */
+	libregf_key_item_cache_t *key_item_cache;
+
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
-	/* The read/write lock
+	/* The read/write lock, which is the read/write lock of the key item
 	 */
 	libcthreads_read_write_lock_t *read_write_lock;
 #endif
@@ -74,6 +79,7 @@ int libregf_key_initialize(
      libregf_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      uint32_t key_offset,
+     uint32_t named_key_hash,
      libregf_hive_bins_list_t *hive_bins_list,
      libcerror_error_t **error );
 
@@ -177,6 +183,12 @@ int libregf_key_get_last_written_time(
      uint64_t *filetime,
      libcerror_error_t **error );
 
+LIBREGF_EXTERN \
+int libregf_key_get_security_key_offset(
+     libregf_key_t *key,
+     uint32_t *security_key_offset,
+     libcerror_error_t **error );
+
 LIBREGF_EXTERN \
 int libregf_key_get_security_descriptor_size(
      libregf_key_t *key,
@@ -246,6 +258,19 @@ int libregf_key_get_value_by_utf16_name(
      libregf_value_t **value,
      libcerror_error_t **error );
 
+int libregf_internal_key_get_value_by_offset(
+     libregf_internal_key_t *internal_key,
+     off64_t value_offset,
+     libregf_value_t **value,
+     libcerror_error_t **error );
+
+LIBREGF_EXTERN \
+int libregf_key_get_value_by_offset(
+     libregf_key_t *key,
+     off64_t value_offset,
+     libregf_value_t **value,
+     libcerror_error_t **error );
+
 LIBREGF_EXTERN \
 int libregf_key_get_number_of_sub_keys(
      libregf_key_t *key,
@@ -23,6 +23,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libregf_arena.h"
 #include "libregf_key_descriptor.h"
 #include "libregf_libcerror.h"
 
@@ -99,6 +100,75 @@ on_error:
 	return( -1 );
 }
 
+/* Creates a key descriptor that is allocated from an arena
+ * The key descriptor is released in bulk when the arena is reset or freed
+ * hence it should not be freed with libregf_key_descriptor_free
+ * Make sure the value key_descriptor is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_descriptor_initialize_from_arena(
+     libregf_key_descriptor_t **key_descriptor,
+     libregf_arena_t *arena,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_key_descriptor_initialize_from_arena";
+
+	if( key_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *key_descriptor != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid key descriptor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libregf_arena_allocate(
+	     arena,
+	     sizeof( libregf_key_descriptor_t ),
+	     (intptr_t **) key_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create key descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *key_descriptor,
+	     0,
+	     sizeof( libregf_key_descriptor_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear key descriptor.",
+		 function );
+
+		*key_descriptor = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Frees a key descriptor
  * Returns 1 if successful or -1 on error
  */
@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libregf_arena.h"
 #include "libregf_libcerror.h"
 
 #if defined( __cplusplus )
@@ -42,12 +43,21 @@ struct libregf_key_descriptor
 	/* The hash value
 	 */
 	uint32_t hash_value;
+
+	/* The name hash, which is 0 if not known
+	 */
+	uint32_t name_hash;
 };
 
 int libregf_key_descriptor_initialize(
      libregf_key_descriptor_t **key_descriptor,
      libcerror_error_t **error );
 
+int libregf_key_descriptor_initialize_from_arena(
+     libregf_key_descriptor_t **key_descriptor,
+     libregf_arena_t *arena,
+     libcerror_error_t **error );
+
 int libregf_key_descriptor_free(
      libregf_key_descriptor_t **key_descriptor,
      libcerror_error_t **error );
@@ -23,8 +23,10 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libregf_arena.h"
 #include "libregf_debug.h"
 #include "libregf_definitions.h"
+#include "libregf_hash_table.h"
 #include "libregf_hive_bins_list.h"
 #include "libregf_io_handle.h"
 #include "libregf_key_descriptor.h"
@@ -33,11 +35,13 @@
 #include "libregf_libcdata.h"
 #include "libregf_libcerror.h"
 #include "libregf_libcnotify.h"
+#include "libregf_libcthreads.h"
 #include "libregf_libfcache.h"
 #include "libregf_libfdata.h"
 #include "libregf_libuna.h"
 #include "libregf_named_key.h"
 #include "libregf_security_key.h"
+#include "libregf_security_key_cache.h"
 #include "libregf_sub_key_list.h"
 #include "libregf_unused.h"
 #include "libregf_value_item.h"
@@ -118,11 +122,33 @@ int libregf_key_item_initialize(
 
 		goto on_error;
 	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *key_item )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	return( 1 );
 
 on_error:
 	if( *key_item != NULL )
 	{
+		if( ( *key_item )->sub_key_descriptors != NULL )
+		{
+			libcdata_array_free(
+			 &( ( *key_item )->sub_key_descriptors ),
+			 NULL,
+			 NULL );
+		}
 		memory_free(
 		 *key_item );
 
@@ -175,7 +201,8 @@ int libregf_key_item_free(
 			memory_free(
 			 ( *key_item )->class_name );
 		}
-		if( ( *key_item )->security_descriptor != NULL )
+		if( ( ( *key_item )->security_descriptor != NULL )
+		 && ( ( *key_item )->security_descriptor_is_shared == 0 ) )
 		{
 			memory_free(
 			 ( *key_item )->security_descriptor );
@@ -196,6 +223,23 @@ int libregf_key_item_free(
 				result = -1;
 			}
 		}
+		if( ( *key_item )->values_name_hash_table != NULL )
+		{
+			if( libregf_hash_table_free(
+			     &( ( *key_item )->values_name_hash_table ),
+			     NULL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free values name hash table.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( ( *key_item )->values_cache != NULL )
 		{
 			if( libfcache_cache_free(
@@ -212,9 +256,28 @@ int libregf_key_item_free(
 				result = -1;
 			}
 		}
+		if( ( *key_item )->sub_key_name_hash_table != NULL )
+		{
+			if( libregf_hash_table_free(
+			     &( ( *key_item )->sub_key_name_hash_table ),
+			     NULL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free sub key name hash table.",
+				 function );
+
+				result = -1;
+			}
+		}
+		/* The sub key descriptors are allocated from the arena
+		 */
 		if( libcdata_array_free(
 		     &( ( *key_item )->sub_key_descriptors ),
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libregf_key_descriptor_free,
+		     NULL,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -226,6 +289,37 @@ int libregf_key_item_free(
 
 			result = -1;
 		}
+		if( ( *key_item )->arena != NULL )
+		{
+			if( libregf_arena_free(
+			     &( ( *key_item )->arena ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free arena.",
+				 function );
+
+				result = -1;
+			}
+		}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *key_item )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		memory_free(
 		 *key_item );
 
@@ -235,6 +329,7 @@ int libregf_key_item_free(
 }
 
 /* Reads a key item
+ * Only the named key is read, the other parts are read on demand
  * Returns 1 if successful or -1 on error
  */
 int libregf_key_item_read(
@@ -246,8 +341,6 @@ int libregf_key_item_read(
      libcerror_error_t **error )
 {
 	static char *function = "libregf_key_item_read";
-	int hive_bin_index    = 0;
-	int result            = 0;
 
 	if( key_item == NULL )
 	{
@@ -303,222 +396,365 @@ int libregf_key_item_read(
 
 		goto on_error;
 	}
-	if( libregf_key_item_read_class_name(
-	     key_item,
-	     file_io_handle,
-	     hive_bins_list,
-	     key_item->named_key->class_name_offset,
-	     key_item->named_key->class_name_size,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read class name at offset: %" PRIu32 " (0x%08" PRIx32 ").",
-		 function,
-		 key_item->named_key->class_name_offset,
-		 key_item->named_key->class_name_offset );
+	key_item->file_io_handle = file_io_handle;
+	key_item->hive_bins_list = hive_bins_list;
+	key_item->read_flags     = 0;
 
-		goto on_error;
-	}
-	if( key_item->named_key->security_key_offset != 0xffffffffUL )
-	{
-		if( libregf_key_item_read_security_key(
-		     key_item,
-		     file_io_handle,
-		     hive_bins_list,
-		     key_item->named_key->security_key_offset,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read security key at offset: %" PRIu32 " (0x%08" PRIx32 ").",
-			 function,
-			 key_item->named_key->security_key_offset,
-			 key_item->named_key->security_key_offset );
+	return( 1 );
 
-			goto on_error;
-		}
-	}
-	if( key_item->named_key->number_of_sub_keys > 0 )
+on_error:
+	if( key_item->named_key != NULL )
 	{
-		result = libregf_key_item_read_sub_keys_list(
-		          key_item->sub_key_descriptors,
-		          file_io_handle,
-		          hive_bins_list,
-		          (off64_t) key_item->named_key->sub_keys_list_offset,
-		          0,
-		          error );
+		libregf_named_key_free(
+		 &( key_item->named_key ),
+		 NULL );
+	}
+	return( -1 );
+}
 
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read sub keys list at offset: %" PRIu32 " (0x%08" PRIx32 ").",
-			 function,
-			 key_item->named_key->sub_keys_list_offset,
-			 key_item->named_key->sub_keys_list_offset );
+/* Reads the parts of a key item that have not been read before
+ * The read flags contain the LIBREGF_KEY_ITEM_READ_FLAG_* of the parts to read
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_item_read_parts(
+     libregf_key_item_t *key_item,
+     uint8_t read_flags,
+     libcerror_error_t **error )
+{
+	static char *function     = "libregf_key_item_read_parts";
+	size_t arena_block_size   = 0;
+	int hive_bin_index        = 0;
+	int maximum_cache_entries = 0;
+	int result                = 0;
 
-			goto on_error;
-		}
-		else if( result == 0 )
-		{
-			key_item->item_flags |= LIBREGF_ITEM_FLAG_IS_CORRUPTED;
-		}
-	}
-/* TODO clone function */
-	if( libfdata_list_initialize(
-	     &( key_item->values_list ),
-	     (intptr_t *) hive_bins_list,
-	     NULL,
-	     NULL,
-	     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libregf_value_item_read_element_data,
-	     NULL,
-	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
-	     error ) != 1 )
+	if( key_item == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create values data list.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key item.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfcache_cache_initialize(
-	     &( key_item->values_cache ),
-	     LIBREGF_MAXIMUM_CACHE_ENTRIES_VALUES,
-	     error ) != 1 )
+	read_flags &= ~( key_item->read_flags );
+
+	if( read_flags == 0 )
+	{
+		return( 1 );
+	}
+	if( key_item->named_key == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create values cache.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key item - missing named key.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	result = libregf_hive_bins_list_get_index_at_offset(
-	          hive_bins_list,
-	          (off64_t) key_item->named_key->values_list_offset,
-	          &hive_bin_index,
-	          error );
-
-	if( result == -1 )
+	if( key_item->hive_bins_list == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine if values list offset is valid.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key item - missing hive bins list.",
 		 function );
 
-		goto on_error;
-	}
-	else if( result == 0 )
-	{
-		key_item->item_flags |= LIBREGF_ITEM_FLAG_IS_CORRUPTED;
+		return( -1 );
 	}
-	else
+	if( ( read_flags & LIBREGF_KEY_ITEM_READ_FLAG_CLASS_NAME ) != 0 )
 	{
-		if( libregf_key_item_read_values_list(
+		if( libregf_key_item_read_class_name(
 		     key_item,
-		     file_io_handle,
-		     hive_bins_list,
-		     key_item->named_key->values_list_offset,
-		     key_item->named_key->number_of_values,
+		     key_item->file_io_handle,
+		     key_item->hive_bins_list,
+		     key_item->named_key->class_name_offset,
+		     key_item->named_key->class_name_size,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read values list at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+			 "%s: unable to read class name at offset: %" PRIu32 " (0x%08" PRIx32 ").",
 			 function,
-			 key_item->named_key->values_list_offset,
-			 key_item->named_key->values_list_offset );
+			 key_item->named_key->class_name_offset,
+			 key_item->named_key->class_name_offset );
 
 			goto on_error;
 		}
+		key_item->read_flags |= LIBREGF_KEY_ITEM_READ_FLAG_CLASS_NAME;
 	}
-	/* The values and sub keys are read on demand
-	 */
-	return( 1 );
-
-on_error:
-	if( key_item->values_cache != NULL )
-	{
-		libfcache_cache_free(
-		 &( key_item->values_cache ),
-		 NULL );
-	}
-	if( key_item->values_list != NULL )
+	if( ( read_flags & LIBREGF_KEY_ITEM_READ_FLAG_SECURITY_DESCRIPTOR ) != 0 )
 	{
-		libfdata_list_free(
-		 &( key_item->values_list ),
-		 NULL );
+		if( key_item->named_key->security_key_offset != 0xffffffffUL )
+		{
+			if( libregf_key_item_read_security_key(
+			     key_item,
+			     key_item->file_io_handle,
+			     key_item->hive_bins_list,
+			     key_item->named_key->security_key_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read security key at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+				 function,
+				 key_item->named_key->security_key_offset,
+				 key_item->named_key->security_key_offset );
+
+				goto on_error;
+			}
+		}
+		key_item->read_flags |= LIBREGF_KEY_ITEM_READ_FLAG_SECURITY_DESCRIPTOR;
 	}
-	if( key_item->security_descriptor != NULL )
+	if( ( read_flags & LIBREGF_KEY_ITEM_READ_FLAG_SUB_KEYS_LIST ) != 0 )
 	{
-		memory_free(
-		 key_item->security_descriptor );
+		if( key_item->named_key->number_of_sub_keys > 0 )
+		{
+			if( key_item->arena == NULL )
+			{
+				/* Size the first block of the arena to fit the sub key descriptors
+				 * and the transient named keys
+				 */
+				arena_block_size = LIBREGF_KEY_ITEM_ARENA_MAXIMUM_BLOCK_SIZE;
 
-		key_item->security_descriptor = NULL;
-	}
-	key_item->security_descriptor_size = 0;
+				if( key_item->named_key->number_of_sub_keys < (uint32_t) ( LIBREGF_KEY_ITEM_ARENA_MAXIMUM_BLOCK_SIZE / LIBREGF_ARENA_ALIGNED_SIZE( sizeof( libregf_key_descriptor_t ) ) ) )
+				{
+					arena_block_size = (size_t) key_item->named_key->number_of_sub_keys * LIBREGF_ARENA_ALIGNED_SIZE( sizeof( libregf_key_descriptor_t ) );
+				}
+				arena_block_size += LIBREGF_KEY_ITEM_ARENA_TRANSIENT_SIZE;
 
-	if( key_item->class_name != NULL )
-	{
-		memory_free(
-		 key_item->class_name );
+				if( libregf_arena_initialize(
+				     &( key_item->arena ),
+				     arena_block_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create arena.",
+					 function );
 
-		key_item->class_name = NULL;
-	}
-	key_item->class_name_size = 0;
+					goto on_error;
+				}
+			}
+			result = libregf_key_item_read_sub_keys_list(
+			          key_item->sub_key_descriptors,
+			          key_item->arena,
+			          key_item->file_io_handle,
+			          key_item->hive_bins_list,
+			          (off64_t) key_item->named_key->sub_keys_list_offset,
+			          0,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read sub keys list at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+				 function,
+				 key_item->named_key->sub_keys_list_offset,
+				 key_item->named_key->sub_keys_list_offset );
 
-	if( key_item->named_key != NULL )
-	{
-		libregf_named_key_free(
-		 &( key_item->named_key ),
-		 NULL );
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				key_item->item_flags |= LIBREGF_ITEM_FLAG_IS_CORRUPTED;
+			}
+		}
+		key_item->read_flags |= LIBREGF_KEY_ITEM_READ_FLAG_SUB_KEYS_LIST;
 	}
-	libcdata_array_empty(
-	 key_item->sub_key_descriptors,
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libregf_key_descriptor_free,
-	 NULL );
+	if( ( read_flags & LIBREGF_KEY_ITEM_READ_FLAG_VALUES_LIST ) != 0 )
+	{
+/* TODO clone function */
+		if( libfdata_list_initialize(
+		     &( key_item->values_list ),
+		     (intptr_t *) key_item->hive_bins_list,
+		     NULL,
+		     NULL,
+		     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libregf_value_item_read_element_data,
+		     NULL,
+		     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create values data list.",
+			 function );
 
-	return( -1 );
-}
+			goto on_error;
+		}
+		/* Size the values cache to the number of values so that keys with
+		 * many values do not need to re-read value keys
+		 */
+		maximum_cache_entries = LIBREGF_MAXIMUM_CACHE_ENTRIES_VALUES;
 
-/* Reads a named key
- * Returns the number of bytes read if successful or -1 on error
- */
-int libregf_key_item_read_named_key(
-     libregf_named_key_t *named_key,
-     libbfio_handle_t *file_io_handle,
-     libregf_hive_bins_list_t *hive_bins_list,
-     off64_t named_key_offset,
-     uint32_t named_key_hash,
-     libcerror_error_t **error )
-{
-	libregf_hive_bin_cell_t *hive_bin_cell = NULL;
-	static char *function                  = "libregf_key_item_read_named_key";
+		if( key_item->named_key->number_of_values > (uint32_t) maximum_cache_entries )
+		{
+			if( key_item->named_key->number_of_values > (uint32_t) ( LIBREGF_MAXIMUM_CACHE_ENTRIES_VALUES_PER_KEY ) )
+			{
+				maximum_cache_entries = LIBREGF_MAXIMUM_CACHE_ENTRIES_VALUES_PER_KEY;
+			}
+			else
+			{
+				maximum_cache_entries = (int) key_item->named_key->number_of_values;
+			}
+		}
+		if( libfcache_cache_initialize(
+		     &( key_item->values_cache ),
+		     maximum_cache_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create values cache.",
+			 function );
 
-	if( hive_bins_list == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid hive bins list.",
-		 function );
+			goto on_error;
+		}
+		result = libregf_hive_bins_list_get_index_at_offset(
+		          key_item->hive_bins_list,
+		          key_item->file_io_handle,
+		          (off64_t) key_item->named_key->values_list_offset,
+		          &hive_bin_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if values list offset is valid.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			key_item->item_flags |= LIBREGF_ITEM_FLAG_IS_CORRUPTED;
+		}
+		else
+		{
+			if( libregf_key_item_read_values_list(
+			     key_item,
+			     key_item->file_io_handle,
+			     key_item->hive_bins_list,
+			     key_item->named_key->values_list_offset,
+			     key_item->named_key->number_of_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read values list at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+				 function,
+				 key_item->named_key->values_list_offset,
+				 key_item->named_key->values_list_offset );
+
+				goto on_error;
+			}
+		}
+		key_item->read_flags |= LIBREGF_KEY_ITEM_READ_FLAG_VALUES_LIST;
+	}
+	return( 1 );
+
+on_error:
+	/* Parts that failed to read are cleared so that they can be read again
+	 */
+	if( ( key_item->read_flags & LIBREGF_KEY_ITEM_READ_FLAG_VALUES_LIST ) == 0 )
+	{
+		if( key_item->values_cache != NULL )
+		{
+			libfcache_cache_free(
+			 &( key_item->values_cache ),
+			 NULL );
+		}
+		if( key_item->values_list != NULL )
+		{
+			libfdata_list_free(
+			 &( key_item->values_list ),
+			 NULL );
+		}
+	}
+	if( ( key_item->read_flags & LIBREGF_KEY_ITEM_READ_FLAG_SUB_KEYS_LIST ) == 0 )
+	{
+		libcdata_array_empty(
+		 key_item->sub_key_descriptors,
+		 NULL,
+		 NULL );
+
+		if( key_item->arena != NULL )
+		{
+			libregf_arena_reset(
+			 key_item->arena,
+			 NULL );
+		}
+	}
+	if( ( key_item->read_flags & LIBREGF_KEY_ITEM_READ_FLAG_SECURITY_DESCRIPTOR ) == 0 )
+	{
+		if( ( key_item->security_descriptor != NULL )
+		 && ( key_item->security_descriptor_is_shared == 0 ) )
+		{
+			memory_free(
+			 key_item->security_descriptor );
+		}
+		key_item->security_descriptor           = NULL;
+		key_item->security_descriptor_size      = 0;
+		key_item->security_descriptor_is_shared = 0;
+	}
+	if( ( key_item->read_flags & LIBREGF_KEY_ITEM_READ_FLAG_CLASS_NAME ) == 0 )
+	{
+		if( key_item->class_name != NULL )
+		{
+			memory_free(
+			 key_item->class_name );
+
+			key_item->class_name = NULL;
+		}
+		key_item->class_name_size = 0;
+	}
+	return( -1 );
+}
+
+/* Reads a named key
+ * Returns the number of bytes read if successful or -1 on error
+ */
+int libregf_key_item_read_named_key(
+     libregf_named_key_t *named_key,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     off64_t named_key_offset,
+     uint32_t named_key_hash,
+     libcerror_error_t **error )
+{
+	libregf_hive_bin_cell_t *hive_bin_cell = NULL;
+	static char *function                  = "libregf_key_item_read_named_key";
+
+	if( hive_bins_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bins list.",
+		 function );
 
 		return( -1 );
 	}
@@ -590,9 +826,35 @@ int libregf_key_item_read_named_key(
 		 named_key_offset,
 		 named_key_offset );
 
+		goto on_error;
+	}
+	if( libregf_hive_bins_list_release_cell_at_offset(
+	     hive_bins_list,
+	     file_io_handle,
+	     (uint32_t) named_key_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release hive bin cell at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 named_key_offset,
+		 named_key_offset );
+
 		return( -1 );
 	}
 	return( 1 );
+
+on_error:
+	libregf_hive_bins_list_release_cell_at_offset(
+	 hive_bins_list,
+	 file_io_handle,
+	 (uint32_t) named_key_offset,
+	 NULL );
+
+	return( -1 );
 }
 
 /* Reads a class name
@@ -869,9 +1131,35 @@ int libregf_key_item_read_class_name(
 		 class_name_offset,
 		 class_name_offset );
 
+		goto on_error;
+	}
+	if( libregf_hive_bins_list_release_cell_at_offset(
+	     hive_bins_list,
+	     file_io_handle,
+	     class_name_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release hive bin cell at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 function,
+		 class_name_offset,
+		 class_name_offset );
+
 		return( -1 );
 	}
 	return( 1 );
+
+on_error:
+	libregf_hive_bins_list_release_cell_at_offset(
+	 hive_bins_list,
+	 file_io_handle,
+	 class_name_offset,
+	 NULL );
+
+	return( -1 );
 }
 
 /* Reads a security key
@@ -922,6 +1210,47 @@ int libregf_key_item_read_security_key(
 
 		return( -1 );
 	}
+	if( hive_bins_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bins list.",
+		 function );
+
+		return( -1 );
+	}
+	/* The security key cache owns the security descriptor that is shared
+	 * by all the keys that reference the same security key
+	 */
+	if( hive_bins_list->security_key_cache != NULL )
+	{
+		if( libregf_security_key_cache_get_security_key(
+		     (libregf_security_key_cache_t *) hive_bins_list->security_key_cache,
+		     file_io_handle,
+		     hive_bins_list,
+		     security_key_offset,
+		     &security_key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve security key at offset: %" PRIu32 " (0x%08" PRIx32 ") from cache.",
+			 function,
+			 security_key_offset,
+			 security_key_offset );
+
+			return( -1 );
+		}
+		key_item->security_descriptor           = security_key->security_descriptor;
+		key_item->security_descriptor_size      = security_key->security_descriptor_size;
+		key_item->security_descriptor_is_shared = 1;
+
+		return( 1 );
+	}
 	if( libregf_hive_bins_list_get_cell_at_offset(
 	     hive_bins_list,
 	     file_io_handle,
@@ -971,6 +1300,27 @@ int libregf_key_item_read_security_key(
 
 		goto on_error;
 	}
+	if( libregf_hive_bins_list_release_cell_at_offset(
+	     hive_bins_list,
+	     file_io_handle,
+	     security_key_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release hive bin cell at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 function,
+		 security_key_offset,
+		 security_key_offset );
+
+		hive_bin_cell = NULL;
+
+		goto on_error;
+	}
+	hive_bin_cell = NULL;
+
 	key_item->security_descriptor      = security_key->security_descriptor;
 	key_item->security_descriptor_size = security_key->security_descriptor_size;
 
@@ -993,6 +1343,14 @@ int libregf_key_item_read_security_key(
 	return( 1 );
 
 on_error:
+	if( hive_bin_cell != NULL )
+	{
+		libregf_hive_bins_list_release_cell_at_offset(
+		 hive_bins_list,
+		 file_io_handle,
+		 security_key_offset,
+		 NULL );
+	}
 	if( security_key != NULL )
 	{
 		libregf_security_key_free(
@@ -1119,7 +1477,7 @@ int libregf_key_item_read_values_list(
 		 "%s: invalid cell size value too small to contain number of values.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	for( values_list_element_index = 0;
 	     values_list_element_index < number_of_values_list_elements;
@@ -1143,6 +1501,7 @@ int libregf_key_item_read_values_list(
 #endif
 		result = libregf_hive_bins_list_get_index_at_offset(
 		          hive_bins_list,
+		          file_io_handle,
 		          (off64_t) values_list_element_offset,
 		          &hive_bin_index,
 		          error );
@@ -1156,7 +1515,7 @@ int libregf_key_item_read_values_list(
 			 "%s: unable to determine if values list element offset is valid.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 		else if( result == 0 )
 		{
@@ -1181,7 +1540,7 @@ int libregf_key_item_read_values_list(
 				 function,
 				 values_list_element_index );
 
-				return( -1 );
+				goto on_error;
 			}
 		}
 	}
@@ -1206,14 +1565,42 @@ int libregf_key_item_read_values_list(
 	}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
+	if( libregf_hive_bins_list_release_cell_at_offset(
+	     hive_bins_list,
+	     file_io_handle,
+	     values_list_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release hive bin cell at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 function,
+		 values_list_offset,
+		 values_list_offset );
+
+		return( -1 );
+	}
 	return( 1 );
+
+on_error:
+	libregf_hive_bins_list_release_cell_at_offset(
+	 hive_bins_list,
+	 file_io_handle,
+	 values_list_offset,
+	 NULL );
+
+	return( -1 );
 }
 
 /* Reads a sub keys list
+ * The sub key descriptors are allocated from the arena if set
  * Returns 1 if successful, 0 if not or -1 on error
  */
 int libregf_key_item_read_sub_keys_list(
      libcdata_array_t *sub_key_descriptors,
+     libregf_arena_t *arena,
      libbfio_handle_t *file_io_handle,
      libregf_hive_bins_list_t *hive_bins_list,
      off64_t sub_keys_list_offset,
@@ -1286,6 +1673,7 @@ int libregf_key_item_read_sub_keys_list(
 	}
 	if( libregf_sub_key_list_initialize(
 	     &sub_key_list,
+	     arena,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1315,6 +1703,27 @@ int libregf_key_item_read_sub_keys_list(
 
 		goto on_error;
 	}
+	if( libregf_hive_bins_list_release_cell_at_offset(
+	     hive_bins_list,
+	     file_io_handle,
+	     (uint32_t) sub_keys_list_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release hive bin cell at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 sub_keys_list_offset,
+		 sub_keys_list_offset );
+
+		hive_bin_cell = NULL;
+
+		goto on_error;
+	}
+	hive_bin_cell = NULL;
+
 	if( libcdata_array_get_number_of_entries(
 	     sub_key_list->sub_key_descriptors,
 	     &number_of_sub_key_descriptors,
@@ -1363,6 +1772,7 @@ int libregf_key_item_read_sub_keys_list(
 		}
 		result = libregf_hive_bins_list_get_index_at_offset(
 		          hive_bins_list,
+		          file_io_handle,
 		          (off64_t) sub_key_descriptor->key_offset,
 		          &hive_bin_index,
 		          error );
@@ -1412,10 +1822,12 @@ int libregf_key_item_read_sub_keys_list(
 					 "%s: unable to append sub key descriptor to array.",
 					 function );
 
-					libregf_key_descriptor_free(
-					 &sub_key_descriptor,
-					 NULL );
-
+					if( arena == NULL )
+					{
+						libregf_key_descriptor_free(
+						 &sub_key_descriptor,
+						 NULL );
+					}
 					goto on_error;
 				}
 				sub_key_descriptor = NULL;
@@ -1424,6 +1836,7 @@ int libregf_key_item_read_sub_keys_list(
 			{
 				result = libregf_key_item_read_sub_keys_list(
 					  sub_key_descriptors,
+					  arena,
 					  file_io_handle,
 					  hive_bins_list,
 				          (off64_t) sub_key_descriptor->key_offset,
@@ -1470,21 +1883,39 @@ int libregf_key_item_read_sub_keys_list(
 	return( 1 );
 
 on_error:
+	if( hive_bin_cell != NULL )
+	{
+		libregf_hive_bins_list_release_cell_at_offset(
+		 hive_bins_list,
+		 file_io_handle,
+		 (uint32_t) sub_keys_list_offset,
+		 NULL );
+	}
 	if( sub_key_list != NULL )
 	{
 		libregf_sub_key_list_free(
 		 &sub_key_list,
 		 NULL );
 	}
-	libcdata_array_empty(
-	 sub_key_descriptors,
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libregf_key_descriptor_free,
-	 NULL );
-
+	if( arena != NULL )
+	{
+		libcdata_array_empty(
+		 sub_key_descriptors,
+		 NULL,
+		 NULL );
+	}
+	else
+	{
+		libcdata_array_empty(
+		 sub_key_descriptors,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libregf_key_descriptor_free,
+		 NULL );
+	}
 	return( -1 );
 }
 
 /* Determines if the key item is corrupted
+ * The sub keys and values lists are read first since corruption is detected while reading them
  * Returns 1 if corrupted, 0 if not or -1 on error
  */
 int libregf_key_item_is_corrupted(
@@ -1504,6 +1935,20 @@ int libregf_key_item_is_corrupted(
 
 		return( -1 );
 	}
+	if( libregf_key_item_read_parts(
+	     key_item,
+	     LIBREGF_KEY_ITEM_READ_FLAG_SUB_KEYS_LIST | LIBREGF_KEY_ITEM_READ_FLAG_VALUES_LIST,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sub keys and values lists.",
+		 function );
+
+		return( -1 );
+	}
 	if( ( key_item->item_flags & LIBREGF_ITEM_FLAG_IS_CORRUPTED ) != 0 )
 	{
 		return( 1 );
@@ -1791,6 +2236,20 @@ int libregf_key_item_get_class_name_size(
 
 		return( -1 );
 	}
+	if( libregf_key_item_read_parts(
+	     key_item,
+	     LIBREGF_KEY_ITEM_READ_FLAG_CLASS_NAME,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read class name.",
+		 function );
+
+		return( -1 );
+	}
 	if( ( key_item->class_name == NULL )
 	 || ( key_item->class_name_size == 0 ) )
 	{
@@ -1845,6 +2304,20 @@ int libregf_key_item_get_class_name(
 
 		return( -1 );
 	}
+	if( libregf_key_item_read_parts(
+	     key_item,
+	     LIBREGF_KEY_ITEM_READ_FLAG_CLASS_NAME,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read class name.",
+		 function );
+
+		return( -1 );
+	}
 	if( ( key_item->class_name == NULL )
 	 || ( key_item->class_name_size == 0 ) )
 	{
@@ -1901,10 +2374,24 @@ int libregf_key_item_get_utf8_class_name_size(
 
 		return( -1 );
 	}
-	if( ( key_item->class_name == NULL )
-	 || ( key_item->class_name_size == 0 ) )
+	if( libregf_key_item_read_parts(
+	     key_item,
+	     LIBREGF_KEY_ITEM_READ_FLAG_CLASS_NAME,
+	     error ) != 1 )
 	{
-		return( 0 );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read class name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_item->class_name == NULL )
+	 || ( key_item->class_name_size == 0 ) )
+	{
+		return( 0 );
 	}
 	if( libuna_utf8_string_size_from_utf16_stream(
 	     key_item->class_name,
@@ -1950,6 +2437,20 @@ int libregf_key_item_get_utf8_class_name(
 
 		return( -1 );
 	}
+	if( libregf_key_item_read_parts(
+	     key_item,
+	     LIBREGF_KEY_ITEM_READ_FLAG_CLASS_NAME,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read class name.",
+		 function );
+
+		return( -1 );
+	}
 	if( ( key_item->class_name == NULL )
 	 || ( key_item->class_name_size == 0 ) )
 	{
@@ -1998,6 +2499,20 @@ int libregf_key_item_get_utf16_class_name_size(
 
 		return( -1 );
 	}
+	if( libregf_key_item_read_parts(
+	     key_item,
+	     LIBREGF_KEY_ITEM_READ_FLAG_CLASS_NAME,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read class name.",
+		 function );
+
+		return( -1 );
+	}
 	if( ( key_item->class_name == NULL )
 	 || ( key_item->class_name_size == 0 ) )
 	{
@@ -2047,6 +2562,20 @@ int libregf_key_item_get_utf16_class_name(
 
 		return( -1 );
 	}
+	if( libregf_key_item_read_parts(
+	     key_item,
+	     LIBREGF_KEY_ITEM_READ_FLAG_CLASS_NAME,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read class name.",
+		 function );
+
+		return( -1 );
+	}
 	if( ( key_item->class_name == NULL )
 	 || ( key_item->class_name_size == 0 ) )
 	{
@@ -2110,6 +2639,60 @@ int libregf_key_item_get_last_written_time(
 	return( 1 );
 }
 
+/* Retrieves the security key offset
+ * Keys with the same security key offset share the same security descriptor
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libregf_key_item_get_security_key_offset(
+     libregf_key_item_t *key_item,
+     uint32_t *security_key_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_key_item_get_security_key_offset";
+
+	if( key_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key item.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_item->named_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key item - missing named key.",
+		 function );
+
+		return( -1 );
+	}
+	if( security_key_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security key offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_item->named_key->security_key_offset == 0 )
+	 || ( key_item->named_key->security_key_offset == 0xffffffffUL ) )
+	{
+		return( 0 );
+	}
+	*security_key_offset = key_item->named_key->security_key_offset;
+
+	return( 1 );
+}
+
 /* Retrieves the security descriptor size
  * Returns 1 if successful, 0 if no such value or -1 on error
  */
@@ -2142,6 +2725,20 @@ int libregf_key_item_get_security_descriptor_size(
 
 		return( -1 );
 	}
+	if( libregf_key_item_read_parts(
+	     key_item,
+	     LIBREGF_KEY_ITEM_READ_FLAG_SECURITY_DESCRIPTOR,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read security descriptor.",
+		 function );
+
+		return( -1 );
+	}
 	if( ( key_item->security_descriptor == NULL )
 	 || ( key_item->security_descriptor_size == 0 ) )
 	{
@@ -2196,6 +2793,20 @@ int libregf_key_item_get_security_descriptor(
 
 		return( -1 );
 	}
+	if( libregf_key_item_read_parts(
+	     key_item,
+	     LIBREGF_KEY_ITEM_READ_FLAG_SECURITY_DESCRIPTOR,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read security descriptor.",
+		 function );
+
+		return( -1 );
+	}
 	if( ( key_item->security_descriptor == NULL )
 	 || ( key_item->security_descriptor_size == 0 ) )
 	{
@@ -2250,6 +2861,20 @@ int libregf_key_item_get_number_of_values(
 
 		return( -1 );
 	}
+	if( libregf_key_item_read_parts(
+	     key_item,
+	     LIBREGF_KEY_ITEM_READ_FLAG_VALUES_LIST,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read values list.",
+		 function );
+
+		return( -1 );
+	}
 	if( libfdata_list_get_number_of_elements(
 	     key_item->values_list,
 	     number_of_values,
@@ -2267,15 +2892,20 @@ int libregf_key_item_get_number_of_values(
 	return( 1 );
 }
 
-/* Retrieves the number of sub key descriptors
- * Returns 1 if successful or -1 on error
+/* Retrieves the values name hash table
+ * The name hash table is created on demand from the name hashes of the value keys
+ * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libregf_key_item_get_number_of_sub_key_descriptors(
+int libregf_key_item_get_values_name_hash_table(
      libregf_key_item_t *key_item,
-     int *number_of_sub_key_descriptors,
+     libbfio_handle_t *file_io_handle,
+     libregf_hash_table_t **name_hash_table,
      libcerror_error_t **error )
 {
-	static char *function = "libregf_key_item_get_number_of_sub_key_descriptors";
+	libregf_value_item_t *value_item = NULL;
+	static char *function            = "libregf_key_item_get_values_name_hash_table";
+	int number_of_values             = 0;
+	int value_index                  = 0;
 
 	if( key_item == NULL )
 	{
@@ -2288,206 +2918,2152 @@ int libregf_key_item_get_number_of_sub_key_descriptors(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_number_of_entries(
-	     key_item->sub_key_descriptors,
-	     number_of_sub_key_descriptors,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of sub key descriptors.",
-		 function );
-
-		return( -1 );
-	}
-	return( 1 );
-}
-
-/* Retrieves a specific sub key descriptor
- * Returns 1 if successful or -1 on error
- */
-int libregf_key_item_get_sub_key_descriptor_by_index(
-     libregf_key_item_t *key_item,
-     int sub_key_descriptor_index,
-     libregf_key_descriptor_t **sub_key_descriptor,
-     libcerror_error_t **error )
-{
-	static char *function = "libregf_key_item_get_sub_key_descriptor_by_index";
-
-	if( key_item == NULL )
+	if( name_hash_table == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid key item.",
+		 "%s: invalid name hash table.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     key_item->sub_key_descriptors,
-             sub_key_descriptor_index,
-	     (intptr_t **) sub_key_descriptor,
+	if( libregf_key_item_read_parts(
+	     key_item,
+	     LIBREGF_KEY_ITEM_READ_FLAG_VALUES_LIST,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve sub key descriptor: %d.",
-		 function,
-		 sub_key_descriptor_index );
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read values list.",
+		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
-
-/* Retrieves the sub key descriptor for the specific UTF-8 encoded name
- * Returns 1 if successful, 0 if no such value or -1 on error
- */
-int libregf_key_item_get_sub_key_descriptor_by_utf8_name(
-     libregf_key_item_t *key_item,
-     libbfio_handle_t *file_io_handle,
-     libregf_hive_bins_list_t *hive_bins_list,
-     uint32_t name_hash,
-     const uint8_t *utf8_string,
-     size_t utf8_string_length,
-     libregf_key_descriptor_t **sub_key_descriptor,
-     libcerror_error_t **error )
-{
-	libregf_key_descriptor_t *safe_sub_key_descriptor = NULL;
-	libregf_named_key_t *named_key                    = NULL;
-	static char *function                             = "libregf_key_item_get_sub_key_descriptor_by_utf8_name";
-	int number_of_sub_key_descriptors                 = 0;
-	int result                                        = 0;
-	int sub_key_descriptor_index                      = 0;
-
-	if( key_item == NULL )
+	if( key_item->values_name_hash_table != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid key item.",
-		 function );
+		*name_hash_table = key_item->values_name_hash_table;
 
-		return( -1 );
+		return( 1 );
 	}
-	if( hive_bins_list == NULL )
+	if( key_item->values_name_hash_table_is_unavailable != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid hive bins list.",
-		 function );
-
-		return( -1 );
+		return( 0 );
 	}
-	if( hive_bins_list->io_handle == NULL )
+	if( libfdata_list_get_number_of_elements(
+	     key_item->values_list,
+	     &number_of_values,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid hive bins list - missing IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements from values data list.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	*sub_key_descriptor = NULL;
+	if( number_of_values == 0 )
+	{
+		key_item->values_name_hash_table_is_unavailable = 1;
 
-/* TODO think of caching and/or optimization
- * e.g. mapping sub key descriptors to name search tree?
- */
-	if( libcdata_array_get_number_of_entries(
-	     key_item->sub_key_descriptors,
-	     &number_of_sub_key_descriptors,
+		return( 0 );
+	}
+	if( libregf_hash_table_initialize(
+	     &( key_item->values_name_hash_table ),
+	     number_of_values,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries from sub key descriptors array.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create values name hash table.",
 		 function );
 
 		goto on_error;
 	}
-	for( sub_key_descriptor_index = 0;
-	     sub_key_descriptor_index < number_of_sub_key_descriptors;
-	     sub_key_descriptor_index++ )
-	{
-		if( libcdata_array_get_entry_by_index(
-		     key_item->sub_key_descriptors,
-		     sub_key_descriptor_index,
-		     (intptr_t **) &safe_sub_key_descriptor,
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		if( libfdata_list_get_element_value_by_index(
+		     key_item->values_list,
+		     (intptr_t *) file_io_handle,
+		     (libfdata_cache_t *) key_item->values_cache,
+		     value_index,
+		     (intptr_t **) &value_item,
+		     0,
+		     error ) != 1 )
+		{
+			/* A value that cannot be read is not indexed, hence
+			 * fall back to comparing the values one by one
+			 */
+			libcerror_error_free(
+			 error );
+
+			break;
+		}
+		if( ( value_item == NULL )
+		 || ( value_item->value_key == NULL ) )
+		{
+			break;
+		}
+		if( libregf_hash_table_insert_value(
+		     key_item->values_name_hash_table,
+		     value_item->value_key->name_hash,
+		     (intptr_t) value_index,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve sub key descriptor: %d from array.",
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert value: %d in name hash table.",
 			 function,
-			 sub_key_descriptor_index );
+			 value_index );
 
 			goto on_error;
 		}
-		if( safe_sub_key_descriptor == NULL )
+	}
+	if( value_index < number_of_values )
+	{
+		if( libregf_hash_table_free(
+		     &( key_item->values_name_hash_table ),
+		     NULL,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free values name hash table.",
+			 function );
+
+			goto on_error;
+		}
+		key_item->values_name_hash_table_is_unavailable = 1;
+
+		return( 0 );
+	}
+	*name_hash_table = key_item->values_name_hash_table;
+
+	return( 1 );
+
+on_error:
+	if( key_item->values_name_hash_table != NULL )
+	{
+		libregf_hash_table_free(
+		 &( key_item->values_name_hash_table ),
+		 NULL,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of sub key descriptors
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_item_get_number_of_sub_key_descriptors(
+     libregf_key_item_t *key_item,
+     int *number_of_sub_key_descriptors,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_key_item_get_number_of_sub_key_descriptors";
+
+	if( key_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key item.",
+		 function );
+
+		return( -1 );
+	}
+	if( libregf_key_item_read_parts(
+	     key_item,
+	     LIBREGF_KEY_ITEM_READ_FLAG_SUB_KEYS_LIST,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sub keys list.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     key_item->sub_key_descriptors,
+	     number_of_sub_key_descriptors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub key descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific sub key descriptor
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_item_get_sub_key_descriptor_by_index(
+     libregf_key_item_t *key_item,
+     int sub_key_descriptor_index,
+     libregf_key_descriptor_t **sub_key_descriptor,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_key_item_get_sub_key_descriptor_by_index";
+
+	if( key_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key item.",
+		 function );
+
+		return( -1 );
+	}
+	if( libregf_key_item_read_parts(
+	     key_item,
+	     LIBREGF_KEY_ITEM_READ_FLAG_SUB_KEYS_LIST,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sub keys list.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     key_item->sub_key_descriptors,
+             sub_key_descriptor_index,
+	     (intptr_t **) sub_key_descriptor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub key descriptor: %d.",
+		 function,
+		 sub_key_descriptor_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the sub key descriptors name hash table
+ * The name hash table is created on demand from the name hashes stored in "lh" sub key lists
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libregf_key_item_get_sub_key_name_hash_table(
+     libregf_key_item_t *key_item,
+     libregf_hash_table_t **name_hash_table,
+     libcerror_error_t **error )
+{
+	libregf_key_descriptor_t *sub_key_descriptor = NULL;
+	static char *function                        = "libregf_key_item_get_sub_key_name_hash_table";
+	int number_of_sub_key_descriptors            = 0;
+	int sub_key_descriptor_index                 = 0;
+
+	if( key_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key item.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( libregf_key_item_read_parts(
+	     key_item,
+	     LIBREGF_KEY_ITEM_READ_FLAG_SUB_KEYS_LIST,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sub keys list.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_item->sub_key_name_hash_table != NULL )
+	{
+		*name_hash_table = key_item->sub_key_name_hash_table;
+
+		return( 1 );
+	}
+	if( key_item->sub_key_name_hash_table_is_unavailable != 0 )
+	{
+		return( 0 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     key_item->sub_key_descriptors,
+	     &number_of_sub_key_descriptors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from sub key descriptors array.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_sub_key_descriptors == 0 )
+	{
+		key_item->sub_key_name_hash_table_is_unavailable = 1;
+
+		return( 0 );
+	}
+	if( libregf_hash_table_initialize(
+	     &( key_item->sub_key_name_hash_table ),
+	     number_of_sub_key_descriptors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sub key name hash table.",
+		 function );
+
+		goto on_error;
+	}
+	for( sub_key_descriptor_index = 0;
+	     sub_key_descriptor_index < number_of_sub_key_descriptors;
+	     sub_key_descriptor_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     key_item->sub_key_descriptors,
+		     sub_key_descriptor_index,
+		     (intptr_t **) &sub_key_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub key descriptor: %d from array.",
+			 function,
+			 sub_key_descriptor_index );
+
+			goto on_error;
+		}
+		if( sub_key_descriptor == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
 			 "%s: missing sub key descriptor: %d.",
 			 function,
 			 sub_key_descriptor_index );
 
 			goto on_error;
 		}
-		if( libregf_named_key_initialize(
-		     &named_key,
+		/* The name hash is not known if the sub key list is not "lh"
+		 */
+		if( sub_key_descriptor->name_hash == 0 )
+		{
+			if( libregf_hash_table_free(
+			     &( key_item->sub_key_name_hash_table ),
+			     NULL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free sub key name hash table.",
+				 function );
+
+				goto on_error;
+			}
+			key_item->sub_key_name_hash_table_is_unavailable = 1;
+
+			return( 0 );
+		}
+		if( libregf_hash_table_insert_value(
+		     key_item->sub_key_name_hash_table,
+		     sub_key_descriptor->name_hash,
+		     (intptr_t) sub_key_descriptor_index,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create named key.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert sub key descriptor: %d in name hash table.",
+			 function,
+			 sub_key_descriptor_index );
+
+			goto on_error;
+		}
+	}
+	*name_hash_table = key_item->sub_key_name_hash_table;
+
+	return( 1 );
+
+on_error:
+	if( key_item->sub_key_name_hash_table != NULL )
+	{
+		libregf_hash_table_free(
+		 &( key_item->sub_key_name_hash_table ),
+		 NULL,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Determines the name hash as stored in a "lh" sub key list of an UTF-8 encoded name
+ * Only names that consist of ASCII characters are supported, since the upper case
+ * conversion of other characters can differ from the one used by Windows
+ * Returns 1 if successful, 0 if the name contains non-ASCII characters or -1 on error
+ */
+int libregf_key_item_get_utf8_sub_key_name_hash(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint32_t *name_hash,
+     libcerror_error_t **error )
+{
+	static char *function    = "libregf_key_item_get_utf8_sub_key_name_hash";
+	size_t utf8_string_index = 0;
+	uint32_t safe_name_hash  = 0;
+	uint8_t character        = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash.",
+		 function );
+
+		return( -1 );
+	}
+	for( utf8_string_index = 0;
+	     utf8_string_index < utf8_string_length;
+	     utf8_string_index++ )
+	{
+		character = utf8_string[ utf8_string_index ];
+
+		if( character >= 0x80 )
+		{
+			return( 0 );
+		}
+		if( ( character >= (uint8_t) 'a' )
+		 && ( character <= (uint8_t) 'z' ) )
+		{
+			character -= (uint8_t) ( 'a' - 'A' );
+		}
+		safe_name_hash *= 37;
+		safe_name_hash += (uint32_t) character;
+	}
+	*name_hash = safe_name_hash;
+
+	return( 1 );
+}
+
+/* Determines the name hash as stored in a "lh" sub key list of an UTF-16 encoded name
+ * Only names that consist of ASCII characters are supported, since the upper case
+ * conversion of other characters can differ from the one used by Windows
+ * Returns 1 if successful, 0 if the name contains non-ASCII characters or -1 on error
+ */
+int libregf_key_item_get_utf16_sub_key_name_hash(
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint32_t *name_hash,
+     libcerror_error_t **error )
+{
+	static char *function     = "libregf_key_item_get_utf16_sub_key_name_hash";
+	size_t utf16_string_index = 0;
+	uint32_t safe_name_hash   = 0;
+	uint16_t character        = 0;
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash.",
+		 function );
+
+		return( -1 );
+	}
+	for( utf16_string_index = 0;
+	     utf16_string_index < utf16_string_length;
+	     utf16_string_index++ )
+	{
+		character = utf16_string[ utf16_string_index ];
+
+		if( character >= 0x0080 )
+		{
+			return( 0 );
+		}
+		if( ( character >= (uint16_t) 'a' )
+		 && ( character <= (uint16_t) 'z' ) )
+		{
+			character -= (uint16_t) ( 'a' - 'A' );
+		}
+		safe_name_hash *= 37;
+		safe_name_hash += (uint32_t) character;
+	}
+	*name_hash = safe_name_hash;
+
+	return( 1 );
+}
+
+/* Compares the name of the sub key with UTF-8 string
+ * Returns 1 if the names match, 0 if not or -1 on error
+ */
+int libregf_key_item_compare_sub_key_name_with_utf8_string(
+     libregf_key_descriptor_t *sub_key_descriptor,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     libregf_arena_t *arena,
+     uint32_t name_hash,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error )
+{
+	libregf_named_key_t *named_key = NULL;
+	static char *function          = "libregf_key_item_compare_sub_key_name_with_utf8_string";
+	size_t arena_mark              = 0;
+	int result                     = 0;
+
+	if( sub_key_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub key descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( hive_bins_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bins list.",
+		 function );
+
+		return( -1 );
+	}
+	if( hive_bins_list->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid hive bins list - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* The named key is only needed for the comparison hence the arena
+	 * is rewound afterwards
+	 */
+	if( arena != NULL )
+	{
+		if( libregf_arena_get_mark(
+		     arena,
+		     &arena_mark,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve arena mark.",
+			 function );
+
+			return( -1 );
+		}
+		result = libregf_named_key_initialize_from_arena(
+		          &named_key,
+		          arena,
+		          error );
+	}
+	else
+	{
+		result = libregf_named_key_initialize(
+		          &named_key,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create named key.",
+		 function );
+
+		goto on_error;
+	}
+	if( libregf_key_item_read_named_key(
+	     named_key,
+	     file_io_handle,
+	     hive_bins_list,
+	     sub_key_descriptor->key_offset,
+	     sub_key_descriptor->hash_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read named key at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 function,
+		 sub_key_descriptor->key_offset,
+		 sub_key_descriptor->key_offset );
+
+		goto on_error;
+	}
+	result = libregf_named_key_compare_name_with_utf8_string(
+	          named_key,
+	          name_hash,
+	          utf8_string,
+	          utf8_string_length,
+	          hive_bins_list->io_handle->ascii_codepage,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to compare named key with UTF-8 string.",
+		 function );
+
+		goto on_error;
+	}
+	if( libregf_named_key_free(
+	     &named_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free named key.",
+		 function );
+
+		goto on_error;
+	}
+	if( arena != NULL )
+	{
+		if( libregf_arena_rewind(
+		     arena,
+		     arena_mark,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to rewind arena.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+
+on_error:
+	if( named_key != NULL )
+	{
+		libregf_named_key_free(
+		 &named_key,
+		 NULL );
+	}
+	if( arena != NULL )
+	{
+		libregf_arena_rewind(
+		 arena,
+		 arena_mark,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Compares the name of the sub key with UTF-16 string
+ * Returns 1 if the names match, 0 if not or -1 on error
+ */
+int libregf_key_item_compare_sub_key_name_with_utf16_string(
+     libregf_key_descriptor_t *sub_key_descriptor,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     libregf_arena_t *arena,
+     uint32_t name_hash,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcerror_error_t **error )
+{
+	libregf_named_key_t *named_key = NULL;
+	static char *function          = "libregf_key_item_compare_sub_key_name_with_utf16_string";
+	size_t arena_mark              = 0;
+	int result                     = 0;
+
+	if( sub_key_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub key descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( hive_bins_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bins list.",
+		 function );
+
+		return( -1 );
+	}
+	if( hive_bins_list->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid hive bins list - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* The named key is only needed for the comparison hence the arena
+	 * is rewound afterwards
+	 */
+	if( arena != NULL )
+	{
+		if( libregf_arena_get_mark(
+		     arena,
+		     &arena_mark,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve arena mark.",
+			 function );
+
+			return( -1 );
+		}
+		result = libregf_named_key_initialize_from_arena(
+		          &named_key,
+		          arena,
+		          error );
+	}
+	else
+	{
+		result = libregf_named_key_initialize(
+		          &named_key,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create named key.",
+		 function );
+
+		goto on_error;
+	}
+	if( libregf_key_item_read_named_key(
+	     named_key,
+	     file_io_handle,
+	     hive_bins_list,
+	     sub_key_descriptor->key_offset,
+	     sub_key_descriptor->hash_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read named key at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 function,
+		 sub_key_descriptor->key_offset,
+		 sub_key_descriptor->key_offset );
+
+		goto on_error;
+	}
+	result = libregf_named_key_compare_name_with_utf16_string(
+	          named_key,
+	          name_hash,
+	          utf16_string,
+	          utf16_string_length,
+	          hive_bins_list->io_handle->ascii_codepage,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to compare named key with UTF-16 string.",
+		 function );
+
+		goto on_error;
+	}
+	if( libregf_named_key_free(
+	     &named_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free named key.",
+		 function );
+
+		goto on_error;
+	}
+	if( arena != NULL )
+	{
+		if( libregf_arena_rewind(
+		     arena,
+		     arena_mark,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to rewind arena.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+
+on_error:
+	if( named_key != NULL )
+	{
+		libregf_named_key_free(
+		 &named_key,
+		 NULL );
+	}
+	if( arena != NULL )
+	{
+		libregf_arena_rewind(
+		 arena,
+		 arena_mark,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Copies an UTF-8 encoded name to an upper case ASCII name
+ * Returns 1 if successful, 0 if the name contains non-ASCII characters or does not fit or -1 on error
+ */
+int libregf_key_item_get_utf8_upper_case_ascii_name(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint8_t *ascii_name,
+     size_t ascii_name_size,
+     libcerror_error_t **error )
+{
+	static char *function    = "libregf_key_item_get_utf8_upper_case_ascii_name";
+	size_t utf8_string_index = 0;
+	uint8_t character        = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ascii_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ASCII name.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > ascii_name_size )
+	{
+		return( 0 );
+	}
+	for( utf8_string_index = 0;
+	     utf8_string_index < utf8_string_length;
+	     utf8_string_index++ )
+	{
+		character = utf8_string[ utf8_string_index ];
+
+		if( character >= 0x80 )
+		{
+			return( 0 );
+		}
+		if( ( character >= (uint8_t) 'a' )
+		 && ( character <= (uint8_t) 'z' ) )
+		{
+			character -= (uint8_t) ( 'a' - 'A' );
+		}
+		ascii_name[ utf8_string_index ] = character;
+	}
+	return( 1 );
+}
+
+/* Copies an UTF-16 encoded name to an upper case ASCII name
+ * Returns 1 if successful, 0 if the name contains non-ASCII characters or does not fit or -1 on error
+ */
+int libregf_key_item_get_utf16_upper_case_ascii_name(
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint8_t *ascii_name,
+     size_t ascii_name_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libregf_key_item_get_utf16_upper_case_ascii_name";
+	size_t utf16_string_index = 0;
+	uint16_t character        = 0;
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ascii_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ASCII name.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length > ascii_name_size )
+	{
+		return( 0 );
+	}
+	for( utf16_string_index = 0;
+	     utf16_string_index < utf16_string_length;
+	     utf16_string_index++ )
+	{
+		character = utf16_string[ utf16_string_index ];
+
+		if( character >= 0x0080 )
+		{
+			return( 0 );
+		}
+		if( ( character >= (uint16_t) 'a' )
+		 && ( character <= (uint16_t) 'z' ) )
+		{
+			character -= (uint16_t) ( 'a' - 'A' );
+		}
+		ascii_name[ utf16_string_index ] = (uint8_t) character;
+	}
+	return( 1 );
+}
+
+/* Determines the sort order of the name of the sub key relative to an upper case ASCII name
+ * The compare result is less than 0 if the sub key name sorts before the ASCII name,
+ * 0 if the names are equal or greater than 0 if the sub key name sorts after the ASCII name
+ * Returns 1 if successful, 0 if the sub key name contains non-ASCII characters or -1 on error
+ */
+int libregf_key_item_compare_sub_key_name_order_with_upper_case_ascii_name(
+     libregf_key_descriptor_t *sub_key_descriptor,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     libregf_arena_t *arena,
+     const uint8_t *ascii_name,
+     size_t ascii_name_length,
+     int *compare_result,
+     libcerror_error_t **error )
+{
+	libregf_named_key_t *named_key = NULL;
+	static char *function          = "libregf_key_item_compare_sub_key_name_order_with_upper_case_ascii_name";
+	size_t arena_mark              = 0;
+	size_t ascii_name_index        = 0;
+	size_t name_index              = 0;
+	uint16_t name_character        = 0;
+	int result                     = 1;
+	int safe_compare_result        = 0;
+
+	if( sub_key_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub key descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( ascii_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ASCII name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ascii_name_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid ASCII name length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compare_result == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compare result.",
+		 function );
+
+		return( -1 );
+	}
+	/* The named key is only needed for the comparison hence the arena
+	 * is rewound afterwards
+	 */
+	if( arena != NULL )
+	{
+		if( libregf_arena_get_mark(
+		     arena,
+		     &arena_mark,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve arena mark.",
+			 function );
+
+			return( -1 );
+		}
+		result = libregf_named_key_initialize_from_arena(
+		          &named_key,
+		          arena,
+		          error );
+	}
+	else
+	{
+		result = libregf_named_key_initialize(
+		          &named_key,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create named key.",
+		 function );
+
+		goto on_error;
+	}
+	if( libregf_key_item_read_named_key(
+	     named_key,
+	     file_io_handle,
+	     hive_bins_list,
+	     sub_key_descriptor->key_offset,
+	     sub_key_descriptor->hash_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read named key at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 function,
+		 sub_key_descriptor->key_offset,
+		 sub_key_descriptor->key_offset );
+
+		goto on_error;
+	}
+	if( named_key->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid named key - missing name.",
+		 function );
+
+		goto on_error;
+	}
+	/* Windows sorts the sub keys by their upper case name
+	 */
+	while( name_index < (size_t) named_key->name_size )
+	{
+		if( ( named_key->flags & LIBREGF_NAMED_KEY_FLAG_NAME_IS_ASCII ) != 0 )
+		{
+			name_character = named_key->name[ name_index ];
+
+			name_index += 1;
+		}
+		else
+		{
+			if( ( name_index + 1 ) >= (size_t) named_key->name_size )
+			{
+				break;
+			}
+			byte_stream_copy_to_uint16_little_endian(
+			 &( named_key->name[ name_index ] ),
+			 name_character );
+
+			name_index += 2;
+		}
+		if( name_character >= 0x0080 )
+		{
+			result = 0;
+
+			break;
+		}
+		if( ( name_character >= (uint16_t) 'a' )
+		 && ( name_character <= (uint16_t) 'z' ) )
+		{
+			name_character -= (uint16_t) ( 'a' - 'A' );
+		}
+		if( ascii_name_index >= ascii_name_length )
+		{
+			safe_compare_result = 1;
+
+			break;
+		}
+		if( name_character != (uint16_t) ascii_name[ ascii_name_index ] )
+		{
+			if( name_character < (uint16_t) ascii_name[ ascii_name_index ] )
+			{
+				safe_compare_result = -1;
+			}
+			else
+			{
+				safe_compare_result = 1;
+			}
+			break;
+		}
+		ascii_name_index++;
+	}
+	if( ( result != 0 )
+	 && ( safe_compare_result == 0 )
+	 && ( ascii_name_index < ascii_name_length ) )
+	{
+		safe_compare_result = -1;
+	}
+	if( libregf_named_key_free(
+	     &named_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free named key.",
+		 function );
+
+		goto on_error;
+	}
+	if( arena != NULL )
+	{
+		if( libregf_arena_rewind(
+		     arena,
+		     arena_mark,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to rewind arena.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*compare_result = safe_compare_result;
+
+	return( result );
+
+on_error:
+	if( named_key != NULL )
+	{
+		libregf_named_key_free(
+		 &named_key,
+		 NULL );
+	}
+	if( arena != NULL )
+	{
+		libregf_arena_rewind(
+		 arena,
+		 arena_mark,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Copies the name of the sub key to an upper case ASCII name
+ * Returns 1 if successful, 0 if the sub key name contains non-ASCII characters or does not fit or -1 on error
+ */
+int libregf_key_item_get_sub_key_upper_case_ascii_name(
+     libregf_key_descriptor_t *sub_key_descriptor,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     libregf_arena_t *arena,
+     uint8_t *ascii_name,
+     size_t ascii_name_size,
+     size_t *ascii_name_length,
+     libcerror_error_t **error )
+{
+	libregf_named_key_t *named_key = NULL;
+	static char *function          = "libregf_key_item_get_sub_key_upper_case_ascii_name";
+	size_t arena_mark              = 0;
+	size_t ascii_name_index        = 0;
+	size_t name_index              = 0;
+	uint16_t name_character        = 0;
+	int result                     = 1;
+
+	if( sub_key_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub key descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	if( ascii_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ASCII name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ascii_name_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid ASCII name size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ascii_name_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ASCII name length.",
+		 function );
+
+		return( -1 );
+	}
+	/* The named key is only needed for the name hence the arena
+	 * is rewound afterwards
+	 */
+	if( arena != NULL )
+	{
+		if( libregf_arena_get_mark(
+		     arena,
+		     &arena_mark,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve arena mark.",
+			 function );
+
+			return( -1 );
+		}
+		result = libregf_named_key_initialize_from_arena(
+		          &named_key,
+		          arena,
+		          error );
+	}
+	else
+	{
+		result = libregf_named_key_initialize(
+		          &named_key,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create named key.",
+		 function );
+
+		goto on_error;
+	}
+	if( libregf_key_item_read_named_key(
+	     named_key,
+	     file_io_handle,
+	     hive_bins_list,
+	     sub_key_descriptor->key_offset,
+	     sub_key_descriptor->hash_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read named key at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 function,
+		 sub_key_descriptor->key_offset,
+		 sub_key_descriptor->key_offset );
+
+		goto on_error;
+	}
+	if( named_key->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid named key - missing name.",
+		 function );
+
+		goto on_error;
+	}
+	while( name_index < (size_t) named_key->name_size )
+	{
+		if( ( named_key->flags & LIBREGF_NAMED_KEY_FLAG_NAME_IS_ASCII ) != 0 )
+		{
+			name_character = named_key->name[ name_index ];
+
+			name_index += 1;
+		}
+		else
+		{
+			if( ( name_index + 1 ) >= (size_t) named_key->name_size )
+			{
+				break;
+			}
+			byte_stream_copy_to_uint16_little_endian(
+			 &( named_key->name[ name_index ] ),
+			 name_character );
+
+			name_index += 2;
+		}
+		if( ( name_character >= 0x0080 )
+		 || ( ascii_name_index >= ascii_name_size ) )
+		{
+			result = 0;
+
+			break;
+		}
+		if( ( name_character >= (uint16_t) 'a' )
+		 && ( name_character <= (uint16_t) 'z' ) )
+		{
+			name_character -= (uint16_t) ( 'a' - 'A' );
+		}
+		ascii_name[ ascii_name_index++ ] = (uint8_t) name_character;
+	}
+	if( libregf_named_key_free(
+	     &named_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free named key.",
+		 function );
+
+		goto on_error;
+	}
+	if( arena != NULL )
+	{
+		if( libregf_arena_rewind(
+		     arena,
+		     arena_mark,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to rewind arena.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*ascii_name_length = ascii_name_index;
+
+	return( result );
+
+on_error:
+	if( named_key != NULL )
+	{
+		libregf_named_key_free(
+		 &named_key,
+		 NULL );
+	}
+	if( arena != NULL )
+	{
+		libregf_arena_rewind(
+		 arena,
+		 arena_mark,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Checks if the sub key descriptors are sorted by upper case name
+ * Marks the sub key descriptors as unordered if they are not sorted or if
+ * a sub key name contains non-ASCII characters. The check is done only once
+ * since it requires the name of every sub key to be read
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_item_check_sub_key_descriptors_order(
+     libregf_key_item_t *key_item,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     libcerror_error_t **error )
+{
+	uint8_t ascii_names[ 2 ][ 256 ];
+	size_t ascii_name_lengths[ 2 ];
+
+	libregf_key_descriptor_t *sub_key_descriptor = NULL;
+	static char *function                        = "libregf_key_item_check_sub_key_descriptors_order";
+	size_t compare_length                        = 0;
+	int compare_result                           = 0;
+	int number_of_sub_key_descriptors            = 0;
+	int result                                   = 0;
+	int sub_key_descriptor_index                 = 0;
+	uint8_t current_name_index                   = 0;
+
+	if( key_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key item.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_item->sub_key_descriptors_order_is_checked != 0 )
+	{
+		return( 1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     key_item->sub_key_descriptors,
+	     &number_of_sub_key_descriptors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from sub key descriptors array.",
+		 function );
+
+		return( -1 );
+	}
+	for( sub_key_descriptor_index = 0;
+	     sub_key_descriptor_index < number_of_sub_key_descriptors;
+	     sub_key_descriptor_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     key_item->sub_key_descriptors,
+		     sub_key_descriptor_index,
+		     (intptr_t **) &sub_key_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub key descriptor: %d from array.",
+			 function,
+			 sub_key_descriptor_index );
+
+			return( -1 );
+		}
+		result = libregf_key_item_get_sub_key_upper_case_ascii_name(
+		          sub_key_descriptor,
+		          file_io_handle,
+		          hive_bins_list,
+		          key_item->arena,
+		          ascii_names[ current_name_index ],
+		          256,
+		          &( ascii_name_lengths[ current_name_index ] ),
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub key descriptor: %d upper case ASCII name.",
+			 function,
+			 sub_key_descriptor_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			key_item->sub_key_descriptors_are_unordered = 1;
+
+			break;
+		}
+		if( sub_key_descriptor_index > 0 )
+		{
+			/* Compare the previous name with the current name
+			 */
+			compare_length = ascii_name_lengths[ 1 - current_name_index ];
+
+			if( compare_length > ascii_name_lengths[ current_name_index ] )
+			{
+				compare_length = ascii_name_lengths[ current_name_index ];
+			}
+			compare_result = memory_compare(
+			                  ascii_names[ 1 - current_name_index ],
+			                  ascii_names[ current_name_index ],
+			                  compare_length );
+
+			if( ( compare_result > 0 )
+			 || ( ( compare_result == 0 )
+			  && ( ascii_name_lengths[ 1 - current_name_index ] > ascii_name_lengths[ current_name_index ] ) ) )
+			{
+				key_item->sub_key_descriptors_are_unordered = 1;
+
+				break;
+			}
+		}
+		current_name_index = 1 - current_name_index;
+	}
+	key_item->sub_key_descriptors_order_is_checked = 1;
+
+	return( 1 );
+}
+
+/* Retrieves the index of the sub key descriptor for the specific upper case ASCII name
+ * This function relies on the sub key descriptors being sorted by upper case name
+ * and marks the sub key descriptors as unordered if this cannot be relied on
+ * Returns 1 if successful, 0 if no such sub key descriptor or -1 on error
+ */
+int libregf_key_item_get_sub_key_descriptor_index_by_upper_case_ascii_name(
+     libregf_key_item_t *key_item,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     const uint8_t *ascii_name,
+     size_t ascii_name_length,
+     int *sub_key_descriptor_index,
+     libcerror_error_t **error )
+{
+	libregf_key_descriptor_t *sub_key_descriptor = NULL;
+	static char *function                        = "libregf_key_item_get_sub_key_descriptor_index_by_upper_case_ascii_name";
+	int compare_result                           = 0;
+	int first_sub_key_descriptor_index           = 0;
+	int last_sub_key_descriptor_index            = 0;
+	int middle_sub_key_descriptor_index          = 0;
+	int number_of_sub_key_descriptors            = 0;
+	int result                                   = 0;
+
+	if( key_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key item.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_key_descriptor_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub key descriptor index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libregf_key_item_read_parts(
+	     key_item,
+	     LIBREGF_KEY_ITEM_READ_FLAG_SUB_KEYS_LIST,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sub keys list.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_item->sub_key_descriptors_are_unordered != 0 )
+	{
+		return( 0 );
+	}
+	/* The sort order of a corrupted key cannot be relied on
+	 */
+	if( ( key_item->item_flags & LIBREGF_ITEM_FLAG_IS_CORRUPTED ) != 0 )
+	{
+		key_item->sub_key_descriptors_are_unordered = 1;
+
+		return( 0 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     key_item->sub_key_descriptors,
+	     &number_of_sub_key_descriptors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from sub key descriptors array.",
+		 function );
+
+		return( -1 );
+	}
+	last_sub_key_descriptor_index = number_of_sub_key_descriptors - 1;
+
+	while( first_sub_key_descriptor_index <= last_sub_key_descriptor_index )
+	{
+		middle_sub_key_descriptor_index = first_sub_key_descriptor_index
+		                                + ( ( last_sub_key_descriptor_index - first_sub_key_descriptor_index ) / 2 );
+
+		if( libcdata_array_get_entry_by_index(
+		     key_item->sub_key_descriptors,
+		     middle_sub_key_descriptor_index,
+		     (intptr_t **) &sub_key_descriptor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub key descriptor: %d from array.",
+			 function,
+			 middle_sub_key_descriptor_index );
+
+			return( -1 );
+		}
+		result = libregf_key_item_compare_sub_key_name_order_with_upper_case_ascii_name(
+		          sub_key_descriptor,
+		          file_io_handle,
+		          hive_bins_list,
+		          key_item->arena,
+		          ascii_name,
+		          ascii_name_length,
+		          &compare_result,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare sub key descriptor: %d name with ASCII name.",
+			 function,
+			 middle_sub_key_descriptor_index );
+
+			return( -1 );
+		}
+		/* The sort order of non-ASCII names is determined by the upper case
+		 * mapping of Windows which is not necessarily the same as towupper
+		 */
+		else if( result == 0 )
+		{
+			key_item->sub_key_descriptors_are_unordered = 1;
+
+			return( 0 );
+		}
+		if( compare_result == 0 )
+		{
+			*sub_key_descriptor_index = middle_sub_key_descriptor_index;
+
+			return( 1 );
+		}
+		else if( compare_result < 0 )
+		{
+			first_sub_key_descriptor_index = middle_sub_key_descriptor_index + 1;
+		}
+		else
+		{
+			last_sub_key_descriptor_index = middle_sub_key_descriptor_index - 1;
+		}
+	}
+	/* A sub keys list that is out of order but otherwise valid is not marked
+	 * as corrupted hence the order is checked before a miss is trusted
+	 */
+	if( libregf_key_item_check_sub_key_descriptors_order(
+	     key_item,
+	     file_io_handle,
+	     hive_bins_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to check sub key descriptors order.",
+		 function );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+/* Retrieves the sub key descriptor for the specific UTF-8 encoded name
+ * Returns 1 if successful, 0 if no such value or -1 on error
+ */
+int libregf_key_item_get_sub_key_descriptor_by_utf8_name(
+     libregf_key_item_t *key_item,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     uint32_t name_hash,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libregf_key_descriptor_t **sub_key_descriptor,
+     libcerror_error_t **error )
+{
+	uint8_t upper_case_ascii_name[ 256 ];
+
+	libregf_key_descriptor_t *safe_sub_key_descriptor = NULL;
+	libregf_hash_table_t *name_hash_table             = NULL;
+	static char *function                             = "libregf_key_item_get_sub_key_descriptor_by_utf8_name";
+	intptr_t hash_table_value                         = 0;
+	uint32_t sub_key_name_hash                        = 0;
+	int hash_table_entry_index                        = 0;
+	int number_of_sub_key_descriptors                 = 0;
+	int result                                        = 0;
+	int sub_key_descriptor_index                      = 0;
+
+	if( key_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key item.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_key_descriptor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub key descriptor.",
+		 function );
+
+		return( -1 );
+	}
+	*sub_key_descriptor = NULL;
+
+	if( libregf_key_item_read_parts(
+	     key_item,
+	     LIBREGF_KEY_ITEM_READ_FLAG_SUB_KEYS_LIST,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sub keys list.",
+		 function );
+
+		return( -1 );
+	}
+
+	result = libregf_key_item_get_sub_key_name_hash_table(
+	          key_item,
+	          &name_hash_table,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub key name hash table.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		result = libregf_key_item_get_utf8_sub_key_name_hash(
+		          utf8_string,
+		          utf8_string_length,
+		          &sub_key_name_hash,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine sub key name hash.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( result != 0 )
+	{
+		/* Only the sub keys with a matching name hash need to be read
+		 */
+		result = libregf_hash_table_get_first_value(
+		          name_hash_table,
+		          sub_key_name_hash,
+		          &hash_table_entry_index,
+		          &hash_table_value,
+		          error );
+
+		if( result == 1 )
+		{
+			sub_key_descriptor_index = (int) hash_table_value;
+		}
+
+		while( result == 1 )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     key_item->sub_key_descriptors,
+			     sub_key_descriptor_index,
+			     (intptr_t **) &safe_sub_key_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sub key descriptor: %d from array.",
+				 function,
+				 sub_key_descriptor_index );
+
+				return( -1 );
+			}
+			result = libregf_key_item_compare_sub_key_name_with_utf8_string(
+			          safe_sub_key_descriptor,
+			          file_io_handle,
+			          hive_bins_list,
+			          key_item->arena,
+			          name_hash,
+			          utf8_string,
+			          utf8_string_length,
+			          error );
+
+			if( result != 0 )
+			{
+				break;
+			}
+			result = libregf_hash_table_get_next_value(
+			          name_hash_table,
+			          sub_key_name_hash,
+			          &hash_table_entry_index,
+			          &hash_table_value,
+			          error );
+
+			if( result == 1 )
+			{
+				sub_key_descriptor_index = (int) hash_table_value;
+			}
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub key descriptor by name hash.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			*sub_key_descriptor = safe_sub_key_descriptor;
+		}
+		return( result );
+	}
+	if( key_item->sub_key_descriptors_are_unordered == 0 )
+	{
+		result = libregf_key_item_get_utf8_upper_case_ascii_name(
+		          utf8_string,
+		          utf8_string_length,
+		          upper_case_ascii_name,
+		          256,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine upper case ASCII name.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			/* Windows stores the sub keys sorted by upper case name
+			 */
+			result = libregf_key_item_get_sub_key_descriptor_index_by_upper_case_ascii_name(
+			          key_item,
+			          file_io_handle,
+			          hive_bins_list,
+			          upper_case_ascii_name,
+			          utf8_string_length,
+			          &sub_key_descriptor_index,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sub key descriptor index by upper case ASCII name.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				if( libcdata_array_get_entry_by_index(
+				     key_item->sub_key_descriptors,
+				     sub_key_descriptor_index,
+				     (intptr_t **) sub_key_descriptor,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve sub key descriptor: %d from array.",
+					 function,
+					 sub_key_descriptor_index );
 
-			goto on_error;
+					return( -1 );
+				}
+				return( 1 );
+			}
+			/* Fall back to a linear search if the sort order cannot be relied on
+			 */
+			else if( key_item->sub_key_descriptors_are_unordered == 0 )
+			{
+				return( 0 );
+			}
 		}
-		if( libregf_key_item_read_named_key(
-		     named_key,
-		     file_io_handle,
-		     hive_bins_list,
-		     safe_sub_key_descriptor->key_offset,
-		     safe_sub_key_descriptor->hash_value,
+	}
+	if( libcdata_array_get_number_of_entries(
+	     key_item->sub_key_descriptors,
+	     &number_of_sub_key_descriptors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from sub key descriptors array.",
+		 function );
+
+		return( -1 );
+	}
+	for( sub_key_descriptor_index = 0;
+	     sub_key_descriptor_index < number_of_sub_key_descriptors;
+	     sub_key_descriptor_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     key_item->sub_key_descriptors,
+		     sub_key_descriptor_index,
+		     (intptr_t **) &safe_sub_key_descriptor,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read named key at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub key descriptor: %d from array.",
 			 function,
-			 safe_sub_key_descriptor->key_offset,
-			 safe_sub_key_descriptor->key_offset );
+			 sub_key_descriptor_index );
 
-			goto on_error;
+			return( -1 );
 		}
-		result = libregf_named_key_compare_name_with_utf8_string(
-		          named_key,
+		result = libregf_key_item_compare_sub_key_name_with_utf8_string(
+		          safe_sub_key_descriptor,
+		          file_io_handle,
+		          hive_bins_list,
+		          key_item->arena,
 		          name_hash,
 		          utf8_string,
 		          utf8_string_length,
-		          hive_bins_list->io_handle->ascii_codepage,
 		          error );
 
 		if( result == -1 )
@@ -2496,45 +5072,20 @@ int libregf_key_item_get_sub_key_descriptor_by_utf8_name(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to compare named key with UTF-8 string.",
-			 function );
+			 "%s: unable to compare sub key descriptor: %d name with UTF-8 string.",
+			 function,
+			 sub_key_descriptor_index );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( libregf_named_key_free(
-		     &named_key,
-		     error ) != 1 )
+		else if( result != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free named key.",
-			 function );
+			*sub_key_descriptor = safe_sub_key_descriptor;
 
-			goto on_error;
-		}
-		if( result != 0 )
-		{
-			break;
+			return( 1 );
 		}
 	}
-	if( sub_key_descriptor_index >= number_of_sub_key_descriptors )
-	{
-		return( 0 );
-	}
-	*sub_key_descriptor = safe_sub_key_descriptor;
-
-	return( 1 );
-
-on_error:
-	if( named_key != NULL )
-	{
-		libregf_named_key_free(
-		 &named_key,
-		 NULL );
-	}
-	return( -1 );
+	return( 0 );
 }
 
 /* Retrieves the sub key descriptor for the specific UTF-16 encoded name
@@ -2550,9 +5101,14 @@ int libregf_key_item_get_sub_key_descriptor_by_utf16_name(
      libregf_key_descriptor_t **sub_key_descriptor,
      libcerror_error_t **error )
 {
+	uint8_t upper_case_ascii_name[ 256 ];
+
 	libregf_key_descriptor_t *safe_sub_key_descriptor = NULL;
-	libregf_named_key_t *named_key                    = NULL;
+	libregf_hash_table_t *name_hash_table             = NULL;
 	static char *function                             = "libregf_key_item_get_sub_key_descriptor_by_utf16_name";
+	intptr_t hash_table_value                         = 0;
+	uint32_t sub_key_name_hash                        = 0;
+	int hash_table_entry_index                        = 0;
 	int number_of_sub_key_descriptors                 = 0;
 	int result                                        = 0;
 	int sub_key_descriptor_index                      = 0;
@@ -2568,117 +5124,261 @@ int libregf_key_item_get_sub_key_descriptor_by_utf16_name(
 
 		return( -1 );
 	}
-	if( hive_bins_list == NULL )
+	if( sub_key_descriptor == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid hive bins list.",
+		 "%s: invalid sub key descriptor.",
 		 function );
 
 		return( -1 );
 	}
-	if( hive_bins_list->io_handle == NULL )
+	*sub_key_descriptor = NULL;
+
+	if( libregf_key_item_read_parts(
+	     key_item,
+	     LIBREGF_KEY_ITEM_READ_FLAG_SUB_KEYS_LIST,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid hive bins list - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sub keys list.",
 		 function );
 
 		return( -1 );
 	}
-	*sub_key_descriptor = NULL;
 
-/* TODO think of caching and/or optimization
- * e.g. mapping sub key descriptors to name search tree?
- */
-	if( libcdata_array_get_number_of_entries(
-	     key_item->sub_key_descriptors,
-	     &number_of_sub_key_descriptors,
-	     error ) != 1 )
+	result = libregf_key_item_get_sub_key_name_hash_table(
+	          key_item,
+	          &name_hash_table,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries from sub key descriptors array.",
+		 "%s: unable to retrieve sub key name hash table.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	for( sub_key_descriptor_index = 0;
-	     sub_key_descriptor_index < number_of_sub_key_descriptors;
-	     sub_key_descriptor_index++ )
+	else if( result != 0 )
 	{
-		if( libcdata_array_get_entry_by_index(
-		     key_item->sub_key_descriptors,
-		     sub_key_descriptor_index,
-		     (intptr_t **) &safe_sub_key_descriptor,
-		     error ) != 1 )
+		result = libregf_key_item_get_utf16_sub_key_name_hash(
+		          utf16_string,
+		          utf16_string_length,
+		          &sub_key_name_hash,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve sub key descriptor: %d from array.",
-			 function,
-			 sub_key_descriptor_index );
+			 "%s: unable to determine sub key name hash.",
+			 function );
 
-			goto on_error;
+			return( -1 );
+		}
+	}
+	if( result != 0 )
+	{
+		/* Only the sub keys with a matching name hash need to be read
+		 */
+		result = libregf_hash_table_get_first_value(
+		          name_hash_table,
+		          sub_key_name_hash,
+		          &hash_table_entry_index,
+		          &hash_table_value,
+		          error );
+
+		if( result == 1 )
+		{
+			sub_key_descriptor_index = (int) hash_table_value;
+		}
+
+		while( result == 1 )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     key_item->sub_key_descriptors,
+			     sub_key_descriptor_index,
+			     (intptr_t **) &safe_sub_key_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sub key descriptor: %d from array.",
+				 function,
+				 sub_key_descriptor_index );
+
+				return( -1 );
+			}
+			result = libregf_key_item_compare_sub_key_name_with_utf16_string(
+			          safe_sub_key_descriptor,
+			          file_io_handle,
+			          hive_bins_list,
+			          key_item->arena,
+			          name_hash,
+			          utf16_string,
+			          utf16_string_length,
+			          error );
+
+			if( result != 0 )
+			{
+				break;
+			}
+			result = libregf_hash_table_get_next_value(
+			          name_hash_table,
+			          sub_key_name_hash,
+			          &hash_table_entry_index,
+			          &hash_table_value,
+			          error );
+
+			if( result == 1 )
+			{
+				sub_key_descriptor_index = (int) hash_table_value;
+			}
 		}
-		if( safe_sub_key_descriptor == NULL )
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing sub key descriptor: %d.",
-			 function,
-			 sub_key_descriptor_index );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub key descriptor by name hash.",
+			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( libregf_named_key_initialize(
-		     &named_key,
-		     error ) != 1 )
+		else if( result != 0 )
+		{
+			*sub_key_descriptor = safe_sub_key_descriptor;
+		}
+		return( result );
+	}
+	if( key_item->sub_key_descriptors_are_unordered == 0 )
+	{
+		result = libregf_key_item_get_utf16_upper_case_ascii_name(
+		          utf16_string,
+		          utf16_string_length,
+		          upper_case_ascii_name,
+		          256,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create named key.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine upper case ASCII name.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( libregf_key_item_read_named_key(
-		     named_key,
-		     file_io_handle,
-		     hive_bins_list,
-		     safe_sub_key_descriptor->key_offset,
-		     safe_sub_key_descriptor->hash_value,
+		else if( result != 0 )
+		{
+			/* Windows stores the sub keys sorted by upper case name
+			 */
+			result = libregf_key_item_get_sub_key_descriptor_index_by_upper_case_ascii_name(
+			          key_item,
+			          file_io_handle,
+			          hive_bins_list,
+			          upper_case_ascii_name,
+			          utf16_string_length,
+			          &sub_key_descriptor_index,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sub key descriptor index by upper case ASCII name.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				if( libcdata_array_get_entry_by_index(
+				     key_item->sub_key_descriptors,
+				     sub_key_descriptor_index,
+				     (intptr_t **) sub_key_descriptor,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve sub key descriptor: %d from array.",
+					 function,
+					 sub_key_descriptor_index );
+
+					return( -1 );
+				}
+				return( 1 );
+			}
+			/* Fall back to a linear search if the sort order cannot be relied on
+			 */
+			else if( key_item->sub_key_descriptors_are_unordered == 0 )
+			{
+				return( 0 );
+			}
+		}
+	}
+	if( libcdata_array_get_number_of_entries(
+	     key_item->sub_key_descriptors,
+	     &number_of_sub_key_descriptors,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from sub key descriptors array.",
+		 function );
+
+		return( -1 );
+	}
+	for( sub_key_descriptor_index = 0;
+	     sub_key_descriptor_index < number_of_sub_key_descriptors;
+	     sub_key_descriptor_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     key_item->sub_key_descriptors,
+		     sub_key_descriptor_index,
+		     (intptr_t **) &safe_sub_key_descriptor,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read named key at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub key descriptor: %d from array.",
 			 function,
-			 safe_sub_key_descriptor->key_offset,
-			 safe_sub_key_descriptor->key_offset );
+			 sub_key_descriptor_index );
 
-			goto on_error;
+			return( -1 );
 		}
-		result = libregf_named_key_compare_name_with_utf16_string(
-		          named_key,
+		result = libregf_key_item_compare_sub_key_name_with_utf16_string(
+		          safe_sub_key_descriptor,
+		          file_io_handle,
+		          hive_bins_list,
+		          key_item->arena,
 		          name_hash,
 		          utf16_string,
 		          utf16_string_length,
-		          hive_bins_list->io_handle->ascii_codepage,
 		          error );
 
 		if( result == -1 )
@@ -2687,44 +5387,19 @@ int libregf_key_item_get_sub_key_descriptor_by_utf16_name(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to compare named key with UTF-16 string.",
-			 function );
+			 "%s: unable to compare sub key descriptor: %d name with UTF-16 string.",
+			 function,
+			 sub_key_descriptor_index );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( libregf_named_key_free(
-		     &named_key,
-		     error ) != 1 )
+		else if( result != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free named key.",
-			 function );
+			*sub_key_descriptor = safe_sub_key_descriptor;
 
-			goto on_error;
-		}
-		if( result != 0 )
-		{
-			break;
+			return( 1 );
 		}
 	}
-	if( sub_key_descriptor_index >= number_of_sub_key_descriptors )
-	{
-		return( 0 );
-	}
-	*sub_key_descriptor = safe_sub_key_descriptor;
-
-	return( 1 );
-
-on_error:
-	if( named_key != NULL )
-	{
-		libregf_named_key_free(
-		 &named_key,
-		 NULL );
-	}
-	return( -1 );
+	return( 0 );
 }
 
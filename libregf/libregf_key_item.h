@@ -25,11 +25,14 @@
 #include <common.h>
 #include <types.h>
 
+#include "libregf_arena.h"
+#include "libregf_hash_table.h"
 #include "libregf_hive_bins_list.h"
 #include "libregf_key_descriptor.h"
 #include "libregf_libbfio.h"
 #include "libregf_libcdata.h"
 #include "libregf_libcerror.h"
+#include "libregf_libcthreads.h"
 #include "libregf_libfcache.h"
 #include "libregf_libfdata.h"
 #include "libregf_named_key.h"
@@ -62,6 +65,10 @@ struct libregf_key_item
 	 */
 	size_t security_descriptor_size;
 
+	/* Value to indicate the security descriptor is owned by the security key cache
+	 */
+	uint8_t security_descriptor_is_shared;
+
 	/* The values list
 	 */
 	libfdata_list_t *values_list;
@@ -70,13 +77,60 @@ struct libregf_key_item
 	 */
 	libfcache_cache_t *values_cache;
 
+	/* The values name hash table, which is created on demand
+	 */
+	libregf_hash_table_t *values_name_hash_table;
+
+	/* Value to indicate the values name hash table is not available
+	 */
+	uint8_t values_name_hash_table_is_unavailable;
+
 	/* The sub key descriptors
 	 */
 	libcdata_array_t *sub_key_descriptors;
 
+	/* The arena the sub key descriptors and the transient named keys
+	 * of the sub key name comparisons are allocated from
+	 */
+	libregf_arena_t *arena;
+
+	/* The sub key descriptors name hash table, which is created on demand
+	 */
+	libregf_hash_table_t *sub_key_name_hash_table;
+
+	/* Value to indicate the sub key descriptors name hash table is not available
+	 */
+	uint8_t sub_key_name_hash_table_is_unavailable;
+
+	/* Value to indicate the sub key descriptors are not sorted by upper case name
+	 */
+	uint8_t sub_key_descriptors_are_unordered;
+
+	/* Value to indicate the sort order of the sub key descriptors was checked
+	 */
+	uint8_t sub_key_descriptors_order_is_checked;
+
 	/* Various item flags
 	 */
 	uint8_t item_flags;
+
+	/* The read flags, which indicate the parts that have been read
+	 */
+	uint8_t read_flags;
+
+	/* The file IO handle, which is used to read the parts on demand
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The hive bins list, which is used to read the parts on demand
+	 */
+	libregf_hive_bins_list_t *hive_bins_list;
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	/* The read/write lock, which is shared by the keys that reference the key item
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 int libregf_key_item_initialize(
@@ -95,6 +149,11 @@ int libregf_key_item_read(
      uint32_t named_key_hash,
      libcerror_error_t **error );
 
+int libregf_key_item_read_parts(
+     libregf_key_item_t *key_item,
+     uint8_t read_flags,
+     libcerror_error_t **error );
+
 int libregf_key_item_read_named_key(
      libregf_named_key_t *named_key,
      libbfio_handle_t *file_io_handle,
@@ -135,6 +194,7 @@ int libregf_key_item_read_values_list(
 
 int libregf_key_item_read_sub_keys_list(
      libcdata_array_t *sub_key_descriptors,
+     libregf_arena_t *arena,
      libbfio_handle_t *file_io_handle,
      libregf_hive_bins_list_t *hive_bins_list,
      off64_t sub_keys_list_offset,
@@ -224,6 +284,11 @@ int libregf_key_item_get_last_written_time(
      uint64_t *filetime,
      libcerror_error_t **error );
 
+int libregf_key_item_get_security_key_offset(
+     libregf_key_item_t *key_item,
+     uint32_t *security_key_offset,
+     libcerror_error_t **error );
+
 int libregf_key_item_get_security_descriptor_size(
      libregf_key_item_t *key_item,
      size_t *security_descriptor_size,
@@ -240,6 +305,12 @@ int libregf_key_item_get_number_of_values(
      int *number_of_values,
      libcerror_error_t **error );
 
+int libregf_key_item_get_values_name_hash_table(
+     libregf_key_item_t *key_item,
+     libbfio_handle_t *file_io_handle,
+     libregf_hash_table_t **name_hash_table,
+     libcerror_error_t **error );
+
 int libregf_key_item_get_number_of_sub_key_descriptors(
      libregf_key_item_t *key_item,
      int *number_of_sub_key_descriptors,
@@ -251,6 +322,92 @@ int libregf_key_item_get_sub_key_descriptor_by_index(
      libregf_key_descriptor_t **sub_key_descriptor,
      libcerror_error_t **error );
 
+int libregf_key_item_get_sub_key_name_hash_table(
+     libregf_key_item_t *key_item,
+     libregf_hash_table_t **name_hash_table,
+     libcerror_error_t **error );
+
+int libregf_key_item_get_utf8_sub_key_name_hash(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint32_t *name_hash,
+     libcerror_error_t **error );
+
+int libregf_key_item_get_utf16_sub_key_name_hash(
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint32_t *name_hash,
+     libcerror_error_t **error );
+
+int libregf_key_item_compare_sub_key_name_with_utf8_string(
+     libregf_key_descriptor_t *sub_key_descriptor,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     libregf_arena_t *arena,
+     uint32_t name_hash,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error );
+
+int libregf_key_item_compare_sub_key_name_with_utf16_string(
+     libregf_key_descriptor_t *sub_key_descriptor,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     libregf_arena_t *arena,
+     uint32_t name_hash,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcerror_error_t **error );
+
+int libregf_key_item_get_utf8_upper_case_ascii_name(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint8_t *ascii_name,
+     size_t ascii_name_size,
+     libcerror_error_t **error );
+
+int libregf_key_item_get_utf16_upper_case_ascii_name(
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint8_t *ascii_name,
+     size_t ascii_name_size,
+     libcerror_error_t **error );
+
+int libregf_key_item_compare_sub_key_name_order_with_upper_case_ascii_name(
+     libregf_key_descriptor_t *sub_key_descriptor,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     libregf_arena_t *arena,
+     const uint8_t *ascii_name,
+     size_t ascii_name_length,
+     int *compare_result,
+     libcerror_error_t **error );
+
+int libregf_key_item_get_sub_key_upper_case_ascii_name(
+     libregf_key_descriptor_t *sub_key_descriptor,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     libregf_arena_t *arena,
+     uint8_t *ascii_name,
+     size_t ascii_name_size,
+     size_t *ascii_name_length,
+     libcerror_error_t **error );
+
+int libregf_key_item_check_sub_key_descriptors_order(
+     libregf_key_item_t *key_item,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     libcerror_error_t **error );
+
+int libregf_key_item_get_sub_key_descriptor_index_by_upper_case_ascii_name(
+     libregf_key_item_t *key_item,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     const uint8_t *ascii_name,
+     size_t ascii_name_length,
+     int *sub_key_descriptor_index,
+     libcerror_error_t **error );
+
 int libregf_key_item_get_sub_key_descriptor_by_utf8_name(
      libregf_key_item_t *key_item,
      libbfio_handle_t *file_io_handle,
@@ -0,0 +1,867 @@
+/*
+ * Key item cache functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libregf_hash_table.h"
+#include "libregf_hive_bins_list.h"
+#include "libregf_key_item.h"
+#include "libregf_key_item_cache.h"
+#include "libregf_libbfio.h"
+#include "libregf_libcerror.h"
+#include "libregf_libcthreads.h"
+
+/* The initial number of entries of the key item cache
+ */
+#define LIBREGF_KEY_ITEM_CACHE_INITIAL_NUMBER_OF_ENTRIES	256
+
+/* Creates a key item cache
+ * Make sure the value key_item_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_item_cache_initialize(
+     libregf_key_item_cache_t **key_item_cache,
+     int maximum_number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_key_item_cache_initialize";
+
+	if( key_item_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key item cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *key_item_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid key item cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_entries <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*key_item_cache = memory_allocate_structure(
+	                   libregf_key_item_cache_t );
+
+	if( *key_item_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create key item cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *key_item_cache,
+	     0,
+	     sizeof( libregf_key_item_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear key item cache.",
+		 function );
+
+		memory_free(
+		 *key_item_cache );
+
+		*key_item_cache = NULL;
+
+		return( -1 );
+	}
+	if( libregf_hash_table_initialize(
+	     &( ( *key_item_cache )->hash_table ),
+	     LIBREGF_KEY_ITEM_CACHE_INITIAL_NUMBER_OF_ENTRIES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create hash table.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *key_item_cache )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *key_item_cache )->maximum_number_of_entries = maximum_number_of_entries;
+
+	return( 1 );
+
+on_error:
+	if( *key_item_cache != NULL )
+	{
+		if( ( *key_item_cache )->hash_table != NULL )
+		{
+			libregf_hash_table_free(
+			 &( ( *key_item_cache )->hash_table ),
+			 NULL,
+			 NULL );
+		}
+		memory_free(
+		 *key_item_cache );
+
+		*key_item_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a key item cache
+ * The key items are freed regardless of their number of references
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_item_cache_free(
+     libregf_key_item_cache_t **key_item_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_key_item_cache_free";
+	int result            = 1;
+
+	if( key_item_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key item cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *key_item_cache != NULL )
+	{
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *key_item_cache )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( libregf_hash_table_free(
+		     &( ( *key_item_cache )->hash_table ),
+		     (int (*)(intptr_t *, libcerror_error_t **)) &libregf_key_item_cache_entry_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free hash table.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *key_item_cache );
+
+		*key_item_cache = NULL;
+	}
+	return( result );
+}
+
+/* Frees a key item cache entry and its key item
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_item_cache_entry_free(
+     libregf_key_item_cache_entry_t **entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_key_item_cache_entry_free";
+	int result            = 1;
+
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *entry != NULL )
+	{
+		if( ( *entry )->key_item != NULL )
+		{
+			if( libregf_key_item_free(
+			     &( ( *entry )->key_item ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free key item.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *entry );
+
+		*entry = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves the entry of a specific key offset
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libregf_key_item_cache_get_entry_by_offset(
+     libregf_key_item_cache_t *key_item_cache,
+     uint32_t key_offset,
+     libregf_key_item_cache_entry_t **entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_key_item_cache_get_entry_by_offset";
+	intptr_t value        = 0;
+	int entry_index       = 0;
+	int result            = 0;
+
+	if( key_item_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key item cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	result = libregf_hash_table_get_first_value(
+	          key_item_cache->hash_table,
+	          key_offset,
+	          &entry_index,
+	          &value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from hash table.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		*entry = (libregf_key_item_cache_entry_t *) value;
+	}
+	return( result );
+}
+
+/* Inserts an entry
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_item_cache_insert_entry(
+     libregf_key_item_cache_t *key_item_cache,
+     libregf_key_item_cache_entry_t *entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_key_item_cache_insert_entry";
+
+	if( key_item_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key item cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libregf_hash_table_insert_value(
+	     key_item_cache->hash_table,
+	     entry->key_offset,
+	     (intptr_t) entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert entry in hash table.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Evicts the least recently released unreferenced entries while the cache exceeds
+ * its maximum number of entries
+ * Entries that are still referenced are never evicted
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_item_cache_evict_entries(
+     libregf_key_item_cache_t *key_item_cache,
+     libcerror_error_t **error )
+{
+	libregf_key_item_cache_entry_t *entry = NULL;
+	static char *function                 = "libregf_key_item_cache_evict_entries";
+
+	if( key_item_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key item cache.",
+		 function );
+
+		return( -1 );
+	}
+	while( ( key_item_cache->hash_table->number_of_values > key_item_cache->maximum_number_of_entries )
+	    && ( key_item_cache->last_unreferenced_entry != NULL ) )
+	{
+		entry = key_item_cache->last_unreferenced_entry;
+
+		key_item_cache->last_unreferenced_entry = entry->previous_unreferenced_entry;
+
+		if( key_item_cache->last_unreferenced_entry != NULL )
+		{
+			key_item_cache->last_unreferenced_entry->next_unreferenced_entry = NULL;
+		}
+		else
+		{
+			key_item_cache->first_unreferenced_entry = NULL;
+		}
+		if( libregf_hash_table_remove_value(
+		     key_item_cache->hash_table,
+		     entry->key_offset,
+		     (intptr_t) entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove entry from hash table.",
+			 function );
+
+			return( -1 );
+		}
+		if( libregf_key_item_cache_entry_free(
+		     &entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free entry.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the key item of a specific key offset
+ * The key item is read if not already cached. The key item must be released
+ * with libregf_key_item_cache_release_key_item when no longer used
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_item_cache_get_key_item(
+     libregf_key_item_cache_t *key_item_cache,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     uint32_t key_offset,
+     uint32_t named_key_hash,
+     libregf_key_item_t **key_item,
+     libcerror_error_t **error )
+{
+	libregf_key_item_cache_entry_t *entry          = NULL;
+	libregf_key_item_cache_entry_t *existing_entry = NULL;
+	libregf_key_item_t *new_key_item               = NULL;
+	static char *function                          = "libregf_key_item_cache_get_key_item";
+	int result                                     = 0;
+
+	if( key_item_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key item cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key item.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     key_item_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libregf_key_item_cache_get_entry_by_offset(
+	          key_item_cache,
+	          key_offset,
+	          &entry,
+	          error );
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( result != 1 )
+	{
+		if( libcthreads_mutex_release(
+		     key_item_cache->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry for key offset: %" PRIu32 ".",
+		 function,
+		 key_offset );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		/* The key item is read without holding the mutex so that other
+		 * keys can be retrieved from the cache in the meantime
+		 */
+		if( libregf_key_item_initialize(
+		     &new_key_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create key item.",
+			 function );
+
+			goto on_error;
+		}
+		if( libregf_key_item_read(
+		     new_key_item,
+		     file_io_handle,
+		     hive_bins_list,
+		     (off64_t) key_offset,
+		     named_key_hash,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read key item at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+			 function,
+			 key_offset,
+			 key_offset );
+
+			goto on_error;
+		}
+		entry = memory_allocate_structure(
+		         libregf_key_item_cache_entry_t );
+
+		if( entry == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create entry.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     entry,
+		     0,
+		     sizeof( libregf_key_item_cache_entry_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear entry.",
+			 function );
+
+			goto on_error;
+		}
+		entry->key_offset = key_offset;
+		entry->key_item   = new_key_item;
+
+		new_key_item = NULL;
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     key_item_cache->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			goto on_error;
+		}
+		/* Another thread could have cached the same key item in the meantime
+		 */
+		result = libregf_key_item_cache_get_entry_by_offset(
+		          key_item_cache,
+		          key_offset,
+		          &existing_entry,
+		          error );
+#endif
+		if( result == 0 )
+		{
+			result = libregf_key_item_cache_insert_entry(
+			          key_item_cache,
+			          entry,
+			          error );
+
+			if( result == 1 )
+			{
+				existing_entry = entry;
+				entry          = NULL;
+
+				result = libregf_key_item_cache_evict_entries(
+				          key_item_cache,
+				          error );
+			}
+		}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+		if( result == -1 )
+		{
+			libcthreads_mutex_release(
+			 key_item_cache->mutex,
+			 NULL );
+		}
+#endif
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to insert entry for key offset: %" PRIu32 " or evict entries.",
+			 function,
+			 key_offset );
+
+			goto on_error;
+		}
+		if( entry != NULL )
+		{
+			libregf_key_item_cache_entry_free(
+			 &entry,
+			 NULL );
+		}
+		entry = existing_entry;
+	}
+	if( entry->number_of_references == 0 )
+	{
+		/* Remove the entry from the unreferenced entries
+		 */
+		if( entry->previous_unreferenced_entry != NULL )
+		{
+			entry->previous_unreferenced_entry->next_unreferenced_entry = entry->next_unreferenced_entry;
+		}
+		else if( key_item_cache->first_unreferenced_entry == entry )
+		{
+			key_item_cache->first_unreferenced_entry = entry->next_unreferenced_entry;
+		}
+		if( entry->next_unreferenced_entry != NULL )
+		{
+			entry->next_unreferenced_entry->previous_unreferenced_entry = entry->previous_unreferenced_entry;
+		}
+		else if( key_item_cache->last_unreferenced_entry == entry )
+		{
+			key_item_cache->last_unreferenced_entry = entry->previous_unreferenced_entry;
+		}
+		entry->previous_unreferenced_entry = NULL;
+		entry->next_unreferenced_entry     = NULL;
+	}
+	entry->number_of_references += 1;
+
+	*key_item = entry->key_item;
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     key_item_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( entry != NULL )
+	{
+		libregf_key_item_cache_entry_free(
+		 &entry,
+		 NULL );
+	}
+	if( new_key_item != NULL )
+	{
+		libregf_key_item_free(
+		 &new_key_item,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Releases the key item of a specific key offset
+ * The key item is kept in the cache until it is evicted
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_item_cache_release_key_item(
+     libregf_key_item_cache_t *key_item_cache,
+     uint32_t key_offset,
+     libcerror_error_t **error )
+{
+	libregf_key_item_cache_entry_t *entry = NULL;
+	static char *function                 = "libregf_key_item_cache_release_key_item";
+	int result                            = 1;
+
+	if( key_item_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key item cache.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     key_item_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libregf_key_item_cache_get_entry_by_offset(
+	          key_item_cache,
+	          key_offset,
+	          &entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry for key offset: %" PRIu32 ".",
+		 function,
+		 key_offset );
+
+		result = -1;
+	}
+	else if( ( result == 0 )
+	      || ( entry->number_of_references <= 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: missing referenced entry for key offset: %" PRIu32 ".",
+		 function,
+		 key_offset );
+
+		result = -1;
+	}
+	else
+	{
+		entry->number_of_references -= 1;
+
+		if( entry->number_of_references == 0 )
+		{
+			/* Add the entry as the most recently released unreferenced entry
+			 */
+			entry->previous_unreferenced_entry = NULL;
+			entry->next_unreferenced_entry     = key_item_cache->first_unreferenced_entry;
+
+			if( key_item_cache->first_unreferenced_entry != NULL )
+			{
+				key_item_cache->first_unreferenced_entry->previous_unreferenced_entry = entry;
+			}
+			else
+			{
+				key_item_cache->last_unreferenced_entry = entry;
+			}
+			key_item_cache->first_unreferenced_entry = entry;
+		}
+		if( libregf_key_item_cache_evict_entries(
+		     key_item_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to evict entries.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     key_item_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
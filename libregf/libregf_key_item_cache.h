@@ -0,0 +1,137 @@
+/*
+ * Key item cache functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBREGF_KEY_ITEM_CACHE_H )
+#define _LIBREGF_KEY_ITEM_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libregf_hash_table.h"
+#include "libregf_key_item.h"
+#include "libregf_libbfio.h"
+#include "libregf_libcerror.h"
+#include "libregf_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libregf_key_item_cache_entry libregf_key_item_cache_entry_t;
+
+struct libregf_key_item_cache_entry
+{
+	/* The key offset
+	 */
+	uint32_t key_offset;
+
+	/* The key item
+	 */
+	libregf_key_item_t *key_item;
+
+	/* The number of references to the key item
+	 */
+	int number_of_references;
+
+	/* The previous unreferenced entry, which was released more recently
+	 */
+	libregf_key_item_cache_entry_t *previous_unreferenced_entry;
+
+	/* The next unreferenced entry, which was released less recently
+	 */
+	libregf_key_item_cache_entry_t *next_unreferenced_entry;
+};
+
+typedef struct libregf_key_item_cache libregf_key_item_cache_t;
+
+struct libregf_key_item_cache
+{
+	/* The hash table, which maps a key offset to its entry
+	 */
+	libregf_hash_table_t *hash_table;
+
+	/* The maximum number of entries
+	 */
+	int maximum_number_of_entries;
+
+	/* The most recently released unreferenced entry
+	 */
+	libregf_key_item_cache_entry_t *first_unreferenced_entry;
+
+	/* The least recently released unreferenced entry, which is evicted first
+	 */
+	libregf_key_item_cache_entry_t *last_unreferenced_entry;
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libregf_key_item_cache_initialize(
+     libregf_key_item_cache_t **key_item_cache,
+     int maximum_number_of_entries,
+     libcerror_error_t **error );
+
+int libregf_key_item_cache_free(
+     libregf_key_item_cache_t **key_item_cache,
+     libcerror_error_t **error );
+
+int libregf_key_item_cache_entry_free(
+     libregf_key_item_cache_entry_t **entry,
+     libcerror_error_t **error );
+
+int libregf_key_item_cache_get_entry_by_offset(
+     libregf_key_item_cache_t *key_item_cache,
+     uint32_t key_offset,
+     libregf_key_item_cache_entry_t **entry,
+     libcerror_error_t **error );
+
+int libregf_key_item_cache_insert_entry(
+     libregf_key_item_cache_t *key_item_cache,
+     libregf_key_item_cache_entry_t *entry,
+     libcerror_error_t **error );
+
+int libregf_key_item_cache_evict_entries(
+     libregf_key_item_cache_t *key_item_cache,
+     libcerror_error_t **error );
+
+int libregf_key_item_cache_get_key_item(
+     libregf_key_item_cache_t *key_item_cache,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     uint32_t key_offset,
+     uint32_t named_key_hash,
+     libregf_key_item_t **key_item,
+     libcerror_error_t **error );
+
+int libregf_key_item_cache_release_key_item(
+     libregf_key_item_cache_t *key_item_cache,
+     uint32_t key_offset,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBREGF_KEY_ITEM_CACHE_H ) */
+
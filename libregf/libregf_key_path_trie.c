@@ -0,0 +1,1330 @@
+/*
+ * Key path trie functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_WCTYPE_H )
+#include <wctype.h>
+#endif
+
+#include "libregf_definitions.h"
+#include "libregf_hive_bins_list.h"
+#include "libregf_io_handle.h"
+#include "libregf_key.h"
+#include "libregf_key_descriptor.h"
+#include "libregf_key_item.h"
+#include "libregf_key_item_cache.h"
+#include "libregf_key_path_trie.h"
+#include "libregf_libbfio.h"
+#include "libregf_libcerror.h"
+#include "libregf_libcthreads.h"
+#include "libregf_libuna.h"
+
+/* Creates a key path trie
+ * Make sure the value key_path_trie is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_path_trie_initialize(
+     libregf_key_path_trie_t **key_path_trie,
+     int number_of_paths,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_key_path_trie_initialize";
+	int path_index        = 0;
+
+	if( key_path_trie == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key path trie.",
+		 function );
+
+		return( -1 );
+	}
+	if( *key_path_trie != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid key path trie value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_paths < 0 )
+	 || ( (size_t) number_of_paths > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( int ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of paths value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*key_path_trie = memory_allocate_structure(
+	                  libregf_key_path_trie_t );
+
+	if( *key_path_trie == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create key path trie.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *key_path_trie,
+	     0,
+	     sizeof( libregf_key_path_trie_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear key path trie.",
+		 function );
+
+		memory_free(
+		 *key_path_trie );
+
+		*key_path_trie = NULL;
+
+		return( -1 );
+	}
+	( *key_path_trie )->root_node = memory_allocate_structure(
+	                                 libregf_key_path_trie_node_t );
+
+	if( ( *key_path_trie )->root_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create root node.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *key_path_trie )->root_node,
+	     0,
+	     sizeof( libregf_key_path_trie_node_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear root node.",
+		 function );
+
+		memory_free(
+		 ( *key_path_trie )->root_node );
+
+		( *key_path_trie )->root_node = NULL;
+
+		goto on_error;
+	}
+	( *key_path_trie )->root_node->path_index = -1;
+
+	if( number_of_paths > 0 )
+	{
+		( *key_path_trie )->next_path_indexes = (int *) memory_allocate(
+		                                                 sizeof( int ) * number_of_paths );
+
+		if( ( *key_path_trie )->next_path_indexes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create next path indexes.",
+			 function );
+
+			goto on_error;
+		}
+		for( path_index = 0;
+		     path_index < number_of_paths;
+		     path_index++ )
+		{
+			( *key_path_trie )->next_path_indexes[ path_index ] = -1;
+		}
+	}
+	( *key_path_trie )->number_of_paths = number_of_paths;
+	( *key_path_trie )->number_of_nodes = 1;
+
+	return( 1 );
+
+on_error:
+	if( *key_path_trie != NULL )
+	{
+		if( ( *key_path_trie )->root_node != NULL )
+		{
+			memory_free(
+			 ( *key_path_trie )->root_node );
+		}
+		memory_free(
+		 *key_path_trie );
+
+		*key_path_trie = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a key path trie
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_path_trie_free(
+     libregf_key_path_trie_t **key_path_trie,
+     libcerror_error_t **error )
+{
+	libregf_key_path_trie_node_t *last_sub_node = NULL;
+	libregf_key_path_trie_node_t *next_node     = NULL;
+	libregf_key_path_trie_node_t *node          = NULL;
+	static char *function                       = "libregf_key_path_trie_free";
+
+	if( key_path_trie == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key path trie.",
+		 function );
+
+		return( -1 );
+	}
+	if( *key_path_trie != NULL )
+	{
+		/* The nodes are freed without recursion by moving the sub nodes
+		 * of a node in front of its next nodes before the node is freed
+		 */
+		node = ( *key_path_trie )->root_node;
+
+		while( node != NULL )
+		{
+			if( node->first_sub_node != NULL )
+			{
+				last_sub_node = node->first_sub_node;
+
+				while( last_sub_node->next_node != NULL )
+				{
+					last_sub_node = last_sub_node->next_node;
+				}
+				last_sub_node->next_node = node->next_node;
+				node->next_node          = node->first_sub_node;
+			}
+			next_node = node->next_node;
+
+			memory_free(
+			 node );
+
+			node = next_node;
+		}
+		if( ( *key_path_trie )->next_path_indexes != NULL )
+		{
+			memory_free(
+			 ( *key_path_trie )->next_path_indexes );
+		}
+		memory_free(
+		 *key_path_trie );
+
+		*key_path_trie = NULL;
+	}
+	return( 1 );
+}
+
+/* Compares the name of a node with an UTF-8 or UTF-16 encoded name
+ * The comparison is case insensitive
+ * Returns 1 if equal, 0 if not or -1 on error
+ */
+int libregf_key_path_trie_compare_names(
+     libregf_key_path_trie_node_t *node,
+     const uint8_t *utf8_name,
+     size_t utf8_name_length,
+     const uint16_t *utf16_name,
+     size_t utf16_name_length,
+     libcerror_error_t **error )
+{
+	libuna_unicode_character_t name_character      = 0;
+	libuna_unicode_character_t node_name_character = 0;
+	static char *function                          = "libregf_key_path_trie_compare_names";
+	size_t name_index                              = 0;
+	size_t node_name_index                         = 0;
+	int result                                     = 0;
+
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( node->utf8_name == NULL )
+	 && ( node->utf16_name == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid node - missing name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_name == NULL )
+	 && ( utf16_name == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	while( 1 )
+	{
+		if( node->utf8_name != NULL )
+		{
+			if( node_name_index >= node->utf8_name_length )
+			{
+				break;
+			}
+			result = libuna_unicode_character_copy_from_utf8(
+			          &node_name_character,
+			          node->utf8_name,
+			          node->utf8_name_length,
+			          &node_name_index,
+			          error );
+		}
+		else
+		{
+			if( node_name_index >= node->utf16_name_length )
+			{
+				break;
+			}
+			result = libuna_unicode_character_copy_from_utf16(
+			          &node_name_character,
+			          node->utf16_name,
+			          node->utf16_name_length,
+			          &node_name_index,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy node name to Unicode character.",
+			 function );
+
+			return( -1 );
+		}
+		if( utf8_name != NULL )
+		{
+			if( name_index >= utf8_name_length )
+			{
+				return( 0 );
+			}
+			result = libuna_unicode_character_copy_from_utf8(
+			          &name_character,
+			          utf8_name,
+			          utf8_name_length,
+			          &name_index,
+			          error );
+		}
+		else
+		{
+			if( name_index >= utf16_name_length )
+			{
+				return( 0 );
+			}
+			result = libuna_unicode_character_copy_from_utf16(
+			          &name_character,
+			          utf16_name,
+			          utf16_name_length,
+			          &name_index,
+			          error );
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy name to Unicode character.",
+			 function );
+
+			return( -1 );
+		}
+		if( towupper( (wint_t) node_name_character ) != towupper( (wint_t) name_character ) )
+		{
+			return( 0 );
+		}
+	}
+	if( utf8_name != NULL )
+	{
+		if( name_index < utf8_name_length )
+		{
+			return( 0 );
+		}
+	}
+	else
+	{
+		if( name_index < utf16_name_length )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the sub node of a parent node for a specific UTF-8 or UTF-16 encoded name
+ * The sub node is created if it does not exist
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_path_trie_get_sub_node(
+     libregf_key_path_trie_t *key_path_trie,
+     libregf_key_path_trie_node_t *parent_node,
+     uint32_t name_hash,
+     const uint8_t *utf8_name,
+     size_t utf8_name_length,
+     const uint16_t *utf16_name,
+     size_t utf16_name_length,
+     libregf_key_path_trie_node_t **sub_node,
+     libcerror_error_t **error )
+{
+	libregf_key_path_trie_node_t *safe_sub_node = NULL;
+	static char *function                       = "libregf_key_path_trie_get_sub_node";
+	int result                                  = 0;
+
+	if( key_path_trie == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key path trie.",
+		 function );
+
+		return( -1 );
+	}
+	if( parent_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parent node.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub node.",
+		 function );
+
+		return( -1 );
+	}
+	for( safe_sub_node = parent_node->first_sub_node;
+	     safe_sub_node != NULL;
+	     safe_sub_node = safe_sub_node->next_node )
+	{
+		if( safe_sub_node->name_hash != name_hash )
+		{
+			continue;
+		}
+		result = libregf_key_path_trie_compare_names(
+		          safe_sub_node,
+		          utf8_name,
+		          utf8_name_length,
+		          utf16_name,
+		          utf16_name_length,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare sub node name.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			*sub_node = safe_sub_node;
+
+			return( 1 );
+		}
+	}
+	safe_sub_node = memory_allocate_structure(
+	                 libregf_key_path_trie_node_t );
+
+	if( safe_sub_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sub node.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     safe_sub_node,
+	     0,
+	     sizeof( libregf_key_path_trie_node_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear sub node.",
+		 function );
+
+		memory_free(
+		 safe_sub_node );
+
+		return( -1 );
+	}
+	safe_sub_node->name_hash         = name_hash;
+	safe_sub_node->utf8_name         = utf8_name;
+	safe_sub_node->utf8_name_length  = utf8_name_length;
+	safe_sub_node->utf16_name        = utf16_name;
+	safe_sub_node->utf16_name_length = utf16_name_length;
+	safe_sub_node->path_index        = -1;
+	safe_sub_node->next_node         = parent_node->first_sub_node;
+
+	parent_node->first_sub_node = safe_sub_node;
+
+	key_path_trie->number_of_nodes += 1;
+
+	*sub_node = safe_sub_node;
+
+	return( 1 );
+}
+
+/* Inserts an UTF-8 encoded path
+ * The path separator is the \ character, a leading separator is ignored
+ * The path is referenced by the trie and must remain available while the trie is used
+ * Returns 1 if successful, 0 if the path cannot refer to a key or -1 on error
+ */
+int libregf_key_path_trie_insert_utf8_path(
+     libregf_key_path_trie_t *key_path_trie,
+     int path_index,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error )
+{
+	libregf_key_path_trie_node_t *node           = NULL;
+	const uint8_t *utf8_string_segment           = NULL;
+	static char *function                        = "libregf_key_path_trie_insert_utf8_path";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t utf8_string_index                     = 0;
+	size_t utf8_string_segment_index             = 0;
+	size_t utf8_string_segment_length            = 0;
+	size_t utf8_string_start_index               = 0;
+	uint32_t name_hash                           = 0;
+	int number_of_segments                       = 0;
+
+	if( key_path_trie == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key path trie.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path_index < 0 )
+	 || ( path_index >= key_path_trie->number_of_paths ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Ignore a leading separator
+	 */
+	if( ( utf8_string_length > 0 )
+	 && ( utf8_string[ 0 ] == (uint8_t) LIBREGF_SEPARATOR ) )
+	{
+		utf8_string_start_index = 1;
+	}
+	/* An empty segment, such as in "A\\B", or too many segments means
+	 * the path cannot refer to a key. Since the separator and the end of
+	 * string character are single byte UTF-8 characters the check does not
+	 * require the string to be decoded
+	 */
+	for( utf8_string_index = utf8_string_start_index;
+	     utf8_string_index < utf8_string_length;
+	     utf8_string_index++ )
+	{
+		if( ( utf8_string[ utf8_string_index ] != (uint8_t) LIBREGF_SEPARATOR )
+		 && ( utf8_string[ utf8_string_index ] != 0 ) )
+		{
+			continue;
+		}
+		if( ( utf8_string_index == utf8_string_start_index )
+		 || ( utf8_string[ utf8_string_index - 1 ] == (uint8_t) LIBREGF_SEPARATOR )
+		 || ( utf8_string[ utf8_string_index - 1 ] == 0 ) )
+		{
+			return( 0 );
+		}
+		number_of_segments++;
+
+		if( number_of_segments > LIBREGF_MAXIMUM_KEY_PATH_DEPTH )
+		{
+			return( 0 );
+		}
+	}
+	node              = key_path_trie->root_node;
+	utf8_string_index = utf8_string_start_index;
+
+	while( utf8_string_index < utf8_string_length )
+	{
+		utf8_string_segment       = &( utf8_string[ utf8_string_index ] );
+		utf8_string_segment_index = utf8_string_index;
+		name_hash                 = 0;
+
+		while( utf8_string_index < utf8_string_length )
+		{
+			if( libuna_unicode_character_copy_from_utf8(
+			     &unicode_character,
+			     utf8_string,
+			     utf8_string_length,
+			     &utf8_string_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy UTF-8 string to Unicode character.",
+				 function );
+
+				return( -1 );
+			}
+			if( ( unicode_character == (libuna_unicode_character_t) LIBREGF_SEPARATOR )
+			 || ( unicode_character == 0 ) )
+			{
+				utf8_string_segment_index += 1;
+
+				break;
+			}
+			name_hash *= 37;
+			name_hash += (uint32_t) towupper( (wint_t) unicode_character );
+		}
+		utf8_string_segment_length = utf8_string_index - utf8_string_segment_index;
+
+		if( libregf_key_path_trie_get_sub_node(
+		     key_path_trie,
+		     node,
+		     name_hash,
+		     utf8_string_segment,
+		     utf8_string_segment_length,
+		     NULL,
+		     0,
+		     &node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub node.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	key_path_trie->next_path_indexes[ path_index ] = node->path_index;
+	node->path_index                               = path_index;
+
+	return( 1 );
+}
+
+/* Inserts an UTF-16 encoded path
+ * The path separator is the \ character, a leading separator is ignored
+ * The path is referenced by the trie and must remain available while the trie is used
+ * Returns 1 if successful, 0 if the path cannot refer to a key or -1 on error
+ */
+int libregf_key_path_trie_insert_utf16_path(
+     libregf_key_path_trie_t *key_path_trie,
+     int path_index,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcerror_error_t **error )
+{
+	libregf_key_path_trie_node_t *node           = NULL;
+	const uint16_t *utf16_string_segment         = NULL;
+	static char *function                        = "libregf_key_path_trie_insert_utf16_path";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t utf16_string_index                    = 0;
+	size_t utf16_string_segment_index            = 0;
+	size_t utf16_string_segment_length           = 0;
+	size_t utf16_string_start_index              = 0;
+	uint32_t name_hash                           = 0;
+	int number_of_segments                       = 0;
+
+	if( key_path_trie == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key path trie.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path_index < 0 )
+	 || ( path_index >= key_path_trie->number_of_paths ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* Ignore a leading separator
+	 */
+	if( ( utf16_string_length > 0 )
+	 && ( utf16_string[ 0 ] == (uint16_t) LIBREGF_SEPARATOR ) )
+	{
+		utf16_string_start_index = 1;
+	}
+	/* An empty segment, such as in "A\\B", or too many segments means
+	 * the path cannot refer to a key
+	 */
+	for( utf16_string_index = utf16_string_start_index;
+	     utf16_string_index < utf16_string_length;
+	     utf16_string_index++ )
+	{
+		if( ( utf16_string[ utf16_string_index ] != (uint16_t) LIBREGF_SEPARATOR )
+		 && ( utf16_string[ utf16_string_index ] != 0 ) )
+		{
+			continue;
+		}
+		if( ( utf16_string_index == utf16_string_start_index )
+		 || ( utf16_string[ utf16_string_index - 1 ] == (uint16_t) LIBREGF_SEPARATOR )
+		 || ( utf16_string[ utf16_string_index - 1 ] == 0 ) )
+		{
+			return( 0 );
+		}
+		number_of_segments++;
+
+		if( number_of_segments > LIBREGF_MAXIMUM_KEY_PATH_DEPTH )
+		{
+			return( 0 );
+		}
+	}
+	node               = key_path_trie->root_node;
+	utf16_string_index = utf16_string_start_index;
+
+	while( utf16_string_index < utf16_string_length )
+	{
+		utf16_string_segment       = &( utf16_string[ utf16_string_index ] );
+		utf16_string_segment_index = utf16_string_index;
+		name_hash                  = 0;
+
+		while( utf16_string_index < utf16_string_length )
+		{
+			if( libuna_unicode_character_copy_from_utf16(
+			     &unicode_character,
+			     utf16_string,
+			     utf16_string_length,
+			     &utf16_string_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy UTF-16 string to Unicode character.",
+				 function );
+
+				return( -1 );
+			}
+			if( ( unicode_character == (libuna_unicode_character_t) LIBREGF_SEPARATOR )
+			 || ( unicode_character == 0 ) )
+			{
+				utf16_string_segment_index += 1;
+
+				break;
+			}
+			name_hash *= 37;
+			name_hash += (uint32_t) towupper( (wint_t) unicode_character );
+		}
+		utf16_string_segment_length = utf16_string_index - utf16_string_segment_index;
+
+		if( libregf_key_path_trie_get_sub_node(
+		     key_path_trie,
+		     node,
+		     name_hash,
+		     NULL,
+		     0,
+		     utf16_string_segment,
+		     utf16_string_segment_length,
+		     &node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub node.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	key_path_trie->next_path_indexes[ path_index ] = node->path_index;
+	node->path_index                               = path_index;
+
+	return( 1 );
+}
+
+/* Resolves the keys of the sub nodes of a resolved node
+ * The key item of the node is read once to look up all its sub nodes
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_path_trie_resolve_node(
+     libregf_key_path_trie_t *key_path_trie,
+     libregf_key_path_trie_node_t *node,
+     libregf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     libregf_key_t **keys,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+	libregf_key_descriptor_t *sub_key_descriptor = NULL;
+	libregf_key_item_cache_t *key_item_cache     = NULL;
+	libregf_key_item_t *key_item                 = NULL;
+	libregf_key_path_trie_node_t *sub_node       = NULL;
+	static char *function                        = "libregf_key_path_trie_resolve_node";
+	int path_index                               = 0;
+	int result                                   = 1;
+
+	if( key_path_trie == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key path trie.",
+		 function );
+
+		return( -1 );
+	}
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	if( hive_bins_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bins list.",
+		 function );
+
+		return( -1 );
+	}
+	if( keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid keys.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( recursion_depth < 0 )
+	 || ( recursion_depth > LIBREGF_MAXIMUM_KEY_PATH_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid recursion depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( path_index = node->path_index;
+	     path_index != -1;
+	     path_index = key_path_trie->next_path_indexes[ path_index ] )
+	{
+		if( libregf_key_initialize(
+		     &( keys[ path_index ] ),
+		     io_handle,
+		     file_io_handle,
+		     node->key_offset,
+		     node->name_hash,
+		     hive_bins_list,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create key: %d.",
+			 function,
+			 path_index );
+
+			return( -1 );
+		}
+	}
+	if( node->first_sub_node == NULL )
+	{
+		return( 1 );
+	}
+	key_item_cache = (libregf_key_item_cache_t *) hive_bins_list->key_item_cache;
+
+	if( key_item_cache != NULL )
+	{
+		if( libregf_key_item_cache_get_key_item(
+		     key_item_cache,
+		     file_io_handle,
+		     hive_bins_list,
+		     node->key_offset,
+		     node->name_hash,
+		     &key_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key item at offset: %" PRIu32 " (0x%08" PRIx32 ") from cache.",
+			 function,
+			 node->key_offset,
+			 node->key_offset );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( libregf_key_item_initialize(
+		     &key_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create key item.",
+			 function );
+
+			goto on_error;
+		}
+		if( libregf_key_item_read(
+		     key_item,
+		     file_io_handle,
+		     hive_bins_list,
+		     node->key_offset,
+		     node->name_hash,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read key item at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+			 function,
+			 node->key_offset,
+			 node->key_offset );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	/* A cached key item can be used by keys in other threads
+	 */
+	if( libcthreads_read_write_lock_grab_for_write(
+	     key_item->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	for( sub_node = node->first_sub_node;
+	     sub_node != NULL;
+	     sub_node = sub_node->next_node )
+	{
+		if( sub_node->utf8_name != NULL )
+		{
+			result = libregf_key_item_get_sub_key_descriptor_by_utf8_name(
+			          key_item,
+			          file_io_handle,
+			          hive_bins_list,
+			          sub_node->name_hash,
+			          sub_node->utf8_name,
+			          sub_node->utf8_name_length,
+			          &sub_key_descriptor,
+			          error );
+		}
+		else
+		{
+			result = libregf_key_item_get_sub_key_descriptor_by_utf16_name(
+			          key_item,
+			          file_io_handle,
+			          hive_bins_list,
+			          sub_node->name_hash,
+			          sub_node->utf16_name,
+			          sub_node->utf16_name_length,
+			          &sub_key_descriptor,
+			          error );
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub key descriptor by name.",
+			 function );
+
+			break;
+		}
+		else if( result != 0 )
+		{
+			sub_node->key_offset = sub_key_descriptor->key_offset;
+		}
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     key_item->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( result == -1 )
+	{
+		goto on_error;
+	}
+	/* The key item is released before the sub nodes are resolved so that
+	 * the number of key items in use is not bound by the depth of the trie
+	 */
+	if( key_item_cache != NULL )
+	{
+		if( libregf_key_item_cache_release_key_item(
+		     key_item_cache,
+		     node->key_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release key item.",
+			 function );
+
+			return( -1 );
+		}
+		key_item = NULL;
+	}
+	else if( libregf_key_item_free(
+	          &key_item,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free key item.",
+		 function );
+
+		return( -1 );
+	}
+	for( sub_node = node->first_sub_node;
+	     sub_node != NULL;
+	     sub_node = sub_node->next_node )
+	{
+		if( sub_node->key_offset == 0 )
+		{
+			continue;
+		}
+		if( libregf_key_path_trie_resolve_node(
+		     key_path_trie,
+		     sub_node,
+		     io_handle,
+		     file_io_handle,
+		     hive_bins_list,
+		     keys,
+		     recursion_depth + 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to resolve sub node.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( key_item != NULL )
+	{
+		if( key_item_cache != NULL )
+		{
+			libregf_key_item_cache_release_key_item(
+			 key_item_cache,
+			 node->key_offset,
+			 NULL );
+		}
+		else
+		{
+			libregf_key_item_free(
+			 &key_item,
+			 NULL );
+		}
+	}
+	return( -1 );
+}
+
+/* Resolves the keys of the paths in the trie relative to a specific key
+ * The keys are traversed once in trie order, where keys shared by multiple paths are read once
+ * Creates a key for every path that refers to a key, the other keys are set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_path_trie_resolve(
+     libregf_key_path_trie_t *key_path_trie,
+     libregf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     uint32_t key_offset,
+     libregf_key_t **keys,
+     int number_of_keys,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_key_path_trie_resolve";
+	int key_index         = 0;
+
+	if( key_path_trie == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key path trie.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_path_trie->root_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key path trie - missing root node.",
+		 function );
+
+		return( -1 );
+	}
+	if( keys == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid keys.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_keys != key_path_trie->number_of_paths )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of keys value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( key_index = 0;
+	     key_index < number_of_keys;
+	     key_index++ )
+	{
+		if( keys[ key_index ] != NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid key: %d value already set.",
+			 function,
+			 key_index );
+
+			return( -1 );
+		}
+	}
+	key_path_trie->root_node->key_offset = key_offset;
+
+	if( libregf_key_path_trie_resolve_node(
+	     key_path_trie,
+	     key_path_trie->root_node,
+	     io_handle,
+	     file_io_handle,
+	     hive_bins_list,
+	     keys,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to resolve root node.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	for( key_index = 0;
+	     key_index < number_of_keys;
+	     key_index++ )
+	{
+		if( keys[ key_index ] != NULL )
+		{
+			libregf_key_free(
+			 &( keys[ key_index ] ),
+			 NULL );
+		}
+	}
+	return( -1 );
+}
+
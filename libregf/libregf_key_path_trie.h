@@ -0,0 +1,167 @@
+/*
+ * Key path trie functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBREGF_KEY_PATH_TRIE_H )
+#define _LIBREGF_KEY_PATH_TRIE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libregf_hive_bins_list.h"
+#include "libregf_io_handle.h"
+#include "libregf_libbfio.h"
+#include "libregf_libcerror.h"
+#include "libregf_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libregf_key_path_trie_node libregf_key_path_trie_node_t;
+
+struct libregf_key_path_trie_node
+{
+	/* The name hash
+	 */
+	uint32_t name_hash;
+
+	/* The UTF-8 encoded name, which references the path it was inserted with
+	 */
+	const uint8_t *utf8_name;
+
+	/* The UTF-8 encoded name length
+	 */
+	size_t utf8_name_length;
+
+	/* The UTF-16 encoded name, which references the path it was inserted with
+	 */
+	const uint16_t *utf16_name;
+
+	/* The UTF-16 encoded name length
+	 */
+	size_t utf16_name_length;
+
+	/* The key offset, which is 0 if the key was not resolved
+	 */
+	uint32_t key_offset;
+
+	/* The index of the first path that ends in the node or -1 if none
+	 */
+	int path_index;
+
+	/* The first sub node
+	 */
+	libregf_key_path_trie_node_t *first_sub_node;
+
+	/* The next node with the same parent node
+	 */
+	libregf_key_path_trie_node_t *next_node;
+};
+
+typedef struct libregf_key_path_trie libregf_key_path_trie_t;
+
+struct libregf_key_path_trie
+{
+	/* The root node, which represents the key the paths are relative to
+	 */
+	libregf_key_path_trie_node_t *root_node;
+
+	/* The number of paths
+	 */
+	int number_of_paths;
+
+	/* The index of the next path that ends in the same node, per path, or -1 if none
+	 */
+	int *next_path_indexes;
+
+	/* The number of nodes
+	 */
+	int number_of_nodes;
+};
+
+int libregf_key_path_trie_initialize(
+     libregf_key_path_trie_t **key_path_trie,
+     int number_of_paths,
+     libcerror_error_t **error );
+
+int libregf_key_path_trie_free(
+     libregf_key_path_trie_t **key_path_trie,
+     libcerror_error_t **error );
+
+int libregf_key_path_trie_compare_names(
+     libregf_key_path_trie_node_t *node,
+     const uint8_t *utf8_name,
+     size_t utf8_name_length,
+     const uint16_t *utf16_name,
+     size_t utf16_name_length,
+     libcerror_error_t **error );
+
+int libregf_key_path_trie_get_sub_node(
+     libregf_key_path_trie_t *key_path_trie,
+     libregf_key_path_trie_node_t *parent_node,
+     uint32_t name_hash,
+     const uint8_t *utf8_name,
+     size_t utf8_name_length,
+     const uint16_t *utf16_name,
+     size_t utf16_name_length,
+     libregf_key_path_trie_node_t **sub_node,
+     libcerror_error_t **error );
+
+int libregf_key_path_trie_insert_utf8_path(
+     libregf_key_path_trie_t *key_path_trie,
+     int path_index,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error );
+
+int libregf_key_path_trie_insert_utf16_path(
+     libregf_key_path_trie_t *key_path_trie,
+     int path_index,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcerror_error_t **error );
+
+int libregf_key_path_trie_resolve_node(
+     libregf_key_path_trie_t *key_path_trie,
+     libregf_key_path_trie_node_t *node,
+     libregf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     libregf_key_t **keys,
+     int recursion_depth,
+     libcerror_error_t **error );
+
+int libregf_key_path_trie_resolve(
+     libregf_key_path_trie_t *key_path_trie,
+     libregf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     uint32_t key_offset,
+     libregf_key_t **keys,
+     int number_of_keys,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBREGF_KEY_PATH_TRIE_H ) */
+
@@ -32,11 +32,240 @@
 #include "libregf_key.h"
 #include "libregf_key_descriptor.h"
 #include "libregf_key_item.h"
+#include "libregf_key_item_cache.h"
 #include "libregf_key_tree.h"
 #include "libregf_libbfio.h"
 #include "libregf_libcerror.h"
+#include "libregf_libcthreads.h"
 #include "libregf_libuna.h"
 
+/* Retrieves the offset of the sub key for the specific UTF-8 or UTF-16 encoded name
+ * The key item is retrieved from the key item cache if available
+ * Returns 1 if successful, 0 if no such sub key or -1 on error
+ */
+int libregf_key_tree_get_sub_key_offset_by_name(
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     uint32_t key_offset,
+     uint32_t name_hash,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint32_t *sub_key_offset,
+     libcerror_error_t **error )
+{
+	libregf_key_descriptor_t *sub_key_descriptor = NULL;
+	libregf_key_item_cache_t *key_item_cache     = NULL;
+	libregf_key_item_t *key_item                 = NULL;
+	static char *function                        = "libregf_key_tree_get_sub_key_offset_by_name";
+	int result                                   = 0;
+
+	if( hive_bins_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bins list.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_key_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub key offset.",
+		 function );
+
+		return( -1 );
+	}
+	key_item_cache = (libregf_key_item_cache_t *) hive_bins_list->key_item_cache;
+
+	if( key_item_cache != NULL )
+	{
+		if( libregf_key_item_cache_get_key_item(
+		     key_item_cache,
+		     file_io_handle,
+		     hive_bins_list,
+		     key_offset,
+		     name_hash,
+		     &key_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key item at offset: %" PRIu32 " (0x%08" PRIx32 ") from cache.",
+			 function,
+			 key_offset,
+			 key_offset );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( libregf_key_item_initialize(
+		     &key_item,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create key item.",
+			 function );
+
+			goto on_error;
+		}
+		if( libregf_key_item_read(
+		     key_item,
+		     file_io_handle,
+		     hive_bins_list,
+		     key_offset,
+		     name_hash,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read key item at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+			 function,
+			 key_offset,
+			 key_offset );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	/* A cached key item can be used by keys in other threads
+	 */
+	if( libcthreads_read_write_lock_grab_for_write(
+	     key_item->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( utf8_string != NULL )
+	{
+		result = libregf_key_item_get_sub_key_descriptor_by_utf8_name(
+		          key_item,
+		          file_io_handle,
+		          hive_bins_list,
+		          name_hash,
+		          utf8_string,
+		          utf8_string_length,
+		          &sub_key_descriptor,
+		          error );
+	}
+	else
+	{
+		result = libregf_key_item_get_sub_key_descriptor_by_utf16_name(
+		          key_item,
+		          file_io_handle,
+		          hive_bins_list,
+		          name_hash,
+		          utf16_string,
+		          utf16_string_length,
+		          &sub_key_descriptor,
+		          error );
+	}
+	if( result == 1 )
+	{
+		*sub_key_offset = sub_key_descriptor->key_offset;
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     key_item->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub key descriptor by name.",
+		 function );
+
+		goto on_error;
+	}
+	if( key_item_cache != NULL )
+	{
+		if( libregf_key_item_cache_release_key_item(
+		     key_item_cache,
+		     key_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release key item.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( libregf_key_item_free(
+	          &key_item,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free key item.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+
+on_error:
+	if( key_item != NULL )
+	{
+		if( key_item_cache != NULL )
+		{
+			libregf_key_item_cache_release_key_item(
+			 key_item_cache,
+			 key_offset,
+			 NULL );
+		}
+		else
+		{
+			libregf_key_item_free(
+			 &key_item,
+			 NULL );
+		}
+	}
+	return( -1 );
+}
+
 /* Retrieves the key for the specific UTF-8 encoded path
  * The path separator is the \ character
  * Creates a new key
@@ -52,8 +281,6 @@ int libregf_key_tree_get_sub_key_by_utf8_path(
      libregf_key_t **sub_key,
      libcerror_error_t **error )
 {
-	libregf_key_descriptor_t *sub_key_descriptor = NULL;
-	libregf_key_item_t *sub_key_item             = NULL;
 	uint8_t *utf8_string_segment                 = NULL;
 	static char *function                        = "libregf_key_tree_get_sub_key_by_utf8_path";
 	libuna_unicode_character_t unicode_character = 0;
@@ -146,7 +373,7 @@ int libregf_key_tree_get_sub_key_by_utf8_path(
 				 "%s: unable to copy UTF-8 string to Unicode character.",
 				 function );
 
-				goto on_error;
+				return( -1 );
 			}
 			if( ( unicode_character == (libuna_unicode_character_t) LIBREGF_SEPARATOR )
 			 || ( unicode_character == 0 ) )
@@ -166,66 +393,17 @@ int libregf_key_tree_get_sub_key_by_utf8_path(
 		}
 		else
 		{
-/* TODO: instead of key item directory read key descriptors ? */
-			if( libregf_key_item_initialize(
-			     &sub_key_item,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create sub key item.",
-				 function );
-
-				goto on_error;
-			}
-			if( libregf_key_item_read(
-			     sub_key_item,
-			     file_io_handle,
-			     hive_bins_list,
-			     sub_key_offset,
-			     name_hash,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read sub key item at offset: %" PRIu32 " (0x%08" PRIx32 ").",
-				 function,
-				 sub_key_offset,
-				 sub_key_offset );
-
-				goto on_error;
-			}
-			result = libregf_key_item_get_sub_key_descriptor_by_utf8_name(
-			          sub_key_item,
+			result = libregf_key_tree_get_sub_key_offset_by_name(
 			          file_io_handle,
 			          hive_bins_list,
+			          sub_key_offset,
 			          name_hash,
-				  utf8_string_segment,
-				  utf8_string_segment_length,
-			          &sub_key_descriptor,
+			          utf8_string_segment,
+			          utf8_string_segment_length,
+			          NULL,
+			          0,
+			          &sub_key_offset,
 			          error );
-
-			if( result == 1 )
-			{
-				sub_key_offset = sub_key_descriptor->key_offset;
-			}
-			if( libregf_key_item_free(
-			     &sub_key_item,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to free sub key item.",
-				 function );
-
-				goto on_error;
-			}
 		}
 		if( result == -1 )
 		{
@@ -236,7 +414,7 @@ int libregf_key_tree_get_sub_key_by_utf8_path(
 			 "%s: unable to retrieve sub key values by name.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 		else if( result == 0 )
 		{
@@ -250,6 +428,7 @@ int libregf_key_tree_get_sub_key_by_utf8_path(
 		     io_handle,
 		     file_io_handle,
 		     sub_key_offset,
+		     name_hash,
 		     hive_bins_list,
 		     error ) != 1 )
 		{
@@ -260,19 +439,10 @@ int libregf_key_tree_get_sub_key_by_utf8_path(
 			 "%s: unable to create sub key.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
 	return( result );
-
-on_error:
-	if( sub_key_item != NULL )
-	{
-		libregf_key_item_free(
-		 &sub_key_item,
-		 NULL );
-	}
-	return( -1 );
 }
 
 /* Retrieves the key for the specific UTF-16 encoded path
@@ -290,8 +460,6 @@ int libregf_key_tree_get_sub_key_by_utf16_path(
      libregf_key_t **sub_key,
      libcerror_error_t **error )
 {
-	libregf_key_descriptor_t *sub_key_descriptor = NULL;
-	libregf_key_item_t *sub_key_item             = NULL;
 	uint16_t *utf16_string_segment               = NULL;
 	static char *function                        = "libregf_key_tree_get_sub_key_by_utf16_path";
 	libuna_unicode_character_t unicode_character = 0;
@@ -384,7 +552,7 @@ int libregf_key_tree_get_sub_key_by_utf16_path(
 				 "%s: unable to copy UTF-16 string to Unicode character.",
 				 function );
 
-				goto on_error;
+				return( -1 );
 			}
 			if( ( unicode_character == (libuna_unicode_character_t) LIBREGF_SEPARATOR )
 			 || ( unicode_character == 0 ) )
@@ -404,66 +572,17 @@ int libregf_key_tree_get_sub_key_by_utf16_path(
 		}
 		else
 		{
-/* TODO: instead of key item directory read key descriptors ? */
-			if( libregf_key_item_initialize(
-			     &sub_key_item,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create sub key item.",
-				 function );
-
-				goto on_error;
-			}
-			if( libregf_key_item_read(
-			     sub_key_item,
-			     file_io_handle,
-			     hive_bins_list,
-			     sub_key_offset,
-			     name_hash,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read sub key item at offset: %" PRIu32 " (0x%08" PRIx32 ").",
-				 function,
-				 sub_key_offset,
-				 sub_key_offset );
-
-				goto on_error;
-			}
-			result = libregf_key_item_get_sub_key_descriptor_by_utf16_name(
-			          sub_key_item,
+			result = libregf_key_tree_get_sub_key_offset_by_name(
 			          file_io_handle,
 			          hive_bins_list,
+			          sub_key_offset,
 			          name_hash,
-				  utf16_string_segment,
-				  utf16_string_segment_length,
-			          &sub_key_descriptor,
+			          NULL,
+			          0,
+			          utf16_string_segment,
+			          utf16_string_segment_length,
+			          &sub_key_offset,
 			          error );
-
-			if( result == 1 )
-			{
-				sub_key_offset = sub_key_descriptor->key_offset;
-			}
-			if( libregf_key_item_free(
-			     &sub_key_item,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to free sub key item.",
-				 function );
-
-				goto on_error;
-			}
 		}
 		if( result == -1 )
 		{
@@ -474,7 +593,7 @@ int libregf_key_tree_get_sub_key_by_utf16_path(
 			 "%s: unable to retrieve sub key values by name.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 		else if( result == 0 )
 		{
@@ -488,6 +607,7 @@ int libregf_key_tree_get_sub_key_by_utf16_path(
 		     io_handle,
 		     file_io_handle,
 		     sub_key_offset,
+		     name_hash,
 		     hive_bins_list,
 		     error ) != 1 )
 		{
@@ -498,18 +618,9 @@ int libregf_key_tree_get_sub_key_by_utf16_path(
 			 "%s: unable to create sub key.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
 	return( result );
-
-on_error:
-	if( sub_key_item != NULL )
-	{
-		libregf_key_item_free(
-		 &sub_key_item,
-		 NULL );
-	}
-	return( -1 );
 }
 
@@ -35,6 +35,18 @@
 extern "C" {
 #endif
 
+int libregf_key_tree_get_sub_key_offset_by_name(
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     uint32_t key_offset,
+     uint32_t name_hash,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint32_t *sub_key_offset,
+     libcerror_error_t **error );
+
 int libregf_key_tree_get_sub_key_by_utf8_path(
      libregf_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
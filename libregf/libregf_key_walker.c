@@ -0,0 +1,1774 @@
+/*
+ * Key walker functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libregf_definitions.h"
+#include "libregf_hive_bins_list.h"
+#include "libregf_io_handle.h"
+#include "libregf_key.h"
+#include "libregf_key_descriptor.h"
+#include "libregf_key_item.h"
+#include "libregf_key_walker.h"
+#include "libregf_libbfio.h"
+#include "libregf_libcerror.h"
+#include "libregf_libcthreads.h"
+
+/* Creates a key walker worker
+ * Make sure the value worker is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_walker_worker_initialize(
+     libregf_key_walker_worker_t **worker,
+     libregf_key_walker_t *key_walker,
+     int worker_index,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_key_walker_worker_initialize";
+	int result            = 0;
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( *worker != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid worker value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key walker.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid worker index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	*worker = memory_allocate_structure(
+	           libregf_key_walker_worker_t );
+
+	if( *worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create worker.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *worker,
+	     0,
+	     sizeof( libregf_key_walker_worker_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear worker.",
+		 function );
+
+		memory_free(
+		 *worker );
+
+		*worker = NULL;
+
+		return( -1 );
+	}
+	if( libbfio_handle_clone(
+	     &( ( *worker )->file_io_handle ),
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	result = libbfio_handle_is_open(
+	          ( *worker )->file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		if( libbfio_handle_open(
+		     ( *worker )->file_io_handle,
+		     LIBBFIO_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libregf_hive_bins_list_clone(
+	     &( ( *worker )->hive_bins_list ),
+	     hive_bins_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create hive bins list.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *worker )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *worker )->key_walker   = key_walker;
+	( *worker )->worker_index = worker_index;
+	( *worker )->result       = 1;
+
+	return( 1 );
+
+on_error:
+	if( *worker != NULL )
+	{
+		if( ( *worker )->hive_bins_list != NULL )
+		{
+			libregf_hive_bins_list_free(
+			 &( ( *worker )->hive_bins_list ),
+			 NULL );
+		}
+		if( ( *worker )->file_io_handle != NULL )
+		{
+			libbfio_handle_free(
+			 &( ( *worker )->file_io_handle ),
+			 NULL );
+		}
+		memory_free(
+		 *worker );
+
+		*worker = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a key walker worker
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_walker_worker_free(
+     libregf_key_walker_worker_t **worker,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_key_walker_worker_free";
+	int result            = 1;
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( *worker != NULL )
+	{
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *worker )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( libregf_hive_bins_list_free(
+		     &( ( *worker )->hive_bins_list ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free hive bins list.",
+			 function );
+
+			result = -1;
+		}
+		if( libbfio_handle_close(
+		     ( *worker )->file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		if( libbfio_handle_free(
+		     &( ( *worker )->file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *worker )->error != NULL )
+		{
+			libcerror_error_free(
+			 &( ( *worker )->error ) );
+		}
+		if( ( *worker )->items != NULL )
+		{
+			memory_free(
+			 ( *worker )->items );
+		}
+		memory_free(
+		 *worker );
+
+		*worker = NULL;
+	}
+	return( result );
+}
+
+/* Pushes items onto the end of the items of the worker
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_walker_worker_push_items(
+     libregf_key_walker_worker_t *worker,
+     const libregf_key_walker_item_t *items,
+     int number_of_items,
+     libcerror_error_t **error )
+{
+	libregf_key_walker_item_t *reallocation = NULL;
+	static char *function                   = "libregf_key_walker_worker_push_items";
+	int item_index                          = 0;
+	int maximum_number_of_items             = 0;
+	int result                              = 1;
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( items == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid items.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_items < 0 )
+	 || ( number_of_items > ( INT_MAX / 2 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of items value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_items == 0 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     worker->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( worker->number_of_items + number_of_items ) > worker->maximum_number_of_items )
+	{
+		/* Move the remaining items to the start of the items
+		 */
+		for( item_index = worker->first_item_index;
+		     item_index < worker->number_of_items;
+		     item_index++ )
+		{
+			worker->items[ item_index - worker->first_item_index ] = worker->items[ item_index ];
+		}
+		worker->number_of_items -= worker->first_item_index;
+		worker->first_item_index = 0;
+	}
+	if( ( worker->number_of_items + number_of_items ) > worker->maximum_number_of_items )
+	{
+		if( worker->maximum_number_of_items > ( INT_MAX / 2 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid worker - maximum number of items value out of bounds.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			maximum_number_of_items = worker->maximum_number_of_items * 2;
+
+			if( maximum_number_of_items < 64 )
+			{
+				maximum_number_of_items = 64;
+			}
+			if( maximum_number_of_items < ( worker->number_of_items + number_of_items ) )
+			{
+				maximum_number_of_items = worker->number_of_items + number_of_items;
+			}
+			reallocation = (libregf_key_walker_item_t *) memory_reallocate(
+			                                              worker->items,
+			                                              sizeof( libregf_key_walker_item_t ) * maximum_number_of_items );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize items.",
+				 function );
+
+				result = -1;
+			}
+			else
+			{
+				worker->items                   = reallocation;
+				worker->maximum_number_of_items = maximum_number_of_items;
+			}
+		}
+	}
+	if( result == 1 )
+	{
+		if( memory_copy(
+		     &( worker->items[ worker->number_of_items ] ),
+		     items,
+		     sizeof( libregf_key_walker_item_t ) * number_of_items ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy items.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			worker->number_of_items += number_of_items;
+		}
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     worker->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Pops an item from the end of the items of the worker
+ * Returns 1 if successful, 0 if no item is available or -1 on error
+ */
+int libregf_key_walker_worker_pop_item(
+     libregf_key_walker_worker_t *worker,
+     libregf_key_walker_item_t *item,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_key_walker_worker_pop_item";
+	int result            = 0;
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     worker->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( worker->number_of_items > worker->first_item_index )
+	{
+		worker->number_of_items -= 1;
+
+		item->key_offset = worker->items[ worker->number_of_items ].key_offset;
+		item->name_hash  = worker->items[ worker->number_of_items ].name_hash;
+		item->depth      = worker->items[ worker->number_of_items ].depth;
+
+		if( worker->number_of_items == worker->first_item_index )
+		{
+			worker->first_item_index = 0;
+			worker->number_of_items  = 0;
+		}
+		result = 1;
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     worker->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Steals an item from the start of the items of the worker
+ * Returns 1 if successful, 0 if no item is available or -1 on error
+ */
+int libregf_key_walker_worker_steal_item(
+     libregf_key_walker_worker_t *worker,
+     libregf_key_walker_item_t *item,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_key_walker_worker_steal_item";
+	int result            = 0;
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     worker->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( worker->number_of_items > worker->first_item_index )
+	{
+		item->key_offset = worker->items[ worker->first_item_index ].key_offset;
+		item->name_hash  = worker->items[ worker->first_item_index ].name_hash;
+		item->depth      = worker->items[ worker->first_item_index ].depth;
+
+		worker->first_item_index += 1;
+
+		if( worker->number_of_items == worker->first_item_index )
+		{
+			worker->first_item_index = 0;
+			worker->number_of_items  = 0;
+		}
+		result = 1;
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     worker->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Processes an item
+ * Queues the sub keys of the key and calls the callback function for the key
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_walker_worker_process_item(
+     libregf_key_walker_worker_t *worker,
+     const libregf_key_walker_item_t *item,
+     libcerror_error_t **error )
+{
+	libregf_key_descriptor_t *sub_key_descriptor = NULL;
+	libregf_key_t *key                           = NULL;
+	libregf_key_walker_item_t *sub_key_items     = NULL;
+	static char *function                        = "libregf_key_walker_worker_process_item";
+	int callback_result                          = 0;
+	int number_of_sub_keys                       = 0;
+	int sub_key_index                            = 0;
+
+	if( worker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker->key_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid worker - missing key walker.",
+		 function );
+
+		return( -1 );
+	}
+	if( item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid item.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( item->depth < 0 )
+	 || ( item->depth > LIBREGF_MAXIMUM_SUB_KEY_RECURSION_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid item - depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libregf_key_initialize(
+	     &key,
+	     worker->key_walker->io_handle,
+	     worker->file_io_handle,
+	     item->key_offset,
+	     item->name_hash,
+	     worker->hive_bins_list,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create key at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 function,
+		 item->key_offset,
+		 item->key_offset );
+
+		goto on_error;
+	}
+	if( libregf_key_item_get_number_of_sub_key_descriptors(
+	     ( (libregf_internal_key_t *) key )->key_item,
+	     &number_of_sub_keys,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub keys.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_sub_keys > 0 )
+	{
+		sub_key_items = (libregf_key_walker_item_t *) memory_allocate(
+		                                               sizeof( libregf_key_walker_item_t ) * number_of_sub_keys );
+
+		if( sub_key_items == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create sub key items.",
+			 function );
+
+			goto on_error;
+		}
+		/* The sub keys are stored in reverse order since the worker
+		 * takes items from the end
+		 */
+		for( sub_key_index = 0;
+		     sub_key_index < number_of_sub_keys;
+		     sub_key_index++ )
+		{
+			if( libregf_key_item_get_sub_key_descriptor_by_index(
+			     ( (libregf_internal_key_t *) key )->key_item,
+			     sub_key_index,
+			     &sub_key_descriptor,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sub key descriptor: %d.",
+				 function,
+				 sub_key_index );
+
+				goto on_error;
+			}
+			if( sub_key_descriptor == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing sub key descriptor: %d.",
+				 function,
+				 sub_key_index );
+
+				goto on_error;
+			}
+			sub_key_items[ number_of_sub_keys - sub_key_index - 1 ].key_offset = sub_key_descriptor->key_offset;
+			sub_key_items[ number_of_sub_keys - sub_key_index - 1 ].name_hash  = sub_key_descriptor->name_hash;
+			sub_key_items[ number_of_sub_keys - sub_key_index - 1 ].depth      = item->depth + 1;
+		}
+		if( libregf_key_walker_worker_push_items(
+		     worker,
+		     sub_key_items,
+		     number_of_sub_keys,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push sub key items.",
+			 function );
+
+			goto on_error;
+		}
+		memory_free(
+		 sub_key_items );
+
+		sub_key_items = NULL;
+
+		if( libregf_key_walker_add_pending_items(
+		     worker->key_walker,
+		     number_of_sub_keys,
+		     number_of_sub_keys,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add pending items.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	callback_result = worker->key_walker->callback_function(
+	                   key,
+	                   worker->key_walker->callback_data,
+	                   error );
+
+	if( callback_result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: callback function failed for key at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 function,
+		 item->key_offset,
+		 item->key_offset );
+
+		goto on_error;
+	}
+	else if( callback_result == 0 )
+	{
+		if( libregf_key_walker_set_abort(
+		     worker->key_walker,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set abort.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libregf_key_free(
+	     &key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free key.",
+		 function );
+
+		goto on_error;
+	}
+	if( libregf_key_walker_add_pending_items(
+	     worker->key_walker,
+	     0,
+	     -1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to remove pending item.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( sub_key_items != NULL )
+	{
+		memory_free(
+		 sub_key_items );
+	}
+	if( key != NULL )
+	{
+		libregf_key_free(
+		 &key,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Runs a key walker worker
+ * Processes items until no more items are pending or the walk is aborted
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_walker_worker_run(
+     libregf_key_walker_worker_t *worker )
+{
+	libregf_key_walker_item_t item;
+
+	int result = 0;
+
+	if( worker == NULL )
+	{
+		return( -1 );
+	}
+	do
+	{
+		result = libregf_key_walker_get_item(
+		          worker->key_walker,
+		          worker->worker_index,
+		          &item,
+		          &( worker->error ) );
+
+		if( result == 1 )
+		{
+			result = libregf_key_walker_worker_process_item(
+			          worker,
+			          &item,
+			          &( worker->error ) );
+		}
+	}
+	while( result == 1 );
+
+	if( result == -1 )
+	{
+		worker->result = -1;
+
+		/* Make sure the other workers stop as well
+		 */
+		libregf_key_walker_set_abort(
+		 worker->key_walker,
+		 NULL );
+	}
+	return( worker->result );
+}
+
+/* Creates a key walker
+ * Make sure the value key_walker is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_walker_initialize(
+     libregf_key_walker_t **key_walker,
+     libregf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     int number_of_workers,
+     int (*callback_function)(
+            libregf_key_t *key,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_key_walker_initialize";
+	int worker_index      = 0;
+
+	if( key_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key walker.",
+		 function );
+
+		return( -1 );
+	}
+	if( *key_walker != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid key walker value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_workers <= 0 )
+	 || ( number_of_workers > LIBREGF_MAXIMUM_NUMBER_OF_WALK_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of workers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	/* Without multi-thread support all items are processed by a single worker
+	 */
+	number_of_workers = 1;
+#endif
+	*key_walker = memory_allocate_structure(
+	               libregf_key_walker_t );
+
+	if( *key_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create key walker.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *key_walker,
+	     0,
+	     sizeof( libregf_key_walker_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear key walker.",
+		 function );
+
+		memory_free(
+		 *key_walker );
+
+		*key_walker = NULL;
+
+		return( -1 );
+	}
+	( *key_walker )->workers = (libregf_key_walker_worker_t **) memory_allocate(
+	                                                             sizeof( libregf_key_walker_worker_t * ) * number_of_workers );
+
+	if( ( *key_walker )->workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create workers.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *key_walker )->workers,
+	     0,
+	     sizeof( libregf_key_walker_worker_t * ) * number_of_workers ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear workers.",
+		 function );
+
+		goto on_error;
+	}
+	( *key_walker )->io_handle         = io_handle;
+	( *key_walker )->callback_function = callback_function;
+	( *key_walker )->callback_data     = callback_data;
+
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		if( libregf_key_walker_worker_initialize(
+		     &( ( *key_walker )->workers[ worker_index ] ),
+		     *key_walker,
+		     worker_index,
+		     file_io_handle,
+		     hive_bins_list,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create worker: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+		( *key_walker )->number_of_workers += 1;
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *key_walker )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *key_walker )->condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create condition.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *key_walker != NULL )
+	{
+		libregf_key_walker_free(
+		 key_walker,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a key walker
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_walker_free(
+     libregf_key_walker_t **key_walker,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_key_walker_free";
+	int result            = 1;
+	int worker_index      = 0;
+
+	if( key_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key walker.",
+		 function );
+
+		return( -1 );
+	}
+	if( *key_walker != NULL )
+	{
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+		if( ( *key_walker )->condition != NULL )
+		{
+			if( libcthreads_condition_free(
+			     &( ( *key_walker )->condition ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free condition.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *key_walker )->mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *key_walker )->mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		if( ( *key_walker )->workers != NULL )
+		{
+			for( worker_index = 0;
+			     worker_index < ( *key_walker )->number_of_workers;
+			     worker_index++ )
+			{
+				if( libregf_key_walker_worker_free(
+				     &( ( *key_walker )->workers[ worker_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free worker: %d.",
+					 function,
+					 worker_index );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 ( *key_walker )->workers );
+		}
+		memory_free(
+		 *key_walker );
+
+		*key_walker = NULL;
+	}
+	return( result );
+}
+
+/* Adds to the number of queued and pending items
+ * Wakes up idle workers if items were queued or no more items are pending
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_walker_add_pending_items(
+     libregf_key_walker_t *key_walker,
+     int number_of_queued_items,
+     int number_of_pending_items,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_key_walker_add_pending_items";
+	int result            = 1;
+
+	if( key_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key walker.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     key_walker->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	key_walker->number_of_queued_items  += number_of_queued_items;
+	key_walker->number_of_pending_items += number_of_pending_items;
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( ( number_of_queued_items > 0 )
+	 || ( key_walker->number_of_pending_items == 0 ) )
+	{
+		if( libcthreads_condition_broadcast(
+		     key_walker->condition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast condition.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     key_walker->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Signals the workers to stop the walk
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_walker_set_abort(
+     libregf_key_walker_t *key_walker,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_key_walker_set_abort";
+	int result            = 1;
+
+	if( key_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key walker.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     key_walker->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	key_walker->abort = 1;
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_condition_broadcast(
+	     key_walker->condition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast condition.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     key_walker->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the next item for a specific worker
+ * The worker first takes its own most recently queued item and otherwise
+ * steals the least recently queued item of another worker
+ * Blocks while other workers are still processing items that can queue sub keys
+ * Returns 1 if successful, 0 if no more items are available or -1 on error
+ */
+int libregf_key_walker_get_item(
+     libregf_key_walker_t *key_walker,
+     int worker_index,
+     libregf_key_walker_item_t *item,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_key_walker_get_item";
+	int is_done           = 0;
+	int result            = 0;
+	int victim_index      = 0;
+
+	if( key_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key walker.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( worker_index < 0 )
+	 || ( worker_index >= key_walker->number_of_workers ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid worker index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		result = libregf_key_walker_worker_pop_item(
+		          key_walker->workers[ worker_index ],
+		          item,
+		          error );
+
+		for( victim_index = 1;
+		     ( result == 0 ) && ( victim_index < key_walker->number_of_workers );
+		     victim_index++ )
+		{
+			result = libregf_key_walker_worker_steal_item(
+			          key_walker->workers[ ( worker_index + victim_index ) % key_walker->number_of_workers ],
+			          item,
+			          error );
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve item.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 1 )
+		{
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+			if( libcthreads_mutex_grab(
+			     key_walker->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab mutex.",
+				 function );
+
+				return( -1 );
+			}
+#endif
+			key_walker->number_of_queued_items -= 1;
+
+			if( key_walker->abort != 0 )
+			{
+				/* The item is no longer processed
+				 */
+				key_walker->number_of_pending_items -= 1;
+
+				result = 0;
+			}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+			if( libcthreads_mutex_release(
+			     key_walker->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release mutex.",
+				 function );
+
+				return( -1 );
+			}
+#endif
+			break;
+		}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     key_walker->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			return( -1 );
+		}
+		while( ( key_walker->abort == 0 )
+		    && ( key_walker->number_of_queued_items == 0 )
+		    && ( key_walker->number_of_pending_items > 0 ) )
+		{
+			if( libcthreads_condition_wait(
+			     key_walker->condition,
+			     key_walker->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to wait for condition.",
+				 function );
+
+				libcthreads_mutex_release(
+				 key_walker->mutex,
+				 NULL );
+
+				return( -1 );
+			}
+		}
+		if( ( key_walker->abort != 0 )
+		 || ( key_walker->number_of_pending_items <= 0 ) )
+		{
+			is_done = 1;
+		}
+		if( libcthreads_mutex_release(
+		     key_walker->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			return( -1 );
+		}
+#else
+		is_done = 1;
+#endif
+	}
+	while( is_done == 0 );
+
+	return( result );
+}
+
+/* Walks all the keys starting with the root key
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_key_walker_walk(
+     libregf_key_walker_t *key_walker,
+     uint32_t root_key_offset,
+     libcerror_error_t **error )
+{
+	libregf_key_walker_item_t root_item;
+
+	libregf_key_walker_worker_t *worker = NULL;
+	static char *function               = "libregf_key_walker_walk";
+	int result                          = 1;
+	int worker_index                    = 0;
+
+	if( key_walker == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key walker.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_walker->number_of_workers <= 0 )
+	 || ( key_walker->workers == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid key walker - missing workers.",
+		 function );
+
+		return( -1 );
+	}
+	key_walker->abort                   = 0;
+	key_walker->number_of_queued_items  = 0;
+	key_walker->number_of_pending_items = 0;
+
+	root_item.key_offset = root_key_offset;
+	root_item.name_hash  = 0;
+	root_item.depth      = 0;
+
+	if( libregf_key_walker_worker_push_items(
+	     key_walker->workers[ 0 ],
+	     &root_item,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push root key item.",
+		 function );
+
+		return( -1 );
+	}
+	if( libregf_key_walker_add_pending_items(
+	     key_walker,
+	     1,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to add pending items.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	/* Worker 0 runs on the calling thread
+	 */
+	for( worker_index = 1;
+	     worker_index < key_walker->number_of_workers;
+	     worker_index++ )
+	{
+		worker = key_walker->workers[ worker_index ];
+
+		if( libcthreads_thread_create(
+		     &( worker->thread ),
+		     NULL,
+		     (int (*)(void *)) &libregf_key_walker_worker_run,
+		     (void *) worker,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread: %d.",
+			 function,
+			 worker_index );
+
+			libregf_key_walker_set_abort(
+			 key_walker,
+			 NULL );
+
+			result = -1;
+
+			break;
+		}
+	}
+#endif
+	worker = key_walker->workers[ 0 ];
+
+	if( result == 1 )
+	{
+		libregf_key_walker_worker_run(
+		 worker );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	for( worker_index = 1;
+	     worker_index < key_walker->number_of_workers;
+	     worker_index++ )
+	{
+		worker = key_walker->workers[ worker_index ];
+
+		if( worker->thread == NULL )
+		{
+			continue;
+		}
+		if( libcthreads_thread_join(
+		     &( worker->thread ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread: %d.",
+			 function,
+			 worker_index );
+
+			result = -1;
+		}
+	}
+#endif
+	/* Report the error of the first worker that failed
+	 */
+	for( worker_index = 0;
+	     worker_index < key_walker->number_of_workers;
+	     worker_index++ )
+	{
+		worker = key_walker->workers[ worker_index ];
+
+		if( worker->result != 1 )
+		{
+			if( ( result == 1 )
+			 && ( error != NULL )
+			 && ( *error == NULL ) )
+			{
+				*error        = worker->error;
+				worker->error = NULL;
+			}
+			if( result == 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: worker: %d failed.",
+				 function,
+				 worker_index );
+			}
+			result = -1;
+		}
+		if( worker->error != NULL )
+		{
+			libcerror_error_free(
+			 &( worker->error ) );
+		}
+		worker->result           = 1;
+		worker->first_item_index = 0;
+		worker->number_of_items  = 0;
+	}
+	return( result );
+}
+
@@ -0,0 +1,241 @@
+/*
+ * Key walker functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBREGF_KEY_WALKER_H )
+#define _LIBREGF_KEY_WALKER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libregf_hive_bins_list.h"
+#include "libregf_io_handle.h"
+#include "libregf_libbfio.h"
+#include "libregf_libcerror.h"
+#include "libregf_libcthreads.h"
+#include "libregf_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libregf_key_walker_item libregf_key_walker_item_t;
+
+struct libregf_key_walker_item
+{
+	/* The key offset
+	 */
+	uint32_t key_offset;
+
+	/* The name hash of the key, which is 0 if not known
+	 */
+	uint32_t name_hash;
+
+	/* The depth of the key relative to the root key
+	 */
+	int depth;
+};
+
+typedef struct libregf_key_walker libregf_key_walker_t;
+
+typedef struct libregf_key_walker_worker libregf_key_walker_worker_t;
+
+struct libregf_key_walker_worker
+{
+	/* The key walker
+	 */
+	libregf_key_walker_t *key_walker;
+
+	/* The worker index
+	 */
+	int worker_index;
+
+	/* The file IO handle, which is a clone of the file IO handle of the file
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The hive bins list, which is a clone of the hive bins list of the file
+	 */
+	libregf_hive_bins_list_t *hive_bins_list;
+
+	/* The items, the worker takes items from the end and
+	 * other workers steal items from the start
+	 */
+	libregf_key_walker_item_t *items;
+
+	/* The index of the first item
+	 */
+	int first_item_index;
+
+	/* The number of items, including the items before the first item index
+	 */
+	int number_of_items;
+
+	/* The maximum number of items
+	 */
+	int maximum_number_of_items;
+
+	/* The error of the worker
+	 */
+	libcerror_error_t *error;
+
+	/* The result of the worker
+	 */
+	int result;
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+
+	/* The mutex that protects the items
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+struct libregf_key_walker
+{
+	/* The IO handle
+	 */
+	libregf_io_handle_t *io_handle;
+
+	/* The callback function
+	 */
+	int (*callback_function)(
+	       libregf_key_t *key,
+	       void *callback_data,
+	       libcerror_error_t **error );
+
+	/* The callback data
+	 */
+	void *callback_data;
+
+	/* The workers
+	 */
+	libregf_key_walker_worker_t **workers;
+
+	/* The number of workers
+	 */
+	int number_of_workers;
+
+	/* The number of items queued in the workers
+	 */
+	int number_of_queued_items;
+
+	/* The number of items that are queued or being processed
+	 */
+	int number_of_pending_items;
+
+	/* Value to indicate if the walk should stop
+	 */
+	int abort;
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	/* The mutex that protects the item counters and abort value
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition that signals idle workers
+	 */
+	libcthreads_condition_t *condition;
+#endif
+};
+
+int libregf_key_walker_worker_initialize(
+     libregf_key_walker_worker_t **worker,
+     libregf_key_walker_t *key_walker,
+     int worker_index,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     libcerror_error_t **error );
+
+int libregf_key_walker_worker_free(
+     libregf_key_walker_worker_t **worker,
+     libcerror_error_t **error );
+
+int libregf_key_walker_worker_push_items(
+     libregf_key_walker_worker_t *worker,
+     const libregf_key_walker_item_t *items,
+     int number_of_items,
+     libcerror_error_t **error );
+
+int libregf_key_walker_worker_pop_item(
+     libregf_key_walker_worker_t *worker,
+     libregf_key_walker_item_t *item,
+     libcerror_error_t **error );
+
+int libregf_key_walker_worker_steal_item(
+     libregf_key_walker_worker_t *worker,
+     libregf_key_walker_item_t *item,
+     libcerror_error_t **error );
+
+int libregf_key_walker_worker_process_item(
+     libregf_key_walker_worker_t *worker,
+     const libregf_key_walker_item_t *item,
+     libcerror_error_t **error );
+
+int libregf_key_walker_worker_run(
+     libregf_key_walker_worker_t *worker );
+
+int libregf_key_walker_initialize(
+     libregf_key_walker_t **key_walker,
+     libregf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     int number_of_workers,
+     int (*callback_function)(
+            libregf_key_t *key,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libregf_key_walker_free(
+     libregf_key_walker_t **key_walker,
+     libcerror_error_t **error );
+
+int libregf_key_walker_add_pending_items(
+     libregf_key_walker_t *key_walker,
+     int number_of_queued_items,
+     int number_of_pending_items,
+     libcerror_error_t **error );
+
+int libregf_key_walker_set_abort(
+     libregf_key_walker_t *key_walker,
+     libcerror_error_t **error );
+
+int libregf_key_walker_get_item(
+     libregf_key_walker_t *key_walker,
+     int worker_index,
+     libregf_key_walker_item_t *item,
+     libcerror_error_t **error );
+
+int libregf_key_walker_walk(
+     libregf_key_walker_t *key_walker,
+     uint32_t root_key_offset,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBREGF_KEY_WALKER_H ) */
+
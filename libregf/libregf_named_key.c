@@ -113,6 +113,77 @@ on_error:
 	return( -1 );
 }
 
+/* Creates a named key that is allocated from an arena
+ * The named key and its name are released in bulk when the arena is rewound,
+ * reset or freed
+ * Make sure the value named_key is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_named_key_initialize_from_arena(
+     libregf_named_key_t **named_key,
+     libregf_arena_t *arena,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_named_key_initialize_from_arena";
+
+	if( named_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid named key.",
+		 function );
+
+		return( -1 );
+	}
+	if( *named_key != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid named key value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libregf_arena_allocate(
+	     arena,
+	     sizeof( libregf_named_key_t ),
+	     (intptr_t **) named_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create named key.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     *named_key,
+	     0,
+	     sizeof( libregf_named_key_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear named key.",
+		 function );
+
+		*named_key = NULL;
+
+		return( -1 );
+	}
+	( *named_key )->arena = arena;
+
+	return( 1 );
+}
+
 /* Frees a named key
  * Returns 1 if successful or -1 on error
  */
@@ -135,14 +206,18 @@ int libregf_named_key_free(
 	}
 	if( *named_key != NULL )
 	{
-		if( ( *named_key )->name != NULL )
+		/* A named key allocated from an arena is released with the arena
+		 */
+		if( ( *named_key )->arena == NULL )
 		{
+			if( ( *named_key )->name != NULL )
+			{
+				memory_free(
+				 ( *named_key )->name );
+			}
 			memory_free(
-			 ( *named_key )->name );
+			 *named_key );
 		}
-		memory_free(
-		 *named_key );
-
 		*named_key = NULL;
 	}
 	return( 1 );
@@ -486,9 +561,22 @@ int libregf_named_key_read_data(
 
 		goto on_error;
 	}
-	named_key->name = (uint8_t *) memory_allocate(
-	                               sizeof( uint8_t ) * (size_t) named_key->name_size );
-
+	if( named_key->arena != NULL )
+	{
+		if( libregf_arena_allocate(
+		     named_key->arena,
+		     sizeof( uint8_t ) * (size_t) named_key->name_size,
+		     (intptr_t **) &( named_key->name ),
+		     error ) != 1 )
+		{
+			named_key->name = NULL;
+		}
+	}
+	else
+	{
+		named_key->name = (uint8_t *) memory_allocate(
+		                               sizeof( uint8_t ) * (size_t) named_key->name_size );
+	}
 	if( named_key->name == NULL )
 	{
 		libcerror_error_set(
@@ -650,9 +738,11 @@ int libregf_named_key_read_data(
 on_error:
 	if( named_key->name != NULL )
 	{
-		memory_free(
-		 named_key->name );
-
+		if( named_key->arena == NULL )
+		{
+			memory_free(
+			 named_key->name );
+		}
 		named_key->name = NULL;
 	}
 	named_key->name_size = 0;
@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libregf_arena.h"
 #include "libregf_io_handle.h"
 #include "libregf_libcerror.h"
 
@@ -83,12 +84,21 @@ struct libregf_named_key
 	/* The class name size
 	 */
 	uint16_t class_name_size;
+
+	/* The arena the named key and its name are allocated from, or NULL if not set
+	 */
+	libregf_arena_t *arena;
 };
 
 int libregf_named_key_initialize(
      libregf_named_key_t **named_key,
      libcerror_error_t **error );
 
+int libregf_named_key_initialize_from_arena(
+     libregf_named_key_t **named_key,
+     libregf_arena_t *arena,
+     libcerror_error_t **error );
+
 int libregf_named_key_free(
      libregf_named_key_t **named_key,
      libcerror_error_t **error );
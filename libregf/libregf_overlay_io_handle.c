@@ -0,0 +1,867 @@
+/*
+ * Overlay IO handle functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libregf_dirty_pages.h"
+#include "libregf_libbfio.h"
+#include "libregf_libcerror.h"
+#include "libregf_overlay_io_handle.h"
+#include "libregf_unused.h"
+
+/* Creates an overlay IO handle
+ * The overlay IO handle reads the hive file with the dirty pages overlaid on the hive bins
+ * Make sure the value overlay_io_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_overlay_io_handle_initialize(
+     libregf_overlay_io_handle_t **overlay_io_handle,
+     libbfio_handle_t *file_io_handle,
+     libregf_dirty_pages_t *dirty_pages,
+     off64_t hive_bins_list_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_overlay_io_handle_initialize";
+
+	if( overlay_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid overlay IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *overlay_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid overlay IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( dirty_pages == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid dirty pages.",
+		 function );
+
+		return( -1 );
+	}
+	if( hive_bins_list_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid hive bins list offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	*overlay_io_handle = memory_allocate_structure(
+	                      libregf_overlay_io_handle_t );
+
+	if( *overlay_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create overlay IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *overlay_io_handle,
+	     0,
+	     sizeof( libregf_overlay_io_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear overlay IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *overlay_io_handle )->file_io_handle        = file_io_handle;
+	( *overlay_io_handle )->dirty_pages           = dirty_pages;
+	( *overlay_io_handle )->hive_bins_list_offset = hive_bins_list_offset;
+
+	return( 1 );
+
+on_error:
+	if( *overlay_io_handle != NULL )
+	{
+		memory_free(
+		 *overlay_io_handle );
+
+		*overlay_io_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Creates a file IO handle that reads the hive file with the dirty pages overlaid on the hive bins
+ * The file IO handle of the hive file and the dirty pages are referenced and must remain
+ * available while the overlay file IO handle is used
+ * Make sure the value handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_overlay_initialize(
+     libbfio_handle_t **handle,
+     libbfio_handle_t *file_io_handle,
+     libregf_dirty_pages_t *dirty_pages,
+     off64_t hive_bins_list_offset,
+     libcerror_error_t **error )
+{
+	libregf_overlay_io_handle_t *overlay_io_handle = NULL;
+	static char *function                          = "libregf_overlay_initialize";
+
+	if( handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libregf_overlay_io_handle_initialize(
+	     &overlay_io_handle,
+	     file_io_handle,
+	     dirty_pages,
+	     hive_bins_list_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create overlay IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_initialize(
+	     handle,
+	     (intptr_t *) overlay_io_handle,
+	     (int (*)(intptr_t **, libcerror_error_t **)) libregf_overlay_io_handle_free,
+	     (int (*)(intptr_t **, intptr_t *, libcerror_error_t **)) libregf_overlay_io_handle_clone,
+	     (int (*)(intptr_t *, int, libcerror_error_t **)) libregf_overlay_io_handle_open,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libregf_overlay_io_handle_close,
+	     (ssize_t (*)(intptr_t *, uint8_t *, size_t, libcerror_error_t **)) libregf_overlay_io_handle_read,
+	     (ssize_t (*)(intptr_t *, const uint8_t *, size_t, libcerror_error_t **)) libregf_overlay_io_handle_write,
+	     (off64_t (*)(intptr_t *, off64_t, int, libcerror_error_t **)) libregf_overlay_io_handle_seek_offset,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libregf_overlay_io_handle_exists,
+	     (int (*)(intptr_t *, libcerror_error_t **)) libregf_overlay_io_handle_is_open,
+	     (int (*)(intptr_t *, size64_t *, libcerror_error_t **)) libregf_overlay_io_handle_get_size,
+	     LIBBFIO_FLAG_IO_HANDLE_MANAGED | LIBBFIO_FLAG_IO_HANDLE_CLONE_BY_FUNCTION,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( overlay_io_handle != NULL )
+	{
+		libregf_overlay_io_handle_free(
+		 &overlay_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees an overlay IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_overlay_io_handle_free(
+     libregf_overlay_io_handle_t **overlay_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_overlay_io_handle_free";
+	int result            = 1;
+
+	if( overlay_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid overlay IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *overlay_io_handle != NULL )
+	{
+		if( ( *overlay_io_handle )->file_io_handle_opened_in_handle != 0 )
+		{
+			if( libbfio_handle_close(
+			     ( *overlay_io_handle )->file_io_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *overlay_io_handle )->file_io_handle_created_in_handle != 0 )
+		{
+			if( libbfio_handle_free(
+			     &( ( *overlay_io_handle )->file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *overlay_io_handle );
+
+		*overlay_io_handle = NULL;
+	}
+	return( result );
+}
+
+/* Clones (duplicates) the overlay IO handle and its attributes
+ * The file IO handle of the hive file is cloned, the dirty pages are shared
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_overlay_io_handle_clone(
+     libregf_overlay_io_handle_t **destination_overlay_io_handle,
+     libregf_overlay_io_handle_t *source_overlay_io_handle,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "libregf_overlay_io_handle_clone";
+
+	if( destination_overlay_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination overlay IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_overlay_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: destination overlay IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_overlay_io_handle == NULL )
+	{
+		*destination_overlay_io_handle = NULL;
+
+		return( 1 );
+	}
+	if( libbfio_handle_clone(
+	     &file_io_handle,
+	     source_overlay_io_handle->file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to clone file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libregf_overlay_io_handle_initialize(
+	     destination_overlay_io_handle,
+	     file_io_handle,
+	     source_overlay_io_handle->dirty_pages,
+	     source_overlay_io_handle->hive_bins_list_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination overlay IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *destination_overlay_io_handle )->file_io_handle_created_in_handle = 1;
+
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Opens the overlay IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_overlay_io_handle_open(
+     libregf_overlay_io_handle_t *overlay_io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_overlay_io_handle_open";
+	int result            = 0;
+
+	if( overlay_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid overlay IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( overlay_io_handle->is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid overlay IO handle - already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBBFIO_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access not supported.",
+		 function );
+
+		return( -1 );
+	}
+	result = libbfio_handle_is_open(
+	          overlay_io_handle->file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		if( libbfio_handle_open(
+		     overlay_io_handle->file_io_handle,
+		     access_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			return( -1 );
+		}
+		overlay_io_handle->file_io_handle_opened_in_handle = 1;
+	}
+	overlay_io_handle->current_offset = 0;
+	overlay_io_handle->is_open        = 1;
+
+	return( 1 );
+}
+
+/* Closes the overlay IO handle
+ * Returns 0 if successful or -1 on error
+ */
+int libregf_overlay_io_handle_close(
+     libregf_overlay_io_handle_t *overlay_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_overlay_io_handle_close";
+
+	if( overlay_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid overlay IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( overlay_io_handle->file_io_handle_opened_in_handle != 0 )
+	{
+		if( libbfio_handle_close(
+		     overlay_io_handle->file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			return( -1 );
+		}
+		overlay_io_handle->file_io_handle_opened_in_handle = 0;
+	}
+	overlay_io_handle->is_open = 0;
+
+	return( 0 );
+}
+
+/* Reads a buffer from the overlay IO handle
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libregf_overlay_io_handle_read(
+         libregf_overlay_io_handle_t *overlay_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error )
+{
+	static char *function      = "libregf_overlay_io_handle_read";
+	size64_t overlay_size      = 0;
+	size_t hive_bins_data_size = 0;
+	size_t hive_bins_offset    = 0;
+	ssize_t read_count         = 0;
+	off64_t hive_bins_end      = 0;
+
+	if( overlay_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid overlay IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libregf_overlay_io_handle_get_size(
+	     overlay_io_handle,
+	     &overlay_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) overlay_io_handle->current_offset >= overlay_size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) size > ( overlay_size - overlay_io_handle->current_offset ) )
+	{
+		size = (size_t) ( overlay_size - overlay_io_handle->current_offset );
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              overlay_io_handle->file_io_handle,
+	              buffer,
+	              size,
+	              overlay_io_handle->current_offset,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer from file IO handle at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 overlay_io_handle->current_offset,
+		 overlay_io_handle->current_offset );
+
+		return( -1 );
+	}
+	/* The replayed hive bins can extend beyond the end of the hive file
+	 */
+	if( (size_t) read_count < size )
+	{
+		if( memory_set(
+		     &( buffer[ read_count ] ),
+		     0,
+		     size - (size_t) read_count ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	hive_bins_end = overlay_io_handle->hive_bins_list_offset + (off64_t) overlay_io_handle->dirty_pages->hive_bins_size;
+
+	if( ( ( overlay_io_handle->current_offset + (off64_t) size ) > overlay_io_handle->hive_bins_list_offset )
+	 && ( overlay_io_handle->current_offset < hive_bins_end ) )
+	{
+		hive_bins_data_size = size;
+
+		if( overlay_io_handle->current_offset < overlay_io_handle->hive_bins_list_offset )
+		{
+			hive_bins_offset     = (size_t) ( overlay_io_handle->hive_bins_list_offset - overlay_io_handle->current_offset );
+			hive_bins_data_size -= hive_bins_offset;
+		}
+		if( libregf_dirty_pages_apply_to_buffer(
+		     overlay_io_handle->dirty_pages,
+		     (uint32_t) ( overlay_io_handle->current_offset + (off64_t) hive_bins_offset - overlay_io_handle->hive_bins_list_offset ),
+		     &( buffer[ hive_bins_offset ] ),
+		     hive_bins_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to apply dirty pages to buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	overlay_io_handle->current_offset += (off64_t) size;
+
+	return( (ssize_t) size );
+}
+
+/* Writes a buffer to the overlay IO handle
+ * Returns the number of bytes written or -1 on error
+ */
+ssize_t libregf_overlay_io_handle_write(
+         libregf_overlay_io_handle_t *overlay_io_handle,
+         const uint8_t *buffer LIBREGF_ATTRIBUTE_UNUSED,
+         size_t size LIBREGF_ATTRIBUTE_UNUSED,
+         libcerror_error_t **error )
+{
+	static char *function = "libregf_overlay_io_handle_write";
+
+	LIBREGF_UNREFERENCED_PARAMETER( buffer )
+	LIBREGF_UNREFERENCED_PARAMETER( size )
+
+	if( overlay_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid overlay IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: write not supported.",
+	 function );
+
+	return( -1 );
+}
+
+/* Seeks a certain offset within the overlay IO handle
+ * Returns the offset if the seek is successful or -1 on error
+ */
+off64_t libregf_overlay_io_handle_seek_offset(
+         libregf_overlay_io_handle_t *overlay_io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error )
+{
+	static char *function = "libregf_overlay_io_handle_seek_offset";
+	size64_t overlay_size = 0;
+
+	if( overlay_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid overlay IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( whence != SEEK_CUR )
+	 && ( whence != SEEK_END )
+	 && ( whence != SEEK_SET ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		return( -1 );
+	}
+	if( whence == SEEK_CUR )
+	{
+		offset += overlay_io_handle->current_offset;
+	}
+	else if( whence == SEEK_END )
+	{
+		if( libregf_overlay_io_handle_get_size(
+		     overlay_io_handle,
+		     &overlay_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve size.",
+			 function );
+
+			return( -1 );
+		}
+		offset += (off64_t) overlay_size;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	overlay_io_handle->current_offset = offset;
+
+	return( offset );
+}
+
+/* Function to determine if a file exists
+ * Returns 1 if file exists, 0 if not or -1 on error
+ */
+int libregf_overlay_io_handle_exists(
+     libregf_overlay_io_handle_t *overlay_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_overlay_io_handle_exists";
+
+	if( overlay_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid overlay IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Check if the overlay IO handle is open
+ * Returns 1 if open, 0 if not or -1 on error
+ */
+int libregf_overlay_io_handle_is_open(
+     libregf_overlay_io_handle_t *overlay_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_overlay_io_handle_is_open";
+
+	if( overlay_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid overlay IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( (int) overlay_io_handle->is_open );
+}
+
+/* Retrieves the size of the overlay IO handle
+ * The size is the size of the hive file or the end of the replayed hive bins if larger
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_overlay_io_handle_get_size(
+     libregf_overlay_io_handle_t *overlay_io_handle,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function  = "libregf_overlay_io_handle_get_size";
+	size64_t file_size     = 0;
+	size64_t hive_bins_end = 0;
+
+	if( overlay_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid overlay IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     overlay_io_handle->file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		return( -1 );
+	}
+	hive_bins_end = (size64_t) overlay_io_handle->hive_bins_list_offset + overlay_io_handle->dirty_pages->hive_bins_size;
+
+	if( file_size < hive_bins_end )
+	{
+		file_size = hive_bins_end;
+	}
+	*size = file_size;
+
+	return( 1 );
+}
+
@@ -0,0 +1,137 @@
+/*
+ * Overlay IO handle functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBREGF_OVERLAY_IO_HANDLE_H )
+#define _LIBREGF_OVERLAY_IO_HANDLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libregf_dirty_pages.h"
+#include "libregf_libbfio.h"
+#include "libregf_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libregf_overlay_io_handle libregf_overlay_io_handle_t;
+
+struct libregf_overlay_io_handle
+{
+	/* The file IO handle of the hive file
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The dirty pages, which are overlaid on the hive bins
+	 */
+	libregf_dirty_pages_t *dirty_pages;
+
+	/* The hive bins list offset
+	 */
+	off64_t hive_bins_list_offset;
+
+	/* The current offset
+	 */
+	off64_t current_offset;
+
+	/* Value to indicate if the file IO handle was created inside the overlay IO handle
+	 */
+	uint8_t file_io_handle_created_in_handle;
+
+	/* Value to indicate if the file IO handle was opened inside the overlay IO handle
+	 */
+	uint8_t file_io_handle_opened_in_handle;
+
+	/* Value to indicate if the overlay IO handle is open
+	 */
+	uint8_t is_open;
+};
+
+int libregf_overlay_io_handle_initialize(
+     libregf_overlay_io_handle_t **overlay_io_handle,
+     libbfio_handle_t *file_io_handle,
+     libregf_dirty_pages_t *dirty_pages,
+     off64_t hive_bins_list_offset,
+     libcerror_error_t **error );
+
+int libregf_overlay_initialize(
+     libbfio_handle_t **handle,
+     libbfio_handle_t *file_io_handle,
+     libregf_dirty_pages_t *dirty_pages,
+     off64_t hive_bins_list_offset,
+     libcerror_error_t **error );
+
+int libregf_overlay_io_handle_free(
+     libregf_overlay_io_handle_t **overlay_io_handle,
+     libcerror_error_t **error );
+
+int libregf_overlay_io_handle_clone(
+     libregf_overlay_io_handle_t **destination_overlay_io_handle,
+     libregf_overlay_io_handle_t *source_overlay_io_handle,
+     libcerror_error_t **error );
+
+int libregf_overlay_io_handle_open(
+     libregf_overlay_io_handle_t *overlay_io_handle,
+     int access_flags,
+     libcerror_error_t **error );
+
+int libregf_overlay_io_handle_close(
+     libregf_overlay_io_handle_t *overlay_io_handle,
+     libcerror_error_t **error );
+
+ssize_t libregf_overlay_io_handle_read(
+         libregf_overlay_io_handle_t *overlay_io_handle,
+         uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+ssize_t libregf_overlay_io_handle_write(
+         libregf_overlay_io_handle_t *overlay_io_handle,
+         const uint8_t *buffer,
+         size_t size,
+         libcerror_error_t **error );
+
+off64_t libregf_overlay_io_handle_seek_offset(
+         libregf_overlay_io_handle_t *overlay_io_handle,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
+int libregf_overlay_io_handle_exists(
+     libregf_overlay_io_handle_t *overlay_io_handle,
+     libcerror_error_t **error );
+
+int libregf_overlay_io_handle_is_open(
+     libregf_overlay_io_handle_t *overlay_io_handle,
+     libcerror_error_t **error );
+
+int libregf_overlay_io_handle_get_size(
+     libregf_overlay_io_handle_t *overlay_io_handle,
+     size64_t *size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBREGF_OVERLAY_IO_HANDLE_H ) */
+
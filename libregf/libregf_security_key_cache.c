@@ -0,0 +1,672 @@
+/*
+ * Security key cache functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libregf_hive_bin_cell.h"
+#include "libregf_hash_table.h"
+#include "libregf_hive_bins_list.h"
+#include "libregf_libbfio.h"
+#include "libregf_libcerror.h"
+#include "libregf_libcthreads.h"
+#include "libregf_security_key.h"
+#include "libregf_security_key_cache.h"
+
+/* The initial number of entries of the security key cache
+ */
+#define LIBREGF_SECURITY_KEY_CACHE_INITIAL_NUMBER_OF_ENTRIES	64
+
+/* Creates a security key cache
+ * Make sure the value security_key_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_security_key_cache_initialize(
+     libregf_security_key_cache_t **security_key_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_security_key_cache_initialize";
+
+	if( security_key_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security key cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *security_key_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid security key cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*security_key_cache = memory_allocate_structure(
+	                       libregf_security_key_cache_t );
+
+	if( *security_key_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create security key cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *security_key_cache,
+	     0,
+	     sizeof( libregf_security_key_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear security key cache.",
+		 function );
+
+		memory_free(
+		 *security_key_cache );
+
+		*security_key_cache = NULL;
+
+		return( -1 );
+	}
+	if( libregf_hash_table_initialize(
+	     &( ( *security_key_cache )->hash_table ),
+	     LIBREGF_SECURITY_KEY_CACHE_INITIAL_NUMBER_OF_ENTRIES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create hash table.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *security_key_cache )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *security_key_cache != NULL )
+	{
+		if( ( *security_key_cache )->hash_table != NULL )
+		{
+			libregf_hash_table_free(
+			 &( ( *security_key_cache )->hash_table ),
+			 NULL,
+			 NULL );
+		}
+		memory_free(
+		 *security_key_cache );
+
+		*security_key_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a security key cache
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_security_key_cache_free(
+     libregf_security_key_cache_t **security_key_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_security_key_cache_free";
+	int result            = 1;
+
+	if( security_key_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security key cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *security_key_cache != NULL )
+	{
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *security_key_cache )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( libregf_hash_table_free(
+		     &( ( *security_key_cache )->hash_table ),
+		     (int (*)(intptr_t *, libcerror_error_t **)) &libregf_security_key_cache_entry_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free hash table.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *security_key_cache );
+
+		*security_key_cache = NULL;
+	}
+	return( result );
+}
+
+/* Frees a security key cache entry and its security key
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_security_key_cache_entry_free(
+     libregf_security_key_cache_entry_t **entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_security_key_cache_entry_free";
+	int result            = 1;
+
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *entry != NULL )
+	{
+		if( ( *entry )->security_key != NULL )
+		{
+			if( libregf_security_key_free(
+			     &( ( *entry )->security_key ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free security key.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *entry );
+
+		*entry = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves the entry of a specific security key offset
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libregf_security_key_cache_get_entry_by_offset(
+     libregf_security_key_cache_t *security_key_cache,
+     uint32_t security_key_offset,
+     libregf_security_key_cache_entry_t **entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_security_key_cache_get_entry_by_offset";
+	intptr_t value        = 0;
+	int entry_index       = 0;
+	int result            = 0;
+
+	if( security_key_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security key cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	result = libregf_hash_table_get_first_value(
+	          security_key_cache->hash_table,
+	          security_key_offset,
+	          &entry_index,
+	          &value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from hash table.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		*entry = (libregf_security_key_cache_entry_t *) value;
+	}
+	return( result );
+}
+
+/* Inserts an entry
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_security_key_cache_insert_entry(
+     libregf_security_key_cache_t *security_key_cache,
+     libregf_security_key_cache_entry_t *entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_security_key_cache_insert_entry";
+
+	if( security_key_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security key cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libregf_hash_table_insert_value(
+	     security_key_cache->hash_table,
+	     entry->security_key_offset,
+	     (intptr_t) entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert entry in hash table.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the security key of a specific security key offset
+ * The security key is read if not already cached. The security key is owned by the cache,
+ * is not modified after it has been cached and remains available until the cache is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_security_key_cache_get_security_key(
+     libregf_security_key_cache_t *security_key_cache,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     uint32_t security_key_offset,
+     libregf_security_key_t **security_key,
+     libcerror_error_t **error )
+{
+	libregf_hive_bin_cell_t *hive_bin_cell             = NULL;
+	libregf_security_key_cache_entry_t *entry          = NULL;
+	libregf_security_key_cache_entry_t *existing_entry = NULL;
+	static char *function                              = "libregf_security_key_cache_get_security_key";
+	int result                                         = 0;
+
+	if( security_key_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security key cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( hive_bins_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hive bins list.",
+		 function );
+
+		return( -1 );
+	}
+	if( security_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid security key.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     security_key_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libregf_security_key_cache_get_entry_by_offset(
+	          security_key_cache,
+	          security_key_offset,
+	          &existing_entry,
+	          error );
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     security_key_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry for security key offset: %" PRIu32 ".",
+		 function,
+		 security_key_offset );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		*security_key = existing_entry->security_key;
+
+		return( 1 );
+	}
+	/* The security key is read without holding the mutex so that other
+	 * security keys can be retrieved from the cache in the meantime
+	 */
+	entry = memory_allocate_structure(
+	         libregf_security_key_cache_entry_t );
+
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     entry,
+	     0,
+	     sizeof( libregf_security_key_cache_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entry.",
+		 function );
+
+		memory_free(
+		 entry );
+
+		return( -1 );
+	}
+	entry->security_key_offset = security_key_offset;
+
+	if( libregf_hive_bins_list_get_cell_at_offset(
+	     hive_bins_list,
+	     file_io_handle,
+	     security_key_offset,
+	     &hive_bin_cell,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve hive bin at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 function,
+		 security_key_offset,
+		 security_key_offset );
+
+		goto on_error;
+	}
+	if( libregf_security_key_initialize(
+	     &( entry->security_key ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create security key.",
+		 function );
+
+		goto on_error;
+	}
+	if( libregf_security_key_read_data(
+	     entry->security_key,
+	     hive_bins_list->io_handle,
+	     hive_bin_cell->data,
+	     hive_bin_cell->size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read security key at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 function,
+		 security_key_offset,
+		 security_key_offset );
+
+		goto on_error;
+	}
+	if( libregf_hive_bins_list_release_cell_at_offset(
+	     hive_bins_list,
+	     file_io_handle,
+	     security_key_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release hive bin cell at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 function,
+		 security_key_offset,
+		 security_key_offset );
+
+		hive_bin_cell = NULL;
+
+		goto on_error;
+	}
+	hive_bin_cell = NULL;
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     security_key_cache->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		goto on_error;
+	}
+	/* Another thread could have cached the same security key in the meantime
+	 */
+	result = libregf_security_key_cache_get_entry_by_offset(
+	          security_key_cache,
+	          security_key_offset,
+	          &existing_entry,
+	          error );
+#endif
+	if( result == 0 )
+	{
+		result = libregf_security_key_cache_insert_entry(
+		          security_key_cache,
+		          entry,
+		          error );
+
+		if( result == 1 )
+		{
+			existing_entry = entry;
+			entry          = NULL;
+		}
+	}
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     security_key_cache->mutex,
+	     NULL ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to insert entry for security key offset: %" PRIu32 ".",
+		 function,
+		 security_key_offset );
+
+		goto on_error;
+	}
+	if( entry != NULL )
+	{
+		libregf_security_key_cache_entry_free(
+		 &entry,
+		 NULL );
+	}
+	*security_key = existing_entry->security_key;
+
+	return( 1 );
+
+on_error:
+	if( hive_bin_cell != NULL )
+	{
+		libregf_hive_bins_list_release_cell_at_offset(
+		 hive_bins_list,
+		 file_io_handle,
+		 security_key_offset,
+		 NULL );
+	}
+	if( entry != NULL )
+	{
+		libregf_security_key_cache_entry_free(
+		 &entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
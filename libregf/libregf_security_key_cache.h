@@ -0,0 +1,103 @@
+/*
+ * Security key cache functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBREGF_SECURITY_KEY_CACHE_H )
+#define _LIBREGF_SECURITY_KEY_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libregf_hash_table.h"
+#include "libregf_hive_bins_list.h"
+#include "libregf_libbfio.h"
+#include "libregf_libcerror.h"
+#include "libregf_libcthreads.h"
+#include "libregf_security_key.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libregf_security_key_cache_entry libregf_security_key_cache_entry_t;
+
+struct libregf_security_key_cache_entry
+{
+	/* The security key offset
+	 */
+	uint32_t security_key_offset;
+
+	/* The security key
+	 */
+	libregf_security_key_t *security_key;
+};
+
+typedef struct libregf_security_key_cache libregf_security_key_cache_t;
+
+struct libregf_security_key_cache
+{
+	/* The hash table, which maps a security key offset to its entry
+	 */
+	libregf_hash_table_t *hash_table;
+
+#if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libregf_security_key_cache_initialize(
+     libregf_security_key_cache_t **security_key_cache,
+     libcerror_error_t **error );
+
+int libregf_security_key_cache_free(
+     libregf_security_key_cache_t **security_key_cache,
+     libcerror_error_t **error );
+
+int libregf_security_key_cache_entry_free(
+     libregf_security_key_cache_entry_t **entry,
+     libcerror_error_t **error );
+
+int libregf_security_key_cache_get_entry_by_offset(
+     libregf_security_key_cache_t *security_key_cache,
+     uint32_t security_key_offset,
+     libregf_security_key_cache_entry_t **entry,
+     libcerror_error_t **error );
+
+int libregf_security_key_cache_insert_entry(
+     libregf_security_key_cache_t *security_key_cache,
+     libregf_security_key_cache_entry_t *entry,
+     libcerror_error_t **error );
+
+int libregf_security_key_cache_get_security_key(
+     libregf_security_key_cache_t *security_key_cache,
+     libbfio_handle_t *file_io_handle,
+     libregf_hive_bins_list_t *hive_bins_list,
+     uint32_t security_key_offset,
+     libregf_security_key_t **security_key,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBREGF_SECURITY_KEY_CACHE_H ) */
+
@@ -34,11 +34,14 @@
 #include "regf_cell_values.h"
 
 /* Creates a sub key list
+ * The sub key descriptors are allocated from the arena if set, these are released
+ * in bulk when the arena is reset or freed
  * Make sure the value sub_key_list is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
  */
 int libregf_sub_key_list_initialize(
      libregf_sub_key_list_t **sub_key_list,
+     libregf_arena_t *arena,
      libcerror_error_t **error )
 {
 	static char *function = "libregf_sub_key_list_initialize";
@@ -112,6 +115,8 @@ int libregf_sub_key_list_initialize(
 
 		goto on_error;
 	}
+	( *sub_key_list )->arena = arena;
+
 	return( 1 );
 
 on_error:
@@ -133,6 +138,7 @@ int libregf_sub_key_list_free(
      libcerror_error_t **error )
 {
 	static char *function = "libregf_sub_key_list_free";
+	int free_result       = 0;
 	int result            = 1;
 
 	if( sub_key_list == NULL )
@@ -148,10 +154,23 @@ int libregf_sub_key_list_free(
 	}
 	if( *sub_key_list != NULL )
 	{
-		if( libcdata_array_free(
-		     &( ( *sub_key_list )->sub_key_descriptors ),
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libregf_key_descriptor_free,
-		     error ) != 1 )
+		/* Sub key descriptors allocated from an arena are released with the arena
+		 */
+		if( ( *sub_key_list )->arena != NULL )
+		{
+			free_result = libcdata_array_free(
+			               &( ( *sub_key_list )->sub_key_descriptors ),
+			               NULL,
+			               error );
+		}
+		else
+		{
+			free_result = libcdata_array_free(
+			               &( ( *sub_key_list )->sub_key_descriptors ),
+			               (int (*)(intptr_t **, libcerror_error_t **)) &libregf_key_descriptor_free,
+			               error );
+		}
+		if( free_result != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -187,7 +206,9 @@ int libregf_sub_key_list_read_data(
 	uint16_t element_index                       = 0;
 	uint16_t number_of_elements                  = 0;
 	uint8_t element_data_size                    = 0;
+	uint8_t has_name_hashes                      = 0;
 	int entry_index                              = 0;
+	int result                                   = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	uint32_t value_32bit                         = 0;
@@ -277,12 +298,20 @@ int libregf_sub_key_list_read_data(
 		sub_key_list->at_leaf_level = 1;
 	}
 	else if( ( data[ data_offset ] == (uint8_t) 'l' )
-	      && ( ( data[ data_offset + 1 ] == (uint8_t) 'f' )
-	        || ( data[ data_offset + 1 ] == (uint8_t) 'h' ) ) )
+	      && ( data[ data_offset + 1 ] == (uint8_t) 'f' ) )
 	{
 		element_data_size           = 8;
 		sub_key_list->at_leaf_level = 1;
 	}
+	else if( ( data[ data_offset ] == (uint8_t) 'l' )
+	      && ( data[ data_offset + 1 ] == (uint8_t) 'h' ) )
+	{
+		/* The hash value of a "lh" sub key list element contains the name hash
+		 */
+		element_data_size           = 8;
+		has_name_hashes             = 1;
+		sub_key_list->at_leaf_level = 1;
+	}
 	else
 	{
 		libcerror_error_set(
@@ -343,9 +372,20 @@ int libregf_sub_key_list_read_data(
 	     element_index < number_of_elements;
 	     element_index++ )
 	{
-		if( libregf_key_descriptor_initialize(
-		     &sub_key_descriptor,
-		     error ) != 1 )
+		if( sub_key_list->arena != NULL )
+		{
+			result = libregf_key_descriptor_initialize_from_arena(
+			          &sub_key_descriptor,
+			          sub_key_list->arena,
+			          error );
+		}
+		else
+		{
+			result = libregf_key_descriptor_initialize(
+			          &sub_key_descriptor,
+			          error );
+		}
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -369,6 +409,11 @@ int libregf_sub_key_list_read_data(
 			 sub_key_descriptor->hash_value );
 
 			data_offset += 4;
+
+			if( has_name_hashes != 0 )
+			{
+				sub_key_descriptor->name_hash = sub_key_descriptor->hash_value;
+			}
 		}
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
@@ -430,7 +475,8 @@ int libregf_sub_key_list_read_data(
 	return( 1 );
 
 on_error:
-	if( sub_key_descriptor != NULL )
+	if( ( sub_key_descriptor != NULL )
+	 && ( sub_key_list->arena == NULL ) )
 	{
 		libregf_key_descriptor_free(
 		 &sub_key_descriptor,
@@ -27,6 +27,7 @@
 
 #include "libregf_io_handle.h"
 #include "libregf_libcdata.h"
+#include "libregf_arena.h"
 #include "libregf_libcerror.h"
 
 #if defined( __cplusplus )
@@ -44,10 +45,15 @@ struct libregf_sub_key_list
 	/* Value to indicates the sub key list is at leaf level
 	 */
 	uint8_t at_leaf_level;
+
+	/* The arena the sub key descriptors are allocated from, or NULL if not set
+	 */
+	libregf_arena_t *arena;
 };
 
 int libregf_sub_key_list_initialize(
      libregf_sub_key_list_t **sub_key_list,
+     libregf_arena_t *arena,
      libcerror_error_t **error );
 
 int libregf_sub_key_list_free(
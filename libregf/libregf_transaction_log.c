@@ -0,0 +1,1092 @@
+/*
+ * Transaction log functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libregf_checksum.h"
+#include "libregf_definitions.h"
+#include "libregf_dirty_pages.h"
+#include "libregf_dirty_vector.h"
+#include "libregf_file_header.h"
+#include "libregf_libbfio.h"
+#include "libregf_libcerror.h"
+#include "libregf_libcnotify.h"
+#include "libregf_transaction_log.h"
+
+#include "regf_file_header.h"
+#include "regf_transaction_log.h"
+
+/* Creates a transaction log
+ * Make sure the value transaction_log is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_transaction_log_initialize(
+     libregf_transaction_log_t **transaction_log,
+     uint32_t sequence_number,
+     uint32_t hive_bins_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_transaction_log_initialize";
+
+	if( transaction_log == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid transaction log.",
+		 function );
+
+		return( -1 );
+	}
+	if( *transaction_log != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid transaction log value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*transaction_log = memory_allocate_structure(
+	                    libregf_transaction_log_t );
+
+	if( *transaction_log == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create transaction log.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *transaction_log,
+	     0,
+	     sizeof( libregf_transaction_log_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear transaction log.",
+		 function );
+
+		memory_free(
+		 *transaction_log );
+
+		*transaction_log = NULL;
+
+		return( -1 );
+	}
+	( *transaction_log )->sequence_number = sequence_number;
+	( *transaction_log )->hive_bins_size  = hive_bins_size;
+
+	return( 1 );
+
+on_error:
+	if( *transaction_log != NULL )
+	{
+		memory_free(
+		 *transaction_log );
+
+		*transaction_log = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a transaction log
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_transaction_log_free(
+     libregf_transaction_log_t **transaction_log,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_transaction_log_free";
+	int result            = 1;
+
+	if( transaction_log == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid transaction log.",
+		 function );
+
+		return( -1 );
+	}
+	if( *transaction_log != NULL )
+	{
+		if( ( *transaction_log )->file_header != NULL )
+		{
+			if( libregf_file_header_free(
+			     &( ( *transaction_log )->file_header ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file header.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *transaction_log );
+
+		*transaction_log = NULL;
+	}
+	return( result );
+}
+
+/* Reads a log entry and applies its dirty pages
+ * Log entries with a sequence number before the one expected are skipped
+ * Returns 1 if successful, 0 if the data does not contain the next log entry or -1 on error
+ */
+int libregf_transaction_log_read_entry_data(
+     libregf_transaction_log_t *transaction_log,
+     libregf_dirty_pages_t *dirty_pages,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function           = "libregf_transaction_log_read_entry_data";
+	size_t page_data_offset         = 0;
+	size_t page_reference_offset    = 0;
+	uint64_t calculated_data_hash   = 0;
+	uint64_t calculated_header_hash = 0;
+	uint64_t stored_data_hash       = 0;
+	uint64_t stored_header_hash     = 0;
+	uint32_t entry_size             = 0;
+	uint32_t hive_bins_size         = 0;
+	uint32_t number_of_dirty_pages  = 0;
+	uint32_t page_index             = 0;
+	uint32_t page_offset            = 0;
+	uint32_t page_size              = 0;
+	uint32_t sequence_number        = 0;
+
+	if( transaction_log == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid transaction log.",
+		 function );
+
+		return( -1 );
+	}
+	if( dirty_pages == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid dirty pages.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( regf_log_entry_header_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     ( (regf_log_entry_header_t *) data )->signature,
+	     "HvLE",
+	     4 ) != 0 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (regf_log_entry_header_t *) data )->size,
+	 entry_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (regf_log_entry_header_t *) data )->sequence_number,
+	 sequence_number );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (regf_log_entry_header_t *) data )->hive_bins_size,
+	 hive_bins_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (regf_log_entry_header_t *) data )->number_of_dirty_pages,
+	 number_of_dirty_pages );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (regf_log_entry_header_t *) data )->data_hash,
+	 stored_data_hash );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (regf_log_entry_header_t *) data )->header_hash,
+	 stored_header_hash );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: size\t\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 entry_size );
+
+		libcnotify_printf(
+		 "%s: sequence number\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 sequence_number );
+
+		libcnotify_printf(
+		 "%s: hive bins size\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 hive_bins_size );
+
+		libcnotify_printf(
+		 "%s: number of dirty pages\t\t\t: %" PRIu32 "\n",
+		 function,
+		 number_of_dirty_pages );
+
+		libcnotify_printf(
+		 "%s: data hash\t\t\t\t: 0x%016" PRIx64 "\n",
+		 function,
+		 stored_data_hash );
+
+		libcnotify_printf(
+		 "%s: header hash\t\t\t\t: 0x%016" PRIx64 "\n",
+		 function,
+		 stored_header_hash );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	if( ( (size_t) entry_size != data_size )
+	 || ( ( entry_size % LIBREGF_DIRTY_PAGE_SIZE ) != 0 )
+	 || ( ( hive_bins_size % LIBREGF_DIRTY_PAGE_SIZE ) != 0 ) )
+	{
+		return( 0 );
+	}
+	if( libregf_checksum_calculate_marvin32(
+	     &calculated_header_hash,
+	     data,
+	     32,
+	     LIBREGF_TRANSACTION_LOG_MARVIN32_SEED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate header hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( stored_header_hash != calculated_header_hash )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: mismatch in header hash ( 0x%016" PRIx64 " != 0x%016" PRIx64 " ).\n",
+			 function,
+			 stored_header_hash,
+			 calculated_header_hash );
+		}
+#endif
+		return( 0 );
+	}
+	if( libregf_checksum_calculate_marvin32(
+	     &calculated_data_hash,
+	     &( data[ sizeof( regf_log_entry_header_t ) ] ),
+	     data_size - sizeof( regf_log_entry_header_t ),
+	     LIBREGF_TRANSACTION_LOG_MARVIN32_SEED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to calculate data hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( stored_data_hash != calculated_data_hash )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: mismatch in data hash ( 0x%016" PRIx64 " != 0x%016" PRIx64 " ).\n",
+			 function,
+			 stored_data_hash,
+			 calculated_data_hash );
+		}
+#endif
+		return( 0 );
+	}
+	if( sequence_number < transaction_log->sequence_number )
+	{
+		/* The log entry was already written to the hive
+		 */
+		return( 1 );
+	}
+	if( sequence_number != transaction_log->sequence_number )
+	{
+		return( 0 );
+	}
+	if( (size_t) number_of_dirty_pages > ( ( data_size - sizeof( regf_log_entry_header_t ) ) / sizeof( regf_dirty_page_reference_t ) ) )
+	{
+		return( 0 );
+	}
+	/* Validate the dirty page references before applying any of them
+	 * so that a log entry is either applied completely or not at all
+	 */
+	page_data_offset = sizeof( regf_log_entry_header_t )
+	                 + ( (size_t) number_of_dirty_pages * sizeof( regf_dirty_page_reference_t ) );
+
+	page_reference_offset = sizeof( regf_log_entry_header_t );
+
+	for( page_index = 0;
+	     page_index < number_of_dirty_pages;
+	     page_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (regf_dirty_page_reference_t *) &( data[ page_reference_offset ] ) )->offset,
+		 page_offset );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (regf_dirty_page_reference_t *) &( data[ page_reference_offset ] ) )->size,
+		 page_size );
+
+		page_reference_offset += sizeof( regf_dirty_page_reference_t );
+
+		if( ( ( page_offset % LIBREGF_DIRTY_PAGE_SIZE ) != 0 )
+		 || ( ( page_size % LIBREGF_DIRTY_PAGE_SIZE ) != 0 )
+		 || ( page_offset > hive_bins_size )
+		 || ( page_size > ( hive_bins_size - page_offset ) )
+		 || ( (size_t) page_size > ( data_size - page_data_offset ) ) )
+		{
+			return( 0 );
+		}
+		page_data_offset += page_size;
+	}
+	if( libregf_dirty_pages_resize(
+	     dirty_pages,
+	     hive_bins_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize dirty pages.",
+		 function );
+
+		return( -1 );
+	}
+	page_data_offset = sizeof( regf_log_entry_header_t )
+	                 + ( (size_t) number_of_dirty_pages * sizeof( regf_dirty_page_reference_t ) );
+
+	page_reference_offset = sizeof( regf_log_entry_header_t );
+
+	for( page_index = 0;
+	     page_index < number_of_dirty_pages;
+	     page_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (regf_dirty_page_reference_t *) &( data[ page_reference_offset ] ) )->offset,
+		 page_offset );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (regf_dirty_page_reference_t *) &( data[ page_reference_offset ] ) )->size,
+		 page_size );
+
+		page_reference_offset += sizeof( regf_dirty_page_reference_t );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: dirty page: %02" PRIu32 " offset\t\t\t: 0x%08" PRIx32 "\n",
+			 function,
+			 page_index,
+			 page_offset );
+
+			libcnotify_printf(
+			 "%s: dirty page: %02" PRIu32 " size\t\t\t: %" PRIu32 "\n",
+			 function,
+			 page_index,
+			 page_size );
+		}
+#endif
+		if( page_size > 0 )
+		{
+			if( libregf_dirty_pages_set_data(
+			     dirty_pages,
+			     page_offset,
+			     &( data[ page_data_offset ] ),
+			     (size_t) page_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set dirty page: %" PRIu32 " data.",
+				 function,
+				 page_index );
+
+				return( -1 );
+			}
+		}
+		page_data_offset += page_size;
+	}
+	transaction_log->sequence_number += 1;
+	transaction_log->hive_bins_size   = hive_bins_size;
+
+	transaction_log->number_of_applied_entries += 1;
+
+	return( 1 );
+}
+
+/* Reads the log entries of a new format transaction log and applies their dirty pages
+ * Reading stops at the first log entry that is missing, invalid or out of sequence
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_transaction_log_read_entries_file_io_handle(
+     libregf_transaction_log_t *transaction_log,
+     libregf_dirty_pages_t *dirty_pages,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	regf_log_entry_header_t entry_header;
+
+	uint8_t *entry_data    = NULL;
+	uint8_t *reallocation  = NULL;
+	static char *function  = "libregf_transaction_log_read_entries_file_io_handle";
+	size64_t file_size     = 0;
+	size_t entry_data_size = 0;
+	ssize_t read_count     = 0;
+	uint32_t entry_size    = 0;
+	int result             = 0;
+
+	if( transaction_log == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid transaction log.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	while( (size64_t) file_offset < file_size )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: reading log entry at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
+			 function,
+			 file_offset,
+			 file_offset );
+		}
+#endif
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              (uint8_t *) &entry_header,
+		              sizeof( regf_log_entry_header_t ),
+		              file_offset,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read log entry header at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			goto on_error;
+		}
+		if( read_count != (ssize_t) sizeof( regf_log_entry_header_t ) )
+		{
+			break;
+		}
+		if( memory_compare(
+		     entry_header.signature,
+		     "HvLE",
+		     4 ) != 0 )
+		{
+			break;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 entry_header.size,
+		 entry_size );
+
+		if( ( entry_size < sizeof( regf_log_entry_header_t ) )
+		 || ( (size64_t) entry_size > ( file_size - file_offset ) )
+		 || ( (size_t) entry_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+		{
+			break;
+		}
+		if( (size_t) entry_size > entry_data_size )
+		{
+			reallocation = (uint8_t *) memory_reallocate(
+			                            entry_data,
+			                            sizeof( uint8_t ) * entry_size );
+
+			if( reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize log entry data.",
+				 function );
+
+				goto on_error;
+			}
+			entry_data      = reallocation;
+			entry_data_size = (size_t) entry_size;
+		}
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              entry_data,
+		              (size_t) entry_size,
+		              file_offset,
+		              error );
+
+		if( read_count != (ssize_t) entry_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read log entry data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			goto on_error;
+		}
+		result = libregf_transaction_log_read_entry_data(
+		          transaction_log,
+		          dirty_pages,
+		          entry_data,
+		          (size_t) entry_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read log entry at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		file_offset += entry_size;
+	}
+	if( entry_data != NULL )
+	{
+		memory_free(
+		 entry_data );
+	}
+	return( 1 );
+
+on_error:
+	if( entry_data != NULL )
+	{
+		memory_free(
+		 entry_data );
+	}
+	return( -1 );
+}
+
+/* Reads the dirty vector and dirty pages of an old format transaction log and applies them
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_transaction_log_read_dirty_vector_file_io_handle(
+     libregf_transaction_log_t *transaction_log,
+     libregf_dirty_pages_t *dirty_pages,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	uint8_t page_data[ LIBREGF_DIRTY_PAGE_SIZE ];
+
+	libregf_dirty_vector_t *dirty_vector = NULL;
+	static char *function                = "libregf_transaction_log_read_dirty_vector_file_io_handle";
+	off64_t page_data_offset             = 0;
+	ssize_t read_count                   = 0;
+	uint32_t hive_bins_size              = 0;
+	uint32_t number_of_pages             = 0;
+	uint32_t page_index                  = 0;
+	int result                           = 0;
+
+	if( transaction_log == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid transaction log.",
+		 function );
+
+		return( -1 );
+	}
+	if( transaction_log->file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid transaction log - missing file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	/* An old format transaction log contains a single set of dirty pages,
+	 * that is only complete when its sequence numbers match, and that
+	 * is only needed when the hive was not written after the log was
+	 */
+	if( ( transaction_log->file_header->primary_sequence_number != transaction_log->file_header->secondary_sequence_number )
+	 || ( transaction_log->file_header->primary_sequence_number < transaction_log->sequence_number ) )
+	{
+		return( 1 );
+	}
+	hive_bins_size = transaction_log->file_header->hive_bins_size;
+
+	if( ( hive_bins_size % LIBREGF_DIRTY_PAGE_SIZE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported hive bins size: %" PRIu32 ".",
+		 function,
+		 hive_bins_size );
+
+		goto on_error;
+	}
+	if( libregf_dirty_vector_initialize(
+	     &dirty_vector,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create dirty vector.",
+		 function );
+
+		goto on_error;
+	}
+	if( libregf_dirty_vector_read_file_io_handle(
+	     dirty_vector,
+	     file_io_handle,
+	     file_offset,
+	     hive_bins_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read dirty vector.",
+		 function );
+
+		goto on_error;
+	}
+	if( dirty_vector->data_size == 0 )
+	{
+		/* The dirty vector is incomplete
+		 */
+		if( libregf_dirty_vector_free(
+		     &dirty_vector,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free dirty vector.",
+			 function );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
+	if( libregf_dirty_pages_resize(
+	     dirty_pages,
+	     hive_bins_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize dirty pages.",
+		 function );
+
+		goto on_error;
+	}
+	page_data_offset = file_offset + (off64_t) dirty_vector->data_size;
+	number_of_pages  = hive_bins_size / LIBREGF_DIRTY_PAGE_SIZE;
+
+	for( page_index = 0;
+	     page_index < number_of_pages;
+	     page_index++ )
+	{
+		result = libregf_dirty_vector_page_is_dirty(
+		          dirty_vector,
+		          page_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if page: %" PRIu32 " is dirty.",
+			 function,
+			 page_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              page_data,
+		              LIBREGF_DIRTY_PAGE_SIZE,
+		              page_data_offset,
+		              error );
+
+		if( read_count != (ssize_t) LIBREGF_DIRTY_PAGE_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read dirty page: %" PRIu32 " data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 page_index,
+			 page_data_offset,
+			 page_data_offset );
+
+			goto on_error;
+		}
+		if( libregf_dirty_pages_set_data(
+		     dirty_pages,
+		     page_index * LIBREGF_DIRTY_PAGE_SIZE,
+		     page_data,
+		     LIBREGF_DIRTY_PAGE_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set dirty page: %" PRIu32 " data.",
+			 function,
+			 page_index );
+
+			goto on_error;
+		}
+		page_data_offset += LIBREGF_DIRTY_PAGE_SIZE;
+	}
+	if( libregf_dirty_vector_free(
+	     &dirty_vector,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free dirty vector.",
+		 function );
+
+		goto on_error;
+	}
+	transaction_log->sequence_number = transaction_log->file_header->primary_sequence_number + 1;
+	transaction_log->hive_bins_size  = hive_bins_size;
+
+	transaction_log->number_of_applied_entries += 1;
+
+	return( 1 );
+
+on_error:
+	if( dirty_vector != NULL )
+	{
+		libregf_dirty_vector_free(
+		 &dirty_vector,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads a transaction log and applies its dirty pages
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_transaction_log_read_file_io_handle(
+     libregf_transaction_log_t *transaction_log,
+     libregf_dirty_pages_t *dirty_pages,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	uint8_t signature[ 4 ];
+
+	static char *function = "libregf_transaction_log_read_file_io_handle";
+	off64_t file_offset   = 0;
+	ssize_t read_count    = 0;
+
+	if( transaction_log == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid transaction log.",
+		 function );
+
+		return( -1 );
+	}
+	if( transaction_log->file_header != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid transaction log - file header value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libregf_file_header_initialize(
+	     &( transaction_log->file_header ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( libregf_file_header_read_file_io_handle(
+	     transaction_log->file_header,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( transaction_log->file_header->file_type != LIBREGF_FILE_TYPE_TRANSACTION_LOG1 )
+	 && ( transaction_log->file_header->file_type != LIBREGF_FILE_TYPE_TRANSACTION_LOG2 )
+	 && ( transaction_log->file_header->file_type != LIBREGF_FILE_TYPE_TRANSACTION_LOG6 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported file type: 0x%08" PRIx32 ".",
+		 function,
+		 transaction_log->file_header->file_type );
+
+		goto on_error;
+	}
+	file_offset = (off64_t) sizeof( regf_file_header_t );
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              signature,
+	              4,
+	              file_offset,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read signature at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		goto on_error;
+	}
+	else if( read_count != 4 )
+	{
+		/* The transaction log does not contain any log entries
+		 */
+		return( 1 );
+	}
+	if( memory_compare(
+	     signature,
+	     "HvLE",
+	     4 ) == 0 )
+	{
+		if( libregf_transaction_log_read_entries_file_io_handle(
+		     transaction_log,
+		     dirty_pages,
+		     file_io_handle,
+		     file_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read log entries.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else if( memory_compare(
+	          signature,
+	          "DIRT",
+	          4 ) == 0 )
+	{
+		if( libregf_transaction_log_read_dirty_vector_file_io_handle(
+		     transaction_log,
+		     dirty_pages,
+		     file_io_handle,
+		     file_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read dirty vector.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( transaction_log->file_header != NULL )
+	{
+		libregf_file_header_free(
+		 &( transaction_log->file_header ),
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,100 @@
+/*
+ * Transaction log functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBREGF_TRANSACTION_LOG_H )
+#define _LIBREGF_TRANSACTION_LOG_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libregf_dirty_pages.h"
+#include "libregf_file_header.h"
+#include "libregf_libbfio.h"
+#include "libregf_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libregf_transaction_log libregf_transaction_log_t;
+
+struct libregf_transaction_log
+{
+	/* The file header
+	 */
+	libregf_file_header_t *file_header;
+
+	/* The sequence number of the next log entry to apply
+	 */
+	uint32_t sequence_number;
+
+	/* The hive bins size after the log entries were applied
+	 */
+	uint32_t hive_bins_size;
+
+	/* The number of log entries applied
+	 */
+	int number_of_applied_entries;
+};
+
+int libregf_transaction_log_initialize(
+     libregf_transaction_log_t **transaction_log,
+     uint32_t sequence_number,
+     uint32_t hive_bins_size,
+     libcerror_error_t **error );
+
+int libregf_transaction_log_free(
+     libregf_transaction_log_t **transaction_log,
+     libcerror_error_t **error );
+
+int libregf_transaction_log_read_entry_data(
+     libregf_transaction_log_t *transaction_log,
+     libregf_dirty_pages_t *dirty_pages,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libregf_transaction_log_read_entries_file_io_handle(
+     libregf_transaction_log_t *transaction_log,
+     libregf_dirty_pages_t *dirty_pages,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libcerror_error_t **error );
+
+int libregf_transaction_log_read_dirty_vector_file_io_handle(
+     libregf_transaction_log_t *transaction_log,
+     libregf_dirty_pages_t *dirty_pages,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     libcerror_error_t **error );
+
+int libregf_transaction_log_read_file_io_handle(
+     libregf_transaction_log_t *transaction_log,
+     libregf_dirty_pages_t *dirty_pages,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBREGF_TRANSACTION_LOG_H ) */
+
@@ -57,6 +57,10 @@ struct libregf_internal_value
 	 */
 	libregf_value_item_t *value_item;
 
+	/* The current value data offset
+	 */
+	off64_t current_offset;
+
 #if defined( HAVE_LIBREGF_MULTI_THREAD_SUPPORT )
 	/* The read/write lock
 	 */
@@ -146,6 +150,49 @@ int libregf_value_get_value_data(
      size_t value_data_size,
      libcerror_error_t **error );
 
+LIBREGF_EXTERN \
+int libregf_value_get_value_data_pointer(
+     libregf_value_t *value,
+     const uint8_t **value_data,
+     size_t *value_data_size,
+     libcerror_error_t **error );
+
+LIBREGF_EXTERN \
+int libregf_value_get_number_of_value_data_segments(
+     libregf_value_t *value,
+     int *number_of_segments,
+     libcerror_error_t **error );
+
+LIBREGF_EXTERN \
+int libregf_value_get_value_data_segment_by_index(
+     libregf_value_t *value,
+     int segment_index,
+     const uint8_t **segment_data,
+     size_t *segment_data_size,
+     libcerror_error_t **error );
+
+LIBREGF_EXTERN \
+ssize_t libregf_value_read_buffer(
+         libregf_value_t *value,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+LIBREGF_EXTERN \
+ssize_t libregf_value_read_buffer_at_offset(
+         libregf_value_t *value,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error );
+
+LIBREGF_EXTERN \
+off64_t libregf_value_seek_offset(
+         libregf_value_t *value,
+         off64_t offset,
+         int whence,
+         libcerror_error_t **error );
+
 LIBREGF_EXTERN \
 int libregf_value_get_value_32bit(
      libregf_value_t *value,
@@ -175,6 +175,11 @@ int libregf_value_item_free(
 				result = -1;
 			}
 		}
+		if( ( *value_item )->segment_buffer != NULL )
+		{
+			memory_free(
+			 ( *value_item )->segment_buffer );
+		}
 		memory_free(
 		 *value_item );
 
@@ -431,6 +436,23 @@ int libregf_value_item_read_value_key(
 #endif
 		value_item->item_flags |= LIBREGF_ITEM_FLAG_IS_CORRUPTED;
 
+		if( libregf_hive_bins_list_release_cell_at_offset(
+		     hive_bins_list,
+		     file_io_handle,
+		     value_key_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release hive bin cell at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+			 function,
+			 value_key_offset,
+			 value_key_offset );
+
+			return( -1 );
+		}
 		return( 1 );
 	}
 	if( libregf_value_key_initialize(
@@ -468,7 +490,28 @@ int libregf_value_item_read_value_key(
 
 		goto on_error;
 	}
-	else if( result == 0 )
+	if( libregf_hive_bins_list_release_cell_at_offset(
+	     hive_bins_list,
+	     file_io_handle,
+	     value_key_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release hive bin cell at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 function,
+		 value_key_offset,
+		 value_key_offset );
+
+		hive_bin_cell = NULL;
+
+		goto on_error;
+	}
+	hive_bin_cell = NULL;
+
+	if( result == 0 )
 	{
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
@@ -528,6 +571,7 @@ int libregf_value_item_read_value_key(
 	{
 		result = libregf_hive_bins_list_get_index_at_offset(
 		          hive_bins_list,
+		          file_io_handle,
 		          (off64_t) value_item->value_key->data_offset,
 		          &hive_bin_index,
 		          error );
@@ -575,6 +619,14 @@ int libregf_value_item_read_value_key(
 	return( 1 );
 
 on_error:
+	if( hive_bin_cell != NULL )
+	{
+		libregf_hive_bins_list_release_cell_at_offset(
+		 hive_bins_list,
+		 file_io_handle,
+		 value_key_offset,
+		 NULL );
+	}
 	if( value_item->data_buffer != NULL )
 	{
 		memory_free(
@@ -716,6 +768,7 @@ int libregf_value_item_read_value_data(
 		}
 		result = libregf_hive_bins_list_get_index_at_offset(
 		          hive_bins_list,
+		          file_io_handle,
 		          (off64_t) data_block_key->data_block_list_offset,
 		          &hive_bin_index,
 		          error );
@@ -946,9 +999,38 @@ int libregf_value_item_read_value_data(
 		}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 	}
+	if( libregf_hive_bins_list_release_cell_at_offset(
+	     hive_bins_list,
+	     file_io_handle,
+	     value_data_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release hive bin cell at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 function,
+		 value_data_offset,
+		 value_data_offset );
+
+		hive_bin_cell = NULL;
+
+		goto on_error;
+	}
+	hive_bin_cell = NULL;
+
 	return( 1 );
 
 on_error:
+	if( hive_bin_cell != NULL )
+	{
+		libregf_hive_bins_list_release_cell_at_offset(
+		 hive_bins_list,
+		 file_io_handle,
+		 value_data_offset,
+		 NULL );
+	}
 	if( value_item->data_buffer != NULL )
 	{
 		memory_free(
@@ -1108,6 +1190,27 @@ int libregf_value_item_read_data_block_list(
 
 		goto on_error;
 	}
+	if( libregf_hive_bins_list_release_cell_at_offset(
+	     hive_bins_list,
+	     file_io_handle,
+	     data_block_list_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release hive bin cell at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+		 function,
+		 data_block_list_offset,
+		 data_block_list_offset );
+
+		hive_bin_cell = NULL;
+
+		goto on_error;
+	}
+	hive_bin_cell = NULL;
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -1221,6 +1324,27 @@ int libregf_value_item_read_data_block_list(
 			segment_offset = (uint32_t) ( hive_bins_list->io_handle->hive_bins_list_offset + 4 + element_offset );
 			segment_size   = hive_bin_cell->size - 4;
 
+			if( libregf_hive_bins_list_release_cell_at_offset(
+			     hive_bins_list,
+			     file_io_handle,
+			     element_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release hive bin cell at offset: %" PRIu32 " (0x%08" PRIx32 ").",
+				 function,
+				 element_offset,
+				 element_offset );
+
+				hive_bin_cell = NULL;
+
+				goto on_error;
+			}
+			hive_bin_cell = NULL;
+
 			if( segment_size > 16344 )
 			{
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -1301,6 +1425,14 @@ int libregf_value_item_read_data_block_list(
 	return( 1 );
 
 on_error:
+	if( hive_bin_cell != NULL )
+	{
+		libregf_hive_bins_list_release_cell_at_offset(
+		 hive_bins_list,
+		 file_io_handle,
+		 data_block_list_offset,
+		 NULL );
+	}
 	if( value_item->data_stream != NULL )
 	{
 		libfdata_stream_free(
@@ -2081,6 +2213,499 @@ on_error:
 	return( -1 );
 }
 
+/* Reads data at a specific offset
+ * Large value data is read from the data stream without caching the whole data
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libregf_value_item_read_data_at_offset(
+         libregf_value_item_t *value_item,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t data_offset,
+         libcerror_error_t **error )
+{
+	static char *function    = "libregf_value_item_read_data_at_offset";
+	size64_t value_data_size = 0;
+	ssize_t read_count       = 0;
+
+	if( value_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value item.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_item->data_type != 0 )
+	 && ( value_item->data_type != LIBREGF_VALUE_ITEM_DATA_TYPE_BUFFER )
+	 && ( value_item->data_type != LIBREGF_VALUE_ITEM_DATA_TYPE_BLOCK ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value item data type: 0x%02" PRIx8 ".",
+		 function,
+		 value_item->data_type );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_item->data_type == LIBREGF_VALUE_ITEM_DATA_TYPE_BLOCK )
+	 && ( value_item->data_buffer == NULL ) )
+	{
+		if( libfdata_stream_get_size(
+		     value_item->data_stream,
+		     &value_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve size from data stream.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( value_item->data_type != 0 )
+	{
+		value_data_size = (size64_t) value_item->data_buffer_size;
+	}
+	if( ( buffer_size == 0 )
+	 || ( (size64_t) data_offset >= value_data_size ) )
+	{
+		return( 0 );
+	}
+	if( (size64_t) buffer_size > ( value_data_size - (size64_t) data_offset ) )
+	{
+		buffer_size = (size_t) ( value_data_size - (size64_t) data_offset );
+	}
+	if( ( value_item->data_type == LIBREGF_VALUE_ITEM_DATA_TYPE_BLOCK )
+	 && ( value_item->data_buffer == NULL ) )
+	{
+		read_count = libfdata_stream_read_buffer_at_offset(
+		              value_item->data_stream,
+		              (intptr_t *) file_io_handle,
+		              buffer,
+		              buffer_size,
+		              data_offset,
+		              0,
+		              error );
+
+		if( read_count != (ssize_t) buffer_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read data from data stream at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 data_offset,
+			 data_offset );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( memory_copy(
+		     buffer,
+		     &( value_item->data_buffer[ data_offset ] ),
+		     buffer_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data.",
+			 function );
+
+			return( -1 );
+		}
+		read_count = (ssize_t) buffer_size;
+	}
+	return( read_count );
+}
+
+/* Retrieves a pointer to the data
+ * The data is owned by the value item and remains valid until the value item is freed
+ * Returns 1 if successful, 0 if the data is stored in multiple segments or -1 on error
+ */
+int libregf_value_item_get_data_pointer(
+     libregf_value_item_t *value_item,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_value_item_get_data_pointer";
+
+	if( value_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value item.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_item->data_type != 0 )
+	 && ( value_item->data_type != LIBREGF_VALUE_ITEM_DATA_TYPE_BUFFER )
+	 && ( value_item->data_type != LIBREGF_VALUE_ITEM_DATA_TYPE_BLOCK ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value item data type: 0x%02" PRIx8 ".",
+		 function,
+		 value_item->data_type );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_item->data_type == LIBREGF_VALUE_ITEM_DATA_TYPE_BLOCK )
+	 && ( value_item->data_buffer == NULL ) )
+	{
+		return( 0 );
+	}
+	if( value_item->data_type != 0 )
+	{
+		*data      = value_item->data_buffer;
+		*data_size = value_item->data_buffer_size;
+	}
+	else
+	{
+		*data      = NULL;
+		*data_size = 0;
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of data segments
+ * Data stored in a single hive bin cell consists of 1 segment
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_value_item_get_number_of_data_segments(
+     libregf_value_item_t *value_item,
+     int *number_of_segments,
+     libcerror_error_t **error )
+{
+	static char *function = "libregf_value_item_get_number_of_data_segments";
+
+	if( value_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value item.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_item->data_type != 0 )
+	 && ( value_item->data_type != LIBREGF_VALUE_ITEM_DATA_TYPE_BUFFER )
+	 && ( value_item->data_type != LIBREGF_VALUE_ITEM_DATA_TYPE_BLOCK ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value item data type: 0x%02" PRIx8 ".",
+		 function,
+		 value_item->data_type );
+
+		return( -1 );
+	}
+	if( number_of_segments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of segments.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_item->data_type == LIBREGF_VALUE_ITEM_DATA_TYPE_BLOCK )
+	{
+		if( libfdata_stream_get_number_of_segments(
+		     value_item->data_stream,
+		     number_of_segments,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of segments from data stream.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( value_item->data_buffer_size > 0 )
+	{
+		*number_of_segments = 1;
+	}
+	else
+	{
+		*number_of_segments = 0;
+	}
+	return( 1 );
+}
+
+/* Retrieves a pointer to a specific data segment
+ * If the file is memory mapped the segment data references the mapped data,
+ * otherwise the segment is read into a buffer owned by the value item that
+ * is reused by the next call
+ * Returns 1 if successful or -1 on error
+ */
+int libregf_value_item_get_data_segment_by_index(
+     libregf_value_item_t *value_item,
+     libregf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     int segment_index,
+     const uint8_t **segment_data,
+     size_t *segment_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *segment_buffer = NULL;
+	static char *function   = "libregf_value_item_get_data_segment_by_index";
+	size64_t segment_size   = 0;
+	ssize_t read_count      = 0;
+	off64_t segment_offset  = 0;
+	uint32_t segment_flags  = 0;
+	int number_of_segments  = 0;
+	int segment_file_index  = 0;
+
+	if( value_item == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value item.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment data.",
+		 function );
+
+		return( -1 );
+	}
+	if( segment_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid segment data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libregf_value_item_get_number_of_data_segments(
+	     value_item,
+	     &number_of_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of data segments.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( segment_index < 0 )
+	 || ( segment_index >= number_of_segments ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid segment index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_item->data_type != LIBREGF_VALUE_ITEM_DATA_TYPE_BLOCK )
+	{
+		*segment_data      = value_item->data_buffer;
+		*segment_data_size = value_item->data_buffer_size;
+
+		return( 1 );
+	}
+	if( libfdata_stream_get_segment_by_index(
+	     value_item->data_stream,
+	     segment_index,
+	     &segment_file_index,
+	     &segment_offset,
+	     &segment_size,
+	     &segment_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data stream segment: %d.",
+		 function,
+		 segment_index );
+
+		return( -1 );
+	}
+	if( ( segment_offset < 0 )
+	 || ( segment_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data stream segment: %d value out of bounds.",
+		 function,
+		 segment_index );
+
+		return( -1 );
+	}
+	if( ( io_handle->mapped_data != NULL )
+	 && ( (size64_t) segment_offset <= io_handle->mapped_data_size )
+	 && ( segment_size <= ( io_handle->mapped_data_size - (size64_t) segment_offset ) ) )
+	{
+		*segment_data      = &( ( io_handle->mapped_data )[ segment_offset ] );
+		*segment_data_size = (size_t) segment_size;
+
+		return( 1 );
+	}
+	if( segment_size > value_item->segment_buffer_size )
+	{
+		segment_buffer = (uint8_t *) memory_reallocate(
+		                              value_item->segment_buffer,
+		                              sizeof( uint8_t ) * (size_t) segment_size );
+
+		if( segment_buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize segment buffer.",
+			 function );
+
+			return( -1 );
+		}
+		value_item->segment_buffer      = segment_buffer;
+		value_item->segment_buffer_size = (size_t) segment_size;
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              value_item->segment_buffer,
+	              (size_t) segment_size,
+	              segment_offset,
+	              error );
+
+	if( read_count != (ssize_t) segment_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data stream segment: %d at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 segment_index,
+		 segment_offset,
+		 segment_offset );
+
+		return( -1 );
+	}
+	*segment_data      = value_item->segment_buffer;
+	*segment_data_size = (size_t) segment_size;
+
+	return( 1 );
+}
+
 /* Retrieves the 32-bit value
  * Returns 1 if successful or -1 on error
  */
@@ -62,6 +62,14 @@ struct libregf_value_item
 	 */
 	libfdata_stream_t *data_stream;
 
+	/* The large value data segment buffer
+	 */
+	uint8_t *segment_buffer;
+
+	/* The large value data segment buffer size
+	 */
+	size_t segment_buffer_size;
+
 	/* Various item flags
 	 */
 	uint8_t item_flags;
@@ -190,6 +198,34 @@ int libregf_value_item_get_data(
      size_t *data_size,
      libcerror_error_t **error );
 
+ssize_t libregf_value_item_read_data_at_offset(
+         libregf_value_item_t *value_item,
+         libbfio_handle_t *file_io_handle,
+         uint8_t *buffer,
+         size_t buffer_size,
+         off64_t data_offset,
+         libcerror_error_t **error );
+
+int libregf_value_item_get_data_pointer(
+     libregf_value_item_t *value_item,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int libregf_value_item_get_number_of_data_segments(
+     libregf_value_item_t *value_item,
+     int *number_of_segments,
+     libcerror_error_t **error );
+
+int libregf_value_item_get_data_segment_by_index(
+     libregf_value_item_t *value_item,
+     libregf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     int segment_index,
+     const uint8_t **segment_data,
+     size_t *segment_data_size,
+     libcerror_error_t **error );
+
 int libregf_value_item_get_value_32bit(
      libregf_value_item_t *value_item,
      libbfio_handle_t *file_io_handle,
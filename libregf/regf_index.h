@@ -0,0 +1,148 @@
+/*
+ * The index file definition of a Windows NT Registry File (REGF)
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _REGF_INDEX_H )
+#define _REGF_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct regf_index_file_header regf_index_file_header_t;
+
+struct regf_index_file_header
+{
+	/* The signature
+	 * Consists of 8 bytes
+	 * Contains: "regfidx\x00"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The primary sequence number of the REGF file header
+	 * Consists of 4 bytes
+	 */
+	uint8_t primary_sequence_number[ 4 ];
+
+	/* The secondary sequence number of the REGF file header
+	 * Consists of 4 bytes
+	 */
+	uint8_t secondary_sequence_number[ 4 ];
+
+	/* The checksum of the REGF file header
+	 * Consists of 4 bytes
+	 */
+	uint8_t file_header_checksum[ 4 ];
+
+	/* The hive bins size of the REGF file header
+	 * Consists of 4 bytes
+	 */
+	uint8_t hive_bins_size[ 4 ];
+
+	/* The root key offset of the REGF file header
+	 * Consists of 4 bytes
+	 */
+	uint8_t root_key_offset[ 4 ];
+
+	/* The codepage used to convert the key names to UTF-8
+	 * Consists of 4 bytes
+	 */
+	uint8_t ascii_codepage[ 4 ];
+
+	/* The flags
+	 * Consists of 4 bytes
+	 */
+	uint8_t flags[ 4 ];
+
+	/* The number of hive bins
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_hive_bins[ 4 ];
+
+	/* The number of keys
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_keys[ 4 ];
+
+	/* The paths data size
+	 * Consists of 4 bytes
+	 */
+	uint8_t paths_data_size[ 4 ];
+
+	/* The XOR-32 checksum of the data after the file header
+	 * Consists of 4 bytes
+	 */
+	uint8_t checksum[ 4 ];
+};
+
+typedef struct regf_index_hive_bin_entry regf_index_hive_bin_entry_t;
+
+struct regf_index_hive_bin_entry
+{
+	/* The file offset of the hive bin
+	 * Consists of 4 bytes
+	 */
+	uint8_t file_offset[ 4 ];
+
+	/* The size of the hive bin
+	 * Consists of 4 bytes
+	 */
+	uint8_t size[ 4 ];
+};
+
+typedef struct regf_index_key_entry regf_index_key_entry_t;
+
+struct regf_index_key_entry
+{
+	/* The hash of the upper case path
+	 * Consists of 4 bytes
+	 */
+	uint8_t path_hash[ 4 ];
+
+	/* The offset of the named key
+	 * Consists of 4 bytes
+	 */
+	uint8_t key_offset[ 4 ];
+
+	/* The offset of the UTF-8 encoded path relative to the start of the paths data
+	 * Consists of 4 bytes
+	 */
+	uint8_t path_offset[ 4 ];
+
+	/* The size of the UTF-8 encoded path, without end of string character
+	 * Consists of 4 bytes
+	 */
+	uint8_t path_size[ 4 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _REGF_INDEX_H ) */
+
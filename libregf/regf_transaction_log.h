@@ -0,0 +1,98 @@
+/*
+ * The transaction log definition of a Windows NT Registry File (REGF)
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _REGF_TRANSACTION_LOG_H )
+#define _REGF_TRANSACTION_LOG_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct regf_log_entry_header regf_log_entry_header_t;
+
+struct regf_log_entry_header
+{
+	/* The signature
+	 * Consists of 4 bytes
+	 * Contains: "HvLE"
+	 */
+	uint8_t signature[ 4 ];
+
+	/* The size of the log entry
+	 * Consists of 4 bytes
+	 */
+	uint8_t size[ 4 ];
+
+	/* The flags
+	 * Consists of 4 bytes
+	 */
+	uint8_t flags[ 4 ];
+
+	/* The sequence number
+	 * Consists of 4 bytes
+	 */
+	uint8_t sequence_number[ 4 ];
+
+	/* The hive bins size
+	 * Consists of 4 bytes
+	 */
+	uint8_t hive_bins_size[ 4 ];
+
+	/* The number of dirty pages
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_dirty_pages[ 4 ];
+
+	/* The Marvin32 hash of the data after the log entry header
+	 * Consists of 8 bytes
+	 */
+	uint8_t data_hash[ 8 ];
+
+	/* The Marvin32 hash of the first 32 bytes of the log entry header
+	 * Consists of 8 bytes
+	 */
+	uint8_t header_hash[ 8 ];
+};
+
+typedef struct regf_dirty_page_reference regf_dirty_page_reference_t;
+
+struct regf_dirty_page_reference
+{
+	/* The offset of the dirty page relative to the start of the hive bins
+	 * Consists of 4 bytes
+	 */
+	uint8_t offset[ 4 ];
+
+	/* The size of the dirty page
+	 * Consists of 4 bytes
+	 */
+	uint8_t size[ 4 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _REGF_TRANSACTION_LOG_H ) */
+
@@ -4,9 +4,9 @@ dnl Version: 20200712
 
 dnl Function to detect if tests dependencies are available
 AC_DEFUN([AX_TESTS_CHECK_LOCAL],
-  [AC_CHECK_HEADERS([dlfcn.h])
+  [AC_CHECK_HEADERS([dlfcn.h sys/resource.h])
 
-  AC_CHECK_FUNCS([fmemopen getopt mkstemp setenv tzset unlink])
+  AC_CHECK_FUNCS([clock_gettime fmemopen getopt getrusage mkstemp setenv tzset unlink])
 
   AC_CHECK_LIB(
     dl,
@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
@@ -30,8 +31,12 @@
 #include "log_handle.h"
 #include "regftools_libcerror.h"
 #include "regftools_libclocale.h"
+#include "regftools_libcthreads.h"
 #include "regftools_libfdatetime.h"
 #include "regftools_libregf.h"
+#include "regftools_libuna.h"
+#include "regftools_output.h"
+#include "regftools_unused.h"
 
 #define EXPORT_HANDLE_NOTIFY_STREAM	stdout
 
@@ -108,14 +113,36 @@ int export_handle_initialize(
 
 		goto on_error;
 	}
-	( *export_handle )->ascii_codepage = LIBREGF_CODEPAGE_WINDOWS_1252;
-	( *export_handle )->notify_stream  = EXPORT_HANDLE_NOTIFY_STREAM;
+	if( regftools_output_buffer_initialize(
+	     &( ( *export_handle )->output_buffer ),
+	     EXPORT_HANDLE_NOTIFY_STREAM,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize output buffer.",
+		 function );
+
+		goto on_error;
+	}
+	( *export_handle )->ascii_codepage    = LIBREGF_CODEPAGE_WINDOWS_1252;
+	( *export_handle )->export_format     = EXPORT_FORMAT_TEXT;
+	( *export_handle )->notify_stream     = EXPORT_HANDLE_NOTIFY_STREAM;
+	( *export_handle )->number_of_threads = 1;
 
 	return( 1 );
 
 on_error:
 	if( *export_handle != NULL )
 	{
+		if( ( *export_handle )->input_file != NULL )
+		{
+			libregf_file_free(
+			 &( ( *export_handle )->input_file ),
+			 NULL );
+		}
 		memory_free(
 		 *export_handle );
 
@@ -160,6 +187,19 @@ int export_handle_free(
 
 			result = -1;
 		}
+		if( regftools_output_buffer_free(
+		     &( ( *export_handle )->output_buffer ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free output buffer.",
+			 function );
+
+			result = -1;
+		}
 		memory_free(
 		 *export_handle );
 
@@ -268,21 +308,17 @@ int export_handle_set_ascii_codepage(
 	return( result );
 }
 
-/* Prints the data on the stream
- * Returns the number of printed characters if successful or -1 on error
+/* Sets the export format
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
  */
-int export_handle_print_data(
+int export_handle_set_export_format(
      export_handle_t *export_handle,
-     FILE *stream,
-     const uint8_t *data,
-     size_t data_size,
+     const system_character_t *string,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_print_data";
-	size_t byte_iterator  = 0;
-	size_t data_iterator  = 0;
-	int print_count       = 0;
-	int total_print_count = 0;
+	static char *function = "export_handle_set_export_format";
+	size_t string_length  = 0;
+	int result            = 0;
 
 	if( export_handle == NULL )
 	{
@@ -295,431 +331,280 @@ int export_handle_print_data(
 
 		return( -1 );
 	}
-	if( stream == NULL )
+	if( string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid stream.",
+		 "%s: invalid string.",
 		 function );
 
 		return( -1 );
 	}
-	if( data == NULL )
-	{
-		return( 0 );
-	}
-	while( data_iterator < data_size )
-	{
-		while( byte_iterator < data_size )
-		{
-			if( byte_iterator % 16 == 0 )
-			{
-				print_count = fprintf(
-					       stream,
-					       "%.8" PRIzx ": ",
-					       byte_iterator );
-
-				if( print_count <= -1 )
-				{
-					return( -1 );
-				}
-				total_print_count += print_count;
-			}
-			print_count = fprintf(
-				       stream,
-				       "%.2" PRIx8 " ",
-				       data[ byte_iterator++ ] );
-
-			if( print_count <= -1 )
-			{
-				return( -1 );
-			}
-			total_print_count += print_count;
-
-			if( byte_iterator % 16 == 0 )
-			{
-				break;
-			}
-			else if( byte_iterator % 8 == 0 )
-			{
-				print_count = fprintf(
-					       stream,
-					       " " );
-
-				if( print_count <= -1 )
-				{
-					return( -1 );
-				}
-				total_print_count += print_count;
-			}
-		}
-		while( byte_iterator % 16 != 0 )
-		{
-			byte_iterator++;
-
-			print_count = fprintf(
-				       stream,
-				       "   " );
-
-			if( print_count <= -1 )
-			{
-				return( -1 );
-			}
-			total_print_count += print_count;
-
-			if( ( byte_iterator % 8 == 0 )
-			 && ( byte_iterator % 16 != 0 ) )
-			{
-				print_count = fprintf(
-					       stream,
-					       " " );
-
-				if( print_count <= -1 )
-				{
-					return( -1 );
-				}
-				total_print_count += print_count;
-			}
-		}
-		print_count = fprintf(
-			       stream,
-			       "  " );
-
-		if( print_count <= -1 )
-		{
-			return( -1 );
-		}
-		total_print_count += print_count;
-
-		byte_iterator = data_iterator;
+	string_length = system_string_length(
+	                 string );
 
-		while( byte_iterator < data_size )
+	if( string_length == 4 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "text" ),
+		     4 ) == 0 )
 		{
-			if( ( data[ byte_iterator ] >= 0x20 )
-			 && ( data[ byte_iterator ] <= 0x7e ) )
-			{
-				print_count = fprintf(
-					       stream,
-					       "%c",
-					       (char) data[ byte_iterator ] );
-			}
-			else
-			{
-				print_count = fprintf(
-					       stream,
-					       "." );
-			}
-			if( print_count <= -1 )
-			{
-				return( -1 );
-			}
-			total_print_count += print_count;
-
-			byte_iterator++;
-
-			if( byte_iterator % 16 == 0 )
-			{
-				break;
-			}
-			else if( byte_iterator % 8 == 0 )
-			{
-				print_count = fprintf(
-					       stream,
-					       " " );
-
-				if( print_count <= -1 )
-				{
-					return( -1 );
-				}
-				total_print_count += print_count;
-			}
+			export_handle->export_format = EXPORT_FORMAT_TEXT;
+			result                       = 1;
 		}
-		print_count = fprintf(
-			       stream,
-			       "\n" );
-
-		if( print_count <= -1 )
+	}
+	else if( string_length == 5 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "jsonl" ),
+		     5 ) == 0 )
 		{
-			return( -1 );
+			export_handle->export_format = EXPORT_FORMAT_JSON_LINES;
+			result                       = 1;
 		}
-		total_print_count += print_count;
-
-		data_iterator = byte_iterator;
 	}
-	print_count = fprintf(
-		       stream,
-		       "\n" );
-
-	if( print_count <= -1 )
+	else if( string_length == 6 )
 	{
-		return( -1 );
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "binary" ),
+		     6 ) == 0 )
+		{
+			export_handle->export_format = EXPORT_FORMAT_BINARY;
+			result                       = 1;
+		}
 	}
-	total_print_count += print_count;
-
-	return( total_print_count );
+	return( result );
 }
 
-/* Opens the input
+/* Creates a job
+ * Make sure the value job is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
  */
-int export_handle_open_input(
-     export_handle_t *export_handle,
-     const system_character_t *filename,
+int export_handle_job_initialize(
+     export_handle_job_t **job,
+     const system_character_t *key_path,
+     size_t key_path_length,
+     off64_t key_offset,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_open_input";
+	static char *function = "export_handle_job_initialize";
 
-	if( export_handle == NULL )
+	if( job == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid export handle.",
+		 "%s: invalid job.",
 		 function );
 
 		return( -1 );
 	}
-	if( libregf_file_set_ascii_codepage(
-	     export_handle->input_file,
-	     export_handle->ascii_codepage,
-	     error ) != 1 )
+	if( *job != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set ASCII codepage in input file.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid job value already set.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libregf_file_open_wide(
-	     export_handle->input_file,
-	     filename,
-	     LIBREGF_OPEN_READ,
-	     error ) != 1 )
-#else
-	if( libregf_file_open(
-	     export_handle->input_file,
-	     filename,
-	     LIBREGF_OPEN_READ,
-	     error ) != 1 )
-#endif
+	if( key_path_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) - 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open input file.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid key path length value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
-
-/* Closes the input
- * Returns the 0 if succesful or -1 on error
- */
-int export_handle_close_input(
-     export_handle_t *export_handle,
-     libcerror_error_t **error )
-{
-	static char *function = "export_handle_close_input";
+	*job = memory_allocate_structure(
+	        export_handle_job_t );
 
-	if( export_handle == NULL )
+	if( *job == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid export handle.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create job.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libregf_file_close(
-	     export_handle->input_file,
-	     error ) != 0 )
+	if( memory_set(
+	     *job,
+	     0,
+	     sizeof( export_handle_job_t ) ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-		 "%s: unable to close input file.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear job.",
 		 function );
 
+		memory_free(
+		 *job );
+
+		*job = NULL;
+
 		return( -1 );
 	}
-	return( 0 );
-}
+	if( key_path != NULL )
+	{
+		( *job )->key_path = system_string_allocate(
+		                      key_path_length + 1 );
 
-/* Prints a FILETIME value
- * Returns 1 if successful or -1 on error
- */
-int export_handle_export_filetime(
-     export_handle_t *export_handle,
-     const char *value_name,
-     uint64_t value_64bit,
-     libcerror_error_t **error )
-{
-	system_character_t date_time_string[ 48 ];
+		if( ( *job )->key_path == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create key path.",
+			 function );
 
-	libfdatetime_filetime_t *filetime = NULL;
-	static char *function             = "export_handle_export_filetime";
-	int result                        = 0;
+			goto on_error;
+		}
+		if( key_path_length > 0 )
+		{
+			if( system_string_copy(
+			     ( *job )->key_path,
+			     key_path,
+			     key_path_length ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy key path.",
+				 function );
 
-	if( export_handle == NULL )
+				goto on_error;
+			}
+		}
+		( *job )->key_path[ key_path_length ] = 0;
+
+		( *job )->key_path_length = key_path_length;
+	}
+	if( regftools_output_buffer_initialize(
+	     &( ( *job )->output_buffer ),
+	     NULL,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid export handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize output buffer.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( value_name == NULL )
+	( *job )->key_offset = key_offset;
+
+	if( key_offset == 0 )
+	{
+		( *job )->status = EXPORT_HANDLE_JOB_STATUS_COMPLETED;
+	}
+	else
+	{
+		( *job )->status = EXPORT_HANDLE_JOB_STATUS_QUEUED;
+	}
+	return( 1 );
+
+on_error:
+	if( *job != NULL )
+	{
+		if( ( *job )->key_path != NULL )
+		{
+			memory_free(
+			 ( *job )->key_path );
+		}
+		memory_free(
+		 *job );
+
+		*job = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a job
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_job_free(
+     export_handle_job_t **job,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_job_free";
+	int result            = 1;
+
+	if( job == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid value name.",
+		 "%s: invalid job.",
 		 function );
 
 		return( -1 );
 	}
-	if( value_64bit == 0 )
-	{
-		fprintf(
-		 export_handle->notify_stream,
-		 "%s: Not set (0)\n",
-		 value_name );
-	}
-	else
+	if( *job != NULL )
 	{
-		if( libfdatetime_filetime_initialize(
-		     &filetime,
+		if( ( *job )->key_path != NULL )
+		{
+			memory_free(
+			 ( *job )->key_path );
+		}
+		if( regftools_output_buffer_free(
+		     &( ( *job )->output_buffer ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create FILETIME.",
-			 function );
-
-			goto on_error;
-		}
-		if( libfdatetime_filetime_copy_from_64bit(
-		     filetime,
-		     value_64bit,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy 64-bit value to FILETIME.",
-			 function );
-
-			goto on_error;
-		}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libfdatetime_filetime_copy_to_utf16_string(
-			  filetime,
-			  (uint16_t *) date_time_string,
-			  48,
-			  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
-			  error );
-#else
-		result = libfdatetime_filetime_copy_to_utf8_string(
-			  filetime,
-			  (uint8_t *) date_time_string,
-			  48,
-			  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
-			  error );
-#endif
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy FILETIME to string.",
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free output buffer.",
 			 function );
 
-			goto on_error;
+			result = -1;
 		}
-		fprintf(
-		 export_handle->notify_stream,
-		 "%s: %" PRIs_SYSTEM " UTC\n",
-		 value_name,
-		 date_time_string );
-
-		if( libfdatetime_filetime_free(
-		     &filetime,
-		     error ) != 1 )
+		if( ( *job )->error != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free FILETIME.",
-			 function );
-
-			goto on_error;
+			libcerror_error_free(
+			 &( ( *job )->error ) );
 		}
-	}
-	return( 1 );
+		memory_free(
+		 *job );
 
-on_error:
-	if( filetime != NULL )
-	{
-		libfdatetime_filetime_free(
-		 &filetime,
-		 NULL );
+		*job = NULL;
 	}
-	return( -1 );
+	return( result );
 }
 
-/* Exports a key
- * Returns the 1 if succesful or -1 on error
+/* Sets the number of threads
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
  */
-int export_handle_export_key(
+int export_handle_set_number_of_threads(
      export_handle_t *export_handle,
-     const system_character_t *key_path,
-     size_t key_path_length,
-     libregf_key_t *key,
-     log_handle_t *log_handle,
+     const system_character_t *string,
      libcerror_error_t **error )
 {
-	libregf_key_t *sub_key           = NULL;
-	libregf_value_t *value           = NULL;
-	system_character_t *sub_key_path = NULL;
-	system_character_t *value_string = NULL;
-	uint8_t *data                    = NULL;
-	static char *function            = "export_handle_export_key";
-	size_t data_size                 = 0;
-	size_t expected_data_size        = 0;
-	size_t sub_key_path_length       = 0;
-	size_t value_string_size         = 0;
-	ssize_t print_count              = 0;
-	uint64_t value_64bit             = 0;
-	uint32_t value_32bit             = 0;
-	uint32_t value_type              = 0;
-	int is_corrupted                 = 0;
-	int number_of_sub_keys           = 0;
-	int number_of_values             = 0;
-	int result                       = 0;
-	int sub_key_index                = 0;
-	int value_index                  = 0;
+	static char *function    = "export_handle_set_number_of_threads";
+	size_t string_index      = 0;
+	size_t string_length     = 0;
+	int number_of_threads    = 0;
 
 	if( export_handle == NULL )
 	{
@@ -732,414 +617,815 @@ int export_handle_export_key(
 
 		return( -1 );
 	}
-	if( key_path == NULL )
+	if( string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid key path.",
+		 "%s: invalid string.",
 		 function );
 
 		return( -1 );
 	}
-	if( key_path_length > ( (size_t) SSIZE_MAX - 1 ) )
+	string_length = system_string_length(
+	                 string );
+
+	if( string_length == 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid key path length value exceeds maximum.",
-		 function );
+		return( 0 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			return( 0 );
+		}
+		number_of_threads *= 10;
+		number_of_threads += (int) ( string[ string_index ] - (system_character_t) '0' );
 
-		return( -1 );
+		if( number_of_threads > EXPORT_HANDLE_MAXIMUM_NUMBER_OF_THREADS )
+		{
+			return( 0 );
+		}
+	}
+	if( number_of_threads == 0 )
+	{
+		number_of_threads = 1;
+	}
+#if !defined( HAVE_REGFTOOLS_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 1 )
+	{
+		return( 0 );
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libregf_key_get_utf16_name_size(
-	          key,
-	          &value_string_size,
-	          error );
-#else
-	result = libregf_key_get_utf8_name_size(
-	          key,
-	          &value_string_size,
-	          error );
 #endif
-	if( result != 1 )
+	export_handle->number_of_threads = number_of_threads;
+
+	return( 1 );
+}
+
+/* Prints the data on the stream
+ * Every line of the hexdump is formatted in a local buffer and appended at once
+ * Returns the number of printed characters if successful or -1 on error
+ */
+int export_handle_print_data(
+     export_handle_t *export_handle,
+     regftools_output_buffer_t *output_buffer,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t line_data[ 96 ];
+
+	const char *hexadecimal_digits = "0123456789abcdef";
+	static char *function          = "export_handle_print_data";
+	size_t byte_index              = 0;
+	size_t data_offset             = 0;
+	size_t line_data_size          = 0;
+	size_t line_size               = 0;
+	uint64_t value_64bit           = 0;
+	uint8_t digit_index            = 0;
+	uint8_t number_of_digits       = 0;
+	int total_print_count          = 0;
+
+	if( export_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve key name size.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( value_string_size > ( (size_t) SSIZE_MAX / sizeof( system_character_t ) ) )
+	if( output_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid name size value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	sub_key_path_length = key_path_length;
-
-	if( value_string_size > 0 )
+	if( data == NULL )
 	{
-		if( key_path_length > 0 )
+		return( 0 );
+	}
+	while( data_offset < data_size )
+	{
+		line_size = data_size - data_offset;
+
+		if( line_size > 16 )
+		{
+			line_size = 16;
+		}
+		line_data_size = 0;
+
+		/* The offset is printed with at least 8 digits similar to "%.8" PRIzx
+		 */
+		value_64bit      = (uint64_t) data_offset;
+		number_of_digits = 8;
+
+		while( ( number_of_digits < 16 )
+		    && ( ( value_64bit >> ( number_of_digits * 4 ) ) != 0 ) )
+		{
+			number_of_digits++;
+		}
+		for( digit_index = number_of_digits;
+		     digit_index > 0;
+		     digit_index-- )
+		{
+			line_data[ line_data_size++ ] = (uint8_t) hexadecimal_digits[ ( value_64bit >> ( ( digit_index - 1 ) * 4 ) ) & 0x0f ];
+		}
+		line_data[ line_data_size++ ] = (uint8_t) ':';
+		line_data[ line_data_size++ ] = (uint8_t) ' ';
+
+		for( byte_index = 0;
+		     byte_index < 16;
+		     byte_index++ )
+		{
+			if( byte_index < line_size )
+			{
+				line_data[ line_data_size++ ] = (uint8_t) hexadecimal_digits[ data[ data_offset + byte_index ] >> 4 ];
+				line_data[ line_data_size++ ] = (uint8_t) hexadecimal_digits[ data[ data_offset + byte_index ] & 0x0f ];
+			}
+			else
+			{
+				line_data[ line_data_size++ ] = (uint8_t) ' ';
+				line_data[ line_data_size++ ] = (uint8_t) ' ';
+			}
+			line_data[ line_data_size++ ] = (uint8_t) ' ';
+
+			if( byte_index == 7 )
+			{
+				line_data[ line_data_size++ ] = (uint8_t) ' ';
+			}
+		}
+		line_data[ line_data_size++ ] = (uint8_t) ' ';
+		line_data[ line_data_size++ ] = (uint8_t) ' ';
+
+		for( byte_index = 0;
+		     byte_index < line_size;
+		     byte_index++ )
+		{
+			if( ( data[ data_offset + byte_index ] >= 0x20 )
+			 && ( data[ data_offset + byte_index ] <= 0x7e ) )
+			{
+				line_data[ line_data_size++ ] = data[ data_offset + byte_index ];
+			}
+			else
+			{
+				line_data[ line_data_size++ ] = (uint8_t) '.';
+			}
+			if( byte_index == 7 )
+			{
+				line_data[ line_data_size++ ] = (uint8_t) ' ';
+			}
+		}
+		line_data[ line_data_size++ ] = (uint8_t) '\n';
+
+		if( regftools_output_buffer_append_data(
+		     output_buffer,
+		     line_data,
+		     line_data_size,
+		     error ) != 1 )
 		{
-			sub_key_path_length += 1;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append data line.",
+			 function );
+
+			return( -1 );
 		}
-		sub_key_path_length += value_string_size - 1;
+		total_print_count += (int) line_data_size;
+
+		data_offset += line_size;
 	}
-	if( sub_key_path_length > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) )
+	if( regftools_output_buffer_append_string(
+	     output_buffer,
+	     "\n",
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid sub key path length value exceeds maximum allocation size.",
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append end of line.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	sub_key_path = system_string_allocate(
-	                sub_key_path_length + 1 );
+	total_print_count += 1;
 
-	if( sub_key_path == NULL )
+	return( total_print_count );
+}
+
+/* Opens the input
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_open_input(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_open_input";
+
+	if( export_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create sub key path.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( sub_key_path == NULL )
+	if( libregf_file_set_ascii_codepage(
+	     export_handle->input_file,
+	     export_handle->ascii_codepage,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create sub key path.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set ASCII codepage in input file.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( system_string_copy(
-	     sub_key_path,
-	     key_path,
-	     key_path_length ) == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to copy key path to sub key path.",
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libregf_file_open_wide(
+	     export_handle->input_file,
+	     filename,
+	     LIBREGF_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libregf_file_open(
+	     export_handle->input_file,
+	     filename,
+	     LIBREGF_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input file.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( key_path_length > 0 )
+	return( 1 );
+}
+
+/* Closes the input
+ * Returns the 0 if succesful or -1 on error
+ */
+int export_handle_close_input(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_close_input";
+
+	if( export_handle == NULL )
 	{
-		sub_key_path[ key_path_length ] = '\\';
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
 
-		key_path_length += 1;
+		return( -1 );
 	}
-	if( value_string_size == 0 )
+	if( libregf_file_close(
+	     export_handle->input_file,
+	     error ) != 0 )
 	{
-		sub_key_path[ key_path_length ] = 0;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input file.",
+		 function );
+
+		return( -1 );
 	}
-	else
+	return( 0 );
+}
+
+/* Prints a FILETIME value
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_filetime(
+     export_handle_t *export_handle,
+     regftools_output_buffer_t *output_buffer,
+     const char *value_name,
+     uint64_t value_64bit,
+     libcerror_error_t **error )
+{
+	system_character_t date_time_string[ 48 ];
+
+	libfdatetime_filetime_t *filetime = NULL;
+	static char *function             = "export_handle_export_filetime";
+	int result                        = 0;
+
+	if( export_handle == NULL )
 	{
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libregf_key_get_utf16_name(
-		          key,
-		          (uint16_t *) &( sub_key_path[ key_path_length ] ),
-		          value_string_size,
-		          error );
-#else
-		result = libregf_key_get_utf8_name(
-		          key,
-		          (uint8_t *) &( sub_key_path[ key_path_length ] ),
-		          value_string_size,
-		          error );
-#endif
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve key name.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
 
-			goto on_error;
-		}
+		return( -1 );
 	}
-	fprintf(
-	 export_handle->notify_stream,
-	 "Key path: %" PRIs_SYSTEM "\n",
-	 sub_key_path );
-
-	fprintf(
-	 export_handle->notify_stream,
-	 "Name: %" PRIs_SYSTEM "\n",
-	 &( sub_key_path[ key_path_length ] ) );
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
 
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libregf_key_get_utf16_class_name_size(
-	          key,
-	          &value_string_size,
-	          error );
-#else
-	result = libregf_key_get_utf8_class_name_size(
-	          key,
-	          &value_string_size,
-	          error );
-#endif
-	if( result == -1 )
+		return( -1 );
+	}
+	if( value_name == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve the class name size.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value name.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( ( result != 0 )
-	 && ( value_string_size > 0 ) )
+	if( value_64bit == 0 )
 	{
-		if( value_string_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) )
+		regftools_output_buffer_printf(
+		 output_buffer,
+		 "%s: Not set (0)\n",
+		 value_name );
+	}
+	else
+	{
+		if( libfdatetime_filetime_initialize(
+		     &filetime,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-			 "%s: invalid name size value exceeds maximum allocation size.",
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create FILETIME.",
 			 function );
 
 			goto on_error;
 		}
-		value_string = system_string_allocate(
-		                value_string_size );
-
-		if( value_string == NULL )
+		if( libfdatetime_filetime_copy_from_64bit(
+		     filetime,
+		     value_64bit,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create name string.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy 64-bit value to FILETIME.",
 			 function );
 
 			goto on_error;
 		}
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libregf_key_get_utf16_class_name(
-		          key,
-		          (uint16_t *) value_string,
-		          value_string_size,
-		          error );
+		result = libfdatetime_filetime_copy_to_utf16_string(
+			  filetime,
+			  (uint16_t *) date_time_string,
+			  48,
+			  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
+			  error );
 #else
-		result = libregf_key_get_utf8_class_name(
-		          key,
-		          (uint8_t *) value_string,
-		          value_string_size,
-		          error );
+		result = libfdatetime_filetime_copy_to_utf8_string(
+			  filetime,
+			  (uint8_t *) date_time_string,
+			  48,
+			  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
+			  error );
 #endif
 		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve class name.",
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy FILETIME to string.",
 			 function );
 
 			goto on_error;
 		}
-		fprintf(
-		 export_handle->notify_stream,
-		 "Class name: %" PRIs_SYSTEM "\n",
-		 value_string );
+		regftools_output_buffer_printf(
+		 output_buffer,
+		 "%s: %" PRIs_SYSTEM " UTC\n",
+		 value_name,
+		 date_time_string );
 
-		memory_free(
-		 value_string );
+		if( libfdatetime_filetime_free(
+		     &filetime,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free FILETIME.",
+			 function );
 
-		value_string = NULL;
+			goto on_error;
+		}
 	}
-	if( libregf_key_get_last_written_time(
-	     key,
-	     &value_64bit,
-	     error ) != 1 )
+	return( 1 );
+
+on_error:
+	if( filetime != NULL )
+	{
+		libfdatetime_filetime_free(
+		 &filetime,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Prints an UTF-8 string as a JSON string
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_print_json_string(
+     export_handle_t *export_handle,
+     regftools_output_buffer_t *output_buffer,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error )
+{
+	uint8_t escaped_character[ 6 ];
+
+	const char *hexadecimal_digits = "0123456789abcdef";
+	static char *function          = "export_handle_print_json_string";
+	size_t escaped_character_size  = 0;
+	size_t string_index            = 0;
+	size_t unescaped_string_index  = 0;
+	uint8_t character              = 0;
+
+	if( export_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve last written time.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( export_handle_export_filetime(
-	     export_handle,
-	     "Last written time",
-	     value_64bit,
-	     error ) != 1 )
+	if( ( utf8_string == NULL )
+	 && ( utf8_string_length > 0 ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GENERIC,
-		 "%s: unable to export last written time.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
 
+		return( -1 );
+	}
+	if( regftools_output_buffer_append_data(
+	     output_buffer,
+	     (uint8_t *) "\"",
+	     1,
+	     error ) != 1 )
+	{
 		goto on_error;
 	}
-	if( libregf_key_get_number_of_values(
-	     key,
-	     &number_of_values,
+	/* Characters that do not need escaping are appended in runs
+	 */
+	for( string_index = 0;
+	     string_index < utf8_string_length;
+	     string_index++ )
+	{
+		character = utf8_string[ string_index ];
+
+		if( ( character >= 0x20 )
+		 && ( character != (uint8_t) '"' )
+		 && ( character != (uint8_t) '\\' ) )
+		{
+			continue;
+		}
+		if( string_index > unescaped_string_index )
+		{
+			if( regftools_output_buffer_append_data(
+			     output_buffer,
+			     &( utf8_string[ unescaped_string_index ] ),
+			     string_index - unescaped_string_index,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+		escaped_character[ 0 ] = (uint8_t) '\\';
+		escaped_character_size = 2;
+
+		switch( character )
+		{
+			case (uint8_t) '"':
+			case (uint8_t) '\\':
+				escaped_character[ 1 ] = character;
+				break;
+
+			case (uint8_t) '\b':
+				escaped_character[ 1 ] = (uint8_t) 'b';
+				break;
+
+			case (uint8_t) '\f':
+				escaped_character[ 1 ] = (uint8_t) 'f';
+				break;
+
+			case (uint8_t) '\n':
+				escaped_character[ 1 ] = (uint8_t) 'n';
+				break;
+
+			case (uint8_t) '\r':
+				escaped_character[ 1 ] = (uint8_t) 'r';
+				break;
+
+			case (uint8_t) '\t':
+				escaped_character[ 1 ] = (uint8_t) 't';
+				break;
+
+			default:
+				escaped_character[ 1 ] = (uint8_t) 'u';
+				escaped_character[ 2 ] = (uint8_t) '0';
+				escaped_character[ 3 ] = (uint8_t) '0';
+				escaped_character[ 4 ] = (uint8_t) hexadecimal_digits[ character >> 4 ];
+				escaped_character[ 5 ] = (uint8_t) hexadecimal_digits[ character & 0x0f ];
+
+				escaped_character_size = 6;
+
+				break;
+		}
+		if( regftools_output_buffer_append_data(
+		     output_buffer,
+		     escaped_character,
+		     escaped_character_size,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		unescaped_string_index = string_index + 1;
+	}
+	if( utf8_string_length > unescaped_string_index )
+	{
+		if( regftools_output_buffer_append_data(
+		     output_buffer,
+		     &( utf8_string[ unescaped_string_index ] ),
+		     utf8_string_length - unescaped_string_index,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( regftools_output_buffer_append_data(
+	     output_buffer,
+	     (uint8_t *) "\"",
+	     1,
 	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_IO,
+	 LIBCERROR_IO_ERROR_WRITE_FAILED,
+	 "%s: unable to print JSON string.",
+	 function );
+
+	return( -1 );
+}
+
+/* Exports the values of a key as JSON Lines
+ * A line is printed for the key and one for each of its values
+ * Returns the 1 if succesful or -1 on error
+ */
+int export_handle_export_key_json_lines(
+     export_handle_t *export_handle,
+     regftools_output_buffer_t *output_buffer,
+     const uint8_t *utf8_key_path,
+     size_t utf8_key_path_length,
+     uint64_t last_written_time,
+     libregf_value_t **values,
+     int number_of_values,
+     libcerror_error_t **error )
+{
+	uint8_t *data           = NULL;
+	static char *function   = "export_handle_export_key_json_lines";
+	size_t data_size        = 0;
+	size_t value_name_size  = 0;
+	uint32_t value_type     = 0;
+	int is_corrupted        = 0;
+	int result              = 0;
+	int value_index         = 0;
+
+	if( export_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of values.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( number_of_values > 0 )
+	if( ( values == NULL )
+	 && ( number_of_values > 0 ) )
 	{
-		fprintf(
-		 export_handle->notify_stream,
-		 "\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values.",
+		 function );
+
+		return( -1 );
 	}
-	for( value_index = 0;
+	for( value_index = -1;
 	     value_index < number_of_values;
 	     value_index++ )
 	{
-		if( libregf_key_get_value_by_index(
-		     key,
-		     value_index,
-		     &value,
+		result = regftools_output_buffer_printf(
+		          output_buffer,
+		          "{\"key_path\":" );
+
+		if( result != -1 )
+		{
+			result = export_handle_print_json_string(
+			          export_handle,
+			          output_buffer,
+			          utf8_key_path,
+			          utf8_key_path_length,
+			          error );
+		}
+		if( result != -1 )
+		{
+			result = regftools_output_buffer_printf(
+			          output_buffer,
+			          ",\"last_written_time\":%" PRIu64 "",
+			          last_written_time );
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to print key.",
+			 function );
+
+			goto on_error;
+		}
+		/* The first line contains the key without a value
+		 */
+		if( value_index == -1 )
+		{
+			if( regftools_output_buffer_printf(
+			     output_buffer,
+			     "}\n" ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to print key.",
+				 function );
+
+				goto on_error;
+			}
+			continue;
+		}
+		if( libregf_value_get_utf8_name_size(
+		     values[ value_index ],
+		     &value_name_size,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value: %d.",
+			 "%s: unable to retrieve value: %d name size.",
 			 function,
 			 value_index );
 
 			goto on_error;
 		}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libregf_value_get_utf16_name_size(
-		          value,
-		          &value_string_size,
-		          error );
-#else
-		result = libregf_value_get_utf8_name_size(
-		          value,
-		          &value_string_size,
-		          error );
-#endif
-		if( result != 1 )
+		if( libregf_value_get_value_data_size(
+		     values[ value_index ],
+		     &data_size,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value name size.",
-			 function );
+			 "%s: unable to retrieve value: %d data size.",
+			 function,
+			 value_index );
 
 			goto on_error;
 		}
-		if( value_string_size > 0 )
+		if( ( value_name_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		 || ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
 		{
-			if( value_string_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-				 "%s: invalid name size value exceeds maximum allocation size.",
-				 function );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid value: %d name or data size value exceeds maximum allocation size.",
+			 function,
+			 value_index );
 
-				goto on_error;
-			}
-			value_string = system_string_allocate(
-			                value_string_size );
+			goto on_error;
+		}
+		/* The buffer is used for both the name and the data of the value
+		 */
+		if( ( value_name_size > 0 )
+		 || ( data_size > 0 ) )
+		{
+			data = (uint8_t *) memory_allocate(
+			                    sizeof( uint8_t ) * ( ( value_name_size > data_size ) ? value_name_size : data_size ) );
 
-			if( value_string == NULL )
+			if( data == NULL )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_MEMORY,
 				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create name string.",
+				 "%s: unable to create data.",
 				 function );
 
 				goto on_error;
 			}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-			result = libregf_value_get_utf16_name(
-			          value,
-			          (uint16_t *) value_string,
-			          value_string_size,
-			          error );
-#else
-			result = libregf_value_get_utf8_name(
-			          value,
-			          (uint8_t *) value_string,
-			          value_string_size,
-			          error );
-#endif
-			if( result != 1 )
+		}
+		if( value_name_size > 0 )
+		{
+			if( libregf_value_get_utf8_name(
+			     values[ value_index ],
+			     data,
+			     value_name_size,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve value name.",
-				 function );
+				 "%s: unable to retrieve value: %d name.",
+				 function,
+				 value_index );
 
 				goto on_error;
 			}
-			fprintf(
-			 export_handle->notify_stream,
-			 "Value: %d %" PRIs_SYSTEM "\n",
-			 value_index,
-			 value_string );
-
-			memory_free(
-			 value_string );
-
-			value_string = NULL;
+			value_name_size -= 1;
 		}
-		else
+		if( libregf_value_get_value_type(
+		     values[ value_index ],
+		     &value_type,
+		     error ) != 1 )
 		{
-			fprintf(
-			 export_handle->notify_stream,
-			 "Value: %d (default)\n",
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d type.",
+			 function,
 			 value_index );
+
+			goto on_error;
 		}
 		is_corrupted = libregf_value_is_corrupted(
-		                value,
+		                values[ value_index ],
 		                error );
 
 		if( is_corrupted == -1 )
@@ -1148,517 +1434,3210 @@ int export_handle_export_key(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine if value is corrupted.",
-			 function );
+			 "%s: unable to determine if value: %d is corrupted.",
+			 function,
+			 value_index );
 
 			goto on_error;
 		}
-		else if( is_corrupted != 0 )
+		result = regftools_output_buffer_printf(
+		          output_buffer,
+		          ",\"value_name\":" );
+
+		if( result != -1 )
 		{
-			fprintf(
-			 export_handle->notify_stream,
-			 "Is corrupted\n" );
+			result = export_handle_print_json_string(
+			          export_handle,
+			          output_buffer,
+			          data,
+			          value_name_size,
+			          error );
 		}
-		if( libregf_value_get_value_type(
-		     value,
-		     &value_type,
-		     error ) != 1 )
+		if( result != -1 )
+		{
+			result = regftools_output_buffer_printf(
+			          output_buffer,
+			          ",\"value_type\":%" PRIu32 ",\"data\":\"",
+			          value_type );
+		}
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value type.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to print value: %d.",
+			 function,
+			 value_index );
 
 			goto on_error;
 		}
-		switch( value_type )
+		if( data_size > 0 )
 		{
-			case LIBREGF_VALUE_TYPE_UNDEFINED:
-				fprintf(
-				 export_handle->notify_stream,
-				 "Type: undefined (REG_NONE)\n" );
-				break;
-
-			case LIBREGF_VALUE_TYPE_STRING:
-				fprintf(
-				 export_handle->notify_stream,
-				 "Type: string (REG_SZ)\n" );
-				break;
+			if( libregf_value_get_value_data(
+			     values[ value_index ],
+			     data,
+			     data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value: %d data.",
+				 function,
+				 value_index );
 
-			case LIBREGF_VALUE_TYPE_EXPANDABLE_STRING:
-				fprintf(
-				 export_handle->notify_stream,
-				 "Type: expandable string (REG_EXPAND_SZ)\n" );
-				break;
+				goto on_error;
+			}
+			if( regftools_output_buffer_append_hexadecimal(
+			     output_buffer,
+			     data,
+			     data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to print value: %d data.",
+				 function,
+				 value_index );
 
-			case LIBREGF_VALUE_TYPE_BINARY_DATA:
-				fprintf(
-				 export_handle->notify_stream,
-				 "Type: binary data (REG_BINARY)\n" );
-				break;
+				goto on_error;
+			}
+		}
+		if( is_corrupted != 0 )
+		{
+			result = regftools_output_buffer_printf(
+			          output_buffer,
+			          "\",\"is_corrupted\":true}\n" );
+		}
+		else
+		{
+			result = regftools_output_buffer_printf(
+			          output_buffer,
+			          "\"}\n" );
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to print value: %d.",
+			 function,
+			 value_index );
 
-			case LIBREGF_VALUE_TYPE_INTEGER_32BIT_LITTLE_ENDIAN:
-				fprintf(
-				 export_handle->notify_stream,
-				 "Type: 32-bit integer little-endian (REG_DWORD_LITTLE_ENDIAN)\n" );
-				break;
+			goto on_error;
+		}
+		if( data != NULL )
+		{
+			memory_free(
+			 data );
 
-			case LIBREGF_VALUE_TYPE_INTEGER_32BIT_BIG_ENDIAN:
-				fprintf(
-				 export_handle->notify_stream,
-				 "Type: 32-bit integer big-endian (REG_DWORD_BIG_ENDIAN)\n" );
-				break;
+			data = NULL;
+		}
+	}
+	return( 1 );
 
-			case LIBREGF_VALUE_TYPE_SYMBOLIC_LINK:
-				fprintf(
-				 export_handle->notify_stream,
-				 "Type: symbolic link (REG_LINK)\n" );
-				break;
+on_error:
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
 
-			case LIBREGF_VALUE_TYPE_MULTI_VALUE_STRING:
-				fprintf(
-				 export_handle->notify_stream,
-				 "Type: multi-value string (REG_MULTI_SZ)\n" );
-				break;
+/* Exports the values of a key as a binary key block
+ * Returns the 1 if succesful or -1 on error
+ */
+int export_handle_export_key_binary(
+     export_handle_t *export_handle,
+     regftools_output_buffer_t *output_buffer,
+     const uint8_t *utf8_key_path,
+     size_t utf8_key_path_length,
+     uint64_t last_written_time,
+     libregf_value_t **values,
+     int number_of_values,
+     libcerror_error_t **error )
+{
+	uint8_t block_header[ 20 ];
+
+	uint8_t *columns_data   = NULL;
+	uint8_t *data           = NULL;
+	static char *function   = "export_handle_export_key_binary";
+	size_t block_size       = 0;
+	size_t columns_size     = 0;
+	size_t data_size        = 0;
+	size_t value_name_size  = 0;
+	uint32_t value_type     = 0;
+	int is_corrupted        = 0;
+	int value_index         = 0;
 
-			case LIBREGF_VALUE_TYPE_RESOURCE_LIST:
-				fprintf(
-				 export_handle->notify_stream,
-				 "Type: resource list (REG_RESOURCE_LIST)\n" );
-				break;
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
 
-			case LIBREGF_VALUE_TYPE_FULL_RESOURCE_DESCRIPTOR:
-				fprintf(
-				 export_handle->notify_stream,
-				 "Type: full resource descriptor (REG_FULL_RESOURCE_DESCRIPTOR)\n" );
-				break;
+		return( -1 );
+	}
+	if( utf8_key_path_length > (size_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 key path length value exceeds maximum.",
+		 function );
 
-			case LIBREGF_VALUE_TYPE_RESOURCE_REQUIREMENTS_LIST:
-				fprintf(
-				 export_handle->notify_stream,
-				 "Type: resource requirements list (REG_RESOURCE_REQUIREMENTS_LIST)\n" );
-				break;
+		return( -1 );
+	}
+	if( ( values == NULL )
+	 && ( number_of_values > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values.",
+		 function );
 
-			case LIBREGF_VALUE_TYPE_INTEGER_64BIT_LITTLE_ENDIAN:
-				fprintf(
-				 export_handle->notify_stream,
-				 "Type: 64-bit integer little-endian (REG_QWORD_LITTLE_ENDIAN)\n" );
-				break;
+		return( -1 );
+	}
+	if( ( number_of_values < 0 )
+	 || ( number_of_values > (int) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 13 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of values value out of bounds.",
+		 function );
 
-			default:
-				fprintf(
-				 export_handle->notify_stream,
-				 "Type: unknown: 0x%08" PRIx32 "\n",
-				 value_type );
-				break;
+		return( -1 );
+	}
+	block_size = 16 + utf8_key_path_length;
+
+	/* The fixed-size columns are the type (4 bytes), flags (1 byte),
+	 * name size (4 bytes) and data size (4 bytes) of each value
+	 */
+	if( number_of_values > 0 )
+	{
+		columns_size = (size_t) number_of_values * 13;
+
+		columns_data = (uint8_t *) memory_allocate(
+		                            sizeof( uint8_t ) * columns_size );
+
+		if( columns_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create columns data.",
+			 function );
+
+			goto on_error;
 		}
-		if( libregf_value_get_value_data_size(
-		     value,
-		     &data_size,
+		block_size += columns_size;
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		if( libregf_value_get_value_type(
+		     values[ value_index ],
+		     &value_type,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value data size.",
-			 function );
+			 "%s: unable to retrieve value: %d type.",
+			 function,
+			 value_index );
 
 			goto on_error;
 		}
-		fprintf(
-		 export_handle->notify_stream,
-		 "Data size: %" PRIzd "\n",
-		 data_size );
+		is_corrupted = libregf_value_is_corrupted(
+		                values[ value_index ],
+		                error );
 
-		switch( value_type )
+		if( is_corrupted == -1 )
 		{
-			case LIBREGF_VALUE_TYPE_STRING:
-			case LIBREGF_VALUE_TYPE_EXPANDABLE_STRING:
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-				result = libregf_value_get_value_utf16_string_size(
-					  value,
-					  &value_string_size,
-					  error );
-#else
-				result = libregf_value_get_value_utf8_string_size(
-					  value,
-					  &value_string_size,
-					  error );
-#endif
-				if( result != 1 )
-				{
-					libcerror_error_free(
-					 error );
-				}
-				else
-				{
-					fprintf(
-					 export_handle->notify_stream,
-					 "Data:" );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if value: %d is corrupted.",
+			 function,
+			 value_index );
 
-					if( value_string_size > 0 )
-					{
-						if( value_string_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-							 "%s: invalid value string size value exceeds maximum allocation size.",
-							 function );
+			goto on_error;
+		}
+		if( libregf_value_get_utf8_name_size(
+		     values[ value_index ],
+		     &value_name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d name size.",
+			 function,
+			 value_index );
 
-							goto on_error;
-						}
-						value_string = system_string_allocate(
-								value_string_size );
+			goto on_error;
+		}
+		if( value_name_size > 0 )
+		{
+			value_name_size -= 1;
+		}
+		if( libregf_value_get_value_data_size(
+		     values[ value_index ],
+		     &data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d data size.",
+			 function,
+			 value_index );
 
-						if( value_string == NULL )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_MEMORY,
-							 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-							 "%s: unable to create value string.",
-							 function );
+			goto on_error;
+		}
+		if( ( value_name_size > (size_t) UINT32_MAX )
+		 || ( data_size > (size_t) UINT32_MAX )
+		 || ( ( value_name_size + data_size ) > ( (size_t) UINT32_MAX - block_size ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid block size value exceeds maximum.",
+			 function );
 
-							goto on_error;
-						}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-						result = libregf_value_get_value_utf16_string(
-							  value,
-							  (uint16_t *) value_string,
-							  value_string_size,
-							  error );
-#else
-						result = libregf_value_get_value_utf8_string(
-							  value,
-							  (uint8_t *) value_string,
-							  value_string_size,
-							  error );
-#endif
-						if( result != 1 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-							 "%s: unable to retrieve value string.",
-							 function );
+			goto on_error;
+		}
+		block_size += value_name_size + data_size;
 
-							goto on_error;
-						}
-						fprintf(
-						 export_handle->notify_stream,
-						 " %" PRIs_SYSTEM "",
-						 value_string );
+		byte_stream_copy_from_uint32_little_endian(
+		 &( columns_data[ value_index * 4 ] ),
+		 value_type );
 
-						memory_free(
-						 value_string );
+		columns_data[ ( number_of_values * 4 ) + value_index ] = ( is_corrupted != 0 ) ? EXPORT_HANDLE_BINARY_FORMAT_VALUE_FLAG_IS_CORRUPTED : 0;
 
-						value_string = NULL;
-					}
-					fprintf(
-					 export_handle->notify_stream,
-					 "\n" );
+		byte_stream_copy_from_uint32_little_endian(
+		 &( columns_data[ ( number_of_values * 5 ) + ( value_index * 4 ) ] ),
+		 (uint32_t) value_name_size );
 
-					result = libregf_value_get_value_utf16_string_size(
-						  value,
-						  &expected_data_size,
-						  error );
+		byte_stream_copy_from_uint32_little_endian(
+		 &( columns_data[ ( number_of_values * 9 ) + ( value_index * 4 ) ] ),
+		 (uint32_t) data_size );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( block_header[ 0 ] ),
+	 (uint32_t) block_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( block_header[ 4 ] ),
+	 last_written_time );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( block_header[ 12 ] ),
+	 (uint32_t) utf8_key_path_length );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( block_header[ 16 ] ),
+	 (uint32_t) number_of_values );
+
+	if( regftools_output_buffer_append_data(
+	     output_buffer,
+	     block_header,
+	     20,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write block header.",
+		 function );
 
-					if( result != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-						 "%s: unable to retrieve value UTF-16 string size.",
-						 function );
+		goto on_error;
+	}
+	if( utf8_key_path_length > 0 )
+	{
+		if( regftools_output_buffer_append_data(
+		     output_buffer,
+		     utf8_key_path,
+		     utf8_key_path_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write key path.",
+			 function );
 
-						goto on_error;
-					}
+			goto on_error;
+		}
+	}
+	if( columns_data != NULL )
+	{
+		if( regftools_output_buffer_append_data(
+		     output_buffer,
+		     columns_data,
+		     columns_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write value columns.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The value names are written before the value data
+	 */
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( columns_data[ ( number_of_values * 5 ) + ( value_index * 4 ) ] ),
+		 value_name_size );
+
+		if( value_name_size == 0 )
+		{
+			continue;
+		}
+		data = (uint8_t *) memory_allocate(
+		                    sizeof( uint8_t ) * ( value_name_size + 1 ) );
+
+		if( data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create value name.",
+			 function );
+
+			goto on_error;
+		}
+		if( libregf_value_get_utf8_name(
+		     values[ value_index ],
+		     data,
+		     value_name_size + 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d name.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		if( regftools_output_buffer_append_data(
+		     output_buffer,
+		     data,
+		     value_name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write value: %d name.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		memory_free(
+		 data );
+
+		data = NULL;
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( columns_data[ ( number_of_values * 9 ) + ( value_index * 4 ) ] ),
+		 data_size );
+
+		if( data_size == 0 )
+		{
+			continue;
+		}
+		data = (uint8_t *) memory_allocate(
+		                    sizeof( uint8_t ) * data_size );
+
+		if( data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create value data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libregf_value_get_value_data(
+		     values[ value_index ],
+		     data,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d data.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		if( regftools_output_buffer_append_data(
+		     output_buffer,
+		     data,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write value: %d data.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		memory_free(
+		 data );
+
+		data = NULL;
+	}
+	if( columns_data != NULL )
+	{
+		memory_free(
+		 columns_data );
+	}
+	return( 1 );
+
+on_error:
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	if( columns_data != NULL )
+	{
+		memory_free(
+		 columns_data );
+	}
+	return( -1 );
+}
+
+/* Exports the information and values of a key as a record
+ * The record is written in the JSON Lines or binary export format
+ * Returns the 1 if succesful or -1 on error
+ */
+int export_handle_export_key_record(
+     export_handle_t *export_handle,
+     regftools_output_buffer_t *output_buffer,
+     const system_character_t *key_path,
+     size_t key_path_length,
+     libregf_key_t *key,
+     libcerror_error_t **error )
+{
+	libregf_value_t **values     = NULL;
+	uint8_t *utf8_key_path       = NULL;
+	static char *function        = "export_handle_export_key_record";
+	size_t utf8_key_path_length  = 0;
+	uint64_t last_written_time   = 0;
+	int number_of_values         = 0;
+	int result                   = 0;
+	int value_index              = 0;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	size_t utf8_key_path_size    = 0;
+#endif
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key path.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libuna_utf8_string_size_from_utf16(
+	     (libuna_utf16_character_t *) key_path,
+	     key_path_length + 1,
+	     &utf8_key_path_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine UTF-8 key path size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( utf8_key_path_size == 0 )
+	 || ( utf8_key_path_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 key path size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	utf8_key_path = (uint8_t *) memory_allocate(
+	                             sizeof( uint8_t ) * utf8_key_path_size );
+
+	if( utf8_key_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-8 key path.",
+		 function );
+
+		goto on_error;
+	}
+	if( libuna_utf8_string_copy_from_utf16(
+	     utf8_key_path,
+	     utf8_key_path_size,
+	     (libuna_utf16_character_t *) key_path,
+	     key_path_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-8 key path.",
+		 function );
+
+		goto on_error;
+	}
+	utf8_key_path_length = utf8_key_path_size - 1;
+#else
+	utf8_key_path        = (uint8_t *) key_path;
+	utf8_key_path_length = key_path_length;
+#endif
+	if( libregf_key_get_last_written_time(
+	     key,
+	     &last_written_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve last written time.",
+		 function );
+
+		goto on_error;
+	}
+	if( libregf_key_get_number_of_values(
+	     key,
+	     &number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of values.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_values > 0 )
+	{
+		if( (size_t) number_of_values > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libregf_value_t * ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of values value exceeds maximum allocation size.",
+			 function );
+
+			goto on_error;
+		}
+		values = (libregf_value_t **) memory_allocate(
+		                               sizeof( libregf_value_t * ) * number_of_values );
+
+		if( values == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create values.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     values,
+		     0,
+		     sizeof( libregf_value_t * ) * number_of_values ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear values.",
+			 function );
+
+			memory_free(
+			 values );
+
+			values = NULL;
+
+			goto on_error;
+		}
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		if( libregf_key_get_value_by_index(
+		     key,
+		     value_index,
+		     &( values[ value_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+	}
+	if( export_handle->export_format == EXPORT_FORMAT_BINARY )
+	{
+		result = export_handle_export_key_binary(
+		          export_handle,
+		          output_buffer,
+		          utf8_key_path,
+		          utf8_key_path_length,
+		          last_written_time,
+		          values,
+		          number_of_values,
+		          error );
+	}
+	else
+	{
+		result = export_handle_export_key_json_lines(
+		          export_handle,
+		          output_buffer,
+		          utf8_key_path,
+		          utf8_key_path_length,
+		          last_written_time,
+		          values,
+		          number_of_values,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to export key record.",
+		 function );
+
+		goto on_error;
+	}
+	if( values != NULL )
+	{
+		for( value_index = 0;
+		     value_index < number_of_values;
+		     value_index++ )
+		{
+			if( libregf_value_free(
+			     &( values[ value_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free value: %d.",
+				 function,
+				 value_index );
+
+				goto on_error;
+			}
+		}
+		memory_free(
+		 values );
+
+		values = NULL;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	memory_free(
+	 utf8_key_path );
+#endif
+	return( 1 );
+
+on_error:
+	if( values != NULL )
+	{
+		for( value_index = 0;
+		     value_index < number_of_values;
+		     value_index++ )
+		{
+			if( values[ value_index ] != NULL )
+			{
+				libregf_value_free(
+				 &( values[ value_index ] ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 values );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( utf8_key_path != NULL )
+	{
+		memory_free(
+		 utf8_key_path );
+	}
+#endif
+	return( -1 );
+}
+
+/* Exports the information and values of a key as text
+ * The key path is the path of the key itself, of which the name starts at name index
+ * Returns the 1 if succesful or -1 on error
+ */
+int export_handle_export_key_text(
+     export_handle_t *export_handle,
+     regftools_output_buffer_t *output_buffer,
+     const system_character_t *key_path,
+     size_t key_path_length,
+     size_t name_index,
+     libregf_key_t *key,
+     libcerror_error_t **error )
+{
+	libregf_value_t *value           = NULL;
+	system_character_t *value_string = NULL;
+	uint8_t *data                    = NULL;
+	static char *function            = "export_handle_export_key_text";
+	size_t data_size                 = 0;
+	size_t expected_data_size        = 0;
+	size_t value_string_size         = 0;
+	ssize_t print_count              = 0;
+	uint64_t value_64bit             = 0;
+	uint32_t value_32bit             = 0;
+	uint32_t value_type              = 0;
+	int is_corrupted                 = 0;
+	int number_of_values             = 0;
+	int result                       = 0;
+	int value_index                  = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key path.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_index > key_path_length )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	regftools_output_buffer_printf(
+	 output_buffer,
+	 "Key path: %" PRIs_SYSTEM "\n",
+	 key_path );
+
+	regftools_output_buffer_printf(
+	 output_buffer,
+	 "Name: %" PRIs_SYSTEM "\n",
+	 &( key_path[ name_index ] ) );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libregf_key_get_utf16_class_name_size(
+	          key,
+	          &value_string_size,
+	          error );
+#else
+	result = libregf_key_get_utf8_class_name_size(
+	          key,
+	          &value_string_size,
+	          error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve the class name size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( result != 0 )
+	 && ( value_string_size > 0 ) )
+	{
+		if( value_string_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid name size value exceeds maximum allocation size.",
+			 function );
+
+			goto on_error;
+		}
+		value_string = system_string_allocate(
+		                value_string_size );
+
+		if( value_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create name string.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libregf_key_get_utf16_class_name(
+		          key,
+		          (uint16_t *) value_string,
+		          value_string_size,
+		          error );
+#else
+		result = libregf_key_get_utf8_class_name(
+		          key,
+		          (uint8_t *) value_string,
+		          value_string_size,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve class name.",
+			 function );
+
+			goto on_error;
+		}
+		regftools_output_buffer_printf(
+		 output_buffer,
+		 "Class name: %" PRIs_SYSTEM "\n",
+		 value_string );
+
+		memory_free(
+		 value_string );
+
+		value_string = NULL;
+	}
+	if( libregf_key_get_last_written_time(
+	     key,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve last written time.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle_export_filetime(
+	     export_handle,
+	     output_buffer,
+	     "Last written time",
+	     value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to export last written time.",
+		 function );
+
+		goto on_error;
+	}
+	if( libregf_key_get_number_of_values(
+	     key,
+	     &number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of values.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_values > 0 )
+	{
+		regftools_output_buffer_printf(
+		 output_buffer,
+		 "\n" );
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		if( libregf_key_get_value_by_index(
+		     key,
+		     value_index,
+		     &value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libregf_value_get_utf16_name_size(
+		          value,
+		          &value_string_size,
+		          error );
+#else
+		result = libregf_value_get_utf8_name_size(
+		          value,
+		          &value_string_size,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value name size.",
+			 function );
+
+			goto on_error;
+		}
+		if( value_string_size > 0 )
+		{
+			if( value_string_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid name size value exceeds maximum allocation size.",
+				 function );
+
+				goto on_error;
+			}
+			value_string = system_string_allocate(
+			                value_string_size );
+
+			if( value_string == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create name string.",
+				 function );
+
+				goto on_error;
+			}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			result = libregf_value_get_utf16_name(
+			          value,
+			          (uint16_t *) value_string,
+			          value_string_size,
+			          error );
+#else
+			result = libregf_value_get_utf8_name(
+			          value,
+			          (uint8_t *) value_string,
+			          value_string_size,
+			          error );
+#endif
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value name.",
+				 function );
+
+				goto on_error;
+			}
+			regftools_output_buffer_printf(
+			 output_buffer,
+			 "Value: %d %" PRIs_SYSTEM "\n",
+			 value_index,
+			 value_string );
+
+			memory_free(
+			 value_string );
+
+			value_string = NULL;
+		}
+		else
+		{
+			regftools_output_buffer_printf(
+			 output_buffer,
+			 "Value: %d (default)\n",
+			 value_index );
+		}
+		is_corrupted = libregf_value_is_corrupted(
+		                value,
+		                error );
+
+		if( is_corrupted == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if value is corrupted.",
+			 function );
+
+			goto on_error;
+		}
+		else if( is_corrupted != 0 )
+		{
+			regftools_output_buffer_printf(
+			 output_buffer,
+			 "Is corrupted\n" );
+		}
+		if( libregf_value_get_value_type(
+		     value,
+		     &value_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type.",
+			 function );
+
+			goto on_error;
+		}
+		switch( value_type )
+		{
+			case LIBREGF_VALUE_TYPE_UNDEFINED:
+				regftools_output_buffer_printf(
+				 output_buffer,
+				 "Type: undefined (REG_NONE)\n" );
+				break;
+
+			case LIBREGF_VALUE_TYPE_STRING:
+				regftools_output_buffer_printf(
+				 output_buffer,
+				 "Type: string (REG_SZ)\n" );
+				break;
+
+			case LIBREGF_VALUE_TYPE_EXPANDABLE_STRING:
+				regftools_output_buffer_printf(
+				 output_buffer,
+				 "Type: expandable string (REG_EXPAND_SZ)\n" );
+				break;
+
+			case LIBREGF_VALUE_TYPE_BINARY_DATA:
+				regftools_output_buffer_printf(
+				 output_buffer,
+				 "Type: binary data (REG_BINARY)\n" );
+				break;
+
+			case LIBREGF_VALUE_TYPE_INTEGER_32BIT_LITTLE_ENDIAN:
+				regftools_output_buffer_printf(
+				 output_buffer,
+				 "Type: 32-bit integer little-endian (REG_DWORD_LITTLE_ENDIAN)\n" );
+				break;
+
+			case LIBREGF_VALUE_TYPE_INTEGER_32BIT_BIG_ENDIAN:
+				regftools_output_buffer_printf(
+				 output_buffer,
+				 "Type: 32-bit integer big-endian (REG_DWORD_BIG_ENDIAN)\n" );
+				break;
+
+			case LIBREGF_VALUE_TYPE_SYMBOLIC_LINK:
+				regftools_output_buffer_printf(
+				 output_buffer,
+				 "Type: symbolic link (REG_LINK)\n" );
+				break;
+
+			case LIBREGF_VALUE_TYPE_MULTI_VALUE_STRING:
+				regftools_output_buffer_printf(
+				 output_buffer,
+				 "Type: multi-value string (REG_MULTI_SZ)\n" );
+				break;
+
+			case LIBREGF_VALUE_TYPE_RESOURCE_LIST:
+				regftools_output_buffer_printf(
+				 output_buffer,
+				 "Type: resource list (REG_RESOURCE_LIST)\n" );
+				break;
+
+			case LIBREGF_VALUE_TYPE_FULL_RESOURCE_DESCRIPTOR:
+				regftools_output_buffer_printf(
+				 output_buffer,
+				 "Type: full resource descriptor (REG_FULL_RESOURCE_DESCRIPTOR)\n" );
+				break;
+
+			case LIBREGF_VALUE_TYPE_RESOURCE_REQUIREMENTS_LIST:
+				regftools_output_buffer_printf(
+				 output_buffer,
+				 "Type: resource requirements list (REG_RESOURCE_REQUIREMENTS_LIST)\n" );
+				break;
+
+			case LIBREGF_VALUE_TYPE_INTEGER_64BIT_LITTLE_ENDIAN:
+				regftools_output_buffer_printf(
+				 output_buffer,
+				 "Type: 64-bit integer little-endian (REG_QWORD_LITTLE_ENDIAN)\n" );
+				break;
+
+			default:
+				regftools_output_buffer_printf(
+				 output_buffer,
+				 "Type: unknown: 0x%08" PRIx32 "\n",
+				 value_type );
+				break;
+		}
+		if( libregf_value_get_value_data_size(
+		     value,
+		     &data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value data size.",
+			 function );
+
+			goto on_error;
+		}
+		regftools_output_buffer_printf(
+		 output_buffer,
+		 "Data size: %" PRIzd "\n",
+		 data_size );
+
+		switch( value_type )
+		{
+			case LIBREGF_VALUE_TYPE_STRING:
+			case LIBREGF_VALUE_TYPE_EXPANDABLE_STRING:
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+				result = libregf_value_get_value_utf16_string_size(
+					  value,
+					  &value_string_size,
+					  error );
+#else
+				result = libregf_value_get_value_utf8_string_size(
+					  value,
+					  &value_string_size,
+					  error );
+#endif
+				if( result != 1 )
+				{
+					libcerror_error_free(
+					 error );
+				}
+				else
+				{
+					regftools_output_buffer_printf(
+					 output_buffer,
+					 "Data:" );
+
+					if( value_string_size > 0 )
+					{
+						if( value_string_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+							 "%s: invalid value string size value exceeds maximum allocation size.",
+							 function );
+
+							goto on_error;
+						}
+						value_string = system_string_allocate(
+								value_string_size );
+
+						if( value_string == NULL )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_MEMORY,
+							 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+							 "%s: unable to create value string.",
+							 function );
+
+							goto on_error;
+						}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+						result = libregf_value_get_value_utf16_string(
+							  value,
+							  (uint16_t *) value_string,
+							  value_string_size,
+							  error );
+#else
+						result = libregf_value_get_value_utf8_string(
+							  value,
+							  (uint8_t *) value_string,
+							  value_string_size,
+							  error );
+#endif
+						if( result != 1 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+							 "%s: unable to retrieve value string.",
+							 function );
+
+							goto on_error;
+						}
+						regftools_output_buffer_printf(
+						 output_buffer,
+						 " %" PRIs_SYSTEM "",
+						 value_string );
+
+						memory_free(
+						 value_string );
+
+						value_string = NULL;
+					}
+					regftools_output_buffer_printf(
+					 output_buffer,
+					 "\n" );
+
+					result = libregf_value_get_value_utf16_string_size(
+						  value,
+						  &expected_data_size,
+						  error );
+
+					if( result != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to retrieve value UTF-16 string size.",
+						 function );
+
+						goto on_error;
+					}
 					expected_data_size *= 2;
 
-					if( expected_data_size == ( data_size + 2 ) )
-					{
-						expected_data_size -= 2;
-					}
-				}
-				break;
+					if( expected_data_size == ( data_size + 2 ) )
+					{
+						expected_data_size -= 2;
+					}
+				}
+				break;
+
+			case LIBREGF_VALUE_TYPE_INTEGER_32BIT_LITTLE_ENDIAN:
+			case LIBREGF_VALUE_TYPE_INTEGER_32BIT_BIG_ENDIAN:
+				if( data_size == 4 )
+				{
+					if( libregf_value_get_value_32bit(
+					     value,
+					     &value_32bit,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to retrieve 32-bit value.",
+						 function );
+
+						goto on_error;
+					}
+					regftools_output_buffer_printf(
+					 output_buffer,
+					 "Data: %" PRIu32 "\n",
+					 value_32bit );
+				}
+				expected_data_size = 4;
+
+				break;
+
+			case LIBREGF_VALUE_TYPE_INTEGER_64BIT_LITTLE_ENDIAN:
+				if( data_size == 8 )
+				{
+					if( libregf_value_get_value_64bit(
+					     value,
+					     &value_64bit,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to retrieve 64-bit value.",
+						 function );
+
+						goto on_error;
+					}
+					regftools_output_buffer_printf(
+					 output_buffer,
+					 "Data: %" PRIu64 "\n",
+					 value_64bit );
+				}
+				expected_data_size = 8;
+
+				break;
+
+			default:
+				expected_data_size = 0;
+
+				break;
+		}
+		if( data_size != expected_data_size )
+		{
+			if( ( data_size == 4 )
+			 && ( expected_data_size == 2 )
+			 && ( ( value_type == LIBREGF_VALUE_TYPE_STRING )
+			  ||  ( value_type == LIBREGF_VALUE_TYPE_EXPANDABLE_STRING ) ) )
+			{
+				/* An empty string is sometimes stored as 4 bytes */
+			}
+			else if( expected_data_size != 0 )
+			{
+				regftools_output_buffer_printf(
+				 output_buffer,
+				 "Mismatch in data size and that required for data type.\n" );
+			}
+			if( data_size > 0 )
+			{
+				data = (uint8_t *) memory_allocate(
+						    sizeof( uint8_t ) * data_size );
+
+				if( data == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create value data.",
+					 function );
+
+					goto on_error;
+				}
+				if( libregf_value_get_value_data(
+				     value,
+				     data,
+				     data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve value data.",
+					 function );
+
+					goto on_error;
+				}
+				regftools_output_buffer_printf(
+				 output_buffer,
+				 "Data:\n" );
+
+				print_count = export_handle_print_data(
+					       export_handle,
+					       output_buffer,
+					       data,
+					       data_size,
+					       error );
+
+				if( print_count == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+					 "%s: unable to print value data.",
+					 function );
+
+					goto on_error;
+				}
+				memory_free(
+				 data );
+
+				data = NULL;
+			}
+			else
+			{
+				regftools_output_buffer_printf(
+				 output_buffer,
+				 "\n" );
+			}
+		}
+		else
+		{
+			regftools_output_buffer_printf(
+			 output_buffer,
+			 "\n" );
+		}
+		if( libregf_value_free(
+		     &value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free value: %d.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+	}
+	if( number_of_values == 0 )
+	{
+		regftools_output_buffer_printf(
+		 output_buffer,
+		 "\n" );
+	}
+	return( 1 );
+
+on_error:
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	if( value != NULL )
+	{
+		libregf_value_free(
+		 &value,
+		 NULL );
+	}
+	if( value_string != NULL )
+	{
+		memory_free(
+		 value_string );
+	}
+	return( -1 );
+}
+
+/* Exports the information and values of a key
+ * The key path is the path of the parent key, the path of the key itself
+ * is returned as the sub key path
+ * Returns the 1 if succesful or -1 on error
+ */
+int export_handle_export_key_information(
+     export_handle_t *export_handle,
+     regftools_output_buffer_t *output_buffer,
+     const system_character_t *key_path,
+     size_t key_path_length,
+     libregf_key_t *key,
+     system_character_t **sub_key_path,
+     size_t *sub_key_path_length,
+     libcerror_error_t **error )
+{
+	system_character_t *safe_sub_key_path = NULL;
+	static char *function                 = "export_handle_export_key_information";
+	size_t safe_sub_key_path_length       = 0;
+	size_t value_string_size              = 0;
+	int result                            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key path.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_path_length > ( (size_t) SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid key path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_key_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub key path.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_key_path_length == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub key path length.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libregf_key_get_utf16_name_size(
+	          key,
+	          &value_string_size,
+	          error );
+#else
+	result = libregf_key_get_utf8_name_size(
+	          key,
+	          &value_string_size,
+	          error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve key name size.",
+		 function );
+
+		goto on_error;
+	}
+	if( value_string_size > ( (size_t) SSIZE_MAX / sizeof( system_character_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid name size value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	safe_sub_key_path_length = key_path_length;
+
+	if( value_string_size > 0 )
+	{
+		if( key_path_length > 0 )
+		{
+			safe_sub_key_path_length += 1;
+		}
+		safe_sub_key_path_length += value_string_size - 1;
+	}
+	if( safe_sub_key_path_length > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid sub key path length value exceeds maximum allocation size.",
+		 function );
+
+		goto on_error;
+	}
+	safe_sub_key_path = system_string_allocate(
+	                safe_sub_key_path_length + 1 );
+
+	if( safe_sub_key_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sub key path.",
+		 function );
+
+		goto on_error;
+	}
+	if( safe_sub_key_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sub key path.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     safe_sub_key_path,
+	     key_path,
+	     key_path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy key path to sub key path.",
+		 function );
+
+		goto on_error;
+	}
+	if( key_path_length > 0 )
+	{
+		safe_sub_key_path[ key_path_length ] = '\\';
+
+		key_path_length += 1;
+	}
+	if( value_string_size == 0 )
+	{
+		safe_sub_key_path[ key_path_length ] = 0;
+	}
+	else
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libregf_key_get_utf16_name(
+		          key,
+		          (uint16_t *) &( safe_sub_key_path[ key_path_length ] ),
+		          value_string_size,
+		          error );
+#else
+		result = libregf_key_get_utf8_name(
+		          key,
+		          (uint8_t *) &( safe_sub_key_path[ key_path_length ] ),
+		          value_string_size,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key name.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( export_handle->export_format == EXPORT_FORMAT_TEXT )
+	{
+		result = export_handle_export_key_text(
+		          export_handle,
+		          output_buffer,
+		          safe_sub_key_path,
+		          safe_sub_key_path_length,
+		          key_path_length,
+		          key,
+		          error );
+	}
+	else
+	{
+		result = export_handle_export_key_record(
+		          export_handle,
+		          output_buffer,
+		          safe_sub_key_path,
+		          safe_sub_key_path_length,
+		          key,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to export key: %" PRIs_SYSTEM ".",
+		 function,
+		 safe_sub_key_path );
+
+		goto on_error;
+	}
+	*sub_key_path        = safe_sub_key_path;
+	*sub_key_path_length = safe_sub_key_path_length;
+
+	return( 1 );
+
+on_error:
+	if( safe_sub_key_path != NULL )
+	{
+		memory_free(
+		 safe_sub_key_path );
+	}
+	return( -1 );
+}
+
+/* Exports a key and its sub keys
+ * Returns the 1 if succesful or -1 on error
+ */
+int export_handle_export_key(
+     export_handle_t *export_handle,
+     regftools_output_buffer_t *output_buffer,
+     const system_character_t *key_path,
+     size_t key_path_length,
+     libregf_key_t *key,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	libregf_key_t *sub_key           = NULL;
+	system_character_t *sub_key_path = NULL;
+	static char *function            = "export_handle_export_key";
+	size_t sub_key_path_length       = 0;
+	int number_of_sub_keys           = 0;
+	int sub_key_index                = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_export_key_information(
+	     export_handle,
+	     output_buffer,
+	     key_path,
+	     key_path_length,
+	     key,
+	     &sub_key_path,
+	     &sub_key_path_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to export key information.",
+		 function );
+
+		goto on_error;
+	}
+	if( libregf_key_get_number_of_sub_keys(
+	     key,
+	     &number_of_sub_keys,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub keys.",
+		 function );
+
+		goto on_error;
+	}
+	for( sub_key_index = 0;
+	     sub_key_index < number_of_sub_keys;
+	     sub_key_index++ )
+	{
+		if( export_handle->abort != 0 )
+		{
+			goto on_error;
+		}
+		if( libregf_key_get_sub_key_by_index(
+		     key,
+		     sub_key_index,
+		     &sub_key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub key: %d.",
+			 function,
+			 sub_key_index );
+
+			goto on_error;
+		}
+		if( export_handle_export_key(
+		     export_handle,
+		     output_buffer,
+		     sub_key_path,
+		     sub_key_path_length,
+		     sub_key,
+		     log_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export sub key: %d.",
+			 function,
+			 sub_key_index );
+
+			goto on_error;
+		}
+		if( libregf_key_free(
+		     &sub_key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sub key: %d.",
+			 function,
+			 sub_key_index );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 sub_key_path );
+
+	return( 1 );
+
+on_error:
+	if( sub_key != NULL )
+	{
+		libregf_key_free(
+		 &sub_key,
+		 NULL );
+	}
+	if( sub_key_path != NULL )
+	{
+		memory_free(
+		 sub_key_path );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_REGFTOOLS_MULTI_THREAD_SUPPORT )
+
+/* Appends a job to the jobs
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_append_job(
+     export_handle_t *export_handle,
+     export_handle_job_t *job,
+     libcerror_error_t **error )
+{
+	export_handle_job_t **jobs   = NULL;
+	static char *function        = "export_handle_append_job";
+	size_t jobs_size             = 0;
+	int number_of_allocated_jobs = 0;
+	int result                   = 1;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     export_handle->jobs_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab jobs mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->number_of_jobs >= export_handle->number_of_allocated_jobs )
+	{
+		if( export_handle->number_of_allocated_jobs == 0 )
+		{
+			number_of_allocated_jobs = 256;
+		}
+		else if( export_handle->number_of_allocated_jobs < ( INT_MAX / 2 ) )
+		{
+			number_of_allocated_jobs = export_handle->number_of_allocated_jobs * 2;
+		}
+		jobs_size = sizeof( export_handle_job_t * ) * number_of_allocated_jobs;
+
+		if( ( number_of_allocated_jobs == 0 )
+		 || ( jobs_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated jobs value exceeds maximum.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			jobs = (export_handle_job_t **) memory_reallocate(
+			                                 export_handle->jobs,
+			                                 jobs_size );
+
+			if( jobs == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize jobs.",
+				 function );
+
+				result = -1;
+			}
+			else
+			{
+				export_handle->jobs                     = jobs;
+				export_handle->number_of_allocated_jobs = number_of_allocated_jobs;
+			}
+		}
+	}
+	if( result == 1 )
+	{
+		export_handle->jobs[ export_handle->number_of_jobs ] = job;
+
+		export_handle->number_of_jobs += 1;
+
+		if( libcthreads_condition_broadcast(
+		     export_handle->jobs_condition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast jobs condition.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     export_handle->jobs_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release jobs mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Queues a key and its sub keys as jobs
+ * The information of keys less deep than EXPORT_HANDLE_JOB_KEY_DEPTH is exported
+ * directly, the sub tree of the other keys is exported by a thread
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_queue_key(
+     export_handle_t *export_handle,
+     const system_character_t *key_path,
+     size_t key_path_length,
+     libregf_key_t *key,
+     int key_depth,
+     libcerror_error_t **error )
+{
+	export_handle_job_t *job         = NULL;
+	libregf_key_t *sub_key           = NULL;
+	system_character_t *sub_key_path = NULL;
+	static char *function            = "export_handle_queue_key";
+	size_t sub_key_path_length       = 0;
+	off64_t key_offset               = 0;
+	int number_of_sub_keys           = 0;
+	int sub_key_index                = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_depth >= EXPORT_HANDLE_JOB_KEY_DEPTH )
+	{
+		if( libregf_key_get_offset(
+		     key,
+		     &key_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key offset.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( export_handle_job_initialize(
+	     &job,
+	     key_path,
+	     key_path_length,
+	     key_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create job.",
+		 function );
+
+		goto on_error;
+	}
+	if( key_offset == 0 )
+	{
+		if( export_handle_export_key_information(
+		     export_handle,
+		     job->output_buffer,
+		     key_path,
+		     key_path_length,
+		     key,
+		     &sub_key_path,
+		     &sub_key_path_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export key information.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( export_handle_append_job(
+	     export_handle,
+	     job,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append job.",
+		 function );
+
+		goto on_error;
+	}
+	job = NULL;
+
+	if( export_handle_write_jobs(
+	     export_handle,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write jobs.",
+		 function );
+
+		goto on_error;
+	}
+	if( key_offset != 0 )
+	{
+		return( 1 );
+	}
+	if( libregf_key_get_number_of_sub_keys(
+	     key,
+	     &number_of_sub_keys,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub keys.",
+		 function );
+
+		goto on_error;
+	}
+	for( sub_key_index = 0;
+	     sub_key_index < number_of_sub_keys;
+	     sub_key_index++ )
+	{
+		if( export_handle->abort != 0 )
+		{
+			goto on_error;
+		}
+		if( libregf_key_get_sub_key_by_index(
+		     key,
+		     sub_key_index,
+		     &sub_key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub key: %d.",
+			 function,
+			 sub_key_index );
+
+			goto on_error;
+		}
+		if( export_handle_queue_key(
+		     export_handle,
+		     sub_key_path,
+		     sub_key_path_length,
+		     sub_key,
+		     key_depth + 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to queue sub key: %d.",
+			 function,
+			 sub_key_index );
+
+			goto on_error;
+		}
+		if( libregf_key_free(
+		     &sub_key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sub key: %d.",
+			 function,
+			 sub_key_index );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 sub_key_path );
+
+	return( 1 );
+
+on_error:
+	if( sub_key != NULL )
+	{
+		libregf_key_free(
+		 &sub_key,
+		 NULL );
+	}
+	if( sub_key_path != NULL )
+	{
+		memory_free(
+		 sub_key_path );
+	}
+	if( job != NULL )
+	{
+		export_handle_job_free(
+		 &job,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Writes the output of the jobs that are completed, in order
+ * If wait_for_jobs is set, waits until all jobs have been written
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_write_jobs(
+     export_handle_t *export_handle,
+     uint8_t wait_for_jobs,
+     libcerror_error_t **error )
+{
+	export_handle_job_t *job = NULL;
+	static char *function    = "export_handle_write_jobs";
+	int result               = 1;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     export_handle->jobs_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab jobs mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( export_handle->next_output_job_index < export_handle->number_of_jobs )
+	{
+		job = export_handle->jobs[ export_handle->next_output_job_index ];
+
+		if( job->status == EXPORT_HANDLE_JOB_STATUS_FAILED )
+		{
+			/* Only move the error of the job if no error was set before
+			 * otherwise the earlier error would be overwritten and leaked
+			 */
+			if( ( error != NULL )
+			 && ( *error == NULL ) )
+			{
+				*error = job->error;
+			}
+			else
+			{
+				libcerror_error_free(
+				 &( job->error ) );
+			}
+			job->error = NULL;
+
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export job: %d.",
+			 function,
+			 export_handle->next_output_job_index );
+
+			result = -1;
+
+			break;
+		}
+		else if( job->status == EXPORT_HANDLE_JOB_STATUS_COMPLETED )
+		{
+			if( ( job->output_buffer->data_size > 0 )
+			 && ( regftools_output_buffer_append_data(
+			       export_handle->output_buffer,
+			       job->output_buffer->data,
+			       job->output_buffer->data_size,
+			       error ) != 1 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write output of job: %d.",
+				 function,
+				 export_handle->next_output_job_index );
+
+				result = -1;
+
+				break;
+			}
+			if( export_handle_job_free(
+			     &( export_handle->jobs[ export_handle->next_output_job_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free job: %d.",
+				 function,
+				 export_handle->next_output_job_index );
+
+				result = -1;
+
+				break;
+			}
+			export_handle->next_output_job_index += 1;
+
+			/* Signal the threads that can export jobs further ahead
+			 */
+			if( libcthreads_condition_broadcast(
+			     export_handle->jobs_condition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to broadcast jobs condition.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+		}
+		else if( wait_for_jobs == 0 )
+		{
+			break;
+		}
+		else if( export_handle->abort != 0 )
+		{
+			result = -1;
+
+			break;
+		}
+		else if( libcthreads_condition_wait(
+		          export_handle->jobs_condition,
+		          export_handle->jobs_mutex,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for jobs condition.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     export_handle->jobs_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release jobs mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Exports the sub tree of the key of a job
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_job(
+     export_handle_t *export_handle,
+     export_handle_job_t *job,
+     libcerror_error_t **error )
+{
+	libregf_key_t *key    = NULL;
+	static char *function = "export_handle_export_job";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job.",
+		 function );
+
+		return( -1 );
+	}
+	if( libregf_file_get_key_by_offset(
+	     export_handle->input_file,
+	     job->key_offset,
+	     &key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve key at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 job->key_offset,
+		 job->key_offset );
+
+		goto on_error;
+	}
+	if( export_handle_export_key(
+	     export_handle,
+	     job->output_buffer,
+	     job->key_path,
+	     job->key_path_length,
+	     key,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to export key.",
+		 function );
+
+		goto on_error;
+	}
+	if( libregf_key_free(
+	     &key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free key.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( key != NULL )
+	{
+		libregf_key_free(
+		 &key,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Runs an export thread
+ * The thread exports queued jobs until all jobs have been added and exported
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_thread_run(
+     export_handle_t *export_handle )
+{
+	export_handle_job_t *job = NULL;
+	int maximum_jobs_ahead   = 0;
+	int result               = 0;
+
+	if( export_handle == NULL )
+	{
+		return( -1 );
+	}
+	maximum_jobs_ahead = export_handle->number_of_threads
+	                   * EXPORT_HANDLE_MAXIMUM_NUMBER_OF_JOBS_AHEAD_PER_THREAD;
+
+	if( libcthreads_mutex_grab(
+	     export_handle->jobs_mutex,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	while( export_handle->abort == 0 )
+	{
+		if( export_handle->next_job_index < export_handle->next_output_job_index )
+		{
+			export_handle->next_job_index = export_handle->next_output_job_index;
+		}
+		while( ( export_handle->next_job_index < export_handle->number_of_jobs )
+		    && ( export_handle->jobs[ export_handle->next_job_index ]->status != EXPORT_HANDLE_JOB_STATUS_QUEUED ) )
+		{
+			export_handle->next_job_index += 1;
+		}
+		if( ( export_handle->next_job_index < export_handle->number_of_jobs )
+		 && ( ( export_handle->next_job_index - export_handle->next_output_job_index ) < maximum_jobs_ahead ) )
+		{
+			job = export_handle->jobs[ export_handle->next_job_index ];
+
+			job->status = EXPORT_HANDLE_JOB_STATUS_RUNNING;
+
+			export_handle->next_job_index += 1;
+
+			/* The job is exported without holding the mutex, the job is not
+			 * accessed by the other threads while its status is running
+			 */
+			if( libcthreads_mutex_release(
+			     export_handle->jobs_mutex,
+			     NULL ) != 1 )
+			{
+				return( -1 );
+			}
+			result = export_handle_export_job(
+			          export_handle,
+			          job,
+			          &( job->error ) );
+
+			if( libcthreads_mutex_grab(
+			     export_handle->jobs_mutex,
+			     NULL ) != 1 )
+			{
+				return( -1 );
+			}
+			if( result == 1 )
+			{
+				job->status = EXPORT_HANDLE_JOB_STATUS_COMPLETED;
+			}
+			else
+			{
+				job->status = EXPORT_HANDLE_JOB_STATUS_FAILED;
+
+				export_handle->abort = 1;
+			}
+			if( libcthreads_condition_broadcast(
+			     export_handle->jobs_condition,
+			     NULL ) != 1 )
+			{
+				break;
+			}
+		}
+		else if( ( export_handle->all_jobs_added != 0 )
+		      && ( export_handle->next_job_index >= export_handle->number_of_jobs ) )
+		{
+			break;
+		}
+		else if( libcthreads_condition_wait(
+		          export_handle->jobs_condition,
+		          export_handle->jobs_mutex,
+		          NULL ) != 1 )
+		{
+			break;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     export_handle->jobs_mutex,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Stops the threads
+ * Waits for the running jobs to complete and joins the threads
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_stop_threads(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_stop_threads";
+	int result            = 1;
+	int thread_index      = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->threads == NULL )
+	{
+		return( 1 );
+	}
+	if( libcthreads_mutex_grab(
+	     export_handle->jobs_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab jobs mutex.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->all_jobs_added = 1;
+
+	if( libcthreads_condition_broadcast(
+	     export_handle->jobs_condition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast jobs condition.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     export_handle->jobs_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release jobs mutex.",
+		 function );
+
+		return( -1 );
+	}
+	for( thread_index = 0;
+	     thread_index < export_handle->number_of_threads;
+	     thread_index++ )
+	{
+		if( export_handle->threads[ thread_index ] == NULL )
+		{
+			continue;
+		}
+		if( libcthreads_thread_join(
+		     &( export_handle->threads[ thread_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread: %d.",
+			 function,
+			 thread_index );
+
+			result = -1;
+		}
+	}
+	memory_free(
+	 export_handle->threads );
 
-			case LIBREGF_VALUE_TYPE_INTEGER_32BIT_LITTLE_ENDIAN:
-			case LIBREGF_VALUE_TYPE_INTEGER_32BIT_BIG_ENDIAN:
-				if( data_size == 4 )
-				{
-					if( libregf_value_get_value_32bit(
-					     value,
-					     &value_32bit,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-						 "%s: unable to retrieve 32-bit value.",
-						 function );
+	export_handle->threads = NULL;
 
-						goto on_error;
-					}
-					fprintf(
-					 export_handle->notify_stream,
-					 "Data: %" PRIu32 "\n",
-					 value_32bit );
-				}
-				expected_data_size = 4;
+	return( result );
+}
 
-				break;
+/* Exports a key and its sub keys using multiple threads
+ * The output is written in the same order as export_handle_export_key
+ * Returns the 1 if succesful or -1 on error
+ */
+int export_handle_export_key_with_threads(
+     export_handle_t *export_handle,
+     const system_character_t *key_path,
+     size_t key_path_length,
+     libregf_key_t *key,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_export_key_with_threads";
+	size_t threads_size   = 0;
+	int job_index         = 0;
+	int result            = 1;
+	int thread_index      = 0;
 
-			case LIBREGF_VALUE_TYPE_INTEGER_64BIT_LITTLE_ENDIAN:
-				if( data_size == 8 )
-				{
-					if( libregf_value_get_value_64bit(
-					     value,
-					     &value_64bit,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-						 "%s: unable to retrieve 64-bit value.",
-						 function );
+	REGFTOOLS_UNREFERENCED_PARAMETER( log_handle )
 
-						goto on_error;
-					}
-					fprintf(
-					 export_handle->notify_stream,
-					 "Data: %" PRIu64 "\n",
-					 value_64bit );
-				}
-				expected_data_size = 8;
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
 
-				break;
+		return( -1 );
+	}
+	if( export_handle->threads != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle - threads value already set.",
+		 function );
 
-			default:
-				expected_data_size = 0;
+		return( -1 );
+	}
+	if( ( export_handle->number_of_threads <= 0 )
+	 || ( export_handle->number_of_threads > EXPORT_HANDLE_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid export handle - number of threads value out of bounds.",
+		 function );
 
-				break;
-		}
-		if( data_size != expected_data_size )
-		{
-			if( ( data_size == 4 )
-			 && ( expected_data_size == 2 )
-			 && ( ( value_type == LIBREGF_VALUE_TYPE_STRING )
-			  ||  ( value_type == LIBREGF_VALUE_TYPE_EXPANDABLE_STRING ) ) )
-			{
-				/* An empty string is sometimes stored as 4 bytes */
-			}
-			else if( expected_data_size != 0 )
-			{
-				fprintf(
-				 export_handle->notify_stream,
-				 "Mismatch in data size and that required for data type.\n" );
-			}
-			if( data_size > 0 )
-			{
-				data = (uint8_t *) memory_allocate(
-						    sizeof( uint8_t ) * data_size );
+		return( -1 );
+	}
+	export_handle->jobs                     = NULL;
+	export_handle->number_of_jobs           = 0;
+	export_handle->number_of_allocated_jobs = 0;
+	export_handle->next_job_index           = 0;
+	export_handle->next_output_job_index    = 0;
+	export_handle->all_jobs_added           = 0;
+
+	if( libcthreads_mutex_initialize(
+	     &( export_handle->jobs_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create jobs mutex.",
+		 function );
 
-				if( data == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_MEMORY,
-					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-					 "%s: unable to create value data.",
-					 function );
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( export_handle->jobs_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create jobs condition.",
+		 function );
 
-					goto on_error;
-				}
-				if( libregf_value_get_value_data(
-				     value,
-				     data,
-				     data_size,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve value data.",
-					 function );
+		goto on_error;
+	}
+	threads_size = sizeof( libcthreads_thread_t * ) * export_handle->number_of_threads;
 
-					goto on_error;
-				}
-				fprintf(
-				 export_handle->notify_stream,
-				 "Data:\n" );
+	export_handle->threads = (libcthreads_thread_t **) memory_allocate(
+	                                                    threads_size );
 
-				print_count = export_handle_print_data(
-					       export_handle,
-					       export_handle->notify_stream,
-					       data,
-					       data_size,
-					       error );
+	if( export_handle->threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create threads.",
+		 function );
 
-				if( print_count == -1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-					 "%s: unable to print value data.",
-					 function );
+		goto on_error;
+	}
+	if( memory_set(
+	     export_handle->threads,
+	     0,
+	     threads_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear threads.",
+		 function );
 
-					goto on_error;
-				}
-				memory_free(
-				 data );
+		memory_free(
+		 export_handle->threads );
 
-				data = NULL;
-			}
-			else
-			{
-				fprintf(
-				 export_handle->notify_stream,
-				 "\n" );
-			}
-		}
-		else
-		{
-			fprintf(
-			 export_handle->notify_stream,
-			 "\n" );
-		}
-		if( libregf_value_free(
-		     &value,
+		export_handle->threads = NULL;
+
+		goto on_error;
+	}
+	for( thread_index = 0;
+	     thread_index < export_handle->number_of_threads;
+	     thread_index++ )
+	{
+		if( libcthreads_thread_create(
+		     &( export_handle->threads[ thread_index ] ),
+		     NULL,
+		     (int (*)(void *)) &export_handle_thread_run,
+		     (void *) export_handle,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free value: %d.",
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread: %d.",
 			 function,
-			 value_index );
+			 thread_index );
+
+			goto on_error;
+		}
+	}
+	if( export_handle_queue_key(
+	     export_handle,
+	     key_path,
+	     key_path_length,
+	     key,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to queue key.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_grab(
+	     export_handle->jobs_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab jobs mutex.",
+		 function );
+
+		goto on_error;
+	}
+	export_handle->all_jobs_added = 1;
+
+	result = libcthreads_condition_broadcast(
+	          export_handle->jobs_condition,
+	          error );
+
+	if( libcthreads_mutex_release(
+	     export_handle->jobs_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release jobs mutex.",
+		 function );
 
-			goto on_error;
-		}
+		goto on_error;
 	}
-	if( number_of_values == 0 )
+	if( result != 1 )
 	{
-		fprintf(
-		 export_handle->notify_stream,
-		 "\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast jobs condition.",
+		 function );
+
+		goto on_error;
 	}
-	if( libregf_key_get_number_of_sub_keys(
-	     key,
-	     &number_of_sub_keys,
+	if( export_handle_write_jobs(
+	     export_handle,
+	     1,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of sub keys.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write jobs.",
 		 function );
 
 		goto on_error;
 	}
-	for( sub_key_index = 0;
-	     sub_key_index < number_of_sub_keys;
-	     sub_key_index++ )
+	if( export_handle_stop_threads(
+	     export_handle,
+	     error ) != 1 )
 	{
-		if( export_handle->abort != 0 )
-		{
-			goto on_error;
-		}
-		if( libregf_key_get_sub_key_by_index(
-		     key,
-		     sub_key_index,
-		     &sub_key,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve sub key: %d.",
-			 function,
-			 sub_key_index );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to stop threads.",
+		 function );
 
-			goto on_error;
-		}
-		if( export_handle_export_key(
-		     export_handle,
-		     sub_key_path,
-		     sub_key_path_length,
-		     sub_key,
-		     log_handle,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to export sub key: %d.",
-			 function,
-			 sub_key_index );
+		goto on_error;
+	}
+	result = 1;
 
-			goto on_error;
-		}
-		if( libregf_key_free(
-		     &sub_key,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free sub key: %d.",
-			 function,
-			 sub_key_index );
+	if( export_handle->jobs != NULL )
+	{
+		memory_free(
+		 export_handle->jobs );
 
-			goto on_error;
-		}
+		export_handle->jobs = NULL;
 	}
-	memory_free(
-	 sub_key_path );
+	if( libcthreads_condition_free(
+	     &( export_handle->jobs_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free jobs condition.",
+		 function );
 
-	return( 1 );
+		result = -1;
+	}
+	if( libcthreads_mutex_free(
+	     &( export_handle->jobs_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free jobs mutex.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
 
 on_error:
-	if( sub_key != NULL )
+	if( export_handle->threads != NULL )
 	{
-		libregf_key_free(
-		 &sub_key,
+		if( libcthreads_mutex_grab(
+		     export_handle->jobs_mutex,
+		     NULL ) == 1 )
+		{
+			export_handle->abort = 1;
+
+			libcthreads_mutex_release(
+			 export_handle->jobs_mutex,
+			 NULL );
+		}
+		export_handle_stop_threads(
+		 export_handle,
 		 NULL );
 	}
-	if( data != NULL )
+	if( export_handle->jobs_mutex != NULL )
+	{
+		/* Write the output of the jobs that completed before the failure
+		 */
+		export_handle_write_jobs(
+		 export_handle,
+		 0,
+		 NULL );
+	}
+	if( export_handle->jobs != NULL )
 	{
+		for( job_index = export_handle->next_output_job_index;
+		     job_index < export_handle->number_of_jobs;
+		     job_index++ )
+		{
+			export_handle_job_free(
+			 &( export_handle->jobs[ job_index ] ),
+			 NULL );
+		}
 		memory_free(
-		 data );
+		 export_handle->jobs );
+
+		export_handle->jobs = NULL;
 	}
-	if( value != NULL )
+	if( export_handle->jobs_condition != NULL )
 	{
-		libregf_value_free(
-		 &value,
+		libcthreads_condition_free(
+		 &( export_handle->jobs_condition ),
 		 NULL );
 	}
-	if( value_string != NULL )
+	if( export_handle->jobs_mutex != NULL )
 	{
-		memory_free(
-		 value_string );
+		libcthreads_mutex_free(
+		 &( export_handle->jobs_mutex ),
+		 NULL );
 	}
-	if( sub_key_path != NULL )
+	return( -1 );
+}
+
+#endif /* defined( HAVE_REGFTOOLS_MULTI_THREAD_SUPPORT ) */
+
+/* Exports the header of the export format
+ * Only the binary export format has a header
+ * Returns the 1 if succesful or -1 on error
+ */
+int export_handle_export_header(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	uint8_t header[ 12 ];
+
+	static char *function = "export_handle_export_header";
+
+	if( export_handle == NULL )
 	{
-		memory_free(
-		 sub_key_path );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
 	}
-	return( -1 );
+	if( export_handle->export_format != EXPORT_FORMAT_BINARY )
+	{
+		return( 1 );
+	}
+	if( memory_copy(
+	     header,
+	     EXPORT_HANDLE_BINARY_FORMAT_SIGNATURE,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( header[ 8 ] ),
+	 EXPORT_HANDLE_BINARY_FORMAT_VERSION );
+
+	if( regftools_output_buffer_append_data(
+	     export_handle->output_buffer,
+	     header,
+	     12,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write header.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
 }
 
 /* Exports keys and values from the file for a specific key path
@@ -1700,6 +4679,19 @@ int export_handle_export_key_path(
 	key_path_length = system_string_length(
 	                   key_path );
 
+	if( export_handle_export_header(
+	     export_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to export header.",
+		 function );
+
+		goto on_error;
+	}
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 	result = libregf_file_get_key_by_utf16_path(
 	          export_handle->input_file,
@@ -1728,20 +4720,47 @@ int export_handle_export_key_path(
 	}
 	else if( result == 0 )
 	{
-		fprintf(
-		 export_handle->notify_stream,
-		 "No key with path: %" PRIs_SYSTEM "\n",
-		 key_path );
+		if( export_handle->export_format == EXPORT_FORMAT_TEXT )
+		{
+			regftools_output_buffer_printf(
+			 export_handle->output_buffer,
+			 "No key with path: %" PRIs_SYSTEM "\n",
+			 key_path );
+		}
+		else
+		{
+			fprintf(
+			 stderr,
+			 "No key with path: %" PRIs_SYSTEM "\n",
+			 key_path );
+		}
 	}
 	else
 	{
-		if( export_handle_export_key(
-		     export_handle,
-		     key_path,
-		     key_path_length,
-		     key,
-		     log_handle,
-		     error ) != 1 )
+#if defined( HAVE_REGFTOOLS_MULTI_THREAD_SUPPORT )
+		if( export_handle->number_of_threads > 1 )
+		{
+			result = export_handle_export_key_with_threads(
+			          export_handle,
+			          key_path,
+			          key_path_length,
+			          key,
+			          log_handle,
+			          error );
+		}
+		else
+#endif
+		{
+			result = export_handle_export_key(
+			          export_handle,
+			          export_handle->output_buffer,
+			          key_path,
+			          key_path_length,
+			          key,
+			          log_handle,
+			          error );
+		}
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -1766,13 +4785,32 @@ int export_handle_export_key_path(
 			goto on_error;
 		}
 	}
-	fprintf(
-	 export_handle->notify_stream,
-	 "\n" );
+	if( export_handle->export_format == EXPORT_FORMAT_TEXT )
+	{
+		regftools_output_buffer_printf(
+		 export_handle->output_buffer,
+		 "\n" );
+	}
+	if( regftools_output_buffer_flush(
+	     export_handle->output_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush output buffer.",
+		 function );
 
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
+	regftools_output_buffer_flush(
+	 export_handle->output_buffer,
+	 NULL );
+
 	if( key != NULL )
 	{
 		libregf_key_free(
@@ -1805,6 +4843,19 @@ int export_handle_export_file(
 
 		return( -1 );
 	}
+	if( export_handle_export_header(
+	     export_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to export header.",
+		 function );
+
+		goto on_error;
+	}
 	result = libregf_file_get_root_key(
 	          export_handle->input_file,
 	          &root_key,
@@ -1823,19 +4874,45 @@ int export_handle_export_file(
 	}
 	else if( result == 0 )
 	{
-		fprintf(
-		 export_handle->notify_stream,
-		 "No root key\n" );
+		if( export_handle->export_format == EXPORT_FORMAT_TEXT )
+		{
+			regftools_output_buffer_printf(
+			 export_handle->output_buffer,
+			 "No root key\n" );
+		}
+		else
+		{
+			fprintf(
+			 stderr,
+			 "No root key\n" );
+		}
 	}
 	else
 	{
-		if( export_handle_export_key(
-		     export_handle,
-		     _SYSTEM_STRING( "" ),
-		     0,
-		     root_key,
-		     log_handle,
-		     error ) != 1 )
+#if defined( HAVE_REGFTOOLS_MULTI_THREAD_SUPPORT )
+		if( export_handle->number_of_threads > 1 )
+		{
+			result = export_handle_export_key_with_threads(
+			          export_handle,
+			          _SYSTEM_STRING( "" ),
+			          0,
+			          root_key,
+			          log_handle,
+			          error );
+		}
+		else
+#endif
+		{
+			result = export_handle_export_key(
+			          export_handle,
+			          export_handle->output_buffer,
+			          _SYSTEM_STRING( "" ),
+			          0,
+			          root_key,
+			          log_handle,
+			          error );
+		}
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -1860,13 +4937,32 @@ int export_handle_export_file(
 			goto on_error;
 		}
 	}
-	fprintf(
-	 export_handle->notify_stream,
-	 "\n" );
+	if( export_handle->export_format == EXPORT_FORMAT_TEXT )
+	{
+		regftools_output_buffer_printf(
+		 export_handle->output_buffer,
+		 "\n" );
+	}
+	if( regftools_output_buffer_flush(
+	     export_handle->output_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush output buffer.",
+		 function );
 
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
+	regftools_output_buffer_flush(
+	 export_handle->output_buffer,
+	 NULL );
+
 	if( root_key != NULL )
 	{
 		libregf_key_free(
@@ -28,12 +28,100 @@
 
 #include "log_handle.h"
 #include "regftools_libcerror.h"
+#include "regftools_libcthreads.h"
 #include "regftools_libregf.h"
+#include "regftools_output.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+/* The maximum number of threads
+ */
+#define EXPORT_HANDLE_MAXIMUM_NUMBER_OF_THREADS			64
+
+/* The depth, relative to the exported key, of the keys of which the sub tree
+ * is exported by a separate job
+ */
+#define EXPORT_HANDLE_JOB_KEY_DEPTH				2
+
+/* The maximum number of jobs per thread that can be exported ahead of
+ * the job that is written, which bounds the amount of buffered output
+ */
+#define EXPORT_HANDLE_MAXIMUM_NUMBER_OF_JOBS_AHEAD_PER_THREAD	16
+
+enum EXPORT_FORMATS
+{
+	EXPORT_FORMAT_BINARY			= (int) 'b',
+	EXPORT_FORMAT_JSON_LINES		= (int) 'j',
+	EXPORT_FORMAT_TEXT			= (int) 't'
+};
+
+/* The binary export format consists of a header followed by a block per key.
+ * All integers are stored in little-endian and all strings in UTF-8 without
+ * an end-of-string character.
+ *
+ * The header consists of:
+ *   8 bytes: the signature "regfexpb"
+ *   4 bytes: the format version
+ *
+ * A key block consists of:
+ *   4 bytes: the size of the remainder of the block
+ *   8 bytes: the last written date and time (FILETIME)
+ *   4 bytes: the size of the key path
+ *   4 bytes: the number of values
+ *   the key path
+ *   the values stored column-wise:
+ *     per value 4 bytes: the value type
+ *     per value 1 byte: the value flags, where 0x01 indicates corruption
+ *     per value 4 bytes: the size of the value name
+ *     per value 4 bytes: the size of the value data
+ *     the value names
+ *     the value data
+ */
+#define EXPORT_HANDLE_BINARY_FORMAT_SIGNATURE		"regfexpb"
+#define EXPORT_HANDLE_BINARY_FORMAT_VERSION		1
+
+#define EXPORT_HANDLE_BINARY_FORMAT_VALUE_FLAG_IS_CORRUPTED	0x01
+
+enum EXPORT_HANDLE_JOB_STATUSES
+{
+	EXPORT_HANDLE_JOB_STATUS_QUEUED		= 0,
+	EXPORT_HANDLE_JOB_STATUS_RUNNING	= 1,
+	EXPORT_HANDLE_JOB_STATUS_COMPLETED	= 2,
+	EXPORT_HANDLE_JOB_STATUS_FAILED		= 3
+};
+
+typedef struct export_handle_job export_handle_job_t;
+
+struct export_handle_job
+{
+	/* The offset of the key of which the sub tree is exported
+	 * or 0 if the output of the job is complete
+	 */
+	off64_t key_offset;
+
+	/* The path of the parent key
+	 */
+	system_character_t *key_path;
+
+	/* The length of the path of the parent key
+	 */
+	size_t key_path_length;
+
+	/* The output buffer
+	 */
+	regftools_output_buffer_t *output_buffer;
+
+	/* The status
+	 */
+	int status;
+
+	/* The error of a failed job
+	 */
+	libcerror_error_t *error;
+};
+
 typedef struct export_handle export_handle_t;
 
 struct export_handle
@@ -46,10 +134,60 @@ struct export_handle
 	 */
 	FILE *notify_stream;
 
+	/* The output buffer of the notification output stream
+	 */
+	regftools_output_buffer_t *output_buffer;
+
 	/* The ascii codepage
 	 */
 	int ascii_codepage;
 
+	/* The export format
+	 */
+	int export_format;
+
+	/* The number of threads
+	 */
+	int number_of_threads;
+
+#if defined( HAVE_REGFTOOLS_MULTI_THREAD_SUPPORT )
+	/* The jobs, in the order of their output
+	 */
+	export_handle_job_t **jobs;
+
+	/* The number of jobs
+	 */
+	int number_of_jobs;
+
+	/* The number of allocated jobs
+	 */
+	int number_of_allocated_jobs;
+
+	/* The index of the next job to export
+	 */
+	int next_job_index;
+
+	/* The index of the next job to write
+	 */
+	int next_output_job_index;
+
+	/* Value to indicate all jobs were added
+	 */
+	int all_jobs_added;
+
+	/* The threads
+	 */
+	libcthreads_thread_t **threads;
+
+	/* The mutex that protects the jobs
+	 */
+	libcthreads_mutex_t *jobs_mutex;
+
+	/* The condition that signals changes in the jobs
+	 */
+	libcthreads_condition_t *jobs_condition;
+#endif
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
@@ -72,9 +210,30 @@ int export_handle_set_ascii_codepage(
      const system_character_t *string,
      libcerror_error_t **error );
 
+int export_handle_set_export_format(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_job_initialize(
+     export_handle_job_t **job,
+     const system_character_t *key_path,
+     size_t key_path_length,
+     off64_t key_offset,
+     libcerror_error_t **error );
+
+int export_handle_job_free(
+     export_handle_job_t **job,
+     libcerror_error_t **error );
+
+int export_handle_set_number_of_threads(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
 int export_handle_print_data(
      export_handle_t *export_handle,
-     FILE *stream,
+     regftools_output_buffer_t *output_buffer,
      const uint8_t *data,
      size_t data_size,
      libcerror_error_t **error );
@@ -90,11 +249,107 @@ int export_handle_close_input(
 
 int export_handle_export_filetime(
      export_handle_t *export_handle,
+     regftools_output_buffer_t *output_buffer,
      const char *value_name,
      uint64_t value_64bit,
      libcerror_error_t **error );
 
+int export_handle_print_json_string(
+     export_handle_t *export_handle,
+     regftools_output_buffer_t *output_buffer,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error );
+
+int export_handle_export_key_text(
+     export_handle_t *export_handle,
+     regftools_output_buffer_t *output_buffer,
+     const system_character_t *key_path,
+     size_t key_path_length,
+     size_t name_index,
+     libregf_key_t *key,
+     libcerror_error_t **error );
+
+int export_handle_export_key_json_lines(
+     export_handle_t *export_handle,
+     regftools_output_buffer_t *output_buffer,
+     const uint8_t *utf8_key_path,
+     size_t utf8_key_path_length,
+     uint64_t last_written_time,
+     libregf_value_t **values,
+     int number_of_values,
+     libcerror_error_t **error );
+
+int export_handle_export_key_binary(
+     export_handle_t *export_handle,
+     regftools_output_buffer_t *output_buffer,
+     const uint8_t *utf8_key_path,
+     size_t utf8_key_path_length,
+     uint64_t last_written_time,
+     libregf_value_t **values,
+     int number_of_values,
+     libcerror_error_t **error );
+
+int export_handle_export_key_record(
+     export_handle_t *export_handle,
+     regftools_output_buffer_t *output_buffer,
+     const system_character_t *key_path,
+     size_t key_path_length,
+     libregf_key_t *key,
+     libcerror_error_t **error );
+
+int export_handle_export_key_information(
+     export_handle_t *export_handle,
+     regftools_output_buffer_t *output_buffer,
+     const system_character_t *key_path,
+     size_t key_path_length,
+     libregf_key_t *key,
+     system_character_t **sub_key_path,
+     size_t *sub_key_path_length,
+     libcerror_error_t **error );
+
 int export_handle_export_key(
+     export_handle_t *export_handle,
+     regftools_output_buffer_t *output_buffer,
+     const system_character_t *key_path,
+     size_t key_path_length,
+     libregf_key_t *key,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+#if defined( HAVE_REGFTOOLS_MULTI_THREAD_SUPPORT )
+
+int export_handle_append_job(
+     export_handle_t *export_handle,
+     export_handle_job_t *job,
+     libcerror_error_t **error );
+
+int export_handle_queue_key(
+     export_handle_t *export_handle,
+     const system_character_t *key_path,
+     size_t key_path_length,
+     libregf_key_t *key,
+     int key_depth,
+     libcerror_error_t **error );
+
+int export_handle_write_jobs(
+     export_handle_t *export_handle,
+     uint8_t wait_for_jobs,
+     libcerror_error_t **error );
+
+int export_handle_export_job(
+     export_handle_t *export_handle,
+     export_handle_job_t *job,
+     libcerror_error_t **error );
+
+int export_handle_thread_run(
+     export_handle_t *export_handle );
+
+int export_handle_stop_threads(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+int export_handle_export_key_with_threads(
      export_handle_t *export_handle,
      const system_character_t *key_path,
      size_t key_path_length,
@@ -102,6 +357,12 @@ int export_handle_export_key(
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
+#endif /* defined( HAVE_REGFTOOLS_MULTI_THREAD_SUPPORT ) */
+
+int export_handle_export_header(
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
 int export_handle_export_key_path(
      export_handle_t *export_handle,
      const system_character_t *key_path,
@@ -33,6 +33,7 @@
 #include "regftools_libfdatetime.h"
 #include "regftools_libregf.h"
 #include "regftools_libuna.h"
+#include "regftools_output.h"
 
 #define INFO_HANDLE_NOTIFY_STREAM	stdout
 
@@ -109,6 +110,20 @@ int info_handle_initialize(
 
 		goto on_error;
 	}
+	if( regftools_output_buffer_initialize(
+	     &( ( *info_handle )->notify_output_buffer ),
+	     INFO_HANDLE_NOTIFY_STREAM,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize notification output buffer.",
+		 function );
+
+		goto on_error;
+	}
 	( *info_handle )->ascii_codepage = LIBREGF_CODEPAGE_WINDOWS_1252;
 	( *info_handle )->notify_stream  = INFO_HANDLE_NOTIFY_STREAM;
 
@@ -117,6 +132,12 @@ int info_handle_initialize(
 on_error:
 	if( *info_handle != NULL )
 	{
+		if( ( *info_handle )->input_file != NULL )
+		{
+			libregf_file_free(
+			 &( ( *info_handle )->input_file ),
+			 NULL );
+		}
 		memory_free(
 		 *info_handle );
 
@@ -161,6 +182,35 @@ int info_handle_free(
 
 			result = -1;
 		}
+		if( ( *info_handle )->bodyfile_output_buffer != NULL )
+		{
+			if( regftools_output_buffer_free(
+			     &( ( *info_handle )->bodyfile_output_buffer ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free bodyfile output buffer.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( regftools_output_buffer_free(
+		     &( ( *info_handle )->notify_output_buffer ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free notification output buffer.",
+			 function );
+
+			result = -1;
+		}
 		memory_free(
 		 *info_handle );
 
@@ -273,6 +323,25 @@ int info_handle_set_bodyfile(
 
 		return( -1 );
 	}
+	if( regftools_output_buffer_initialize(
+	     &( info_handle->bodyfile_output_buffer ),
+	     info_handle->bodyfile_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize bodyfile output buffer.",
+		 function );
+
+		file_stream_close(
+		 info_handle->bodyfile_stream );
+
+		info_handle->bodyfile_stream = NULL;
+
+		return( -1 );
+	}
 	return( 1 );
 }
 
@@ -588,10 +657,38 @@ int info_handle_name_value_fprint(
 	}
 	escaped_value_string[ escaped_value_string_index ] = 0;
 
-	fprintf(
-	 info_handle->notify_stream,
-	 "%" PRIs_SYSTEM "",
-	 escaped_value_string );
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( regftools_output_buffer_printf(
+	     info_handle->notify_output_buffer,
+	     "%" PRIs_SYSTEM "",
+	     escaped_value_string ) < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print escaped value string.",
+		 function );
+
+		goto on_error;
+	}
+#else
+	if( regftools_output_buffer_append_data(
+	     info_handle->notify_output_buffer,
+	     (uint8_t *) escaped_value_string,
+	     escaped_value_string_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append escaped value string.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 
 	memory_free(
 	 escaped_value_string );
@@ -916,10 +1013,38 @@ int info_handle_bodyfile_name_value_fprint(
 	}
 	escaped_value_string[ escaped_value_string_index ] = 0;
 
-	fprintf(
-	 info_handle->bodyfile_stream,
-	 "%" PRIs_SYSTEM "",
-	 escaped_value_string );
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( regftools_output_buffer_printf(
+	     info_handle->bodyfile_output_buffer,
+	     "%" PRIs_SYSTEM "",
+	     escaped_value_string ) < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print escaped value string.",
+		 function );
+
+		goto on_error;
+	}
+#else
+	if( regftools_output_buffer_append_data(
+	     info_handle->bodyfile_output_buffer,
+	     (uint8_t *) escaped_value_string,
+	     escaped_value_string_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append escaped value string.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 
 	memory_free(
 	 escaped_value_string );
@@ -993,9 +1118,20 @@ int info_handle_bodyfile_key_value_fprint(
 	/* Colums in a Sleuthkit 3.x and later bodyfile
 	 * MD5|name|inode|mode_as_string|UID|GID|size|atime|mtime|ctime|crtime
 	 */
-	fprintf(
-	 info_handle->bodyfile_stream,
-	 "0|" );
+	if( regftools_output_buffer_append_string(
+	     info_handle->bodyfile_output_buffer,
+	     "0|",
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print MD5 column.",
+		 function );
+
+		return( -1 );
+	}
 
 	if( key_path != NULL )
 	{
@@ -1033,12 +1169,76 @@ int info_handle_bodyfile_key_value_fprint(
 			return( -1 );
 		}
 	}
-	fprintf(
-	 info_handle->bodyfile_stream,
-	 "|%" PRIi64 "|d/drwxrwxrwx|0|0|0|0.0|%.9f|0.0|0.0\n",
-	 key_offset,
-	 (double) ( modification_time - 116444736000000000L ) / 10000000 );
+	if( regftools_output_buffer_append_string(
+	     info_handle->bodyfile_output_buffer,
+	     "|",
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print name column.",
+		 function );
+
+		return( -1 );
+	}
+	if( regftools_output_buffer_append_signed_decimal(
+	     info_handle->bodyfile_output_buffer,
+	     (int64_t) key_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print inode column.",
+		 function );
 
+		return( -1 );
+	}
+	if( regftools_output_buffer_append_string(
+	     info_handle->bodyfile_output_buffer,
+	     "|d/drwxrwxrwx|0|0|0|0.0|",
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print mode, UID, GID, size and atime columns.",
+		 function );
+
+		return( -1 );
+	}
+	if( regftools_output_buffer_append_filetime_as_posix_time(
+	     info_handle->bodyfile_output_buffer,
+	     modification_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print mtime column.",
+		 function );
+
+		return( -1 );
+	}
+	if( regftools_output_buffer_append_string(
+	     info_handle->bodyfile_output_buffer,
+	     "|0.0|0.0\n",
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print ctime and crtime columns.",
+		 function );
+
+		return( -1 );
+	}
 	return( 1 );
 }
 
@@ -1210,9 +1410,20 @@ int info_handle_key_fprint(
 					goto on_error;
 				}
 			}
-			fprintf(
-			 info_handle->notify_stream,
-			 "\n" );
+			if( regftools_output_buffer_append_string(
+			     info_handle->notify_output_buffer,
+			     "\n",
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print end of line.",
+				 function );
+
+				goto on_error;
+			}
 		}
 	}
 	if( libregf_key_get_number_of_values(
@@ -1324,10 +1535,47 @@ int info_handle_key_fprint(
 			}
 			if( info_handle->bodyfile_stream == NULL )
 			{
-				fprintf(
-				 info_handle->notify_stream,
-				 "\t%" PRIs_SYSTEM "\n",
-				 value_name );
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+				if( regftools_output_buffer_printf(
+				     info_handle->notify_output_buffer,
+				     "\t%" PRIs_SYSTEM "\n",
+				     value_name ) < 0 )
+				{
+					result = -1;
+				}
+#else
+				result = regftools_output_buffer_append_string(
+				          info_handle->notify_output_buffer,
+				          "\t",
+				          error );
+
+				if( result == 1 )
+				{
+					result = regftools_output_buffer_append_data(
+					          info_handle->notify_output_buffer,
+					          (uint8_t *) value_name,
+					          value_name_size - 1,
+					          error );
+				}
+				if( result == 1 )
+				{
+					result = regftools_output_buffer_append_string(
+					          info_handle->notify_output_buffer,
+					          "\n",
+					          error );
+				}
+#endif
+				if( result != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+					 "%s: unable to print value name.",
+					 function );
+
+					goto on_error;
+				}
 			}
 			memory_free(
 			 value_name );
@@ -1336,9 +1584,20 @@ int info_handle_key_fprint(
 		}
 		else if( info_handle->bodyfile_stream == NULL )
 		{
-			fprintf(
-			 info_handle->notify_stream,
-			 "\t(default)\n" );
+			if( regftools_output_buffer_append_string(
+			     info_handle->notify_output_buffer,
+			     "\t(default)\n",
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print default value name.",
+				 function );
+
+				goto on_error;
+			}
 		}
 		if( libregf_value_free(
 		     &value,
@@ -1549,13 +1808,20 @@ int info_handle_key_value_hierarchy_fprint(
 	}
 	if( info_handle->bodyfile_stream == NULL )
 	{
-		fprintf(
-		 info_handle->notify_stream,
-		 "Windows NT Registry File information:\n\n" );
+		if( regftools_output_buffer_append_string(
+		     info_handle->notify_output_buffer,
+		     "Windows NT Registry File information:\n\nKey and value hierarchy:\n",
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print header.",
+			 function );
 
-		fprintf(
-		 info_handle->notify_stream,
-		 "Key and value hierarchy:\n" );
+			goto on_error;
+		}
 	}
 	result = libregf_file_get_root_key(
 	          info_handle->input_file,
@@ -1607,9 +1873,49 @@ int info_handle_key_value_hierarchy_fprint(
 	}
 	if( info_handle->bodyfile_stream == NULL )
 	{
-		fprintf(
-		 info_handle->notify_stream,
-		 "\n" );
+		if( regftools_output_buffer_append_string(
+		     info_handle->notify_output_buffer,
+		     "\n",
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print end of line.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( info_handle->bodyfile_output_buffer != NULL )
+	{
+		if( regftools_output_buffer_flush(
+		     info_handle->bodyfile_output_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush bodyfile output buffer.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( regftools_output_buffer_flush(
+	     info_handle->notify_output_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush notification output buffer.",
+		 function );
+
+		goto on_error;
 	}
 	return( 1 );
 
@@ -1620,6 +1926,18 @@ on_error:
 		 &root_key,
 		 NULL );
 	}
+	/* Write the output of the keys that were printed before the error
+	 */
+	if( info_handle->bodyfile_output_buffer != NULL )
+	{
+		regftools_output_buffer_flush(
+		 info_handle->bodyfile_output_buffer,
+		 NULL );
+	}
+	regftools_output_buffer_flush(
+	 info_handle->notify_output_buffer,
+	 NULL );
+
 	return( -1 );
 }
 
@@ -28,6 +28,7 @@
 
 #include "regftools_libcerror.h"
 #include "regftools_libregf.h"
+#include "regftools_output.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -45,10 +46,18 @@ struct info_handle
 	 */
 	FILE *bodyfile_stream;
 
+	/* The bodyfile output buffer
+	 */
+	regftools_output_buffer_t *bodyfile_output_buffer;
+
 	/* The notification output stream
 	 */
 	FILE *notify_stream;
 
+	/* The notification output buffer
+	 */
+	regftools_output_buffer_t *notify_output_buffer;
+
 	/* The ascii codepage
 	 */
 	int ascii_codepage;
@@ -45,6 +45,7 @@
 
 /* Creates a file entry
  * Make sure the value file_entry is referencing, is set to NULL
+ * The file entry takes over the key and value
  * Returns 1 if successful or -1 on error
  */
 int mount_file_entry_initialize(
@@ -241,22 +242,18 @@ int mount_file_entry_free(
 		}
 		if( ( *file_entry )->regf_key != NULL )
 		{
-			if( ( ( *file_entry )->type != MOUNT_FILE_ENTRY_TYPE_CLASS_NAME )
-			 && ( ( *file_entry )->type != MOUNT_FILE_ENTRY_TYPE_VALUE ) )
+			if( libregf_key_free(
+			     &( ( *file_entry )->regf_key ),
+			     error ) != 1 )
 			{
-				if( libregf_key_free(
-				     &( ( *file_entry )->regf_key ),
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-					 "%s: unable to free key.",
-					 function );
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free key.",
+				 function );
 
-					result = -1;
-				}
+				result = -1;
 			}
 		}
 		if( ( *file_entry )->regf_value != NULL )
@@ -834,6 +831,7 @@ int mount_file_entry_get_sub_file_entry_by_index(
 	static char *function                        = "mount_file_entry_get_sub_file_entry_by_index";
 	size_t class_name_size                       = 0;
 	size_t filename_size                         = 0;
+	off64_t key_offset                           = 0;
 	int classname_sub_file_entry_index           = -1;
 	int number_of_sub_keys                       = 0;
 	int number_of_values                         = 0;
@@ -1055,7 +1053,43 @@ int mount_file_entry_get_sub_file_entry_by_index(
 
 				goto on_error;
 			}
-			sub_regf_key = file_entry->regf_key;
+		}
+	}
+	if( sub_regf_key == NULL )
+	{
+		/* The class name, value and values file entries are given a key
+		 * of their own, since a file entry frees its key
+		 */
+		if( libregf_key_get_offset(
+		     file_entry->regf_key,
+		     &key_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key offset.",
+			 function );
+
+			goto on_error;
+		}
+		if( mount_file_system_get_key_by_offset(
+		     file_entry->file_system,
+		     key_offset,
+		     &sub_regf_key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 key_offset,
+			 key_offset );
+
+			goto on_error;
 		}
 	}
 	if( mount_file_entry_initialize(
@@ -1101,8 +1135,7 @@ on_error:
 		 &regf_value,
 		 NULL );
 	}
-	if( ( sub_regf_key != NULL )
-	 && ( sub_regf_key != file_entry->regf_key ) )
+	if( sub_regf_key != NULL )
 	{
 		libregf_key_free(
 		 &sub_regf_key,
@@ -1111,6 +1144,391 @@ on_error:
 	return( -1 );
 }
 
+/* Retrieves the sub file entry for the specific name
+ * Returns 1 if successful, 0 if no such sub file entry or -1 on error
+ */
+int mount_file_entry_get_sub_file_entry_by_name(
+     mount_file_entry_t *file_entry,
+     const system_character_t *name,
+     size_t name_length,
+     mount_file_entry_t **sub_file_entry,
+     libcerror_error_t **error )
+{
+	libregf_key_t *sub_regf_key = NULL;
+	libregf_value_t *regf_value = NULL;
+	static char *function       = "mount_file_entry_get_sub_file_entry_by_name";
+	size_t class_name_size      = 0;
+	off64_t key_offset          = 0;
+	int number_of_values        = 0;
+	int result                  = 0;
+	int sub_file_entry_type     = MOUNT_FILE_ENTRY_TYPE_UNKNOWN;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name_length == 0 )
+	 || ( name_length > (size_t) ( SSIZE_MAX - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( sub_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sub_file_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sub file entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_entry->type != MOUNT_FILE_ENTRY_TYPE_KEY )
+	 && ( file_entry->type != MOUNT_FILE_ENTRY_TYPE_VALUES ) )
+	{
+		return( 0 );
+	}
+	if( file_entry->type == MOUNT_FILE_ENTRY_TYPE_VALUES )
+	{
+		result = mount_file_system_get_value_by_filename(
+		          file_entry->file_system,
+		          file_entry->regf_key,
+		          name,
+		          name_length,
+		          &regf_value,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		sub_file_entry_type = MOUNT_FILE_ENTRY_TYPE_VALUE;
+	}
+	else
+	{
+		if( name_length == 8 )
+		{
+#if defined( WINAPI )
+			result = system_string_compare_no_case(
+			          name,
+			          _SYSTEM_STRING( "(values)" ),
+			          8 );
+#else
+			result = system_string_compare(
+			          name,
+			          _SYSTEM_STRING( "(values)" ),
+			          8 );
+#endif
+			if( result == 0 )
+			{
+				if( libregf_key_get_number_of_values(
+				     file_entry->regf_key,
+				     &number_of_values,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve number of values.",
+					 function );
+
+					goto on_error;
+				}
+				if( number_of_values > 0 )
+				{
+					sub_file_entry_type = MOUNT_FILE_ENTRY_TYPE_VALUES;
+				}
+			}
+		}
+		else if( name_length == 11 )
+		{
+#if defined( WINAPI )
+			result = system_string_compare_no_case(
+			          name,
+			          _SYSTEM_STRING( "(classname)" ),
+			          11 );
+#else
+			result = system_string_compare(
+			          name,
+			          _SYSTEM_STRING( "(classname)" ),
+			          11 );
+#endif
+			if( result == 0 )
+			{
+				result = libregf_key_get_class_name_size(
+				          file_entry->regf_key,
+				          &class_name_size,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve class name size.",
+					 function );
+
+					goto on_error;
+				}
+				else if( result != 0 )
+				{
+					sub_file_entry_type = MOUNT_FILE_ENTRY_TYPE_CLASS_NAME;
+				}
+			}
+		}
+		if( sub_file_entry_type == MOUNT_FILE_ENTRY_TYPE_UNKNOWN )
+		{
+			result = mount_file_system_get_sub_key_by_filename(
+			          file_entry->file_system,
+			          file_entry->regf_key,
+			          name,
+			          name_length,
+			          &sub_regf_key,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sub key.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				return( 0 );
+			}
+			sub_file_entry_type = MOUNT_FILE_ENTRY_TYPE_KEY;
+		}
+	}
+	if( sub_regf_key == NULL )
+	{
+		/* The class name, value and values file entries are given a key
+		 * of their own, since a file entry frees its key
+		 */
+		if( libregf_key_get_offset(
+		     file_entry->regf_key,
+		     &key_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key offset.",
+			 function );
+
+			goto on_error;
+		}
+		if( mount_file_system_get_key_by_offset(
+		     file_entry->file_system,
+		     key_offset,
+		     &sub_regf_key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve key at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 key_offset,
+			 key_offset );
+
+			goto on_error;
+		}
+	}
+	if( mount_file_entry_initialize(
+	     sub_file_entry,
+	     file_entry->file_system,
+	     name,
+	     name_length,
+	     sub_file_entry_type,
+	     sub_regf_key,
+	     regf_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize sub file entry.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( regf_value != NULL )
+	{
+		libregf_value_free(
+		 &regf_value,
+		 NULL );
+	}
+	if( sub_regf_key != NULL )
+	{
+		libregf_key_free(
+		 &sub_regf_key,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the inode number
+ * The lower 32-bit contain the file offset of the key (nk) cell and the upper 32-bit
+ * contain the file offset of the value (vk) cell for a value file entry or
+ * the file entry type otherwise
+ * Returns 1 if successful or -1 on error
+ */
+int mount_file_entry_get_inode_number(
+     mount_file_entry_t *file_entry,
+     uint64_t *inode_number,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_entry_get_inode_number";
+	off64_t key_offset    = 0;
+	off64_t value_offset  = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode_number == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode number.",
+		 function );
+
+		return( -1 );
+	}
+	if( libregf_key_get_offset(
+	     file_entry->regf_key,
+	     &key_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve key offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_offset <= 0 )
+	 || ( key_offset > (off64_t) UINT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid key offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_entry->type == MOUNT_FILE_ENTRY_TYPE_VALUE )
+	{
+		if( libregf_value_get_offset(
+		     file_entry->regf_value,
+		     &value_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value offset.",
+			 function );
+
+			return( -1 );
+		}
+		/* The value offset must not overlap with the file entry types
+		 */
+		if( ( value_offset <= MOUNT_FILE_ENTRY_TYPE_VALUES )
+		 || ( value_offset > (off64_t) UINT32_MAX ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid value offset value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		*inode_number = ( (uint64_t) value_offset << 32 ) | (uint64_t) key_offset;
+	}
+	else
+	{
+		*inode_number = ( (uint64_t) file_entry->type << 32 ) | (uint64_t) key_offset;
+	}
+	return( 1 );
+}
+
 /* Reads data at a specific offset
  * Returns the number of bytes read or -1 on error
  */
@@ -1169,41 +1587,47 @@ ssize_t mount_file_entry_read_buffer_at_offset(
 
 		return( -1 );
 	}
-	if( file_entry->value_data_size == 0 )
+	if( file_entry->type == MOUNT_FILE_ENTRY_TYPE_VALUE )
 	{
-		if( file_entry->type == MOUNT_FILE_ENTRY_TYPE_CLASS_NAME )
+		/* Read the value data directly to prevent large values being read entirely per read call
+		 */
+		read_count = libregf_value_read_buffer_at_offset(
+		              file_entry->regf_value,
+		              (uint8_t *) buffer,
+		              buffer_size,
+		              offset,
+		              error );
+
+		if( read_count == -1 )
 		{
-			if( libregf_key_get_class_name_size(
-			     file_entry->regf_key,
-			     &( file_entry->value_data_size ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve class name size.",
-				 function );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read value data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 offset,
+			 offset );
 
-				return( -1 );
-			}
+			return( -1 );
 		}
-		else if( file_entry->type == MOUNT_FILE_ENTRY_TYPE_VALUE )
+		return( read_count );
+	}
+	if( file_entry->value_data_size == 0 )
+	{
+		if( libregf_key_get_class_name_size(
+		     file_entry->regf_key,
+		     &( file_entry->value_data_size ),
+		     error ) != 1 )
 		{
-			if( libregf_value_get_value_data_size(
-			     file_entry->regf_value,
-			     &( file_entry->value_data_size ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve value data size.",
-				 function );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve class name size.",
+			 function );
 
-				return( -1 );
-			}
+			return( -1 );
 		}
 	}
 	if( file_entry->value_data_size == 0 )
@@ -1237,51 +1661,25 @@ ssize_t mount_file_entry_read_buffer_at_offset(
 
 			return( -1 );
 		}
-		if( file_entry->type == MOUNT_FILE_ENTRY_TYPE_CLASS_NAME )
-		{
-			if( libregf_key_get_class_name(
-			     file_entry->regf_key,
-			     file_entry->value_data,
-			     file_entry->value_data_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve class name.",
-				 function );
-
-				memory_free(
-				 file_entry->value_data );
-
-				file_entry->value_data = NULL;
-
-				return( -1 );
-			}
-		}
-		else if( file_entry->type == MOUNT_FILE_ENTRY_TYPE_VALUE )
+		if( libregf_key_get_class_name(
+		     file_entry->regf_key,
+		     file_entry->value_data,
+		     file_entry->value_data_size,
+		     error ) != 1 )
 		{
-			if( libregf_value_get_value_data(
-			     file_entry->regf_value,
-			     file_entry->value_data,
-			     file_entry->value_data_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve value data.",
-				 function );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve class name.",
+			 function );
 
-				memory_free(
-				 file_entry->value_data );
+			memory_free(
+			 file_entry->value_data );
 
-				file_entry->value_data = NULL;
+			file_entry->value_data = NULL;
 
-				return( -1 );
-			}
+			return( -1 );
 		}
 	}
 	if( offset < (off64_t) file_entry->value_data_size )
@@ -1296,7 +1694,7 @@ ssize_t mount_file_entry_read_buffer_at_offset(
 		}
 		if( memory_copy(
 		     buffer,
-		     file_entry->value_data,
+		     &( file_entry->value_data[ offset ] ),
 		     (size_t) read_count ) == NULL )
 		{
 			libcerror_error_set(
@@ -42,6 +42,10 @@ enum MOUNT_FILE_ENTRY_TYPES
 	MOUNT_FILE_ENTRY_TYPE_VALUES
 };
 
+/* The inode number of the root file entry
+ */
+#define MOUNT_FILE_ENTRY_ROOT_INODE_NUMBER	1
+
 typedef struct mount_file_entry mount_file_entry_t;
 
 struct mount_file_entry
@@ -145,6 +149,18 @@ int mount_file_entry_get_sub_file_entry_by_index(
      mount_file_entry_t **sub_file_entry,
      libcerror_error_t **error );
 
+int mount_file_entry_get_sub_file_entry_by_name(
+     mount_file_entry_t *file_entry,
+     const system_character_t *name,
+     size_t name_length,
+     mount_file_entry_t **sub_file_entry,
+     libcerror_error_t **error );
+
+int mount_file_entry_get_inode_number(
+     mount_file_entry_t *file_entry,
+     uint64_t *inode_number,
+     libcerror_error_t **error );
+
 ssize_t mount_file_entry_read_buffer_at_offset(
          mount_file_entry_t *file_entry,
          void *buffer,
@@ -478,6 +478,152 @@ on_error:
 	return( -1 );
 }
 
+/* Retrieves the key at a specific offset
+ * Returns 1 if successful, 0 if no such key or -1 on error
+ */
+int mount_file_system_get_key_by_offset(
+     mount_file_system_t *file_system,
+     off64_t key_offset,
+     libregf_key_t **regf_key,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_system_get_key_by_offset";
+	int result            = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	result = libregf_file_get_key_by_offset(
+	          file_system->regf_file,
+	          key_offset,
+	          regf_key,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve key at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 key_offset,
+		 key_offset );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the sub key for the specific filename
+ * Returns 1 if successful, 0 if no such sub key or -1 on error
+ */
+int mount_file_system_get_sub_key_by_filename(
+     mount_file_system_t *file_system,
+     libregf_key_t *regf_key,
+     const system_character_t *filename,
+     size_t filename_length,
+     libregf_key_t **sub_regf_key,
+     libcerror_error_t **error )
+{
+	system_character_t *key_name = NULL;
+	static char *function        = "mount_file_system_get_sub_key_by_filename";
+	size_t key_name_length       = 0;
+	size_t key_name_size         = 0;
+	int result                   = 0;
+
+	if( file_system == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system.",
+		 function );
+
+		return( -1 );
+	}
+	/* Key names are escaped in the same way as value names
+	 */
+	if( mount_file_system_get_value_name_from_filename(
+	     file_system,
+	     filename,
+	     filename_length,
+	     &key_name,
+	     &key_name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve key name from filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( key_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing key name.",
+		 function );
+
+		goto on_error;
+	}
+	key_name_length = system_string_length(
+	                   key_name );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libregf_key_get_sub_key_by_utf16_name(
+	          regf_key,
+	          (uint16_t *) key_name,
+	          key_name_length,
+	          sub_regf_key,
+	          error );
+#else
+	result = libregf_key_get_sub_key_by_utf8_name(
+	          regf_key,
+	          (uint8_t *) key_name,
+	          key_name_length,
+	          sub_regf_key,
+	          error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub key by name.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 key_name );
+
+	return( result );
+
+on_error:
+	if( key_name != NULL )
+	{
+		memory_free(
+		 key_name );
+	}
+	return( -1 );
+}
+
 /* Retrieves the value name from the filename
  * Returns 1 if successful or -1 on error
  */
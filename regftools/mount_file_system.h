@@ -79,6 +79,20 @@ int mount_file_system_get_key_by_path(
      libregf_key_t **regf_key,
      libcerror_error_t **error );
 
+int mount_file_system_get_key_by_offset(
+     mount_file_system_t *file_system,
+     off64_t key_offset,
+     libregf_key_t **regf_key,
+     libcerror_error_t **error );
+
+int mount_file_system_get_sub_key_by_filename(
+     mount_file_system_t *file_system,
+     libregf_key_t *regf_key,
+     const system_character_t *filename,
+     size_t filename_length,
+     libregf_key_t **sub_regf_key,
+     libcerror_error_t **error );
+
 int mount_file_system_get_value_name_from_filename(
      mount_file_system_t *file_system,
      const system_character_t *filename,
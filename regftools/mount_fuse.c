@@ -37,6 +37,7 @@
 
 #include "mount_fuse.h"
 #include "mount_handle.h"
+#include "mount_inode_table.h"
 #include "regftools_libcerror.h"
 #include "regftools_libcnotify.h"
 #include "regftools_libregf.h"
@@ -121,108 +122,27 @@ int mount_fuse_set_stat_info(
 	return( 1 );
 }
 
-/* Fills a directory entry
+/* Sets the values in a stat info structure from an inode
  * Returns 1 if successful or -1 on error
  */
-int mount_fuse_filldir(
-     void *buffer,
-     fuse_fill_dir_t filler,
-     const char *name,
+int mount_fuse_set_stat_info_from_inode(
      struct stat *stat_info,
-     mount_file_entry_t *file_entry,
+     mount_inode_t *inode,
      libcerror_error_t **error )
 {
-	static char *function      = "mount_fuse_filldir";
-	size64_t file_size         = 0;
-	uint64_t access_time       = 0;
-	uint64_t inode_change_time = 0;
-	uint64_t modification_time = 0;
-	uint16_t file_mode         = 0;
+	static char *function = "mount_fuse_set_stat_info_from_inode";
 
-	if( filler == NULL )
+	if( stat_info == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filler.",
+		 "%s: invalid stat info.",
 		 function );
 
 		return( -1 );
 	}
-	if( file_entry != NULL )
-	{
-		if( mount_file_entry_get_size(
-		     file_entry,
-		     &file_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve file entry size.",
-			 function );
-
-			return( -1 );
-		}
-		if( mount_file_entry_get_file_mode(
-		     file_entry,
-		     &file_mode,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve file mode.",
-			 function );
-
-			return( -1 );
-		}
-		if( mount_file_entry_get_access_time(
-		     file_entry,
-		     &access_time,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve access time.",
-			 function );
-
-			return( -1 );
-		}
-		if( mount_file_entry_get_modification_time(
-		     file_entry,
-		     &modification_time,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve modification time.",
-			 function );
-
-			return( -1 );
-		}
-		if( mount_file_entry_get_inode_change_time(
-		     file_entry,
-		     &inode_change_time,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve inode change time.",
-			 function );
-
-			return( -1 );
-		}
-	}
 	if( memory_set(
 	     stat_info,
 	     0,
@@ -237,13 +157,60 @@ int mount_fuse_filldir(
 
 		return( -1 );
 	}
+	if( inode == NULL )
+	{
+		return( 1 );
+	}
 	if( mount_fuse_set_stat_info(
 	     stat_info,
-	     file_size,
-	     file_mode,
-	     (int64_t) access_time,
-	     (int64_t) inode_change_time,
-	     (int64_t) modification_time,
+	     inode->size,
+	     inode->file_mode,
+	     (int64_t) inode->access_time,
+	     (int64_t) inode->inode_change_time,
+	     (int64_t) inode->modification_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set stat info.",
+		 function );
+
+		return( -1 );
+	}
+	stat_info->st_ino = (ino_t) inode->inode_number;
+
+	return( 1 );
+}
+
+/* Fills a directory entry
+ * Returns 1 if successful or -1 on error
+ */
+int mount_fuse_filldir(
+     void *buffer,
+     fuse_fill_dir_t filler,
+     const char *name,
+     struct stat *stat_info,
+     mount_inode_t *inode,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_fuse_filldir";
+
+	if( filler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filler.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_fuse_set_stat_info_from_inode(
+	     stat_info,
+	     inode,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -256,12 +223,15 @@ int mount_fuse_filldir(
 		return( -1 );
 	}
 #if defined( HAVE_LIBFUSE3 )
+	/* The stat info contains all the attributes hence the kernel does not
+	 * need to look up the entry again when reading the directory with readdirplus
+	 */
 	if( filler(
 	     buffer,
 	     name,
 	     stat_info,
 	     0,
-	     0 ) == 1 )
+	     ( inode != NULL ) ? FUSE_FILL_DIR_PLUS : 0 ) == 1 )
 #else
 	if( filler(
 	     buffer,
@@ -579,6 +549,7 @@ int mount_fuse_opendir(
      struct fuse_file_info *file_info )
 {
 	libcerror_error_t *error = NULL;
+	mount_inode_t *inode     = NULL;
 	static char *function    = "mount_fuse_opendir";
 	int result               = 0;
 
@@ -630,17 +601,17 @@ int mount_fuse_opendir(
 
 		goto on_error;
 	}
-	if( mount_handle_get_file_entry_by_path(
+	if( mount_handle_get_inode_by_path(
 	     regfmount_mount_handle,
 	     path,
-	     (mount_file_entry_t **) &( file_info->fh ),
+	     &inode,
 	     &error ) != 1 )
 	{
 		libcerror_error_set(
 		 &error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file entry for path: %s.",
+		 "%s: unable to retrieve inode for path: %s.",
 		 function,
 		 path );
 
@@ -648,6 +619,10 @@ int mount_fuse_opendir(
 
 		goto on_error;
 	}
+	/* The inode is managed by the inode table and remains valid while mounted
+	 */
+	file_info->fh = (uint64_t) (intptr_t) inode;
+
 	return( 0 );
 
 on_error:
@@ -670,7 +645,7 @@ int mount_fuse_readdir(
      void *buffer,
      fuse_fill_dir_t filler,
      off_t offset REGFTOOLS_ATTRIBUTE_UNUSED,
-     struct fuse_file_info *file_info REGFTOOLS_ATTRIBUTE_UNUSED,
+     struct fuse_file_info *file_info,
      enum fuse_readdir_flags flags REGFTOOLS_ATTRIBUTE_UNUSED )
 #else
 int mount_fuse_readdir(
@@ -678,19 +653,16 @@ int mount_fuse_readdir(
      void *buffer,
      fuse_fill_dir_t filler,
      off_t offset REGFTOOLS_ATTRIBUTE_UNUSED,
-     struct fuse_file_info *file_info REGFTOOLS_ATTRIBUTE_UNUSED )
+     struct fuse_file_info *file_info )
 #endif
 {
-	struct stat *stat_info                = NULL;
-	libcerror_error_t *error              = NULL;
-	mount_file_entry_t *parent_file_entry = NULL;
-	mount_file_entry_t *sub_file_entry    = NULL;
-	static char *function                 = "mount_fuse_readdir";
-	char *name                            = NULL;
-	size_t name_size                      = 0;
-	int number_of_sub_file_entries        = 0;
-	int result                            = 0;
-	int sub_file_entry_index              = 0;
+	struct stat *stat_info   = NULL;
+	libcerror_error_t *error = NULL;
+	mount_inode_t *inode     = NULL;
+	mount_inode_t *sub_inode = NULL;
+	static char *function    = "mount_fuse_readdir";
+	int result               = 0;
+	int sub_inode_index      = 0;
 
 	REGFTOOLS_UNREFERENCED_PARAMETER( offset )
 
@@ -746,6 +718,26 @@ int mount_fuse_readdir(
 
 		goto on_error;
 	}
+	inode = (mount_inode_t *) (intptr_t) file_info->fh;
+
+	/* The directory listing is read once and then served from the inode table
+	 */
+	if( mount_handle_read_sub_inodes(
+	     regfmount_mount_handle,
+	     inode,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to read sub inodes.",
+		 function );
+
+		result = -EIO;
+
+		goto on_error;
+	}
 	stat_info = memory_allocate_structure(
 	             struct stat );
 
@@ -767,7 +759,7 @@ int mount_fuse_readdir(
 	     filler,
 	     ".",
 	     stat_info,
-	     (mount_file_entry_t *) file_info->fh,
+	     inode,
 	     &error ) != 1 )
 	{
 		libcerror_error_set(
@@ -781,30 +773,12 @@ int mount_fuse_readdir(
 
 		goto on_error;
 	}
-	result = mount_file_entry_get_parent_file_entry(
-	          (mount_file_entry_t *) file_info->fh,
-	          &parent_file_entry,
-	          &error );
-
-	if( result == -1 )
-	{
-		libcerror_error_set(
-		 &error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve parent file entry.",
-		 function );
-
-		result = -EIO;
-
-		goto on_error;
-	}
 	if( mount_fuse_filldir(
 	     buffer,
 	     filler,
 	     "..",
 	     stat_info,
-	     parent_file_entry,
+	     inode->parent_inode,
 	     &error ) != 1 )
 	{
 		libcerror_error_set(
@@ -818,145 +792,27 @@ int mount_fuse_readdir(
 
 		goto on_error;
 	}
-	if( mount_file_entry_free(
-	     &parent_file_entry,
-	     &error ) != 1 )
-	{
-		libcerror_error_set(
-		 &error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free parent file entry.",
-		 function );
-
-		result = -EIO;
-
-		goto on_error;
-	}
-	if( mount_file_entry_get_number_of_sub_file_entries(
-	     (mount_file_entry_t *) file_info->fh,
-	     &number_of_sub_file_entries,
-	     &error ) != 1 )
-	{
-		libcerror_error_set(
-		 &error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of sub file entries.",
-		 function );
-
-		result = -EIO;
-
-		goto on_error;
-	}
-	for( sub_file_entry_index = 0;
-	     sub_file_entry_index < number_of_sub_file_entries;
-	     sub_file_entry_index++ )
+	for( sub_inode_index = 0;
+	     sub_inode_index < inode->number_of_sub_inodes;
+	     sub_inode_index++ )
 	{
-		if( mount_file_entry_get_sub_file_entry_by_index(
-		     (mount_file_entry_t *) file_info->fh,
-		     sub_file_entry_index,
-		     &sub_file_entry,
-		     &error ) != 1 )
-		{
-			libcerror_error_set(
-			 &error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve sub file entry: %d.",
-			 function,
-			 sub_file_entry_index );
-
-			result = -EIO;
-
-			goto on_error;
-		}
-		if( mount_file_entry_get_name_size(
-		     sub_file_entry,
-		     &name_size,
-		     &error ) != 1 )
-		{
-			libcerror_error_set(
-			 &error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve sub file entry: %d name size.",
-			 function,
-			 sub_file_entry_index );
-
-			result = -EIO;
-
-			goto on_error;
-		}
-		name = narrow_string_allocate(
-		        name_size );
+		sub_inode = inode->sub_inodes[ sub_inode_index ];
 
-		if( name == NULL )
-		{
-			libcerror_error_set(
-			 &error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create sub file entry: %d name.",
-			 function );
-
-			result = -EIO;
-
-			goto on_error;
-		}
-		if( mount_file_entry_get_name(
-		     sub_file_entry,
-		     name,
-		     name_size,
-		     &error ) != 1 )
-		{
-			libcerror_error_set(
-			 &error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve sub file entry: %d name.",
-			 function,
-			 sub_file_entry_index );
-
-			result = -EIO;
-
-			goto on_error;
-		}
 		if( mount_fuse_filldir(
 		     buffer,
 		     filler,
-		     name,
+		     &( sub_inode->path[ sub_inode->name_index ] ),
 		     stat_info,
-		     sub_file_entry,
+		     sub_inode,
 		     &error ) != 1 )
 		{
 			libcerror_error_set(
 			 &error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set directory entry.",
-			 function );
-
-			result = -EIO;
-
-			goto on_error;
-		}
-		memory_free(
-		 name );
-
-		name = NULL;
-
-		if( mount_file_entry_free(
-		     &sub_file_entry,
-		     &error ) != 1 )
-		{
-			libcerror_error_set(
-			 &error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free sub file entry: %d.",
+			 "%s: unable to set directory entry: %d.",
 			 function,
-			 sub_file_entry_index );
+			 sub_inode_index );
 
 			result = -EIO;
 
@@ -976,23 +832,6 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( name != NULL )
-	{
-		memory_free(
-		 name );
-	}
-	if( sub_file_entry != NULL )
-	{
-		mount_file_entry_free(
-		 &sub_file_entry,
-		 NULL );
-	}
-	if( parent_file_entry != NULL )
-	{
-		mount_file_entry_free(
-		 &parent_file_entry,
-		 NULL );
-	}
 	if( stat_info != NULL )
 	{
 		memory_free(
@@ -1078,15 +917,10 @@ int mount_fuse_getattr(
      struct stat *stat_info )
 #endif
 {
-	libcerror_error_t *error       = NULL;
-	mount_file_entry_t *file_entry = NULL;
-	static char *function          = "mount_fuse_getattr";
-	size64_t file_size             = 0;
-	uint64_t access_time           = 0;
-	uint64_t inode_change_time     = 0;
-	uint64_t modification_time     = 0;
-	uint16_t file_mode             = 0;
-	int result                     = 0;
+	libcerror_error_t *error = NULL;
+	mount_inode_t *inode     = NULL;
+	static char *function    = "mount_fuse_getattr";
+	int result               = 0;
 
 #if defined( HAVE_LIBFUSE3 )
 	REGFTOOLS_UNREFERENCED_PARAMETER( file_info )
@@ -1127,26 +961,13 @@ int mount_fuse_getattr(
 
 		goto on_error;
 	}
-	if( memory_set(
-	     stat_info,
-	     0,
-	     sizeof( struct stat ) ) == NULL )
-	{
-		libcerror_error_set(
-		 &error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear stat info.",
-		 function );
-
-		result = errno;
-
-		goto on_error;
-	}
-	result = mount_handle_get_file_entry_by_path(
+	/* The attributes are cached in the inode table hence the path
+	 * is only resolved the first time it is requested
+	 */
+	result = mount_handle_get_inode_by_path(
 	          regfmount_mount_handle,
 	          path,
-	          &file_entry,
+	          &inode,
 	          &error );
 
 	if( result == -1 )
@@ -1155,7 +976,7 @@ int mount_fuse_getattr(
 		 &error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value for: %s.",
+		 "%s: unable to retrieve inode for: %s.",
 		 function,
 		 path );
 
@@ -1167,93 +988,9 @@ int mount_fuse_getattr(
 	{
 		return( -ENOENT );
 	}
-	if( mount_file_entry_get_size(
-	     file_entry,
-	     &file_size,
-	     &error ) != 1 )
-	{
-		libcerror_error_set(
-		 &error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file entry size.",
-		 function );
-
-		result = -EIO;
-
-		goto on_error;
-	}
-	if( mount_file_entry_get_file_mode(
-	     file_entry,
-	     &file_mode,
-	     &error ) != 1 )
-	{
-		libcerror_error_set(
-		 &error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file mode.",
-		 function );
-
-		result = -EIO;
-
-		goto on_error;
-	}
-	if( mount_file_entry_get_access_time(
-	     file_entry,
-	     &access_time,
-	     &error ) != 1 )
-	{
-		libcerror_error_set(
-		 &error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve access time.",
-		 function );
-
-		result = -EIO;
-
-		goto on_error;
-	}
-	if( mount_file_entry_get_modification_time(
-	     file_entry,
-	     &modification_time,
-	     &error ) != 1 )
-	{
-		libcerror_error_set(
-		 &error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve modification time.",
-		 function );
-
-		result = -EIO;
-
-		goto on_error;
-	}
-	if( mount_file_entry_get_inode_change_time(
-	     file_entry,
-	     &inode_change_time,
-	     &error ) != 1 )
-	{
-		libcerror_error_set(
-		 &error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve inode change time.",
-		 function );
-
-		result = -EIO;
-
-		goto on_error;
-	}
-	if( mount_fuse_set_stat_info(
+	if( mount_fuse_set_stat_info_from_inode(
 	     stat_info,
-	     file_size,
-	     file_mode,
-	     (int64_t) access_time,
-	     (int64_t) inode_change_time,
-	     (int64_t) modification_time,
+	     inode,
 	     &error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1267,21 +1004,6 @@ int mount_fuse_getattr(
 
 		goto on_error;
 	}
-	if( mount_file_entry_free(
-	     &file_entry,
-	     &error ) != 1 )
-	{
-		libcerror_error_set(
-		 &error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free file entry.",
-		 function );
-
-		result = -EIO;
-
-		goto on_error;
-	}
 	return( 0 );
 
 on_error:
@@ -1292,15 +1014,36 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( file_entry != NULL )
+	return( result );
+}
+
+#if defined( HAVE_LIBFUSE3 )
+
+/* Initializes the file system
+ * Returns the private data
+ */
+void *mount_fuse_init(
+       struct fuse_conn_info *connection_information REGFTOOLS_ATTRIBUTE_UNUSED,
+       struct fuse_config *configuration )
+{
+	REGFTOOLS_UNREFERENCED_PARAMETER( connection_information )
+
+	if( configuration != NULL )
 	{
-		mount_file_entry_free(
-		 &file_entry,
-		 NULL );
+		/* The mounted file is read-only hence the kernel can cache
+		 * the entries, attributes and data while mounted
+		 */
+		configuration->entry_timeout    = (double) MOUNT_FUSE_CACHE_TIMEOUT;
+		configuration->negative_timeout = (double) MOUNT_FUSE_CACHE_TIMEOUT;
+		configuration->attr_timeout     = (double) MOUNT_FUSE_CACHE_TIMEOUT;
+		configuration->kernel_cache     = 1;
+		configuration->use_ino          = 1;
 	}
-	return( result );
+	return( fuse_get_context()->private_data );
 }
 
+#endif /* defined( HAVE_LIBFUSE3 ) */
+
 /* Cleans up when fuse is done
  */
 void mount_fuse_destroy(
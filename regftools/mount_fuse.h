@@ -51,6 +51,7 @@
 
 #include "mount_file_entry.h"
 #include "mount_handle.h"
+#include "mount_inode_table.h"
 #include "regftools_libcerror.h"
 #include "regftools_libregf.h"
 
@@ -60,6 +61,13 @@ extern "C" {
 
 #if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE )
 
+/* The number of seconds the kernel caches entries and attributes
+ * the mounted file is read-only hence they do not change while mounted
+ */
+#define MOUNT_FUSE_CACHE_TIMEOUT	3600
+
+#define MOUNT_FUSE_CACHE_OPTIONS	"kernel_cache,use_ino,entry_timeout=3600,attr_timeout=3600,negative_timeout=3600"
+
 int mount_fuse_set_stat_info(
      struct stat *stat_info,
      size64_t size,
@@ -69,12 +77,17 @@ int mount_fuse_set_stat_info(
      int64_t modification_time,
      libcerror_error_t **error );
 
+int mount_fuse_set_stat_info_from_inode(
+     struct stat *stat_info,
+     mount_inode_t *inode,
+     libcerror_error_t **error );
+
 int mount_fuse_filldir(
      void *buffer,
      fuse_fill_dir_t filler,
      const char *name,
      struct stat *stat_info,
-     mount_file_entry_t *file_entry,
+     mount_inode_t *inode,
      libcerror_error_t **error );
 
 int mount_fuse_open(
@@ -128,6 +141,12 @@ int mount_fuse_getattr(
      struct stat *stat_info );
 #endif
 
+#if defined( HAVE_LIBFUSE3 )
+void *mount_fuse_init(
+       struct fuse_conn_info *connection_information,
+       struct fuse_config *configuration );
+#endif
+
 void mount_fuse_destroy(
       void *private_data );
 
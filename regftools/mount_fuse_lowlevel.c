@@ -0,0 +1,1394 @@
+/*
+ * Mount tool fuse low-level functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H ) || defined( WINAPI )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "mount_file_entry.h"
+#include "mount_fuse.h"
+#include "mount_fuse_lowlevel.h"
+#include "mount_handle.h"
+#include "regftools_libcerror.h"
+#include "regftools_libcnotify.h"
+#include "regftools_unused.h"
+
+extern mount_handle_t *regfmount_mount_handle;
+
+#if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE )
+
+/* Sets the values in a stat info structure from a file entry
+ * Returns 1 if successful or -1 on error
+ */
+int mount_fuse_lowlevel_set_stat_info_from_file_entry(
+     struct stat *stat_info,
+     mount_file_entry_t *file_entry,
+     uint64_t inode_number,
+     libcerror_error_t **error )
+{
+	static char *function      = "mount_fuse_lowlevel_set_stat_info_from_file_entry";
+	size64_t file_size         = 0;
+	uint64_t access_time       = 0;
+	uint64_t inode_change_time = 0;
+	uint64_t modification_time = 0;
+	uint16_t file_mode         = 0;
+
+	if( stat_info == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stat info.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     stat_info,
+	     0,
+	     sizeof( struct stat ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear stat info.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_file_entry_get_size(
+	     file_entry,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry size.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_file_entry_get_file_mode(
+	     file_entry,
+	     &file_mode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file mode.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_file_entry_get_access_time(
+	     file_entry,
+	     &access_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve access time.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_file_entry_get_modification_time(
+	     file_entry,
+	     &modification_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve modification time.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_file_entry_get_inode_change_time(
+	     file_entry,
+	     &inode_change_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode change time.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_fuse_set_stat_info(
+	     stat_info,
+	     file_size,
+	     file_mode,
+	     (int64_t) access_time,
+	     (int64_t) inode_change_time,
+	     (int64_t) modification_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set stat info.",
+		 function );
+
+		return( -1 );
+	}
+	stat_info->st_ino = (ino_t) inode_number;
+
+	return( 1 );
+}
+
+/* Adds a directory entry to a directory buffer
+ * Returns 1 if successful, 0 if the buffer is too small or -1 on error
+ */
+int mount_fuse_lowlevel_add_directory_entry(
+     fuse_req_t request,
+     char *buffer,
+     size_t buffer_size,
+     size_t *buffer_offset,
+     const char *name,
+     mount_file_entry_t *file_entry,
+     uint64_t inode_number,
+     off_t next_offset,
+     uint8_t use_plus,
+     libcerror_error_t **error )
+{
+	struct fuse_entry_param entry_parameters;
+
+	static char *function = "mount_fuse_lowlevel_add_directory_entry";
+	size_t entry_size     = 0;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( *buffer_offset > buffer_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &entry_parameters,
+	     0,
+	     sizeof( struct fuse_entry_param ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entry parameters.",
+		 function );
+
+		return( -1 );
+	}
+	/* The current and parent directory entries only need a file type
+	 */
+	if( file_entry == NULL )
+	{
+		entry_parameters.attr.st_ino  = (ino_t) inode_number;
+		entry_parameters.attr.st_mode = S_IFDIR;
+	}
+	else if( mount_fuse_lowlevel_set_stat_info_from_file_entry(
+	          &( entry_parameters.attr ),
+	          file_entry,
+	          inode_number,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set stat info.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFUSE3 )
+	if( use_plus != 0 )
+	{
+		entry_parameters.ino           = (fuse_ino_t) inode_number;
+		entry_parameters.attr_timeout  = MOUNT_FUSE_CACHE_TIMEOUT;
+		entry_parameters.entry_timeout = MOUNT_FUSE_CACHE_TIMEOUT;
+
+		entry_size = fuse_add_direntry_plus(
+		              request,
+		              &( buffer[ *buffer_offset ] ),
+		              buffer_size - *buffer_offset,
+		              name,
+		              &entry_parameters,
+		              next_offset );
+	}
+	else
+#endif
+	{
+		entry_size = fuse_add_direntry(
+		              request,
+		              &( buffer[ *buffer_offset ] ),
+		              buffer_size - *buffer_offset,
+		              name,
+		              &( entry_parameters.attr ),
+		              next_offset );
+	}
+	/* The entry is only added if it fits in the remainder of the buffer
+	 */
+	if( entry_size > ( buffer_size - *buffer_offset ) )
+	{
+		return( 0 );
+	}
+	*buffer_offset += entry_size;
+
+	return( 1 );
+}
+
+/* Reads a directory into a directory buffer and replies to the request
+ * The offset of the entries after the current and parent directory entries
+ * is the sub file entry index + 2
+ * Returns 0 if successful or an errno value on error
+ */
+int mount_fuse_lowlevel_read_directory(
+     fuse_req_t request,
+     fuse_ino_t inode_number,
+     size_t size,
+     off_t offset,
+     uint8_t use_plus )
+{
+	libcerror_error_t *error           = NULL;
+	mount_file_entry_t *file_entry     = NULL;
+	mount_file_entry_t *sub_file_entry = NULL;
+	char *buffer                       = NULL;
+	char *name                         = NULL;
+	static char *function              = "mount_fuse_lowlevel_read_directory";
+	size_t buffer_offset               = 0;
+	size_t name_size                   = 0;
+	uint64_t sub_inode_number          = 0;
+	uint16_t file_mode                 = 0;
+	int entry_index                    = 0;
+	int number_of_sub_file_entries     = 0;
+	int result                         = 0;
+
+	if( ( size == 0 )
+	 || ( size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		result = EINVAL;
+
+		goto on_error;
+	}
+	if( ( offset < 0 )
+	 || ( offset > (off_t) INT_MAX ) )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		result = EINVAL;
+
+		goto on_error;
+	}
+	result = mount_handle_get_file_entry_by_inode_number(
+	          regfmount_mount_handle,
+	          (uint64_t) inode_number,
+	          &file_entry,
+	          &error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry: %" PRIu64 ".",
+		 function,
+		 (uint64_t) inode_number );
+
+		result = ENOENT;
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		result = ENOENT;
+
+		goto on_error;
+	}
+	if( mount_file_entry_get_file_mode(
+	     file_entry,
+	     &file_mode,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file mode.",
+		 function );
+
+		result = EIO;
+
+		goto on_error;
+	}
+	if( ( file_mode & S_IFDIR ) == 0 )
+	{
+		result = ENOTDIR;
+
+		goto on_error;
+	}
+	if( mount_file_entry_get_number_of_sub_file_entries(
+	     file_entry,
+	     &number_of_sub_file_entries,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub file entries.",
+		 function );
+
+		result = EIO;
+
+		goto on_error;
+	}
+	buffer = (char *) memory_allocate(
+	                   sizeof( char ) * size );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		result = ENOMEM;
+
+		goto on_error;
+	}
+	for( entry_index = (int) offset;
+	     entry_index < ( number_of_sub_file_entries + 2 );
+	     entry_index++ )
+	{
+		if( entry_index < 2 )
+		{
+			/* The kernel resolves the parent directory itself
+			 */
+			result = mount_fuse_lowlevel_add_directory_entry(
+			          request,
+			          buffer,
+			          size,
+			          &buffer_offset,
+			          ( entry_index == 0 ) ? "." : "..",
+			          NULL,
+			          (uint64_t) inode_number,
+			          (off_t) entry_index + 1,
+			          use_plus,
+			          &error );
+		}
+		else
+		{
+			if( mount_file_entry_get_sub_file_entry_by_index(
+			     file_entry,
+			     entry_index - 2,
+			     &sub_file_entry,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sub file entry: %d.",
+				 function,
+				 entry_index - 2 );
+
+				result = EIO;
+
+				goto on_error;
+			}
+			if( mount_file_entry_get_inode_number(
+			     sub_file_entry,
+			     &sub_inode_number,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sub file entry: %d inode number.",
+				 function,
+				 entry_index - 2 );
+
+				result = EIO;
+
+				goto on_error;
+			}
+			if( mount_file_entry_get_name_size(
+			     sub_file_entry,
+			     &name_size,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sub file entry: %d name size.",
+				 function,
+				 entry_index - 2 );
+
+				result = EIO;
+
+				goto on_error;
+			}
+			name = narrow_string_allocate(
+			        name_size );
+
+			if( name == NULL )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create sub file entry: %d name.",
+				 function,
+				 entry_index - 2 );
+
+				result = ENOMEM;
+
+				goto on_error;
+			}
+			if( mount_file_entry_get_name(
+			     sub_file_entry,
+			     name,
+			     name_size,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sub file entry: %d name.",
+				 function,
+				 entry_index - 2 );
+
+				result = EIO;
+
+				goto on_error;
+			}
+			result = mount_fuse_lowlevel_add_directory_entry(
+			          request,
+			          buffer,
+			          size,
+			          &buffer_offset,
+			          name,
+			          sub_file_entry,
+			          sub_inode_number,
+			          (off_t) entry_index + 1,
+			          use_plus,
+			          &error );
+
+			memory_free(
+			 name );
+
+			name = NULL;
+
+			if( mount_file_entry_free(
+			     &sub_file_entry,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free sub file entry: %d.",
+				 function,
+				 entry_index - 2 );
+
+				result = EIO;
+
+				goto on_error;
+			}
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to add directory entry: %d.",
+			 function,
+			 entry_index );
+
+			result = EIO;
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+	}
+	if( mount_file_entry_free(
+	     &file_entry,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file entry.",
+		 function );
+
+		result = EIO;
+
+		goto on_error;
+	}
+	fuse_reply_buf(
+	 request,
+	 buffer,
+	 buffer_offset );
+
+	memory_free(
+	 buffer );
+
+	return( 0 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( name != NULL )
+	{
+		memory_free(
+		 name );
+	}
+	if( sub_file_entry != NULL )
+	{
+		mount_file_entry_free(
+		 &sub_file_entry,
+		 NULL );
+	}
+	if( file_entry != NULL )
+	{
+		mount_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	fuse_reply_err(
+	 request,
+	 result );
+
+	return( result );
+}
+
+/* Looks up a directory entry by name
+ */
+void mount_fuse_lowlevel_lookup(
+      fuse_req_t request,
+      fuse_ino_t parent_inode_number,
+      const char *name )
+{
+	struct fuse_entry_param entry_parameters;
+
+	libcerror_error_t *error              = NULL;
+	mount_file_entry_t *parent_file_entry = NULL;
+	mount_file_entry_t *sub_file_entry    = NULL;
+	static char *function                 = "mount_fuse_lowlevel_lookup";
+	uint64_t inode_number                 = 0;
+	size_t name_length                    = 0;
+	int result                            = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: %" PRIu64 " %s\n",
+		 function,
+		 (uint64_t) parent_inode_number,
+		 name );
+	}
+#endif
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		result = EINVAL;
+
+		goto on_error;
+	}
+	name_length = narrow_string_length(
+	               name );
+
+	result = mount_handle_get_file_entry_by_inode_number(
+	          regfmount_mount_handle,
+	          (uint64_t) parent_inode_number,
+	          &parent_file_entry,
+	          &error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve parent file entry: %" PRIu64 ".",
+		 function,
+		 (uint64_t) parent_inode_number );
+
+		result = ENOENT;
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		result = ENOENT;
+
+		goto on_error;
+	}
+	result = 0;
+
+	if( name_length > 0 )
+	{
+		result = mount_file_entry_get_sub_file_entry_by_name(
+		          parent_file_entry,
+		          name,
+		          name_length,
+		          &sub_file_entry,
+		          &error );
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub file entry: %s.",
+		 function,
+		 name );
+
+		result = ENOENT;
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		result = ENOENT;
+
+		goto on_error;
+	}
+	if( mount_file_entry_get_inode_number(
+	     sub_file_entry,
+	     &inode_number,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode number.",
+		 function );
+
+		result = EIO;
+
+		goto on_error;
+	}
+	if( memory_set(
+	     &entry_parameters,
+	     0,
+	     sizeof( struct fuse_entry_param ) ) == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entry parameters.",
+		 function );
+
+		result = EIO;
+
+		goto on_error;
+	}
+	if( mount_fuse_lowlevel_set_stat_info_from_file_entry(
+	     &( entry_parameters.attr ),
+	     sub_file_entry,
+	     inode_number,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set stat info.",
+		 function );
+
+		result = EIO;
+
+		goto on_error;
+	}
+	/* The mounted file is read-only hence the kernel can cache the entry
+	 * and its attributes
+	 */
+	entry_parameters.ino           = (fuse_ino_t) inode_number;
+	entry_parameters.attr_timeout  = MOUNT_FUSE_CACHE_TIMEOUT;
+	entry_parameters.entry_timeout = MOUNT_FUSE_CACHE_TIMEOUT;
+
+	if( mount_file_entry_free(
+	     &sub_file_entry,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free sub file entry.",
+		 function );
+
+		result = EIO;
+
+		goto on_error;
+	}
+	if( mount_file_entry_free(
+	     &parent_file_entry,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free parent file entry.",
+		 function );
+
+		result = EIO;
+
+		goto on_error;
+	}
+	fuse_reply_entry(
+	 request,
+	 &entry_parameters );
+
+	return;
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( sub_file_entry != NULL )
+	{
+		mount_file_entry_free(
+		 &sub_file_entry,
+		 NULL );
+	}
+	if( parent_file_entry != NULL )
+	{
+		mount_file_entry_free(
+		 &parent_file_entry,
+		 NULL );
+	}
+	if( result == ENOENT )
+	{
+		/* A negative entry with a timeout allows the kernel to cache
+		 * that the entry does not exist
+		 */
+		if( memory_set(
+		     &entry_parameters,
+		     0,
+		     sizeof( struct fuse_entry_param ) ) != NULL )
+		{
+			entry_parameters.entry_timeout = MOUNT_FUSE_CACHE_TIMEOUT;
+
+			fuse_reply_entry(
+			 request,
+			 &entry_parameters );
+
+			return;
+		}
+	}
+	fuse_reply_err(
+	 request,
+	 result );
+
+	return;
+}
+
+/* Retrieves the attributes of an inode
+ */
+void mount_fuse_lowlevel_getattr(
+      fuse_req_t request,
+      fuse_ino_t inode_number,
+      struct fuse_file_info *file_info REGFTOOLS_ATTRIBUTE_UNUSED )
+{
+	struct stat stat_info;
+
+	libcerror_error_t *error       = NULL;
+	mount_file_entry_t *file_entry = NULL;
+	static char *function          = "mount_fuse_lowlevel_getattr";
+	int result                     = 0;
+
+	REGFTOOLS_UNREFERENCED_PARAMETER( file_info )
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: %" PRIu64 "\n",
+		 function,
+		 (uint64_t) inode_number );
+	}
+#endif
+	result = mount_handle_get_file_entry_by_inode_number(
+	          regfmount_mount_handle,
+	          (uint64_t) inode_number,
+	          &file_entry,
+	          &error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry: %" PRIu64 ".",
+		 function,
+		 (uint64_t) inode_number );
+
+		result = ENOENT;
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		result = ENOENT;
+
+		goto on_error;
+	}
+	if( mount_fuse_lowlevel_set_stat_info_from_file_entry(
+	     &stat_info,
+	     file_entry,
+	     (uint64_t) inode_number,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set stat info.",
+		 function );
+
+		result = EIO;
+
+		goto on_error;
+	}
+	if( mount_file_entry_free(
+	     &file_entry,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file entry.",
+		 function );
+
+		result = EIO;
+
+		goto on_error;
+	}
+	fuse_reply_attr(
+	 request,
+	 &stat_info,
+	 MOUNT_FUSE_CACHE_TIMEOUT );
+
+	return;
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_entry != NULL )
+	{
+		mount_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	fuse_reply_err(
+	 request,
+	 result );
+
+	return;
+}
+
+/* Opens a file
+ * No file entry is kept open, since every read resolves the inode number
+ */
+void mount_fuse_lowlevel_open(
+      fuse_req_t request,
+      fuse_ino_t inode_number,
+      struct fuse_file_info *file_info )
+{
+	libcerror_error_t *error       = NULL;
+	mount_file_entry_t *file_entry = NULL;
+	static char *function          = "mount_fuse_lowlevel_open";
+	uint16_t file_mode             = 0;
+	int result                     = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: %" PRIu64 "\n",
+		 function,
+		 (uint64_t) inode_number );
+	}
+#endif
+	if( file_info == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file information.",
+		 function );
+
+		result = EINVAL;
+
+		goto on_error;
+	}
+	if( ( file_info->flags & 0x03 ) != O_RDONLY )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		result = EACCES;
+
+		goto on_error;
+	}
+	result = mount_handle_get_file_entry_by_inode_number(
+	          regfmount_mount_handle,
+	          (uint64_t) inode_number,
+	          &file_entry,
+	          &error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry: %" PRIu64 ".",
+		 function,
+		 (uint64_t) inode_number );
+
+		result = ENOENT;
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		result = ENOENT;
+
+		goto on_error;
+	}
+	if( mount_file_entry_get_file_mode(
+	     file_entry,
+	     &file_mode,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file mode.",
+		 function );
+
+		result = EIO;
+
+		goto on_error;
+	}
+	if( mount_file_entry_free(
+	     &file_entry,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file entry.",
+		 function );
+
+		result = EIO;
+
+		goto on_error;
+	}
+	if( ( file_mode & S_IFDIR ) != 0 )
+	{
+		result = EISDIR;
+
+		goto on_error;
+	}
+	/* The mounted file is read-only hence the kernel can keep the data cached
+	 */
+	file_info->fh         = 0;
+	file_info->keep_cache = 1;
+
+	fuse_reply_open(
+	 request,
+	 file_info );
+
+	return;
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_entry != NULL )
+	{
+		mount_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	fuse_reply_err(
+	 request,
+	 result );
+
+	return;
+}
+
+/* Reads a buffer of data from a file
+ */
+void mount_fuse_lowlevel_read(
+      fuse_req_t request,
+      fuse_ino_t inode_number,
+      size_t size,
+      off_t offset,
+      struct fuse_file_info *file_info REGFTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error       = NULL;
+	mount_file_entry_t *file_entry = NULL;
+	char *buffer                   = NULL;
+	static char *function          = "mount_fuse_lowlevel_read";
+	ssize_t read_count             = 0;
+	int result                     = 0;
+
+	REGFTOOLS_UNREFERENCED_PARAMETER( file_info )
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: %" PRIu64 "\n",
+		 function,
+		 (uint64_t) inode_number );
+	}
+#endif
+	if( ( size == 0 )
+	 || ( size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		result = EINVAL;
+
+		goto on_error;
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid offset value less than zero.",
+		 function );
+
+		result = EINVAL;
+
+		goto on_error;
+	}
+	result = mount_handle_get_file_entry_by_inode_number(
+	          regfmount_mount_handle,
+	          (uint64_t) inode_number,
+	          &file_entry,
+	          &error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry: %" PRIu64 ".",
+		 function,
+		 (uint64_t) inode_number );
+
+		result = ENOENT;
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		result = ENOENT;
+
+		goto on_error;
+	}
+	buffer = (char *) memory_allocate(
+	                   sizeof( char ) * size );
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		result = ENOMEM;
+
+		goto on_error;
+	}
+	read_count = mount_file_entry_read_buffer_at_offset(
+	              file_entry,
+	              (void *) buffer,
+	              size,
+	              (off64_t) offset,
+	              &error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from file entry.",
+		 function );
+
+		result = EIO;
+
+		goto on_error;
+	}
+	if( mount_file_entry_free(
+	     &file_entry,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file entry.",
+		 function );
+
+		result = EIO;
+
+		goto on_error;
+	}
+	fuse_reply_buf(
+	 request,
+	 buffer,
+	 (size_t) read_count );
+
+	memory_free(
+	 buffer );
+
+	return;
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( buffer != NULL )
+	{
+		memory_free(
+		 buffer );
+	}
+	if( file_entry != NULL )
+	{
+		mount_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	fuse_reply_err(
+	 request,
+	 result );
+
+	return;
+}
+
+/* Reads a directory
+ */
+void mount_fuse_lowlevel_readdir(
+      fuse_req_t request,
+      fuse_ino_t inode_number,
+      size_t size,
+      off_t offset,
+      struct fuse_file_info *file_info REGFTOOLS_ATTRIBUTE_UNUSED )
+{
+#if defined( HAVE_DEBUG_OUTPUT )
+	static char *function = "mount_fuse_lowlevel_readdir";
+#endif
+
+	REGFTOOLS_UNREFERENCED_PARAMETER( file_info )
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: %" PRIu64 "\n",
+		 function,
+		 (uint64_t) inode_number );
+	}
+#endif
+	mount_fuse_lowlevel_read_directory(
+	 request,
+	 inode_number,
+	 size,
+	 offset,
+	 0 );
+}
+
+#if defined( HAVE_LIBFUSE3 )
+
+/* Reads a directory including the attributes of the directory entries
+ */
+void mount_fuse_lowlevel_readdirplus(
+      fuse_req_t request,
+      fuse_ino_t inode_number,
+      size_t size,
+      off_t offset,
+      struct fuse_file_info *file_info REGFTOOLS_ATTRIBUTE_UNUSED )
+{
+#if defined( HAVE_DEBUG_OUTPUT )
+	static char *function = "mount_fuse_lowlevel_readdirplus";
+#endif
+
+	REGFTOOLS_UNREFERENCED_PARAMETER( file_info )
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: %" PRIu64 "\n",
+		 function,
+		 (uint64_t) inode_number );
+	}
+#endif
+	mount_fuse_lowlevel_read_directory(
+	 request,
+	 inode_number,
+	 size,
+	 offset,
+	 1 );
+}
+
+#endif /* defined( HAVE_LIBFUSE3 ) */
+
+#endif /* defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE ) */
+
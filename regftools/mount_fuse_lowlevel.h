@@ -0,0 +1,121 @@
+/*
+ * Mount tool fuse low-level functions
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _MOUNT_FUSE_LOWLEVEL_H )
+#define _MOUNT_FUSE_LOWLEVEL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "mount_fuse.h"
+
+#if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE )
+
+#if defined( HAVE_LIBFUSE )
+#include <fuse/fuse_lowlevel.h>
+#elif defined( HAVE_LIBFUSE3 )
+#include <fuse3/fuse_lowlevel.h>
+#elif defined( HAVE_LIBOSXFUSE )
+#include <osxfuse/fuse_lowlevel.h>
+#endif
+
+#endif /* defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE ) */
+
+#include "mount_file_entry.h"
+#include "regftools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE )
+
+int mount_fuse_lowlevel_set_stat_info_from_file_entry(
+     struct stat *stat_info,
+     mount_file_entry_t *file_entry,
+     uint64_t inode_number,
+     libcerror_error_t **error );
+
+int mount_fuse_lowlevel_add_directory_entry(
+     fuse_req_t request,
+     char *buffer,
+     size_t buffer_size,
+     size_t *buffer_offset,
+     const char *name,
+     mount_file_entry_t *file_entry,
+     uint64_t inode_number,
+     off_t next_offset,
+     uint8_t use_plus,
+     libcerror_error_t **error );
+
+int mount_fuse_lowlevel_read_directory(
+     fuse_req_t request,
+     fuse_ino_t inode_number,
+     size_t size,
+     off_t offset,
+     uint8_t use_plus );
+
+void mount_fuse_lowlevel_lookup(
+      fuse_req_t request,
+      fuse_ino_t parent_inode_number,
+      const char *name );
+
+void mount_fuse_lowlevel_getattr(
+      fuse_req_t request,
+      fuse_ino_t inode_number,
+      struct fuse_file_info *file_info );
+
+void mount_fuse_lowlevel_open(
+      fuse_req_t request,
+      fuse_ino_t inode_number,
+      struct fuse_file_info *file_info );
+
+void mount_fuse_lowlevel_read(
+      fuse_req_t request,
+      fuse_ino_t inode_number,
+      size_t size,
+      off_t offset,
+      struct fuse_file_info *file_info );
+
+void mount_fuse_lowlevel_readdir(
+      fuse_req_t request,
+      fuse_ino_t inode_number,
+      size_t size,
+      off_t offset,
+      struct fuse_file_info *file_info );
+
+#if defined( HAVE_LIBFUSE3 )
+void mount_fuse_lowlevel_readdirplus(
+      fuse_req_t request,
+      fuse_ino_t inode_number,
+      size_t size,
+      off_t offset,
+      struct fuse_file_info *file_info );
+#endif
+
+#endif /* defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _MOUNT_FUSE_LOWLEVEL_H ) */
+
@@ -29,6 +29,7 @@
 #include "mount_file_entry.h"
 #include "mount_file_system.h"
 #include "mount_handle.h"
+#include "mount_inode_table.h"
 #include "regftools_libcerror.h"
 #include "regftools_libclocale.h"
 #include "regftools_libcpath.h"
@@ -145,6 +146,22 @@ int mount_handle_free(
 	}
 	if( *mount_handle != NULL )
 	{
+		if( ( *mount_handle )->inode_table != NULL )
+		{
+			if( mount_inode_table_free(
+			     &( ( *mount_handle )->inode_table ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free inode table.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( mount_file_system_free(
 		     &( ( *mount_handle )->file_system ),
 		     error ) != 1 )
@@ -346,6 +363,24 @@ int mount_handle_open(
 
 		goto on_error;
 	}
+	if( mount_inode_table_initialize(
+	     &( mount_handle->inode_table ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create inode table.",
+		 function );
+
+		mount_file_system_set_file(
+		 mount_handle->file_system,
+		 NULL,
+		 NULL );
+
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
@@ -379,6 +414,24 @@ int mount_handle_close(
 
 		return( -1 );
 	}
+	/* The inodes are only valid for the file they were read from
+	 */
+	if( mount_handle->inode_table != NULL )
+	{
+		if( mount_inode_table_free(
+		     &( mount_handle->inode_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free inode table.",
+			 function );
+
+			return( -1 );
+		}
+	}
 	if( mount_file_system_get_file(
 	     mount_handle->file_system,
 	     &regf_file,
@@ -692,3 +745,931 @@ on_error:
 	return( -1 );
 }
 
+/* Retrieves a file entry for a specific inode number
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
+ */
+int mount_handle_get_file_entry_by_inode_number(
+     mount_handle_t *mount_handle,
+     uint64_t inode_number,
+     mount_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	libregf_key_t *regf_key        = NULL;
+	libregf_value_t *regf_value    = NULL;
+	const system_character_t *name = NULL;
+	system_character_t *filename   = NULL;
+	static char *function          = "mount_handle_get_file_entry_by_inode_number";
+	size_t name_size               = 0;
+	off64_t key_offset             = 0;
+	off64_t value_offset           = 0;
+	int file_entry_type            = MOUNT_FILE_ENTRY_TYPE_UNKNOWN;
+	int result                     = 0;
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode_number == MOUNT_FILE_ENTRY_ROOT_INODE_NUMBER )
+	{
+		return( mount_handle_get_file_entry_by_path(
+		         mount_handle,
+		         _SYSTEM_STRING( "/" ),
+		         file_entry,
+		         error ) );
+	}
+	/* Refer to mount_file_entry_get_inode_number for the layout of the inode number
+	 */
+	key_offset = (off64_t) ( inode_number & 0xffffffffUL );
+
+	if( ( inode_number >> 32 ) > MOUNT_FILE_ENTRY_TYPE_VALUES )
+	{
+		file_entry_type = MOUNT_FILE_ENTRY_TYPE_VALUE;
+		value_offset    = (off64_t) ( inode_number >> 32 );
+	}
+	else
+	{
+		file_entry_type = (int) ( inode_number >> 32 );
+	}
+	if( ( file_entry_type != MOUNT_FILE_ENTRY_TYPE_CLASS_NAME )
+	 && ( file_entry_type != MOUNT_FILE_ENTRY_TYPE_KEY )
+	 && ( file_entry_type != MOUNT_FILE_ENTRY_TYPE_VALUE )
+	 && ( file_entry_type != MOUNT_FILE_ENTRY_TYPE_VALUES ) )
+	{
+		return( 0 );
+	}
+	result = mount_file_system_get_key_by_offset(
+	          mount_handle->file_system,
+	          key_offset,
+	          &regf_key,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve key at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 key_offset,
+		 key_offset );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	switch( file_entry_type )
+	{
+		case MOUNT_FILE_ENTRY_TYPE_CLASS_NAME:
+			name      = _SYSTEM_STRING( "(classname)" );
+			name_size = 12;
+
+			break;
+
+		case MOUNT_FILE_ENTRY_TYPE_KEY:
+			if( mount_file_system_get_filename_from_key(
+			     mount_handle->file_system,
+			     regf_key,
+			     &filename,
+			     &name_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve filename of key.",
+				 function );
+
+				goto on_error;
+			}
+			name = filename;
+
+			break;
+
+		case MOUNT_FILE_ENTRY_TYPE_VALUE:
+			result = libregf_key_get_value_by_offset(
+			          regf_key,
+			          value_offset,
+			          &regf_value,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 value_offset,
+				 value_offset );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				libregf_key_free(
+				 &regf_key,
+				 NULL );
+
+				return( 0 );
+			}
+			if( mount_file_system_get_filename_from_value(
+			     mount_handle->file_system,
+			     regf_value,
+			     &filename,
+			     &name_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve filename of value.",
+				 function );
+
+				goto on_error;
+			}
+			name = filename;
+
+			break;
+
+		case MOUNT_FILE_ENTRY_TYPE_VALUES:
+			name      = _SYSTEM_STRING( "(values)" );
+			name_size = 9;
+
+			break;
+	}
+	if( mount_file_entry_initialize(
+	     file_entry,
+	     mount_handle->file_system,
+	     name,
+	     name_size - 1,
+	     file_entry_type,
+	     regf_key,
+	     regf_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( filename != NULL )
+	{
+		memory_free(
+		 filename );
+	}
+	return( 1 );
+
+on_error:
+	if( filename != NULL )
+	{
+		memory_free(
+		 filename );
+	}
+	if( regf_value != NULL )
+	{
+		libregf_value_free(
+		 &regf_value,
+		 NULL );
+	}
+	if( regf_key != NULL )
+	{
+		libregf_key_free(
+		 &regf_key,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Creates an inode for a file entry and inserts it into the inode table
+ * Returns 1 if successful or -1 on error
+ */
+int mount_handle_initialize_inode(
+     mount_handle_t *mount_handle,
+     const system_character_t *path,
+     size_t path_length,
+     mount_file_entry_t *file_entry,
+     mount_inode_t *parent_inode,
+     mount_inode_t **inode,
+     libcerror_error_t **error )
+{
+	mount_inode_t *safe_inode = NULL;
+	static char *function     = "mount_handle_initialize_inode";
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_inode_initialize(
+	     &safe_inode,
+	     path,
+	     path_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create inode.",
+		 function );
+
+		goto on_error;
+	}
+	if( mount_file_entry_get_size(
+	     file_entry,
+	     &( safe_inode->size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry size.",
+		 function );
+
+		goto on_error;
+	}
+	if( mount_file_entry_get_file_mode(
+	     file_entry,
+	     &( safe_inode->file_mode ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file mode.",
+		 function );
+
+		goto on_error;
+	}
+	if( mount_file_entry_get_access_time(
+	     file_entry,
+	     &( safe_inode->access_time ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve access time.",
+		 function );
+
+		goto on_error;
+	}
+	if( mount_file_entry_get_modification_time(
+	     file_entry,
+	     &( safe_inode->modification_time ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve modification time.",
+		 function );
+
+		goto on_error;
+	}
+	if( mount_file_entry_get_inode_change_time(
+	     file_entry,
+	     &( safe_inode->inode_change_time ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve inode change time.",
+		 function );
+
+		goto on_error;
+	}
+	if( mount_inode_table_insert_inode(
+	     mount_handle->inode_table,
+	     safe_inode,
+	     parent_inode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert inode.",
+		 function );
+
+		goto on_error;
+	}
+	*inode = safe_inode;
+
+	return( 1 );
+
+on_error:
+	if( safe_inode != NULL )
+	{
+		mount_inode_free(
+		 &safe_inode,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the inode of a specific path
+ * The inode is read from the file and cached in the inode table if not available
+ * Returns 1 if successful, 0 if no such file entry or -1 on error
+ */
+int mount_handle_get_inode_by_path(
+     mount_handle_t *mount_handle,
+     const system_character_t *path,
+     mount_inode_t **inode,
+     libcerror_error_t **error )
+{
+	mount_file_entry_t *file_entry  = NULL;
+	mount_inode_t *parent_inode     = NULL;
+	system_character_t *parent_path = NULL;
+	static char *function           = "mount_handle_get_inode_by_path";
+	size_t parent_path_length       = 0;
+	size_t path_length              = 0;
+	int result                      = 0;
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( mount_handle->inode_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid mount handle - missing inode table.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	path_length = system_string_length(
+	               path );
+
+	if( ( path_length >= 2 )
+	 && ( path[ path_length - 1 ] == LIBCPATH_SEPARATOR ) )
+	{
+		path_length -= 1;
+	}
+	result = mount_inode_table_get_inode_by_path(
+	          mount_handle->inode_table,
+	          path,
+	          path_length,
+	          inode,
+	          error );
+
+	if( result != 0 )
+	{
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve inode from table.",
+			 function );
+		}
+		return( result );
+	}
+	result = mount_handle_get_file_entry_by_path(
+	          mount_handle,
+	          path,
+	          &file_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	/* Determine the parent inode, the root has no parent
+	 */
+	parent_path_length = path_length;
+
+	while( parent_path_length > 0 )
+	{
+		if( path[ parent_path_length - 1 ] == LIBCPATH_SEPARATOR )
+		{
+			break;
+		}
+		parent_path_length--;
+	}
+	if( ( parent_path_length > 0 )
+	 && ( parent_path_length < path_length ) )
+	{
+		if( parent_path_length > 1 )
+		{
+			parent_path_length -= 1;
+		}
+		parent_path = system_string_allocate(
+		               parent_path_length + 1 );
+
+		if( parent_path == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create parent path.",
+			 function );
+
+			goto on_error;
+		}
+		if( system_string_copy(
+		     parent_path,
+		     path,
+		     parent_path_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy parent path.",
+			 function );
+
+			goto on_error;
+		}
+		parent_path[ parent_path_length ] = 0;
+
+		result = mount_handle_get_inode_by_path(
+		          mount_handle,
+		          parent_path,
+		          &parent_inode,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve parent inode.",
+			 function );
+
+			goto on_error;
+		}
+		memory_free(
+		 parent_path );
+
+		parent_path = NULL;
+	}
+	if( mount_handle_initialize_inode(
+	     mount_handle,
+	     path,
+	     path_length,
+	     file_entry,
+	     parent_inode,
+	     inode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create inode.",
+		 function );
+
+		goto on_error;
+	}
+	if( mount_file_entry_free(
+	     &file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file entry.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( parent_path != NULL )
+	{
+		memory_free(
+		 parent_path );
+	}
+	if( file_entry != NULL )
+	{
+		mount_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the sub inodes of an inode
+ * The sub inodes are cached in the inode table hence they are only read once
+ * Returns 1 if successful or -1 on error
+ */
+int mount_handle_read_sub_inodes(
+     mount_handle_t *mount_handle,
+     mount_inode_t *inode,
+     libcerror_error_t **error )
+{
+	mount_file_entry_t *file_entry     = NULL;
+	mount_file_entry_t *sub_file_entry = NULL;
+	mount_inode_t **sub_inodes         = NULL;
+	system_character_t *sub_path       = NULL;
+	static char *function              = "mount_handle_read_sub_inodes";
+	size_t name_size                   = 0;
+	size_t path_length                 = 0;
+	size_t sub_path_length             = 0;
+	size_t sub_path_size               = 0;
+	int number_of_sub_file_entries     = 0;
+	int result                         = 0;
+	int sub_file_entry_index           = 0;
+
+	if( mount_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mount handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode->sub_inodes_read != 0 )
+	{
+		return( 1 );
+	}
+	result = mount_handle_get_file_entry_by_path(
+	          mount_handle,
+	          inode->path,
+	          &file_entry,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( inode->file_mode & 0x4000 ) != 0 )
+	{
+		if( mount_file_entry_get_number_of_sub_file_entries(
+		     file_entry,
+		     &number_of_sub_file_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of sub file entries.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( number_of_sub_file_entries > 0 )
+	{
+		if( (size_t) number_of_sub_file_entries > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( mount_inode_t * ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of sub file entries value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		sub_inodes = (mount_inode_t **) memory_allocate(
+		                                 sizeof( mount_inode_t * ) * number_of_sub_file_entries );
+
+		if( sub_inodes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create sub inodes.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The path of the root already ends with a separator
+	 */
+	path_length = inode->path_length;
+
+	if( ( path_length == 1 )
+	 && ( inode->path[ 0 ] == LIBCPATH_SEPARATOR ) )
+	{
+		path_length = 0;
+	}
+	for( sub_file_entry_index = 0;
+	     sub_file_entry_index < number_of_sub_file_entries;
+	     sub_file_entry_index++ )
+	{
+		if( mount_file_entry_get_sub_file_entry_by_index(
+		     file_entry,
+		     sub_file_entry_index,
+		     &sub_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub file entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
+		if( mount_file_entry_get_name_size(
+		     sub_file_entry,
+		     &name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub file entry: %d name size.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
+		if( ( name_size == 0 )
+		 || ( name_size > ( (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) - path_length - 1 ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid sub file entry: %d name size value out of bounds.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
+		sub_path_length = path_length + name_size;
+
+		if( sub_path_length + 1 > sub_path_size )
+		{
+			if( sub_path != NULL )
+			{
+				memory_free(
+				 sub_path );
+			}
+			sub_path_size = sub_path_length + 1;
+
+			sub_path = system_string_allocate(
+			            sub_path_size );
+
+			if( sub_path == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create sub path.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( path_length > 0 )
+		{
+			if( system_string_copy(
+			     sub_path,
+			     inode->path,
+			     path_length ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy path.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		sub_path[ path_length ] = LIBCPATH_SEPARATOR;
+
+		if( mount_file_entry_get_name(
+		     sub_file_entry,
+		     &( sub_path[ path_length + 1 ] ),
+		     name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub file entry: %d name.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
+		result = mount_inode_table_get_inode_by_path(
+		          mount_handle->inode_table,
+		          sub_path,
+		          sub_path_length,
+		          &( sub_inodes[ sub_file_entry_index ] ),
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub inode: %d from table.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( mount_handle_initialize_inode(
+			     mount_handle,
+			     sub_path,
+			     sub_path_length,
+			     sub_file_entry,
+			     inode,
+			     &( sub_inodes[ sub_file_entry_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create sub inode: %d.",
+				 function,
+				 sub_file_entry_index );
+
+				goto on_error;
+			}
+		}
+		if( mount_file_entry_free(
+		     &sub_file_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sub file entry: %d.",
+			 function,
+			 sub_file_entry_index );
+
+			goto on_error;
+		}
+	}
+	if( sub_path != NULL )
+	{
+		memory_free(
+		 sub_path );
+
+		sub_path = NULL;
+	}
+	if( mount_file_entry_free(
+	     &file_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( mount_inode_set_sub_inodes(
+	     inode,
+	     sub_inodes,
+	     number_of_sub_file_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set sub inodes.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( sub_path != NULL )
+	{
+		memory_free(
+		 sub_path );
+	}
+	if( sub_file_entry != NULL )
+	{
+		mount_file_entry_free(
+		 &sub_file_entry,
+		 NULL );
+	}
+	if( file_entry != NULL )
+	{
+		mount_file_entry_free(
+		 &file_entry,
+		 NULL );
+	}
+	if( sub_inodes != NULL )
+	{
+		memory_free(
+		 sub_inodes );
+	}
+	return( -1 );
+}
@@ -28,6 +28,7 @@
 
 #include "mount_file_entry.h"
 #include "mount_file_system.h"
+#include "mount_inode_table.h"
 #include "regftools_libcerror.h"
 #include "regftools_libregf.h"
 
@@ -43,6 +44,11 @@ struct mount_handle
 	 */
 	mount_file_system_t *file_system;
 
+	/* The inode table, which caches the attributes and directory listings
+	 * of the file entries while the file is open
+	 */
+	mount_inode_table_t *inode_table;
+
 	/* The ASCII codepage
 	 */
 	int ascii_codepage;
@@ -84,6 +90,32 @@ int mount_handle_get_file_entry_by_path(
      mount_file_entry_t **file_entry,
      libcerror_error_t **error );
 
+int mount_handle_get_file_entry_by_inode_number(
+     mount_handle_t *mount_handle,
+     uint64_t inode_number,
+     mount_file_entry_t **file_entry,
+     libcerror_error_t **error );
+
+int mount_handle_initialize_inode(
+     mount_handle_t *mount_handle,
+     const system_character_t *path,
+     size_t path_length,
+     mount_file_entry_t *file_entry,
+     mount_inode_t *parent_inode,
+     mount_inode_t **inode,
+     libcerror_error_t **error );
+
+int mount_handle_get_inode_by_path(
+     mount_handle_t *mount_handle,
+     const system_character_t *path,
+     mount_inode_t **inode,
+     libcerror_error_t **error );
+
+int mount_handle_read_sub_inodes(
+     mount_handle_t *mount_handle,
+     mount_inode_t *inode,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,732 @@
+/*
+ * Mount inode table
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "mount_inode_table.h"
+#include "regftools_libcerror.h"
+#include "regftools_libcpath.h"
+
+/* Creates an inode
+ * Make sure the value inode is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int mount_inode_initialize(
+     mount_inode_t **inode,
+     const system_character_t *path,
+     size_t path_length,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_inode_initialize";
+	size_t name_index     = 0;
+
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( *inode != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid inode value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( path_length == 0 )
+	 || ( path_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*inode = memory_allocate_structure(
+	          mount_inode_t );
+
+	if( *inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create inode.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *inode,
+	     0,
+	     sizeof( mount_inode_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear inode.",
+		 function );
+
+		memory_free(
+		 *inode );
+
+		*inode = NULL;
+
+		return( -1 );
+	}
+	( *inode )->path = system_string_allocate(
+	                    path_length + 1 );
+
+	if( ( *inode )->path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     ( *inode )->path,
+	     path,
+	     path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy path.",
+		 function );
+
+		goto on_error;
+	}
+	( *inode )->path[ path_length ] = 0;
+
+	( *inode )->path_length = path_length;
+	( *inode )->path_hash   = mount_inode_table_calculate_path_hash(
+	                           path,
+	                           path_length );
+
+	/* The name of the root is empty
+	 */
+	name_index = path_length;
+
+	while( name_index > 0 )
+	{
+		if( path[ name_index - 1 ] == (system_character_t) LIBCPATH_SEPARATOR )
+		{
+			break;
+		}
+		name_index--;
+	}
+	( *inode )->name_index = name_index;
+
+	return( 1 );
+
+on_error:
+	if( *inode != NULL )
+	{
+		if( ( *inode )->path != NULL )
+		{
+			memory_free(
+			 ( *inode )->path );
+		}
+		memory_free(
+		 *inode );
+
+		*inode = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an inode
+ * The sub inodes are not freed since they are owned by the inode table
+ * Returns 1 if successful or -1 on error
+ */
+int mount_inode_free(
+     mount_inode_t **inode,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_inode_free";
+
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( *inode != NULL )
+	{
+		if( ( *inode )->sub_inodes != NULL )
+		{
+			memory_free(
+			 ( *inode )->sub_inodes );
+		}
+		if( ( *inode )->path != NULL )
+		{
+			memory_free(
+			 ( *inode )->path );
+		}
+		memory_free(
+		 *inode );
+
+		*inode = NULL;
+	}
+	return( 1 );
+}
+
+/* Sets the sub inodes
+ * The inode takes over management of the sub inodes array but not of the sub inodes
+ * Returns 1 if successful or -1 on error
+ */
+int mount_inode_set_sub_inodes(
+     mount_inode_t *inode,
+     mount_inode_t **sub_inodes,
+     int number_of_sub_inodes,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_inode_set_sub_inodes";
+
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode->sub_inodes_read != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid inode - sub inodes value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_sub_inodes < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of sub inodes value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( sub_inodes == NULL )
+	 && ( number_of_sub_inodes > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sub inodes.",
+		 function );
+
+		return( -1 );
+	}
+	inode->sub_inodes           = sub_inodes;
+	inode->number_of_sub_inodes = number_of_sub_inodes;
+	inode->sub_inodes_read      = 1;
+
+	return( 1 );
+}
+
+/* Creates an inode table
+ * Make sure the value inode_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int mount_inode_table_initialize(
+     mount_inode_table_t **inode_table,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_inode_table_initialize";
+
+	if( inode_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *inode_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid inode table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*inode_table = memory_allocate_structure(
+	                mount_inode_table_t );
+
+	if( *inode_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create inode table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *inode_table,
+	     0,
+	     sizeof( mount_inode_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear inode table.",
+		 function );
+
+		memory_free(
+		 *inode_table );
+
+		*inode_table = NULL;
+
+		return( -1 );
+	}
+	if( mount_inode_table_resize_buckets(
+	     *inode_table,
+	     MOUNT_INODE_TABLE_INITIAL_NUMBER_OF_BUCKETS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize buckets.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *inode_table != NULL )
+	{
+		if( ( *inode_table )->buckets != NULL )
+		{
+			memory_free(
+			 ( *inode_table )->buckets );
+		}
+		memory_free(
+		 *inode_table );
+
+		*inode_table = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an inode table
+ * Returns 1 if successful or -1 on error
+ */
+int mount_inode_table_free(
+     mount_inode_table_t **inode_table,
+     libcerror_error_t **error )
+{
+	mount_inode_t *inode      = NULL;
+	mount_inode_t *next_inode = NULL;
+	static char *function     = "mount_inode_table_free";
+	uint32_t bucket_index     = 0;
+	int result                = 1;
+
+	if( inode_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *inode_table != NULL )
+	{
+		for( bucket_index = 0;
+		     bucket_index < ( *inode_table )->number_of_buckets;
+		     bucket_index++ )
+		{
+			inode = ( *inode_table )->buckets[ bucket_index ];
+
+			while( inode != NULL )
+			{
+				next_inode = inode->next_bucket_inode;
+
+				if( mount_inode_free(
+				     &inode,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free inode.",
+					 function );
+
+					result = -1;
+				}
+				inode = next_inode;
+			}
+		}
+		memory_free(
+		 ( *inode_table )->buckets );
+
+		memory_free(
+		 *inode_table );
+
+		*inode_table = NULL;
+	}
+	return( result );
+}
+
+/* Calculates the hash of a path
+ * Returns the hash
+ */
+uint32_t mount_inode_table_calculate_path_hash(
+          const system_character_t *path,
+          size_t path_length )
+{
+	size_t path_index = 0;
+	uint32_t hash     = 0;
+
+	if( path == NULL )
+	{
+		return( 0 );
+	}
+	for( path_index = 0;
+	     path_index < path_length;
+	     path_index++ )
+	{
+		hash *= 37;
+		hash += (uint32_t) path[ path_index ];
+	}
+	return( hash );
+}
+
+/* Resizes the buckets
+ * Returns 1 if successful or -1 on error
+ */
+int mount_inode_table_resize_buckets(
+     mount_inode_table_t *inode_table,
+     uint32_t number_of_buckets,
+     libcerror_error_t **error )
+{
+	mount_inode_t **buckets   = NULL;
+	mount_inode_t *inode      = NULL;
+	mount_inode_t *next_inode = NULL;
+	static char *function     = "mount_inode_table_resize_buckets";
+	uint32_t bucket_index     = 0;
+	uint32_t new_bucket_index = 0;
+
+	if( inode_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_buckets == 0 )
+	 || ( ( number_of_buckets & ( number_of_buckets - 1 ) ) != 0 )
+	 || ( (size_t) number_of_buckets > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( mount_inode_t * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of buckets value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	buckets = (mount_inode_t **) memory_allocate(
+	                              sizeof( mount_inode_t * ) * number_of_buckets );
+
+	if( buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     buckets,
+	     0,
+	     sizeof( mount_inode_t * ) * number_of_buckets ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buckets.",
+		 function );
+
+		memory_free(
+		 buckets );
+
+		return( -1 );
+	}
+	if( inode_table->buckets != NULL )
+	{
+		for( bucket_index = 0;
+		     bucket_index < inode_table->number_of_buckets;
+		     bucket_index++ )
+		{
+			inode = inode_table->buckets[ bucket_index ];
+
+			while( inode != NULL )
+			{
+				next_inode       = inode->next_bucket_inode;
+				new_bucket_index = inode->path_hash & ( number_of_buckets - 1 );
+
+				inode->next_bucket_inode    = buckets[ new_bucket_index ];
+				buckets[ new_bucket_index ] = inode;
+
+				inode = next_inode;
+			}
+		}
+		memory_free(
+		 inode_table->buckets );
+	}
+	inode_table->buckets           = buckets;
+	inode_table->number_of_buckets = number_of_buckets;
+
+	return( 1 );
+}
+
+/* Retrieves the inode of a specific path
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int mount_inode_table_get_inode_by_path(
+     mount_inode_table_t *inode_table,
+     const system_character_t *path,
+     size_t path_length,
+     mount_inode_t **inode,
+     libcerror_error_t **error )
+{
+	mount_inode_t *bucket_inode = NULL;
+	static char *function       = "mount_inode_table_get_inode_by_path";
+	uint32_t path_hash          = 0;
+
+	if( inode_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode table.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	path_hash = mount_inode_table_calculate_path_hash(
+	             path,
+	             path_length );
+
+	bucket_inode = inode_table->buckets[ path_hash & ( inode_table->number_of_buckets - 1 ) ];
+
+	while( bucket_inode != NULL )
+	{
+		if( ( bucket_inode->path_hash == path_hash )
+		 && ( bucket_inode->path_length == path_length )
+		 && ( system_string_compare(
+		       bucket_inode->path,
+		       path,
+		       path_length ) == 0 ) )
+		{
+			*inode = bucket_inode;
+
+			return( 1 );
+		}
+		bucket_inode = bucket_inode->next_bucket_inode;
+	}
+	*inode = NULL;
+
+	return( 0 );
+}
+
+/* Inserts an inode
+ * The inode table takes over management of the inode and assigns its inode number
+ * Returns 1 if successful or -1 on error
+ */
+int mount_inode_table_insert_inode(
+     mount_inode_table_t *inode_table,
+     mount_inode_t *inode,
+     mount_inode_t *parent_inode,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_inode_table_insert_inode";
+	uint32_t bucket_index = 0;
+
+	if( inode_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode table.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid inode.",
+		 function );
+
+		return( -1 );
+	}
+	if( inode->inode_number != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid inode - inode number value already set.",
+		 function );
+
+		return( -1 );
+	}
+	/* Keep the average number of inodes per bucket below 2
+	 */
+	if( ( inode_table->number_of_inodes / 2 ) >= (uint64_t) inode_table->number_of_buckets )
+	{
+		if( ( inode_table->number_of_buckets <= ( (uint32_t) INT32_MAX / 2 ) )
+		 && ( (size_t) inode_table->number_of_buckets <= (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( mount_inode_t * ) ) ) ) )
+		{
+			if( mount_inode_table_resize_buckets(
+			     inode_table,
+			     inode_table->number_of_buckets * 2,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+				 "%s: unable to resize buckets.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	bucket_index = inode->path_hash & ( inode_table->number_of_buckets - 1 );
+
+	inode_table->number_of_inodes += 1;
+
+	/* Inode number 1 is used by the first inode, which is the root
+	 */
+	inode->inode_number      = inode_table->number_of_inodes;
+	inode->parent_inode      = parent_inode;
+	inode->next_bucket_inode = inode_table->buckets[ bucket_index ];
+
+	inode_table->buckets[ bucket_index ] = inode;
+
+	return( 1 );
+}
+
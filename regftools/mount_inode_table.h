@@ -0,0 +1,171 @@
+/*
+ * Mount inode table
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _MOUNT_INODE_TABLE_H )
+#define _MOUNT_INODE_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "regftools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The initial number of buckets, which must be a power of 2
+ */
+#define MOUNT_INODE_TABLE_INITIAL_NUMBER_OF_BUCKETS	1024
+
+typedef struct mount_inode mount_inode_t;
+
+struct mount_inode
+{
+	/* The inode number
+	 */
+	uint64_t inode_number;
+
+	/* The parent inode or NULL if the root
+	 */
+	mount_inode_t *parent_inode;
+
+	/* The path
+	 */
+	system_character_t *path;
+
+	/* The path length
+	 */
+	size_t path_length;
+
+	/* The hash of the path
+	 */
+	uint32_t path_hash;
+
+	/* The index of the name in the path
+	 */
+	size_t name_index;
+
+	/* The size
+	 */
+	size64_t size;
+
+	/* The file mode
+	 */
+	uint16_t file_mode;
+
+	/* The access date and time
+	 */
+	uint64_t access_time;
+
+	/* The inode change date and time
+	 */
+	uint64_t inode_change_time;
+
+	/* The modification date and time
+	 */
+	uint64_t modification_time;
+
+	/* Value to indicate the sub inodes were read
+	 */
+	uint8_t sub_inodes_read;
+
+	/* The sub inodes
+	 */
+	mount_inode_t **sub_inodes;
+
+	/* The number of sub inodes
+	 */
+	int number_of_sub_inodes;
+
+	/* The next inode in the same bucket
+	 */
+	mount_inode_t *next_bucket_inode;
+};
+
+typedef struct mount_inode_table mount_inode_table_t;
+
+struct mount_inode_table
+{
+	/* The number of buckets, which is a power of 2
+	 */
+	uint32_t number_of_buckets;
+
+	/* The buckets, which contain the first inode or NULL if empty
+	 */
+	mount_inode_t **buckets;
+
+	/* The number of inodes
+	 */
+	uint64_t number_of_inodes;
+};
+
+int mount_inode_initialize(
+     mount_inode_t **inode,
+     const system_character_t *path,
+     size_t path_length,
+     libcerror_error_t **error );
+
+int mount_inode_free(
+     mount_inode_t **inode,
+     libcerror_error_t **error );
+
+int mount_inode_set_sub_inodes(
+     mount_inode_t *inode,
+     mount_inode_t **sub_inodes,
+     int number_of_sub_inodes,
+     libcerror_error_t **error );
+
+int mount_inode_table_initialize(
+     mount_inode_table_t **inode_table,
+     libcerror_error_t **error );
+
+int mount_inode_table_free(
+     mount_inode_table_t **inode_table,
+     libcerror_error_t **error );
+
+uint32_t mount_inode_table_calculate_path_hash(
+          const system_character_t *path,
+          size_t path_length );
+
+int mount_inode_table_resize_buckets(
+     mount_inode_table_t *inode_table,
+     uint32_t number_of_buckets,
+     libcerror_error_t **error );
+
+int mount_inode_table_get_inode_by_path(
+     mount_inode_table_t *inode_table,
+     const system_character_t *path,
+     size_t path_length,
+     mount_inode_t **inode,
+     libcerror_error_t **error );
+
+int mount_inode_table_insert_inode(
+     mount_inode_table_t *inode_table,
+     mount_inode_t *inode,
+     mount_inode_t *parent_inode,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _MOUNT_INODE_TABLE_H ) */
+
@@ -26,6 +26,10 @@
 
 #include <stdio.h>
 
+#if defined( HAVE_FCNTL_H ) || defined( WINAPI )
+#include <fcntl.h>
+#endif
+
 #if defined( HAVE_IO_H ) || defined( WINAPI )
 #include <io.h>
 #endif
@@ -63,8 +67,8 @@ void usage_fprint(
 	fprintf( stream, "Use regfexport to export information from a Windows NT\n"
 	                 "Registry File (REGF).\n\n" );
 
-	fprintf( stream, "Usage: regfexport [ -c codepage ] [ -K key_path ] [ -l logfile ]\n"
-	                 "                  [ -hvV ] source\n\n" );
+	fprintf( stream, "Usage: regfexport [ -c codepage ] [ -f format ] [ -j jobs ]\n"
+	                 "                  [ -K key_path ] [ -l logfile ] [ -hvV ] source\n\n" );
 
 	fprintf( stream, "\tsource: the source file\n\n" );
 
@@ -73,7 +77,11 @@ void usage_fprint(
 	                 "\t        windows-1250, windows-1251, windows-1252 (default),\n"
 	                 "\t        windows-1253, windows-1254, windows-1255, windows-1256\n"
 	                 "\t        windows-1257 or windows-1258\n" );
+	fprintf( stream, "\t-f:     output format, options: text (default), jsonl (JSON Lines)\n"
+	                 "\t        or binary\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-j:     the number of concurrent export jobs, where 0 or 1 (default)\n"
+	                 "\t        exports without threads\n" );
 	fprintf( stream, "\t-K:     show information about a specific key path.\n" );
 	fprintf( stream, "\t-l:     logs information about the exported items\n" );
 	fprintf( stream, "\t-v:     verbose output to stderr\n" );
@@ -135,6 +143,8 @@ int main( int argc, char * const argv[] )
 	libcerror_error_t *error                  = NULL;
 	log_handle_t *log_handle                  = NULL;
 	system_character_t *option_ascii_codepage = NULL;
+	system_character_t *option_export_format  = NULL;
+	system_character_t *option_jobs           = NULL;
 	system_character_t *key_path              = NULL;
 	system_character_t *log_filename          = NULL;
 	system_character_t *source                = NULL;
@@ -169,19 +179,19 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	regftools_output_version_fprint(
-	 stdout,
-	 program );
-
 	while( ( option = regftools_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "c:hK:l:vV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "c:f:hj:K:l:vV" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
 			case (system_integer_t) '?':
 			default:
+				regftools_output_version_fprint(
+				 stdout,
+				 program );
+
 				fprintf(
 				 stderr,
 				 "Invalid argument: %" PRIs_SYSTEM "\n",
@@ -197,12 +207,26 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'f':
+				option_export_format = optarg;
+
+				break;
+
 			case (system_integer_t) 'h':
+				regftools_output_version_fprint(
+				 stdout,
+				 program );
+
 				usage_fprint(
 				 stdout );
 
 				return( EXIT_SUCCESS );
 
+			case (system_integer_t) 'j':
+				option_jobs = optarg;
+
+				break;
+
 			case (system_integer_t) 'K':
 				key_path = optarg;
 
@@ -219,6 +243,10 @@ int main( int argc, char * const argv[] )
 				break;
 
 			case (system_integer_t) 'V':
+				regftools_output_version_fprint(
+				 stdout,
+				 program );
+
 				regftools_output_copyright_fprint(
 				 stdout );
 
@@ -227,6 +255,10 @@ int main( int argc, char * const argv[] )
 	}
 	if( optind == argc )
 	{
+		regftools_output_version_fprint(
+		 stdout,
+		 program );
+
 		fprintf(
 		 stderr,
 		 "Missing source file.\n" );
@@ -300,6 +332,75 @@ int main( int argc, char * const argv[] )
 			 "Unsupported ASCII codepage defaulting to: windows-1252.\n" );
 		}
 	}
+	if( option_export_format != NULL )
+	{
+		result = export_handle_set_export_format(
+		          regfexport_export_handle,
+		          option_export_format,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set export format in export handle.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported export format defaulting to: text.\n" );
+		}
+	}
+	/* Keep the standard output free of anything but the exported data
+	 * for the machine-readable export formats
+	 */
+	if( regfexport_export_handle->export_format == EXPORT_FORMAT_TEXT )
+	{
+		regftools_output_version_fprint(
+		 stdout,
+		 program );
+	}
+	else
+	{
+		regftools_output_version_fprint(
+		 stderr,
+		 program );
+
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+		if( regfexport_export_handle->export_format == EXPORT_FORMAT_BINARY )
+		{
+			_setmode(
+			 _fileno(
+			  stdout ),
+			 _O_BINARY );
+		}
+#endif
+	}
+	if( option_jobs != NULL )
+	{
+		result = export_handle_set_number_of_threads(
+		          regfexport_export_handle,
+		          option_jobs,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of jobs in export handle.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of jobs defaulting to: 1.\n" );
+		}
+	}
 	if( export_handle_open_input(
 	     regfexport_export_handle,
 	     source,
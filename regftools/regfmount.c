@@ -41,6 +41,7 @@
 
 #include "mount_dokan.h"
 #include "mount_fuse.h"
+#include "mount_fuse_lowlevel.h"
 #include "mount_handle.h"
 #include "regftools_getopt.h"
 #include "regftools_i18n.h"
@@ -66,7 +67,7 @@ void usage_fprint(
 	}
 	fprintf( stream, "Use regfmount to mount a Windows NT Registry File (REGF)\n\n" );
 
-	fprintf( stream, "Usage: regfmount [ -c codepage ] [ -X extended_options ] [ -hvV ] file\n"
+	fprintf( stream, "Usage: regfmount [ -c codepage ] [ -X extended_options ] [ -hlvV ] file\n"
 	                 "                 mount_point\n\n" );
 
 	fprintf( stream, "\tfile:        a Windows NT Registry File (REGF)\n\n" );
@@ -77,6 +78,9 @@ void usage_fprint(
 	                 "\t             windows-1252 (default), windows-1253, windows-1254, windows-1255,\n"
 	                 "\t             windows-1256, windows-1257 or windows-1258\n" );
 	fprintf( stream, "\t-h:          shows this help\n" );
+	fprintf( stream, "\t-l:          use the fuse low-level interface, which uses the key and value\n"
+	                 "\t             cell offsets as inode numbers and handles requests in\n"
+	                 "\t             multiple threads\n" );
 	fprintf( stream, "\t-v:          verbose output to stderr, while regfmount will remain running in the\n"
 	                 "\t             foreground\n" );
 	fprintf( stream, "\t-V:          print version\n" );
@@ -143,10 +147,12 @@ int main( int argc, char * const argv[] )
 	char *program                               = "regfmount";
 	system_integer_t option                     = 0;
 	int result                                  = 0;
+	int use_lowlevel                            = 0;
 	int verbose                                 = 0;
 
 #if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE )
 	struct fuse_operations regfmount_fuse_operations;
+	struct fuse_lowlevel_ops regfmount_fuse_lowlevel_operations;
 
 #if defined( HAVE_LIBFUSE3 )
 	/* Need to set this to 1 even if there no arguments, otherwise this causes
@@ -159,6 +165,7 @@ int main( int argc, char * const argv[] )
 	struct fuse_chan *regfmount_fuse_channel    = NULL;
 #endif
 	struct fuse *regfmount_fuse_handle          = NULL;
+	struct fuse_session *regfmount_fuse_session = NULL;
 
 #elif defined( HAVE_LIBDOKAN )
 	DOKAN_OPERATIONS regfmount_dokan_operations;
@@ -198,7 +205,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = regftools_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "c:hvVX:" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "c:hlvVX:" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -225,6 +232,11 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_SUCCESS );
 
+			case (system_integer_t) 'l':
+				use_lowlevel = 1;
+
+				break;
+
 			case (system_integer_t) 'v':
 				verbose = 1;
 
@@ -320,13 +332,55 @@ int main( int argc, char * const argv[] )
 		goto on_error;
 	}
 #if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE )
+#if !defined( HAVE_LIBFUSE3 )
+	/* This argument is required but ignored
+	 */
+	if( fuse_opt_add_arg(
+	     &regfmount_fuse_arguments,
+	     "" ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable add fuse arguments.\n" );
+
+		goto on_error;
+	}
+	/* The mounted file is read-only hence the kernel can cache the entries,
+	 * attributes and data, with fuse 3 this is configured by mount_fuse_init
+	 * and with the low-level interface by the reply timeouts
+	 */
+	if( use_lowlevel == 0 )
+	{
+		if( fuse_opt_add_arg(
+		     &regfmount_fuse_arguments,
+		     "-o" ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable add fuse arguments.\n" );
+
+			goto on_error;
+		}
+		if( fuse_opt_add_arg(
+		     &regfmount_fuse_arguments,
+		     MOUNT_FUSE_CACHE_OPTIONS ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable add fuse arguments.\n" );
+
+			goto on_error;
+		}
+	}
+#endif /* !defined( HAVE_LIBFUSE3 ) */
+
 	if( option_extended_options != NULL )
 	{
 #if defined( HAVE_LIBFUSE3 )
 		// fuse_opt_add_arg: Assertion `!args->argv || args->allocated' failed.
 		regfmount_fuse_arguments.argc = 0;
 		regfmount_fuse_arguments.argv = NULL;
-#endif
+
 		/* This argument is required but ignored
 		 */
 		if( fuse_opt_add_arg(
@@ -339,6 +393,7 @@ int main( int argc, char * const argv[] )
 
 			goto on_error;
 		}
+#endif
 		if( fuse_opt_add_arg(
 		     &regfmount_fuse_arguments,
 		     "-o" ) != 0 )
@@ -360,6 +415,152 @@ int main( int argc, char * const argv[] )
 			goto on_error;
 		}
 	}
+	if( use_lowlevel != 0 )
+	{
+		if( memory_set(
+		     &regfmount_fuse_lowlevel_operations,
+		     0,
+		     sizeof( struct fuse_lowlevel_ops ) ) == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to clear fuse low-level operations.\n" );
+
+			goto on_error;
+		}
+		regfmount_fuse_lowlevel_operations.lookup      = &mount_fuse_lowlevel_lookup;
+		regfmount_fuse_lowlevel_operations.getattr     = &mount_fuse_lowlevel_getattr;
+		regfmount_fuse_lowlevel_operations.open        = &mount_fuse_lowlevel_open;
+		regfmount_fuse_lowlevel_operations.read        = &mount_fuse_lowlevel_read;
+		regfmount_fuse_lowlevel_operations.readdir     = &mount_fuse_lowlevel_readdir;
+		regfmount_fuse_lowlevel_operations.destroy     = &mount_fuse_destroy;
+
+#if defined( HAVE_LIBFUSE3 )
+		regfmount_fuse_lowlevel_operations.readdirplus = &mount_fuse_lowlevel_readdirplus;
+
+		regfmount_fuse_session = fuse_session_new(
+		                          &regfmount_fuse_arguments,
+		                          &regfmount_fuse_lowlevel_operations,
+		                          sizeof( struct fuse_lowlevel_ops ),
+		                          regfmount_mount_handle );
+
+		if( regfmount_fuse_session == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create fuse session.\n" );
+
+			goto on_error;
+		}
+		if( fuse_session_mount(
+		     regfmount_fuse_session,
+		     mount_point ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to fuse mount file system.\n" );
+
+			goto on_error;
+		}
+#else
+		regfmount_fuse_channel = fuse_mount(
+		                          mount_point,
+		                          &regfmount_fuse_arguments );
+
+		if( regfmount_fuse_channel == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create fuse channel.\n" );
+
+			goto on_error;
+		}
+		regfmount_fuse_session = fuse_lowlevel_new(
+		                          &regfmount_fuse_arguments,
+		                          &regfmount_fuse_lowlevel_operations,
+		                          sizeof( struct fuse_lowlevel_ops ),
+		                          regfmount_mount_handle );
+
+		if( regfmount_fuse_session == NULL )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to create fuse session.\n" );
+
+			goto on_error;
+		}
+		fuse_session_add_chan(
+		 regfmount_fuse_session,
+		 regfmount_fuse_channel );
+
+#endif /* defined( HAVE_LIBFUSE3 ) */
+
+		if( fuse_set_signal_handlers(
+		     regfmount_fuse_session ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set fuse signal handlers.\n" );
+
+			goto on_error;
+		}
+		if( verbose == 0 )
+		{
+			if( fuse_daemonize(
+			     0 ) != 0 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to daemonize fuse.\n" );
+
+				goto on_error;
+			}
+		}
+		/* The low-level operations do not share state between requests
+		 * hence they can be handled concurrently if libregf is thread-safe
+		 */
+#if defined( LIBREGF_HAVE_MULTI_THREAD_SUPPORT ) && defined( HAVE_LIBFUSE3 )
+		result = fuse_session_loop_mt(
+		          regfmount_fuse_session,
+		          0 );
+#elif defined( LIBREGF_HAVE_MULTI_THREAD_SUPPORT )
+		result = fuse_session_loop_mt(
+		          regfmount_fuse_session );
+#else
+		result = fuse_session_loop(
+		          regfmount_fuse_session );
+#endif
+		fuse_remove_signal_handlers(
+		 regfmount_fuse_session );
+
+		if( result != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to run fuse session loop.\n" );
+
+			goto on_error;
+		}
+#if defined( HAVE_LIBFUSE3 )
+		fuse_session_unmount(
+		 regfmount_fuse_session );
+#else
+		fuse_session_remove_chan(
+		 regfmount_fuse_channel );
+#endif
+		fuse_session_destroy(
+		 regfmount_fuse_session );
+
+#if !defined( HAVE_LIBFUSE3 )
+		fuse_unmount(
+		 mount_point,
+		 regfmount_fuse_channel );
+#endif
+		fuse_opt_free_args(
+		 &regfmount_fuse_arguments );
+
+		return( EXIT_SUCCESS );
+	}
 	if( memory_set(
 	     &regfmount_fuse_operations,
 	     0,
@@ -380,6 +581,10 @@ int main( int argc, char * const argv[] )
 	regfmount_fuse_operations.getattr    = &mount_fuse_getattr;
 	regfmount_fuse_operations.destroy    = &mount_fuse_destroy;
 
+#if defined( HAVE_LIBFUSE3 )
+	regfmount_fuse_operations.init       = &mount_fuse_init;
+#endif
+
 #if defined( HAVE_LIBFUSE3 )
 	regfmount_fuse_handle = fuse_new(
 	                         &regfmount_fuse_arguments,
@@ -646,6 +851,15 @@ on_error:
 		 &error );
 	}
 #if defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE )
+	if( regfmount_fuse_session != NULL )
+	{
+#if !defined( HAVE_LIBFUSE3 )
+		fuse_session_remove_chan(
+		 regfmount_fuse_channel );
+#endif
+		fuse_session_destroy(
+		 regfmount_fuse_session );
+	}
 	if( regfmount_fuse_handle != NULL )
 	{
 		fuse_destroy(
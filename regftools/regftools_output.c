@@ -22,8 +22,17 @@
 #include <common.h>
 #include <file_stream.h>
 #include <memory.h>
+#include <narrow_string.h>
 #include <types.h>
 
+#if defined( HAVE_STDARG_H ) || defined( WINAPI )
+#include <stdarg.h>
+#elif defined( HAVE_VARARGS_H )
+#include <varargs.h>
+#else
+#error Missing headers stdarg.h and varargs.h
+#endif
+
 #include "regftools_i18n.h"
 #include "regftools_libbfio.h"
 #include "regftools_libcerror.h"
@@ -198,3 +207,818 @@ void regftools_output_version_detailed_fprint(
 	 ")\n\n" );
 }
 
+/* Creates an output buffer
+ * The data is written to the stream when the buffer exceeds the flush size,
+ * if the stream is NULL the data is kept in memory
+ * Make sure the value output_buffer is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int regftools_output_buffer_initialize(
+     regftools_output_buffer_t **output_buffer,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	static char *function = "regftools_output_buffer_initialize";
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *output_buffer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid output buffer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*output_buffer = memory_allocate_structure(
+	                  regftools_output_buffer_t );
+
+	if( *output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create output buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *output_buffer,
+	     0,
+	     sizeof( regftools_output_buffer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear output buffer.",
+		 function );
+
+		goto on_error;
+	}
+	( *output_buffer )->stream = stream;
+
+	return( 1 );
+
+on_error:
+	if( *output_buffer != NULL )
+	{
+		memory_free(
+		 *output_buffer );
+
+		*output_buffer = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an output buffer
+ * Data that was not flushed is discarded
+ * Returns 1 if successful or -1 on error
+ */
+int regftools_output_buffer_free(
+     regftools_output_buffer_t **output_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "regftools_output_buffer_free";
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *output_buffer != NULL )
+	{
+		if( ( *output_buffer )->data != NULL )
+		{
+			memory_free(
+			 ( *output_buffer )->data );
+		}
+		memory_free(
+		 *output_buffer );
+
+		*output_buffer = NULL;
+	}
+	return( 1 );
+}
+
+/* Resizes an output buffer so that it can contain at least data size bytes
+ * Returns 1 if successful or -1 on error
+ */
+int regftools_output_buffer_resize(
+     regftools_output_buffer_t *output_buffer,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *reallocation      = NULL;
+	static char *function      = "regftools_output_buffer_resize";
+	size_t allocated_data_size = 0;
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum allocation size.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size <= output_buffer->allocated_data_size )
+	{
+		return( 1 );
+	}
+	/* Grow the buffer exponentially to limit the number of reallocations
+	 */
+	allocated_data_size = output_buffer->allocated_data_size;
+
+	if( allocated_data_size < 4096 )
+	{
+		allocated_data_size = 4096;
+	}
+	while( allocated_data_size < data_size )
+	{
+		if( allocated_data_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+		{
+			allocated_data_size = (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE;
+
+			break;
+		}
+		allocated_data_size *= 2;
+	}
+	reallocation = (uint8_t *) memory_reallocate(
+	                            output_buffer->data,
+	                            sizeof( uint8_t ) * allocated_data_size );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize data.",
+		 function );
+
+		return( -1 );
+	}
+	output_buffer->data                = reallocation;
+	output_buffer->allocated_data_size = allocated_data_size;
+
+	return( 1 );
+}
+
+/* Appends data to an output buffer
+ * Returns 1 if successful or -1 on error
+ */
+int regftools_output_buffer_append_data(
+     regftools_output_buffer_t *output_buffer,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "regftools_output_buffer_append_data";
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - output_buffer->data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_buffer->stream != NULL )
+	{
+		if( ( output_buffer->data_size + data_size ) > REGFTOOLS_OUTPUT_BUFFER_FLUSH_SIZE )
+		{
+			if( regftools_output_buffer_flush(
+			     output_buffer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to flush output buffer.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		/* Data that does not fit in the buffer is written directly
+		 */
+		if( data_size >= REGFTOOLS_OUTPUT_BUFFER_FLUSH_SIZE )
+		{
+			if( fwrite(
+			     data,
+			     sizeof( uint8_t ),
+			     data_size,
+			     output_buffer->stream ) != data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write data to stream.",
+				 function );
+
+				return( -1 );
+			}
+			return( 1 );
+		}
+	}
+	if( regftools_output_buffer_resize(
+	     output_buffer,
+	     output_buffer->data_size + data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     &( output_buffer->data[ output_buffer->data_size ] ),
+	     data,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data.",
+		 function );
+
+		return( -1 );
+	}
+	output_buffer->data_size += data_size;
+
+	return( 1 );
+}
+
+/* Appends data to an output buffer as a lower case hexadecimal string
+ * Returns 1 if successful or -1 on error
+ */
+int regftools_output_buffer_append_hexadecimal(
+     regftools_output_buffer_t *output_buffer,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	const char *hexadecimal_digits = "0123456789abcdef";
+	static char *function          = "regftools_output_buffer_append_hexadecimal";
+	size_t data_offset             = 0;
+	size_t output_data_offset      = 0;
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > ( ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - output_buffer->data_size ) / 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( output_buffer->stream != NULL )
+	 && ( ( output_buffer->data_size + ( data_size * 2 ) ) > REGFTOOLS_OUTPUT_BUFFER_FLUSH_SIZE ) )
+	{
+		if( regftools_output_buffer_flush(
+		     output_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush output buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( regftools_output_buffer_resize(
+	     output_buffer,
+	     output_buffer->data_size + ( data_size * 2 ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	output_data_offset = output_buffer->data_size;
+
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		output_buffer->data[ output_data_offset++ ] = (uint8_t) hexadecimal_digits[ data[ data_offset ] >> 4 ];
+		output_buffer->data[ output_data_offset++ ] = (uint8_t) hexadecimal_digits[ data[ data_offset ] & 0x0f ];
+	}
+	output_buffer->data_size = output_data_offset;
+
+	return( 1 );
+}
+
+/* Appends a narrow string to an output buffer
+ * Returns 1 if successful or -1 on error
+ */
+int regftools_output_buffer_append_string(
+     regftools_output_buffer_t *output_buffer,
+     const char *string,
+     libcerror_error_t **error )
+{
+	static char *function = "regftools_output_buffer_append_string";
+	size_t string_length  = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = narrow_string_length(
+	                 string );
+
+	if( regftools_output_buffer_append_data(
+	     output_buffer,
+	     (uint8_t *) string,
+	     string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends an unsigned 64-bit value to an output buffer as a decimal string
+ * Returns 1 if successful or -1 on error
+ */
+int regftools_output_buffer_append_unsigned_decimal(
+     regftools_output_buffer_t *output_buffer,
+     uint64_t value_64bit,
+     libcerror_error_t **error )
+{
+	uint8_t value_string[ 20 ];
+
+	static char *function     = "regftools_output_buffer_append_unsigned_decimal";
+	size_t value_string_index = 20;
+
+	do
+	{
+		value_string[ --value_string_index ] = (uint8_t) '0' + (uint8_t) ( value_64bit % 10 );
+
+		value_64bit /= 10;
+	}
+	while( value_64bit > 0 );
+
+	if( regftools_output_buffer_append_data(
+	     output_buffer,
+	     &( value_string[ value_string_index ] ),
+	     20 - value_string_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append decimal string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a signed 64-bit value to an output buffer as a decimal string
+ * Returns 1 if successful or -1 on error
+ */
+int regftools_output_buffer_append_signed_decimal(
+     regftools_output_buffer_t *output_buffer,
+     int64_t value_64bit,
+     libcerror_error_t **error )
+{
+	uint8_t value_string[ 21 ];
+
+	static char *function     = "regftools_output_buffer_append_signed_decimal";
+	size_t value_string_index = 21;
+	uint64_t absolute_value   = 0;
+
+	/* Negate in unsigned arithmetic to handle INT64_MIN
+	 */
+	if( value_64bit < 0 )
+	{
+		absolute_value = ~( (uint64_t) value_64bit ) + 1;
+	}
+	else
+	{
+		absolute_value = (uint64_t) value_64bit;
+	}
+	do
+	{
+		value_string[ --value_string_index ] = (uint8_t) '0' + (uint8_t) ( absolute_value % 10 );
+
+		absolute_value /= 10;
+	}
+	while( absolute_value > 0 );
+
+	if( value_64bit < 0 )
+	{
+		value_string[ --value_string_index ] = (uint8_t) '-';
+	}
+	if( regftools_output_buffer_append_data(
+	     output_buffer,
+	     &( value_string[ value_string_index ] ),
+	     21 - value_string_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append decimal string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a 64-bit value to an output buffer as a lower case hexadecimal string
+ * The string is padded with zeros to contain at least number of digits, similar to "%.8" PRIx64
+ * Returns 1 if successful or -1 on error
+ */
+int regftools_output_buffer_append_hexadecimal_integer(
+     regftools_output_buffer_t *output_buffer,
+     uint64_t value_64bit,
+     uint8_t number_of_digits,
+     libcerror_error_t **error )
+{
+	uint8_t value_string[ 16 ];
+
+	const char *hexadecimal_digits = "0123456789abcdef";
+	static char *function          = "regftools_output_buffer_append_hexadecimal_integer";
+	size_t value_string_index      = 16;
+
+	if( ( number_of_digits == 0 )
+	 || ( number_of_digits > 16 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of digits value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		value_string[ --value_string_index ] = (uint8_t) hexadecimal_digits[ value_64bit & 0x0f ];
+
+		value_64bit >>= 4;
+	}
+	while( ( value_64bit > 0 )
+	    || ( ( 16 - value_string_index ) < (size_t) number_of_digits ) );
+
+	if( regftools_output_buffer_append_data(
+	     output_buffer,
+	     &( value_string[ value_string_index ] ),
+	     16 - value_string_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append hexadecimal string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends a FILETIME value to an output buffer as a POSIX timestamp with a nanosecond fraction
+ * e.g. 1234567890.123456700 as used by bodyfiles. A FILETIME before the POSIX epoch is appended
+ * as a negative timestamp. The fraction is determined with integer arithmetic and is exact.
+ * Returns 1 if successful or -1 on error
+ */
+int regftools_output_buffer_append_filetime_as_posix_time(
+     regftools_output_buffer_t *output_buffer,
+     uint64_t filetime,
+     libcerror_error_t **error )
+{
+	uint8_t value_string[ 32 ];
+
+	static char *function      = "regftools_output_buffer_append_filetime_as_posix_time";
+	size_t value_string_index  = 32;
+	uint64_t number_of_seconds = 0;
+	uint64_t number_of_ticks   = 0;
+	uint32_t fraction          = 0;
+	uint8_t digit_index        = 0;
+	uint8_t is_negative        = 0;
+
+	if( filetime >= REGFTOOLS_OUTPUT_FILETIME_POSIX_EPOCH )
+	{
+		number_of_ticks = filetime - REGFTOOLS_OUTPUT_FILETIME_POSIX_EPOCH;
+	}
+	else
+	{
+		number_of_ticks = REGFTOOLS_OUTPUT_FILETIME_POSIX_EPOCH - filetime;
+		is_negative     = 1;
+	}
+	number_of_seconds = number_of_ticks / 10000000;
+	fraction          = (uint32_t) ( number_of_ticks % 10000000 );
+
+	/* A FILETIME tick is 100 nano seconds
+	 */
+	value_string[ --value_string_index ] = (uint8_t) '0';
+	value_string[ --value_string_index ] = (uint8_t) '0';
+
+	for( digit_index = 0;
+	     digit_index < 7;
+	     digit_index++ )
+	{
+		value_string[ --value_string_index ] = (uint8_t) '0' + (uint8_t) ( fraction % 10 );
+
+		fraction /= 10;
+	}
+	value_string[ --value_string_index ] = (uint8_t) '.';
+
+	do
+	{
+		value_string[ --value_string_index ] = (uint8_t) '0' + (uint8_t) ( number_of_seconds % 10 );
+
+		number_of_seconds /= 10;
+	}
+	while( number_of_seconds > 0 );
+
+	if( is_negative != 0 )
+	{
+		value_string[ --value_string_index ] = (uint8_t) '-';
+	}
+	if( regftools_output_buffer_append_data(
+	     output_buffer,
+	     &( value_string[ value_string_index ] ),
+	     32 - value_string_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append POSIX timestamp string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Prints a formatted string to an output buffer
+ * Returns the number of printed characters if successful or -1 on error
+ */
+int regftools_output_buffer_printf(
+     regftools_output_buffer_t *output_buffer,
+     const char *format,
+     ... )
+{
+	va_list argument_list;
+
+	size_t remaining_data_size = 0;
+	int print_count            = 0;
+
+	if( output_buffer == NULL )
+	{
+		return( -1 );
+	}
+	if( format == NULL )
+	{
+		return( -1 );
+	}
+	/* Make sure there is room for the end-of-string character
+	 */
+	if( regftools_output_buffer_resize(
+	     output_buffer,
+	     output_buffer->data_size + 256,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	remaining_data_size = output_buffer->allocated_data_size - output_buffer->data_size;
+
+	va_start(
+	 argument_list,
+	 format );
+
+	print_count = narrow_string_vsnprintf(
+	               (char *) &( output_buffer->data[ output_buffer->data_size ] ),
+	               remaining_data_size,
+	               format,
+	               argument_list );
+
+	va_end(
+	 argument_list );
+
+	if( print_count < 0 )
+	{
+		return( -1 );
+	}
+	if( (size_t) print_count >= remaining_data_size )
+	{
+		if( regftools_output_buffer_resize(
+		     output_buffer,
+		     output_buffer->data_size + (size_t) print_count + 1,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+		remaining_data_size = output_buffer->allocated_data_size - output_buffer->data_size;
+
+		va_start(
+		 argument_list,
+		 format );
+
+		print_count = narrow_string_vsnprintf(
+		               (char *) &( output_buffer->data[ output_buffer->data_size ] ),
+		               remaining_data_size,
+		               format,
+		               argument_list );
+
+		va_end(
+		 argument_list );
+
+		if( ( print_count < 0 )
+		 || ( (size_t) print_count >= remaining_data_size ) )
+		{
+			return( -1 );
+		}
+	}
+	output_buffer->data_size += (size_t) print_count;
+
+	if( ( output_buffer->stream != NULL )
+	 && ( output_buffer->data_size >= REGFTOOLS_OUTPUT_BUFFER_FLUSH_SIZE ) )
+	{
+		if( regftools_output_buffer_flush(
+		     output_buffer,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	return( print_count );
+}
+
+/* Writes the data of an output buffer to its stream
+ * Returns 1 if successful or -1 on error
+ */
+int regftools_output_buffer_flush(
+     regftools_output_buffer_t *output_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "regftools_output_buffer_flush";
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_buffer->stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid output buffer - missing stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_buffer->data_size > 0 )
+	{
+		if( fwrite(
+		     output_buffer->data,
+		     sizeof( uint8_t ),
+		     output_buffer->data_size,
+		     output_buffer->stream ) != output_buffer->data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write data to stream.",
+			 function );
+
+			return( -1 );
+		}
+		output_buffer->data_size = 0;
+	}
+	return( 1 );
+}
+
@@ -32,6 +32,35 @@
 extern "C" {
 #endif
 
+/* The size at which the data of an output buffer is written to its stream
+ */
+#define REGFTOOLS_OUTPUT_BUFFER_FLUSH_SIZE	65536
+
+/* The FILETIME value of the POSIX epoch 1970-01-01 00:00:00 UTC
+ */
+#define REGFTOOLS_OUTPUT_FILETIME_POSIX_EPOCH	(uint64_t) 116444736000000000UL
+
+typedef struct regftools_output_buffer regftools_output_buffer_t;
+
+struct regftools_output_buffer
+{
+	/* The stream or NULL if the data is kept in memory
+	 */
+	FILE *stream;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The allocated data size
+	 */
+	size_t allocated_data_size;
+};
+
 int regftools_output_initialize(
      int stdio_mode,
      libcerror_error_t **error );
@@ -47,6 +76,67 @@ void regftools_output_version_detailed_fprint(
       FILE *stream,
       const char *program );
 
+int regftools_output_buffer_initialize(
+     regftools_output_buffer_t **output_buffer,
+     FILE *stream,
+     libcerror_error_t **error );
+
+int regftools_output_buffer_free(
+     regftools_output_buffer_t **output_buffer,
+     libcerror_error_t **error );
+
+int regftools_output_buffer_resize(
+     regftools_output_buffer_t *output_buffer,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int regftools_output_buffer_append_data(
+     regftools_output_buffer_t *output_buffer,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int regftools_output_buffer_append_hexadecimal(
+     regftools_output_buffer_t *output_buffer,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int regftools_output_buffer_append_string(
+     regftools_output_buffer_t *output_buffer,
+     const char *string,
+     libcerror_error_t **error );
+
+int regftools_output_buffer_append_unsigned_decimal(
+     regftools_output_buffer_t *output_buffer,
+     uint64_t value_64bit,
+     libcerror_error_t **error );
+
+int regftools_output_buffer_append_signed_decimal(
+     regftools_output_buffer_t *output_buffer,
+     int64_t value_64bit,
+     libcerror_error_t **error );
+
+int regftools_output_buffer_append_hexadecimal_integer(
+     regftools_output_buffer_t *output_buffer,
+     uint64_t value_64bit,
+     uint8_t number_of_digits,
+     libcerror_error_t **error );
+
+int regftools_output_buffer_append_filetime_as_posix_time(
+     regftools_output_buffer_t *output_buffer,
+     uint64_t filetime,
+     libcerror_error_t **error );
+
+int regftools_output_buffer_printf(
+     regftools_output_buffer_t *output_buffer,
+     const char *format,
+     ... );
+
+int regftools_output_buffer_flush(
+     regftools_output_buffer_t *output_buffer,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
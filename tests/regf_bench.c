@@ -0,0 +1,2299 @@
+/*
+ * Library benchmark program
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_SYS_RESOURCE_H )
+#include <sys/resource.h>
+#endif
+
+#if defined( HAVE_CLOCK_GETTIME )
+#include <time.h>
+#endif
+
+#if defined( WINAPI )
+#include <windows.h>
+#include <psapi.h>
+#endif
+
+#include "regf_test_getopt.h"
+#include "regf_test_libcerror.h"
+#include "regf_test_libregf.h"
+#include "regf_test_unused.h"
+
+#if defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT )
+#include "../libregf/libregf_checksum.h"
+#endif
+
+/* The size of the fixed part of a named key
+ */
+#define REGF_BENCH_NAMED_KEY_SIZE		76
+
+/* The size of the fixed part of a value key
+ */
+#define REGF_BENCH_VALUE_KEY_SIZE		20
+
+/* The maximum size of the data in a big data segment
+ */
+#define REGF_BENCH_DATA_BLOCK_SEGMENT_SIZE	16344
+
+/* The size of the data of a big data value
+ */
+#define REGF_BENCH_BIG_DATA_SIZE		( ( 4 * REGF_BENCH_DATA_BLOCK_SEGMENT_SIZE ) + 1024 )
+
+/* The size of the data of a regular binary data value
+ */
+#define REGF_BENCH_BINARY_DATA_SIZE		64
+
+/* The maximum depth of the generated key tree
+ */
+#define REGF_BENCH_MAXIMUM_DEPTH		128
+
+/* The maximum size of a key path
+ */
+#define REGF_BENCH_MAXIMUM_PATH_SIZE		( REGF_BENCH_MAXIMUM_DEPTH * 12 ) + 1
+
+/* The size of the buffer of the checksum benchmark
+ */
+#define REGF_BENCH_CHECKSUM_BUFFER_SIZE		( 1024 * 1024 )
+
+typedef struct regf_bench_parameters regf_bench_parameters_t;
+
+struct regf_bench_parameters
+{
+	/* The number of keys, including the root key
+	 */
+	uint32_t number_of_keys;
+
+	/* The maximum number of sub keys per key
+	 */
+	uint32_t fan_out;
+
+	/* The number of values per key
+	 */
+	uint32_t number_of_values;
+
+	/* The percentage of binary data values that are stored as big data
+	 */
+	uint32_t big_data_ratio;
+
+	/* The number of path lookups
+	 */
+	uint32_t number_of_lookups;
+
+	/* The number of open iterations
+	 */
+	uint32_t number_of_open_iterations;
+
+	/* The number of threads used by the key walk
+	 */
+	uint32_t number_of_threads;
+
+	/* The number of checksum iterations
+	 */
+	uint32_t number_of_checksum_iterations;
+
+	/* The seed of the pseudo random number generator
+	 */
+	uint32_t seed;
+};
+
+typedef struct regf_bench_hive regf_bench_hive_t;
+
+struct regf_bench_hive
+{
+	/* The hive bins data
+	 */
+	uint8_t *data;
+
+	/* The allocated size of the hive bins data
+	 */
+	size_t allocated_size;
+
+	/* The used size of the hive bins data
+	 */
+	size_t data_size;
+
+	/* The offset of the current hive bin
+	 */
+	size_t hive_bin_offset;
+
+	/* The size of the current hive bin
+	 */
+	size_t hive_bin_size;
+
+	/* The offset of the first free byte in the current hive bin
+	 */
+	size_t hive_bin_free_offset;
+
+	/* The root key offset
+	 */
+	uint32_t root_key_offset;
+
+	/* The state of the pseudo random number generator
+	 */
+	uint32_t random_state;
+};
+
+typedef struct regf_bench_walk_statistics regf_bench_walk_statistics_t;
+
+struct regf_bench_walk_statistics
+{
+	/* The number of keys
+	 */
+	uint64_t number_of_keys;
+
+	/* The number of values
+	 */
+	uint64_t number_of_values;
+
+	/* The number of value data bytes decoded
+	 */
+	uint64_t value_data_size;
+
+	/* Value to indicate the values should be decoded
+	 */
+	int decode_values;
+
+	/* The value data buffer
+	 */
+	uint8_t *value_data;
+
+	/* The value data buffer size
+	 */
+	size_t value_data_buffer_size;
+};
+
+/* Prints usage information
+ */
+void regf_bench_usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use regf_bench to benchmark libregf using a synthetic hive.\n\n" );
+
+	fprintf( stream, "Usage: regf_bench [ -b ratio ] [ -c iterations ] [ -f fan_out ]\n"
+	                 "                  [ -i iterations ] [ -k keys ] [ -l lookups ]\n"
+	                 "                  [ -s seed ] [ -t threads ] [ -v values ] [ -h ]\n"
+	                 "                  [ filename ]\n\n" );
+
+	fprintf( stream, "\tfilename: the file the synthetic hive is written to, default is\n"
+	                 "\t          regf_bench.hiv, the file is removed afterwards\n\n" );
+	fprintf( stream, "\t-b: percentage of binary values stored as big data, default is 5\n" );
+	fprintf( stream, "\t-c: number of checksum iterations over a 1 MiB buffer, default is\n"
+	                 "\t    1000\n" );
+	fprintf( stream, "\t-f: maximum number of sub keys per key, default is 16\n" );
+	fprintf( stream, "\t-h: shows this help\n" );
+	fprintf( stream, "\t-i: number of open iterations, default is 100\n" );
+	fprintf( stream, "\t-k: number of keys, including the root key, default is 10000\n" );
+	fprintf( stream, "\t-l: number of path lookups, default is 10000\n" );
+	fprintf( stream, "\t-s: seed of the pseudo random number generator, default is 1\n" );
+	fprintf( stream, "\t-t: number of threads of the key walk, default is 1\n" );
+	fprintf( stream, "\t-v: number of values per key, default is 4\n\n" );
+
+	fprintf( stream, "The results are written to stdout as one JSON object per line.\n" );
+}
+
+/* Copies a decimal string into an unsigned 32-bit value
+ * Returns 1 if successful or -1 on error
+ */
+int regf_bench_string_copy_to_uint32(
+     const system_character_t *string,
+     uint32_t *value_32bit )
+{
+	uint64_t safe_value_64bit = 0;
+	size_t string_index       = 0;
+
+	if( ( string == NULL )
+	 || ( value_32bit == NULL ) )
+	{
+		return( -1 );
+	}
+	if( string[ 0 ] == 0 )
+	{
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string[ string_index ] != 0;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			return( -1 );
+		}
+		safe_value_64bit *= 10;
+		safe_value_64bit += (uint64_t) ( string[ string_index ] - (system_character_t) '0' );
+
+		if( safe_value_64bit > (uint64_t) UINT32_MAX )
+		{
+			return( -1 );
+		}
+	}
+	*value_32bit = (uint32_t) safe_value_64bit;
+
+	return( 1 );
+}
+
+/* Retrieves a monotonic time stamp in nanoseconds
+ * Returns the time stamp or 0 on error
+ */
+uint64_t regf_bench_get_time(
+          void )
+{
+#if defined( WINAPI )
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+
+	if( ( QueryPerformanceFrequency(
+	       &frequency ) == 0 )
+	 || ( QueryPerformanceCounter(
+	       &counter ) == 0 ) )
+	{
+		return( 0 );
+	}
+	return( (uint64_t) ( ( (double) counter.QuadPart * 1000000000.0 ) / (double) frequency.QuadPart ) );
+
+#elif defined( HAVE_CLOCK_GETTIME ) && defined( CLOCK_MONOTONIC )
+	struct timespec time_specification;
+
+	if( clock_gettime(
+	     CLOCK_MONOTONIC,
+	     &time_specification ) != 0 )
+	{
+		return( 0 );
+	}
+	return( ( (uint64_t) time_specification.tv_sec * 1000000000UL ) + (uint64_t) time_specification.tv_nsec );
+
+#else
+	return( 0 );
+
+#endif
+}
+
+/* Retrieves the peak resident set size in kilobytes
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int regf_bench_get_peak_resident_set_size(
+     uint64_t *peak_resident_set_size )
+{
+#if defined( WINAPI )
+	PROCESS_MEMORY_COUNTERS memory_counters;
+
+#elif defined( HAVE_GETRUSAGE )
+	struct rusage resource_usage;
+
+#endif
+
+	if( peak_resident_set_size == NULL )
+	{
+		return( -1 );
+	}
+#if defined( WINAPI )
+	if( GetProcessMemoryInfo(
+	     GetCurrentProcess(),
+	     &memory_counters,
+	     sizeof( PROCESS_MEMORY_COUNTERS ) ) == 0 )
+	{
+		return( -1 );
+	}
+	*peak_resident_set_size = (uint64_t) memory_counters.PeakWorkingSetSize / 1024;
+
+	return( 1 );
+
+#elif defined( HAVE_GETRUSAGE )
+	if( getrusage(
+	     RUSAGE_SELF,
+	     &resource_usage ) != 0 )
+	{
+		return( -1 );
+	}
+#if defined( __APPLE__ )
+	/* On Mac OS X ru_maxrss is in bytes
+	 */
+	*peak_resident_set_size = (uint64_t) resource_usage.ru_maxrss / 1024;
+#else
+	*peak_resident_set_size = (uint64_t) resource_usage.ru_maxrss;
+#endif
+	return( 1 );
+
+#else
+	return( 0 );
+
+#endif
+}
+
+/* Prints the result of a benchmark as a JSON object
+ */
+void regf_bench_result_fprint(
+      FILE *stream,
+      const char *name,
+      uint64_t number_of_operations,
+      uint64_t elapsed_time )
+{
+	uint64_t time_per_operation = 0;
+
+	if( ( stream == NULL )
+	 || ( name == NULL ) )
+	{
+		return;
+	}
+	if( number_of_operations > 0 )
+	{
+		time_per_operation = elapsed_time / number_of_operations;
+	}
+	fprintf(
+	 stream,
+	 "{\"benchmark\": \"%s\", \"operations\": %" PRIu64 ", \"elapsed_ns\": %" PRIu64 ", \"ns_per_operation\": %" PRIu64 "}\n",
+	 name,
+	 number_of_operations,
+	 elapsed_time,
+	 time_per_operation );
+}
+
+/* Retrieves the next pseudo random number using xorshift32
+ */
+uint32_t regf_bench_hive_get_random(
+          regf_bench_hive_t *hive )
+{
+	hive->random_state ^= hive->random_state << 13;
+	hive->random_state ^= hive->random_state >> 17;
+	hive->random_state ^= hive->random_state << 5;
+
+	return( hive->random_state );
+}
+
+/* Marks the remainder of the current hive bin as an unallocated cell
+ */
+void regf_bench_hive_close_hive_bin(
+      regf_bench_hive_t *hive )
+{
+	size_t remaining_size = 0;
+
+	remaining_size = hive->hive_bin_size - ( hive->hive_bin_free_offset - hive->hive_bin_offset );
+
+	if( remaining_size > 0 )
+	{
+		/* Unallocated cells have a positive size
+		 */
+		byte_stream_copy_from_uint32_little_endian(
+		 &( hive->data[ hive->hive_bin_free_offset ] ),
+		 (uint32_t) remaining_size );
+
+		hive->hive_bin_free_offset += remaining_size;
+	}
+}
+
+/* Allocates a cell in the hive bins data
+ * The cell offset is relative to the start of the hive bins data and
+ * points to the cell size
+ * Returns 1 if successful or -1 on error
+ */
+int regf_bench_hive_allocate_cell(
+     regf_bench_hive_t *hive,
+     size_t cell_data_size,
+     uint32_t *cell_offset )
+{
+	uint8_t *reallocation  = NULL;
+	size_t allocation_size = 0;
+	size_t cell_size       = 0;
+	size_t hive_bin_size   = 0;
+
+	if( ( hive == NULL )
+	 || ( cell_offset == NULL ) )
+	{
+		return( -1 );
+	}
+	if( cell_data_size > (size_t) ( INT32_MAX - 4096 ) )
+	{
+		return( -1 );
+	}
+	cell_size = ( 4 + cell_data_size + 7 ) & ~( (size_t) 7 );
+
+	if( cell_size > ( hive->hive_bin_size - ( hive->hive_bin_free_offset - hive->hive_bin_offset ) ) )
+	{
+		if( hive->hive_bin_size > 0 )
+		{
+			regf_bench_hive_close_hive_bin(
+			 hive );
+		}
+		hive_bin_size = ( 32 + cell_size + 4095 ) & ~( (size_t) 4095 );
+
+		if( hive_bin_size > ( (size_t) INT32_MAX - hive->data_size ) )
+		{
+			return( -1 );
+		}
+		if( ( hive->data_size + hive_bin_size ) > hive->allocated_size )
+		{
+			allocation_size = hive->allocated_size * 2;
+
+			if( allocation_size < ( hive->data_size + hive_bin_size ) )
+			{
+				allocation_size = hive->data_size + hive_bin_size;
+			}
+			reallocation = (uint8_t *) memory_reallocate(
+			                            hive->data,
+			                            sizeof( uint8_t ) * allocation_size );
+
+			if( reallocation == NULL )
+			{
+				return( -1 );
+			}
+			hive->data           = reallocation;
+			hive->allocated_size = allocation_size;
+		}
+		if( memory_set(
+		     &( hive->data[ hive->data_size ] ),
+		     0,
+		     hive_bin_size ) == NULL )
+		{
+			return( -1 );
+		}
+		hive->data[ hive->data_size ]     = (uint8_t) 'h';
+		hive->data[ hive->data_size + 1 ] = (uint8_t) 'b';
+		hive->data[ hive->data_size + 2 ] = (uint8_t) 'i';
+		hive->data[ hive->data_size + 3 ] = (uint8_t) 'n';
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( hive->data[ hive->data_size + 4 ] ),
+		 (uint32_t) hive->data_size );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( hive->data[ hive->data_size + 8 ] ),
+		 (uint32_t) hive_bin_size );
+
+		hive->hive_bin_offset      = hive->data_size;
+		hive->hive_bin_size        = hive_bin_size;
+		hive->hive_bin_free_offset = hive->data_size + 32;
+		hive->data_size           += hive_bin_size;
+	}
+	*cell_offset = (uint32_t) hive->hive_bin_free_offset;
+
+	/* Allocated cells have a negative size
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( hive->data[ hive->hive_bin_free_offset ] ),
+	 (uint32_t) ( -1 * (int32_t) cell_size ) );
+
+	hive->hive_bin_free_offset += cell_size;
+
+	return( 1 );
+}
+
+/* Retrieves the name of a generated key
+ * Returns the length of the name or 0 on error
+ */
+size_t regf_bench_get_key_name(
+        uint32_t key_index,
+        char *name,
+        size_t name_size )
+{
+	int print_count = 0;
+
+	if( key_index == 0 )
+	{
+		print_count = narrow_string_snprintf(
+		               name,
+		               name_size,
+		               "ROOT" );
+	}
+	else
+	{
+		print_count = narrow_string_snprintf(
+		               name,
+		               name_size,
+		               "key%08" PRIu32 "",
+		               key_index );
+	}
+	if( ( print_count < 0 )
+	 || ( (size_t) print_count >= name_size ) )
+	{
+		return( 0 );
+	}
+	return( (size_t) print_count );
+}
+
+/* Retrieves the path of a generated key
+ * The sub keys of key N are the keys ( N * fan_out ) + 1 to ( N * fan_out ) + fan_out
+ * Returns 1 if successful or -1 on error
+ */
+int regf_bench_get_key_path(
+     uint32_t key_index,
+     uint32_t fan_out,
+     char *path,
+     size_t path_size,
+     size_t *path_length )
+{
+	char name[ 16 ];
+
+	uint32_t key_indexes[ REGF_BENCH_MAXIMUM_DEPTH ];
+
+	size_t name_length = 0;
+	size_t path_index  = 0;
+	int depth          = 0;
+
+	if( ( path == NULL )
+	 || ( path_length == NULL ) )
+	{
+		return( -1 );
+	}
+	while( key_index != 0 )
+	{
+		if( depth >= REGF_BENCH_MAXIMUM_DEPTH )
+		{
+			return( -1 );
+		}
+		key_indexes[ depth++ ] = key_index;
+
+		key_index = ( key_index - 1 ) / fan_out;
+	}
+	while( depth > 0 )
+	{
+		depth--;
+
+		name_length = regf_bench_get_key_name(
+		               key_indexes[ depth ],
+		               name,
+		               16 );
+
+		if( ( name_length == 0 )
+		 || ( ( path_index + name_length + 2 ) > path_size ) )
+		{
+			return( -1 );
+		}
+		path[ path_index++ ] = '\\';
+
+		if( memory_copy(
+		     &( path[ path_index ] ),
+		     name,
+		     name_length ) == NULL )
+		{
+			return( -1 );
+		}
+		path_index += name_length;
+	}
+	path[ path_index ] = 0;
+
+	*path_length = path_index;
+
+	return( 1 );
+}
+
+/* Calculates the hash of an ASCII key name as stored in a "lh" sub keys list
+ */
+uint32_t regf_bench_calculate_name_hash(
+          const char *name,
+          size_t name_length )
+{
+	size_t name_index  = 0;
+	uint32_t name_hash = 0;
+	char character     = 0;
+
+	for( name_index = 0;
+	     name_index < name_length;
+	     name_index++ )
+	{
+		character = name[ name_index ];
+
+		if( ( character >= 'a' )
+		 && ( character <= 'z' ) )
+		{
+			character -= 'a' - 'A';
+		}
+		name_hash *= 37;
+		name_hash += (uint32_t) character;
+	}
+	return( name_hash );
+}
+
+/* Generates a value key and its data
+ * Returns 1 if successful or -1 on error
+ */
+int regf_bench_hive_generate_value(
+     regf_bench_hive_t *hive,
+     regf_bench_parameters_t *parameters,
+     uint32_t key_index,
+     uint32_t value_index,
+     uint32_t *value_key_offset )
+{
+	char name[ 16 ];
+	char string[ 32 ];
+
+	uint8_t *value_key_data     = NULL;
+	size_t name_length          = 0;
+	size_t segment_size         = 0;
+	size_t string_index         = 0;
+	size_t string_size          = 0;
+	uint32_t data_offset        = 0;
+	uint32_t data_size          = 0;
+	uint32_t list_offset        = 0;
+	uint32_t number_of_segments = 0;
+	uint32_t segment_index      = 0;
+	uint32_t segment_offset     = 0;
+	uint32_t value_type         = 0;
+	int print_count             = 0;
+
+	print_count = narrow_string_snprintf(
+	               name,
+	               16,
+	               "value%04" PRIu32 "",
+	               value_index );
+
+	if( ( print_count < 0 )
+	 || ( print_count >= 16 ) )
+	{
+		return( -1 );
+	}
+	name_length = (size_t) print_count;
+
+	switch( value_index % 3 )
+	{
+		case 0:
+			/* The value data is stored in the data offset of the value key
+			 */
+			value_type  = LIBREGF_VALUE_TYPE_INTEGER_32BIT_LITTLE_ENDIAN;
+			data_size   = 0x80000000UL | 4;
+			data_offset = key_index ^ value_index;
+
+			break;
+
+		case 1:
+			value_type = LIBREGF_VALUE_TYPE_STRING;
+
+			print_count = narrow_string_snprintf(
+			               string,
+			               32,
+			               "string %" PRIu32 ".%" PRIu32 "",
+			               key_index,
+			               value_index );
+
+			if( ( print_count < 0 )
+			 || ( print_count >= 32 ) )
+			{
+				return( -1 );
+			}
+			string_size = (size_t) print_count + 1;
+			data_size   = (uint32_t) ( string_size * 2 );
+
+			if( regf_bench_hive_allocate_cell(
+			     hive,
+			     (size_t) data_size,
+			     &data_offset ) != 1 )
+			{
+				return( -1 );
+			}
+			for( string_index = 0;
+			     string_index < string_size;
+			     string_index++ )
+			{
+				hive->data[ data_offset + 4 + ( string_index * 2 ) ]     = (uint8_t) string[ string_index ];
+				hive->data[ data_offset + 4 + ( string_index * 2 ) + 1 ] = 0;
+			}
+			break;
+
+		default:
+			value_type = LIBREGF_VALUE_TYPE_BINARY_DATA;
+
+			if( ( regf_bench_hive_get_random( hive ) % 100 ) < parameters->big_data_ratio )
+			{
+				/* The value data is stored in segments referenced by a data block key
+				 */
+				data_size          = REGF_BENCH_BIG_DATA_SIZE;
+				number_of_segments = ( data_size + REGF_BENCH_DATA_BLOCK_SEGMENT_SIZE - 1 ) / REGF_BENCH_DATA_BLOCK_SEGMENT_SIZE;
+
+				if( regf_bench_hive_allocate_cell(
+				     hive,
+				     (size_t) ( 4 * number_of_segments ),
+				     &list_offset ) != 1 )
+				{
+					return( -1 );
+				}
+				for( segment_index = 0;
+				     segment_index < number_of_segments;
+				     segment_index++ )
+				{
+					segment_size = REGF_BENCH_DATA_BLOCK_SEGMENT_SIZE;
+
+					if( segment_index == ( number_of_segments - 1 ) )
+					{
+						segment_size = data_size - ( segment_index * REGF_BENCH_DATA_BLOCK_SEGMENT_SIZE );
+					}
+					if( regf_bench_hive_allocate_cell(
+					     hive,
+					     segment_size,
+					     &segment_offset ) != 1 )
+					{
+						return( -1 );
+					}
+					memory_set(
+					 &( hive->data[ segment_offset + 4 ] ),
+					 (int) ( ( key_index + segment_index ) & 0xff ),
+					 segment_size );
+
+					byte_stream_copy_from_uint32_little_endian(
+					 &( hive->data[ list_offset + 4 + ( segment_index * 4 ) ] ),
+					 segment_offset );
+				}
+				if( regf_bench_hive_allocate_cell(
+				     hive,
+				     8,
+				     &data_offset ) != 1 )
+				{
+					return( -1 );
+				}
+				hive->data[ data_offset + 4 ] = (uint8_t) 'd';
+				hive->data[ data_offset + 5 ] = (uint8_t) 'b';
+
+				byte_stream_copy_from_uint16_little_endian(
+				 &( hive->data[ data_offset + 6 ] ),
+				 (uint16_t) number_of_segments );
+
+				byte_stream_copy_from_uint32_little_endian(
+				 &( hive->data[ data_offset + 8 ] ),
+				 list_offset );
+			}
+			else
+			{
+				data_size = REGF_BENCH_BINARY_DATA_SIZE;
+
+				if( regf_bench_hive_allocate_cell(
+				     hive,
+				     (size_t) data_size,
+				     &data_offset ) != 1 )
+				{
+					return( -1 );
+				}
+				memory_set(
+				 &( hive->data[ data_offset + 4 ] ),
+				 (int) ( key_index & 0xff ),
+				 (size_t) data_size );
+			}
+			break;
+	}
+	if( regf_bench_hive_allocate_cell(
+	     hive,
+	     REGF_BENCH_VALUE_KEY_SIZE + name_length,
+	     value_key_offset ) != 1 )
+	{
+		return( -1 );
+	}
+	value_key_data = &( hive->data[ *value_key_offset + 4 ] );
+
+	value_key_data[ 0 ] = (uint8_t) 'v';
+	value_key_data[ 1 ] = (uint8_t) 'k';
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( value_key_data[ 2 ] ),
+	 (uint16_t) name_length );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( value_key_data[ 4 ] ),
+	 data_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( value_key_data[ 8 ] ),
+	 data_offset );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( value_key_data[ 12 ] ),
+	 value_type );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( value_key_data[ 16 ] ),
+	 0x0001 );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( value_key_data[ 18 ] ),
+	 0 );
+
+	if( memory_copy(
+	     &( value_key_data[ REGF_BENCH_VALUE_KEY_SIZE ] ),
+	     name,
+	     name_length ) == NULL )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Generates the hive bins of a synthetic hive
+ * The named keys are generated first so that sub key lists can reference them
+ * Returns 1 if successful or -1 on error
+ */
+int regf_bench_hive_generate(
+     regf_bench_hive_t *hive,
+     regf_bench_parameters_t *parameters )
+{
+	char name[ 16 ];
+
+	uint8_t *named_key_data       = NULL;
+	uint32_t *key_offsets         = NULL;
+	uint32_t *value_key_offsets   = NULL;
+	uint64_t first_sub_key_index  = 0;
+	size_t name_length            = 0;
+	uint32_t key_index            = 0;
+	uint32_t number_of_sub_keys   = 0;
+	uint32_t sub_key_index        = 0;
+	uint32_t sub_keys_list_offset = 0;
+	uint32_t value_index          = 0;
+	uint32_t values_list_offset   = 0;
+
+	if( ( hive == NULL )
+	 || ( parameters == NULL ) )
+	{
+		return( -1 );
+	}
+	key_offsets = (uint32_t *) memory_allocate(
+	                            sizeof( uint32_t ) * parameters->number_of_keys );
+
+	if( key_offsets == NULL )
+	{
+		goto on_error;
+	}
+	if( parameters->number_of_values > 0 )
+	{
+		value_key_offsets = (uint32_t *) memory_allocate(
+		                                  sizeof( uint32_t ) * parameters->number_of_values );
+
+		if( value_key_offsets == NULL )
+		{
+			goto on_error;
+		}
+	}
+	for( key_index = 0;
+	     key_index < parameters->number_of_keys;
+	     key_index++ )
+	{
+		name_length = regf_bench_get_key_name(
+		               key_index,
+		               name,
+		               16 );
+
+		if( name_length == 0 )
+		{
+			goto on_error;
+		}
+		if( regf_bench_hive_allocate_cell(
+		     hive,
+		     REGF_BENCH_NAMED_KEY_SIZE + name_length,
+		     &( key_offsets[ key_index ] ) ) != 1 )
+		{
+			goto on_error;
+		}
+		named_key_data = &( hive->data[ key_offsets[ key_index ] + 4 ] );
+
+		if( memory_set(
+		     named_key_data,
+		     0,
+		     REGF_BENCH_NAMED_KEY_SIZE ) == NULL )
+		{
+			goto on_error;
+		}
+		named_key_data[ 0 ] = (uint8_t) 'n';
+		named_key_data[ 1 ] = (uint8_t) 'k';
+
+		/* The root key is marked as hive entry and no delete
+		 */
+		byte_stream_copy_from_uint16_little_endian(
+		 &( named_key_data[ 2 ] ),
+		 ( key_index == 0 ) ? 0x002c : 0x0020 );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( named_key_data[ 16 ] ),
+		 ( key_index == 0 ) ? 0 : key_offsets[ ( key_index - 1 ) / parameters->fan_out ] );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( named_key_data[ 28 ] ),
+		 0xffffffffUL );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( named_key_data[ 32 ] ),
+		 0xffffffffUL );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( named_key_data[ 40 ] ),
+		 0xffffffffUL );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( named_key_data[ 44 ] ),
+		 0xffffffffUL );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 &( named_key_data[ 48 ] ),
+		 0xffffffffUL );
+
+		byte_stream_copy_from_uint16_little_endian(
+		 &( named_key_data[ 72 ] ),
+		 (uint16_t) name_length );
+
+		if( memory_copy(
+		     &( named_key_data[ REGF_BENCH_NAMED_KEY_SIZE ] ),
+		     name,
+		     name_length ) == NULL )
+		{
+			goto on_error;
+		}
+	}
+	hive->root_key_offset = key_offsets[ 0 ];
+
+	for( key_index = 0;
+	     key_index < parameters->number_of_keys;
+	     key_index++ )
+	{
+		/* The sub keys are stored in a "lh" sub keys list sorted by name
+		 */
+		number_of_sub_keys  = 0;
+		first_sub_key_index = ( (uint64_t) key_index * parameters->fan_out ) + 1;
+
+		if( first_sub_key_index < (uint64_t) parameters->number_of_keys )
+		{
+			number_of_sub_keys = parameters->number_of_keys - (uint32_t) first_sub_key_index;
+
+			if( number_of_sub_keys > parameters->fan_out )
+			{
+				number_of_sub_keys = parameters->fan_out;
+			}
+			if( regf_bench_hive_allocate_cell(
+			     hive,
+			     (size_t) ( 4 + ( 8 * number_of_sub_keys ) ),
+			     &sub_keys_list_offset ) != 1 )
+			{
+				goto on_error;
+			}
+			hive->data[ sub_keys_list_offset + 4 ] = (uint8_t) 'l';
+			hive->data[ sub_keys_list_offset + 5 ] = (uint8_t) 'h';
+
+			byte_stream_copy_from_uint16_little_endian(
+			 &( hive->data[ sub_keys_list_offset + 6 ] ),
+			 (uint16_t) number_of_sub_keys );
+
+			for( sub_key_index = 0;
+			     sub_key_index < number_of_sub_keys;
+			     sub_key_index++ )
+			{
+				name_length = regf_bench_get_key_name(
+				               (uint32_t) first_sub_key_index + sub_key_index,
+				               name,
+				               16 );
+
+				byte_stream_copy_from_uint32_little_endian(
+				 &( hive->data[ sub_keys_list_offset + 8 + ( sub_key_index * 8 ) ] ),
+				 key_offsets[ first_sub_key_index + sub_key_index ] );
+
+				byte_stream_copy_from_uint32_little_endian(
+				 &( hive->data[ sub_keys_list_offset + 12 + ( sub_key_index * 8 ) ] ),
+				 regf_bench_calculate_name_hash(
+				  name,
+				  name_length ) );
+			}
+		}
+		for( value_index = 0;
+		     value_index < parameters->number_of_values;
+		     value_index++ )
+		{
+			if( regf_bench_hive_generate_value(
+			     hive,
+			     parameters,
+			     key_index,
+			     value_index,
+			     &( value_key_offsets[ value_index ] ) ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+		if( parameters->number_of_values > 0 )
+		{
+			if( regf_bench_hive_allocate_cell(
+			     hive,
+			     (size_t) ( 4 * parameters->number_of_values ),
+			     &values_list_offset ) != 1 )
+			{
+				goto on_error;
+			}
+			for( value_index = 0;
+			     value_index < parameters->number_of_values;
+			     value_index++ )
+			{
+				byte_stream_copy_from_uint32_little_endian(
+				 &( hive->data[ values_list_offset + 4 + ( value_index * 4 ) ] ),
+				 value_key_offsets[ value_index ] );
+			}
+		}
+		/* The hive bins data can have been reallocated
+		 */
+		named_key_data = &( hive->data[ key_offsets[ key_index ] + 4 ] );
+
+		if( number_of_sub_keys > 0 )
+		{
+			byte_stream_copy_from_uint32_little_endian(
+			 &( named_key_data[ 20 ] ),
+			 number_of_sub_keys );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 &( named_key_data[ 28 ] ),
+			 sub_keys_list_offset );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 &( named_key_data[ 52 ] ),
+			 22 );
+		}
+		if( parameters->number_of_values > 0 )
+		{
+			byte_stream_copy_from_uint32_little_endian(
+			 &( named_key_data[ 36 ] ),
+			 parameters->number_of_values );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 &( named_key_data[ 40 ] ),
+			 values_list_offset );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 &( named_key_data[ 60 ] ),
+			 18 );
+		}
+	}
+	regf_bench_hive_close_hive_bin(
+	 hive );
+
+	if( value_key_offsets != NULL )
+	{
+		memory_free(
+		 value_key_offsets );
+	}
+	memory_free(
+	 key_offsets );
+
+	return( 1 );
+
+on_error:
+	if( value_key_offsets != NULL )
+	{
+		memory_free(
+		 value_key_offsets );
+	}
+	if( key_offsets != NULL )
+	{
+		memory_free(
+		 key_offsets );
+	}
+	return( -1 );
+}
+
+/* Writes the synthetic hive to a file
+ * Returns 1 if successful or -1 on error
+ */
+int regf_bench_hive_write(
+     regf_bench_hive_t *hive,
+     const char *filename )
+{
+	uint8_t file_header_data[ 4096 ];
+
+	FILE *file_stream         = NULL;
+	size_t data_offset        = 0;
+	uint32_t value_32bit      = 0;
+	uint32_t xor32_checksum   = 0;
+
+	if( ( hive == NULL )
+	 || ( filename == NULL ) )
+	{
+		return( -1 );
+	}
+	if( memory_set(
+	     file_header_data,
+	     0,
+	     4096 ) == NULL )
+	{
+		return( -1 );
+	}
+	file_header_data[ 0 ] = (uint8_t) 'r';
+	file_header_data[ 1 ] = (uint8_t) 'e';
+	file_header_data[ 2 ] = (uint8_t) 'g';
+	file_header_data[ 3 ] = (uint8_t) 'f';
+
+	/* Primary and secondary sequence number
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( file_header_data[ 4 ] ),
+	 1 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( file_header_data[ 8 ] ),
+	 1 );
+
+	/* Format version 1.5
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( file_header_data[ 20 ] ),
+	 1 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( file_header_data[ 24 ] ),
+	 5 );
+
+	/* File type and file format
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( file_header_data[ 28 ] ),
+	 LIBREGF_FILE_TYPE_REGISTRY );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( file_header_data[ 32 ] ),
+	 1 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( file_header_data[ 36 ] ),
+	 hive->root_key_offset );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( file_header_data[ 40 ] ),
+	 (uint32_t) hive->data_size );
+
+	/* Clustering factor
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( file_header_data[ 44 ] ),
+	 1 );
+
+	for( data_offset = 0;
+	     data_offset < 508;
+	     data_offset += 4 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( file_header_data[ data_offset ] ),
+		 value_32bit );
+
+		xor32_checksum ^= value_32bit;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( file_header_data[ 508 ] ),
+	 xor32_checksum );
+
+	file_stream = file_stream_open(
+	               filename,
+	               FILE_STREAM_BINARY_OPEN_WRITE );
+
+	if( file_stream == NULL )
+	{
+		return( -1 );
+	}
+	if( file_stream_write(
+	     file_stream,
+	     file_header_data,
+	     4096 ) != 4096 )
+	{
+		goto on_error;
+	}
+	if( file_stream_write(
+	     file_stream,
+	     hive->data,
+	     hive->data_size ) != hive->data_size )
+	{
+		goto on_error;
+	}
+	if( file_stream_close(
+	     file_stream ) != 0 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	file_stream_close(
+	 file_stream );
+
+	return( -1 );
+}
+
+/* Decodes the values of a key
+ * Returns 1 if successful or -1 on error
+ */
+int regf_bench_decode_values(
+     libregf_key_t *key,
+     regf_bench_walk_statistics_t *statistics,
+     libcerror_error_t **error )
+{
+	libregf_value_t *value = NULL;
+	uint8_t *reallocation  = NULL;
+	size_t value_data_size = 0;
+	uint32_t value_32bit   = 0;
+	uint32_t value_type    = 0;
+	int number_of_values   = 0;
+	int value_index        = 0;
+
+	if( libregf_key_get_number_of_values(
+	     key,
+	     &number_of_values,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	for( value_index = 0;
+	     value_index < number_of_values;
+	     value_index++ )
+	{
+		if( libregf_key_get_value_by_index(
+		     key,
+		     value_index,
+		     &value,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( libregf_value_get_value_type(
+		     value,
+		     &value_type,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( value_type == LIBREGF_VALUE_TYPE_INTEGER_32BIT_LITTLE_ENDIAN )
+		{
+			if( libregf_value_get_value_32bit(
+			     value,
+			     &value_32bit,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+			value_data_size = 4;
+		}
+		else if( value_type == LIBREGF_VALUE_TYPE_STRING )
+		{
+			if( libregf_value_get_value_utf8_string_size(
+			     value,
+			     &value_data_size,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+		else
+		{
+			if( libregf_value_get_value_data_size(
+			     value,
+			     &value_data_size,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+		if( value_data_size > statistics->value_data_buffer_size )
+		{
+			reallocation = (uint8_t *) memory_reallocate(
+			                            statistics->value_data,
+			                            sizeof( uint8_t ) * value_data_size );
+
+			if( reallocation == NULL )
+			{
+				goto on_error;
+			}
+			statistics->value_data             = reallocation;
+			statistics->value_data_buffer_size = value_data_size;
+		}
+		if( ( value_type == LIBREGF_VALUE_TYPE_STRING )
+		 && ( value_data_size > 0 ) )
+		{
+			if( libregf_value_get_value_utf8_string(
+			     value,
+			     statistics->value_data,
+			     value_data_size,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+		else if( ( value_type != LIBREGF_VALUE_TYPE_INTEGER_32BIT_LITTLE_ENDIAN )
+		      && ( value_data_size > 0 ) )
+		{
+			if( libregf_value_get_value_data(
+			     value,
+			     statistics->value_data,
+			     value_data_size,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+		statistics->number_of_values += 1;
+		statistics->value_data_size  += value_data_size;
+
+		if( libregf_value_free(
+		     &value,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( value != NULL )
+	{
+		libregf_value_free(
+		 &value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Walks a key and its sub keys recursively
+ * Returns 1 if successful or -1 on error
+ */
+int regf_bench_walk_key(
+     libregf_key_t *key,
+     regf_bench_walk_statistics_t *statistics,
+     int depth,
+     libcerror_error_t **error )
+{
+	libregf_key_t *sub_key = NULL;
+	int number_of_sub_keys = 0;
+	int sub_key_index      = 0;
+
+	if( depth > REGF_BENCH_MAXIMUM_DEPTH )
+	{
+		return( -1 );
+	}
+	statistics->number_of_keys += 1;
+
+	if( statistics->decode_values != 0 )
+	{
+		if( regf_bench_decode_values(
+		     key,
+		     statistics,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( libregf_key_get_number_of_sub_keys(
+	     key,
+	     &number_of_sub_keys,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	for( sub_key_index = 0;
+	     sub_key_index < number_of_sub_keys;
+	     sub_key_index++ )
+	{
+		if( libregf_key_get_sub_key_by_index(
+		     key,
+		     sub_key_index,
+		     &sub_key,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( regf_bench_walk_key(
+		     sub_key,
+		     statistics,
+		     depth + 1,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( libregf_key_free(
+		     &sub_key,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( sub_key != NULL )
+	{
+		libregf_key_free(
+		 &sub_key,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Callback function for libregf_file_walk that counts the keys
+ * Returns 1 to continue the walk
+ */
+int regf_bench_file_walk_callback(
+     libregf_key_t *key REGF_TEST_ATTRIBUTE_UNUSED,
+     void *callback_data REGF_TEST_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error REGF_TEST_ATTRIBUTE_UNUSED )
+{
+	REGF_TEST_UNREFERENCED_PARAMETER( key )
+	REGF_TEST_UNREFERENCED_PARAMETER( callback_data )
+	REGF_TEST_UNREFERENCED_PARAMETER( error )
+
+	return( 1 );
+}
+
+/* Benchmarks opening and closing the file
+ * Returns 1 if successful or -1 on error
+ */
+int regf_bench_open(
+     const char *filename,
+     regf_bench_parameters_t *parameters,
+     int use_memory_mapping,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libregf_file_t *file   = NULL;
+	const char *name       = NULL;
+	uint64_t elapsed_time  = 0;
+	uint64_t start_time    = 0;
+	uint32_t iteration     = 0;
+	int result             = 0;
+
+	for( iteration = 0;
+	     iteration < parameters->number_of_open_iterations;
+	     iteration++ )
+	{
+		if( libregf_file_initialize(
+		     &file,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		start_time = regf_bench_get_time();
+
+		if( use_memory_mapping != 0 )
+		{
+			result = libregf_file_open_mmap(
+			          file,
+			          filename,
+			          access_flags,
+			          error );
+		}
+		else
+		{
+			result = libregf_file_open(
+			          file,
+			          filename,
+			          access_flags,
+			          error );
+		}
+		if( result != 1 )
+		{
+			goto on_error;
+		}
+		elapsed_time += regf_bench_get_time() - start_time;
+
+		if( libregf_file_close(
+		     file,
+		     error ) != 0 )
+		{
+			goto on_error;
+		}
+		if( libregf_file_free(
+		     &file,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	if( ( access_flags & LIBREGF_ACCESS_FLAG_READ_HIVE_BINS_ON_DEMAND ) != 0 )
+	{
+		name = ( use_memory_mapping != 0 ) ? "open_mmap_on_demand" : "open_on_demand";
+	}
+	else
+	{
+		name = ( use_memory_mapping != 0 ) ? "open_mmap" : "open";
+	}
+	regf_bench_result_fprint(
+	 stdout,
+	 name,
+	 (uint64_t) parameters->number_of_open_iterations,
+	 elapsed_time );
+
+	return( 1 );
+
+on_error:
+	if( file != NULL )
+	{
+		libregf_file_free(
+		 &file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Benchmarks path lookups, first on a newly opened file and then repeated
+ * Returns 1 if successful or -1 on error
+ */
+int regf_bench_lookup(
+     libregf_file_t *file,
+     regf_bench_parameters_t *parameters,
+     libcerror_error_t **error )
+{
+	char path[ REGF_BENCH_MAXIMUM_PATH_SIZE ];
+
+	const char *benchmark_names[ 2 ] = { "lookup_cold", "lookup_warm" };
+	libregf_key_t *key               = NULL;
+	uint64_t elapsed_time            = 0;
+	uint64_t start_time              = 0;
+	size_t path_length               = 0;
+	uint32_t key_index               = 0;
+	uint32_t lookup_index            = 0;
+	uint32_t random_state            = 0;
+	int pass                         = 0;
+	int result                       = 0;
+
+	for( pass = 0;
+	     pass < 2;
+	     pass++ )
+	{
+		/* Both passes look up the same sequence of keys
+		 */
+		random_state = parameters->seed;
+		elapsed_time = 0;
+
+		for( lookup_index = 0;
+		     lookup_index < parameters->number_of_lookups;
+		     lookup_index++ )
+		{
+			random_state ^= random_state << 13;
+			random_state ^= random_state >> 17;
+			random_state ^= random_state << 5;
+
+			key_index = random_state % parameters->number_of_keys;
+
+			if( regf_bench_get_key_path(
+			     key_index,
+			     parameters->fan_out,
+			     path,
+			     REGF_BENCH_MAXIMUM_PATH_SIZE,
+			     &path_length ) != 1 )
+			{
+				goto on_error;
+			}
+			start_time = regf_bench_get_time();
+
+			result = libregf_file_get_key_by_utf8_path(
+			          file,
+			          (uint8_t *) path,
+			          path_length,
+			          &key,
+			          error );
+
+			elapsed_time += regf_bench_get_time() - start_time;
+
+			if( result != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to find key: %s.\n",
+				 path );
+
+				goto on_error;
+			}
+			if( libregf_key_free(
+			     &key,
+			     error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+		regf_bench_result_fprint(
+		 stdout,
+		 benchmark_names[ pass ],
+		 (uint64_t) parameters->number_of_lookups,
+		 elapsed_time );
+	}
+	return( 1 );
+
+on_error:
+	if( key != NULL )
+	{
+		libregf_key_free(
+		 &key,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Benchmarks walking all the keys and decoding all the values
+ * Returns 1 if successful or -1 on error
+ */
+int regf_bench_walk(
+     libregf_file_t *file,
+     regf_bench_parameters_t *parameters,
+     int decode_values,
+     libcerror_error_t **error )
+{
+	regf_bench_walk_statistics_t statistics;
+
+	libregf_key_t *root_key = NULL;
+	uint64_t elapsed_time   = 0;
+	uint64_t start_time     = 0;
+
+	if( memory_set(
+	     &statistics,
+	     0,
+	     sizeof( regf_bench_walk_statistics_t ) ) == NULL )
+	{
+		return( -1 );
+	}
+	statistics.decode_values = decode_values;
+
+	start_time = regf_bench_get_time();
+
+	if( libregf_file_get_root_key(
+	     file,
+	     &root_key,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( regf_bench_walk_key(
+	     root_key,
+	     &statistics,
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libregf_key_free(
+	     &root_key,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	elapsed_time = regf_bench_get_time() - start_time;
+
+	if( statistics.number_of_keys != (uint64_t) parameters->number_of_keys )
+	{
+		fprintf(
+		 stderr,
+		 "Mismatch in number of keys walked: %" PRIu64 ".\n",
+		 statistics.number_of_keys );
+
+		goto on_error;
+	}
+	if( decode_values == 0 )
+	{
+		regf_bench_result_fprint(
+		 stdout,
+		 "walk",
+		 statistics.number_of_keys,
+		 elapsed_time );
+	}
+	else
+	{
+		regf_bench_result_fprint(
+		 stdout,
+		 "value_decode",
+		 statistics.number_of_values,
+		 elapsed_time );
+
+		fprintf(
+		 stdout,
+		 "{\"benchmark\": \"value_decode_bytes\", \"bytes\": %" PRIu64 "}\n",
+		 statistics.value_data_size );
+	}
+	if( statistics.value_data != NULL )
+	{
+		memory_free(
+		 statistics.value_data );
+	}
+	return( 1 );
+
+on_error:
+	if( root_key != NULL )
+	{
+		libregf_key_free(
+		 &root_key,
+		 NULL );
+	}
+	if( statistics.value_data != NULL )
+	{
+		memory_free(
+		 statistics.value_data );
+	}
+	return( -1 );
+}
+
+/* Benchmarks walking all the keys using libregf_file_walk
+ * Returns 1 if successful or -1 on error
+ */
+int regf_bench_file_walk(
+     libregf_file_t *file,
+     regf_bench_parameters_t *parameters,
+     libcerror_error_t **error )
+{
+	uint64_t elapsed_time = 0;
+	uint64_t start_time   = 0;
+
+	start_time = regf_bench_get_time();
+
+	if( libregf_file_walk(
+	     file,
+	     &regf_bench_file_walk_callback,
+	     NULL,
+	     (int) parameters->number_of_threads,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	elapsed_time = regf_bench_get_time() - start_time;
+
+	regf_bench_result_fprint(
+	 stdout,
+	 "file_walk",
+	 (uint64_t) parameters->number_of_keys,
+	 elapsed_time );
+
+	return( 1 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT )
+
+/* Benchmarks a XOR-32 checksum calculation function
+ * Returns 1 if successful or -1 on error
+ */
+int regf_bench_checksum(
+     const char *name,
+     int (*calculate_function)(
+            uint32_t *checksum_value,
+            const uint8_t *buffer,
+            size_t size,
+            uint32_t initial_value,
+            libcerror_error_t **error ),
+     const uint8_t *buffer,
+     regf_bench_parameters_t *parameters,
+     libcerror_error_t **error )
+{
+	uint64_t elapsed_time   = 0;
+	uint64_t start_time     = 0;
+	uint32_t checksum_value = 0;
+	uint32_t iteration      = 0;
+
+	start_time = regf_bench_get_time();
+
+	/* The checksum value is passed as the initial value of the next iteration
+	 * so the calculations cannot be optimized away
+	 */
+	for( iteration = 0;
+	     iteration < parameters->number_of_checksum_iterations;
+	     iteration++ )
+	{
+		if( calculate_function(
+		     &checksum_value,
+		     buffer,
+		     REGF_BENCH_CHECKSUM_BUFFER_SIZE,
+		     checksum_value,
+		     error ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	elapsed_time = regf_bench_get_time() - start_time;
+
+	regf_bench_result_fprint(
+	 stdout,
+	 name,
+	 (uint64_t) parameters->number_of_checksum_iterations,
+	 elapsed_time );
+
+	return( 1 );
+}
+
+/* Benchmarks the XOR-32 checksum calculation variants
+ * Returns 1 if successful or -1 on error
+ */
+int regf_bench_checksums(
+     regf_bench_parameters_t *parameters,
+     libcerror_error_t **error )
+{
+	uint8_t *buffer     = NULL;
+	size_t buffer_index = 0;
+
+	buffer = (uint8_t *) memory_allocate(
+	                      sizeof( uint8_t ) * REGF_BENCH_CHECKSUM_BUFFER_SIZE );
+
+	if( buffer == NULL )
+	{
+		return( -1 );
+	}
+	for( buffer_index = 0;
+	     buffer_index < REGF_BENCH_CHECKSUM_BUFFER_SIZE;
+	     buffer_index++ )
+	{
+		buffer[ buffer_index ] = (uint8_t) ( ( buffer_index * 131 ) ^ ( buffer_index >> 8 ) );
+	}
+	if( regf_bench_checksum(
+	     "xor32",
+	     &libregf_checksum_calculate_little_endian_xor32,
+	     buffer,
+	     parameters,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( regf_bench_checksum(
+	     "xor32_scalar",
+	     &libregf_checksum_calculate_little_endian_xor32_scalar,
+	     buffer,
+	     parameters,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+#if defined( LIBREGF_CHECKSUM_HAVE_SSE2 )
+	if( regf_bench_checksum(
+	     "xor32_sse2",
+	     &libregf_checksum_calculate_little_endian_xor32_sse2,
+	     buffer,
+	     parameters,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+#endif
+#if defined( LIBREGF_CHECKSUM_HAVE_AVX2 )
+	if( __builtin_cpu_supports( "avx2" ) != 0 )
+	{
+		if( regf_bench_checksum(
+		     "xor32_avx2",
+		     &libregf_checksum_calculate_little_endian_xor32_avx2,
+		     buffer,
+		     parameters,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+#endif
+#if defined( LIBREGF_CHECKSUM_HAVE_NEON )
+	if( regf_bench_checksum(
+	     "xor32_neon",
+	     &libregf_checksum_calculate_little_endian_xor32_neon,
+	     buffer,
+	     parameters,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+#endif
+	memory_free(
+	 buffer );
+
+	return( 1 );
+
+on_error:
+	memory_free(
+	 buffer );
+
+	return( -1 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	regf_bench_hive_t hive;
+	regf_bench_parameters_t parameters;
+
+	libcerror_error_t *error        = NULL;
+	libregf_file_t *file            = NULL;
+	const char *filename            = "regf_bench.hiv";
+	uint64_t elapsed_time           = 0;
+	uint64_t peak_resident_set_size = 0;
+	uint64_t start_time             = 0;
+	uint32_t *option_value          = NULL;
+	uint32_t key_index              = 0;
+	system_integer_t option         = 0;
+	int depth                       = 0;
+	int file_written                = 0;
+	int result                      = 0;
+
+	if( memory_set(
+	     &hive,
+	     0,
+	     sizeof( regf_bench_hive_t ) ) == NULL )
+	{
+		return( EXIT_FAILURE );
+	}
+	parameters.number_of_keys                = 10000;
+	parameters.fan_out                       = 16;
+	parameters.number_of_values              = 4;
+	parameters.big_data_ratio                = 5;
+	parameters.number_of_lookups             = 10000;
+	parameters.number_of_open_iterations     = 100;
+	parameters.number_of_threads             = 1;
+	parameters.number_of_checksum_iterations = 1000;
+	parameters.seed                          = 1;
+
+	while( ( option = regf_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "b:c:f:hi:k:l:s:t:v:" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) 'b':
+				option_value = &( parameters.big_data_ratio );
+				break;
+
+			case (system_integer_t) 'c':
+				option_value = &( parameters.number_of_checksum_iterations );
+				break;
+
+			case (system_integer_t) 'f':
+				option_value = &( parameters.fan_out );
+				break;
+
+			case (system_integer_t) 'h':
+				regf_bench_usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'i':
+				option_value = &( parameters.number_of_open_iterations );
+				break;
+
+			case (system_integer_t) 'k':
+				option_value = &( parameters.number_of_keys );
+				break;
+
+			case (system_integer_t) 'l':
+				option_value = &( parameters.number_of_lookups );
+				break;
+
+			case (system_integer_t) 's':
+				option_value = &( parameters.seed );
+				break;
+
+			case (system_integer_t) 't':
+				option_value = &( parameters.number_of_threads );
+				break;
+
+			case (system_integer_t) 'v':
+				option_value = &( parameters.number_of_values );
+				break;
+
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				regf_bench_usage_fprint(
+				 stderr );
+
+				return( EXIT_FAILURE );
+		}
+		if( regf_bench_string_copy_to_uint32(
+		     optarg,
+		     option_value ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Invalid value of option: %" PRIs_SYSTEM ".\n",
+			 argv[ optind - 2 ] );
+
+			return( EXIT_FAILURE );
+		}
+	}
+	if( optind < argc )
+	{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		fprintf(
+		 stderr,
+		 "Filename argument not supported.\n" );
+
+		return( EXIT_FAILURE );
+#else
+		filename = argv[ optind ];
+#endif
+	}
+	if( ( parameters.number_of_keys == 0 )
+	 || ( parameters.fan_out == 0 )
+	 || ( parameters.fan_out > 65535 )
+	 || ( parameters.number_of_values > 65535 )
+	 || ( parameters.big_data_ratio > 100 )
+	 || ( parameters.number_of_threads == 0 )
+	 || ( parameters.number_of_threads > 256 ) )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid parameters.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	/* The deepest key has the highest index
+	 */
+	depth     = 0;
+	key_index = parameters.number_of_keys - 1;
+
+	while( key_index != 0 )
+	{
+		key_index = ( key_index - 1 ) / parameters.fan_out;
+
+		depth++;
+	}
+	if( depth > REGF_BENCH_MAXIMUM_DEPTH )
+	{
+		fprintf(
+		 stderr,
+		 "Invalid fan out value too small for number of keys.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	hive.random_state = ( parameters.seed == 0 ) ? 1 : parameters.seed;
+
+	start_time = regf_bench_get_time();
+
+	if( regf_bench_hive_generate(
+	     &hive,
+	     &parameters ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to generate hive.\n" );
+
+		goto on_error;
+	}
+	if( regf_bench_hive_write(
+	     &hive,
+	     filename ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to write hive to file: %s.\n",
+		 filename );
+
+		goto on_error;
+	}
+	file_written = 1;
+	elapsed_time = regf_bench_get_time() - start_time;
+
+	fprintf(
+	 stdout,
+	 "{\"benchmark\": \"generate\", \"keys\": %" PRIu32 ", \"fan_out\": %" PRIu32 ", \"values_per_key\": %" PRIu32 ", \"big_data_ratio\": %" PRIu32 ", \"file_size\": %" PRIzd ", \"elapsed_ns\": %" PRIu64 "}\n",
+	 parameters.number_of_keys,
+	 parameters.fan_out,
+	 parameters.number_of_values,
+	 parameters.big_data_ratio,
+	 hive.data_size + 4096,
+	 elapsed_time );
+
+	memory_free(
+	 hive.data );
+
+	hive.data = NULL;
+
+	if( regf_bench_open(
+	     filename,
+	     &parameters,
+	     0,
+	     LIBREGF_OPEN_READ,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to benchmark open.\n" );
+
+		goto on_error;
+	}
+	if( regf_bench_open(
+	     filename,
+	     &parameters,
+	     1,
+	     LIBREGF_OPEN_READ,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to benchmark open with memory mapping.\n" );
+
+		goto on_error;
+	}
+	if( regf_bench_open(
+	     filename,
+	     &parameters,
+	     0,
+	     LIBREGF_OPEN_READ | LIBREGF_ACCESS_FLAG_READ_HIVE_BINS_ON_DEMAND,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to benchmark open with hive bins read on demand.\n" );
+
+		goto on_error;
+	}
+	/* The cold lookups are done on a newly opened file
+	 */
+	if( libregf_file_initialize(
+	     &file,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libregf_file_open(
+	     file,
+	     filename,
+	     LIBREGF_OPEN_READ,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open file: %s.\n",
+		 filename );
+
+		goto on_error;
+	}
+	if( regf_bench_lookup(
+	     file,
+	     &parameters,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to benchmark path lookup.\n" );
+
+		goto on_error;
+	}
+	if( regf_bench_walk(
+	     file,
+	     &parameters,
+	     0,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to benchmark walk.\n" );
+
+		goto on_error;
+	}
+	if( regf_bench_walk(
+	     file,
+	     &parameters,
+	     1,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to benchmark value decode.\n" );
+
+		goto on_error;
+	}
+	if( regf_bench_file_walk(
+	     file,
+	     &parameters,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to benchmark file walk.\n" );
+
+		goto on_error;
+	}
+	if( libregf_file_close(
+	     file,
+	     &error ) != 0 )
+	{
+		goto on_error;
+	}
+	if( libregf_file_free(
+	     &file,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+#if defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT )
+	if( regf_bench_checksums(
+	     &parameters,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to benchmark checksums.\n" );
+
+		goto on_error;
+	}
+#endif
+	result = regf_bench_get_peak_resident_set_size(
+	          &peak_resident_set_size );
+
+	if( result == 1 )
+	{
+		fprintf(
+		 stdout,
+		 "{\"benchmark\": \"peak_rss\", \"kilobytes\": %" PRIu64 "}\n",
+		 peak_resident_set_size );
+	}
+	remove(
+	 filename );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_backtrace_fprint(
+		 error,
+		 stderr );
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libregf_file_free(
+		 &file,
+		 NULL );
+	}
+	if( hive.data != NULL )
+	{
+		memory_free(
+		 hive.data );
+	}
+	if( file_written != 0 )
+	{
+		remove(
+		 filename );
+	}
+	return( EXIT_FAILURE );
+}
+
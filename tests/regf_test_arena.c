@@ -0,0 +1,1031 @@
+/*
+ * Library arena functions test program
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "regf_test_libcerror.h"
+#include "regf_test_libregf.h"
+#include "regf_test_macros.h"
+#include "regf_test_memory.h"
+#include "regf_test_unused.h"
+
+#include "../libregf/libregf_arena.h"
+
+#if defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT )
+
+/* Tests the libregf_arena_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_arena_initialize(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libregf_arena_t *arena                   = NULL;
+	int result                               = 0;
+
+#if defined( HAVE_REGF_TEST_MEMORY )
+	int number_of_malloc_fail_tests          = 1;
+	int number_of_memset_fail_tests          = 1;
+	int test_number                          = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libregf_arena_initialize(
+	          &arena,
+	          256,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_arena_free(
+	          &arena,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_arena_initialize(
+	          NULL,
+	          256,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	arena = (libregf_arena_t *) 0x12345678UL;
+
+	result = libregf_arena_initialize(
+	          &arena,
+	          256,
+	          &error );
+
+	arena = NULL;
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_arena_initialize(
+	          &arena,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_arena_initialize(
+	          &arena,
+	          (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE + 1,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_REGF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libregf_arena_initialize with malloc failing
+		 */
+		regf_test_malloc_attempts_before_fail = test_number;
+
+		result = libregf_arena_initialize(
+		          &arena,
+		          256,
+		          &error );
+
+		if( regf_test_malloc_attempts_before_fail != -1 )
+		{
+			regf_test_malloc_attempts_before_fail = -1;
+
+			if( arena != NULL )
+			{
+				libregf_arena_free(
+				 &arena,
+				 NULL );
+			}
+		}
+		else
+		{
+			REGF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			REGF_TEST_ASSERT_IS_NULL(
+			 "arena",
+			 arena );
+
+			REGF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libregf_arena_initialize with memset failing
+		 */
+		regf_test_memset_attempts_before_fail = test_number;
+
+		result = libregf_arena_initialize(
+		          &arena,
+		          256,
+		          &error );
+
+		if( regf_test_memset_attempts_before_fail != -1 )
+		{
+			regf_test_memset_attempts_before_fail = -1;
+
+			if( arena != NULL )
+			{
+				libregf_arena_free(
+				 &arena,
+				 NULL );
+			}
+		}
+		else
+		{
+			REGF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			REGF_TEST_ASSERT_IS_NULL(
+			 "arena",
+			 arena );
+
+			REGF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_REGF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		libregf_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_arena_free function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_arena_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libregf_arena_free(
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_arena_allocate function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_arena_allocate(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libregf_arena_t *arena   = NULL;
+	intptr_t *data1          = NULL;
+	intptr_t *data2          = NULL;
+	intptr_t *data3          = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libregf_arena_initialize(
+	          &arena,
+	          64,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libregf_arena_allocate(
+	          arena,
+	          3,
+	          &data1,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "data1",
+	 data1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "data1 alignment",
+	 (int) ( (intptr_t) data1 % LIBREGF_ARENA_ALIGNMENT ),
+	 0 );
+
+	result = libregf_arena_allocate(
+	          arena,
+	          5,
+	          &data2,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_INTPTR(
+	 "data2",
+	 (intptr_t) data2,
+	 (intptr_t) data1 + LIBREGF_ARENA_ALIGNMENT );
+
+	/* Test an allocation that does not fit in the remainder of the first block
+	 */
+	result = libregf_arena_allocate(
+	          arena,
+	          60,
+	          &data3,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "arena->first_block->next_block",
+	 arena->first_block->next_block );
+
+	REGF_TEST_ASSERT_EQUAL_INTPTR(
+	 "data3",
+	 (intptr_t) data3,
+	 (intptr_t) arena->first_block->next_block->data );
+
+	/* Test an allocation that is larger than the block size
+	 */
+	result = libregf_arena_allocate(
+	          arena,
+	          1000,
+	          &data1,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_SIZE(
+	 "arena->current_block->data_size",
+	 arena->current_block->data_size,
+	 (size_t) 1000 );
+
+	memory_set(
+	 data1,
+	 0xff,
+	 1000 );
+
+	/* Test error cases
+	 */
+	result = libregf_arena_allocate(
+	          NULL,
+	          8,
+	          &data1,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_arena_allocate(
+	          arena,
+	          0,
+	          &data1,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_arena_allocate(
+	          arena,
+	          (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE + 1,
+	          &data1,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_arena_allocate(
+	          arena,
+	          8,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libregf_arena_free(
+	          &arena,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		libregf_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_arena_get_mark and libregf_arena_rewind functions
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_arena_rewind(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libregf_arena_t *arena   = NULL;
+	intptr_t *data1          = NULL;
+	intptr_t *data2          = NULL;
+	size_t mark              = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libregf_arena_initialize(
+	          &arena,
+	          64,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_arena_allocate(
+	          arena,
+	          16,
+	          &data1,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libregf_arena_get_mark(
+	          arena,
+	          &mark,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_SIZE(
+	 "mark",
+	 mark,
+	 (size_t) 16 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Allocate enough to span multiple blocks
+	 */
+	result = libregf_arena_allocate(
+	          arena,
+	          48,
+	          &data2,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_arena_allocate(
+	          arena,
+	          48,
+	          &data2,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "arena->first_block->next_block",
+	 arena->first_block->next_block );
+
+	result = libregf_arena_rewind(
+	          arena,
+	          mark,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The memory after the mark is reused
+	 */
+	result = libregf_arena_allocate(
+	          arena,
+	          48,
+	          &data2,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_INTPTR(
+	 "data2",
+	 (intptr_t) data2,
+	 (intptr_t) data1 + 16 );
+
+	/* Test error cases
+	 */
+	result = libregf_arena_get_mark(
+	          NULL,
+	          &mark,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_arena_get_mark(
+	          arena,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_arena_rewind(
+	          NULL,
+	          mark,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_arena_rewind(
+	          arena,
+	          4096,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libregf_arena_free(
+	          &arena,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		libregf_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_arena_reset function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_arena_reset(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libregf_arena_t *arena   = NULL;
+	intptr_t *data1          = NULL;
+	intptr_t *data2          = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libregf_arena_initialize(
+	          &arena,
+	          64,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_arena_allocate(
+	          arena,
+	          32,
+	          &data1,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_arena_allocate(
+	          arena,
+	          128,
+	          &data2,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libregf_arena_reset(
+	          arena,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The first block is reused after a reset
+	 */
+	result = libregf_arena_allocate(
+	          arena,
+	          8,
+	          &data2,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_INTPTR(
+	 "data2",
+	 (intptr_t) data2,
+	 (intptr_t) data1 );
+
+	/* The retained larger block is reused for an allocation that does not fit the first block
+	 */
+	result = libregf_arena_allocate(
+	          arena,
+	          128,
+	          &data1,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_INTPTR(
+	 "data1",
+	 (intptr_t) data1,
+	 (intptr_t) arena->first_block->next_block->data );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "arena->first_block->next_block->next_block",
+	 arena->first_block->next_block->next_block );
+
+	/* Test error cases
+	 */
+	result = libregf_arena_reset(
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libregf_arena_free(
+	          &arena,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		libregf_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc REGF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] REGF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc REGF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] REGF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	REGF_TEST_UNREFERENCED_PARAMETER( argc )
+	REGF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT )
+
+	REGF_TEST_RUN(
+	 "libregf_arena_initialize",
+	 regf_test_arena_initialize );
+
+	REGF_TEST_RUN(
+	 "libregf_arena_free",
+	 regf_test_arena_free );
+
+	REGF_TEST_RUN(
+	 "libregf_arena_allocate",
+	 regf_test_arena_allocate );
+
+	REGF_TEST_RUN(
+	 "libregf_arena_rewind",
+	 regf_test_arena_rewind );
+
+	REGF_TEST_RUN(
+	 "libregf_arena_reset",
+	 regf_test_arena_reset );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT ) */
+}
+
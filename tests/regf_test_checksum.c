@@ -70,6 +70,162 @@ uint8_t regf_test_checksum_file_header_data[ 512 ] = {
 
 #if defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT )
 
+/* Tests a XOR-32 calculation function against a byte-wise calculation
+ * for all buffer alignments and sizes
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_checksum_calculate_little_endian_xor32_function(
+     int (*calculate_function)(
+            uint32_t *checksum_value,
+            const uint8_t *buffer,
+            size_t size,
+            uint32_t initial_value,
+            libcerror_error_t **error ) )
+{
+	uint8_t data[ 1024 ];
+
+	libcerror_error_t *error = NULL;
+	size_t data_offset       = 0;
+	size_t data_size         = 0;
+	uint32_t checksum_value  = 0;
+	uint32_t expected_value  = 0;
+	int result               = 0;
+
+	for( data_offset = 0;
+	     data_offset < 1024;
+	     data_offset++ )
+	{
+		data[ data_offset ] = (uint8_t) ( ( data_offset * 131 ) ^ ( data_offset >> 3 ) );
+	}
+	/* Test regular cases
+	 */
+	result = calculate_function(
+	          &checksum_value,
+	          regf_test_checksum_file_header_data,
+	          512 - 4,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "checksum_value",
+	 checksum_value,
+	 (uint32_t) 0xb421b4cdUL );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( data_offset = 0;
+	     data_offset < 32;
+	     data_offset++ )
+	{
+		expected_value = 0x12345678UL;
+
+		for( data_size = 0;
+		     ( data_offset + data_size ) <= 1024;
+		     data_size++ )
+		{
+			if( data_size > 0 )
+			{
+				expected_value ^= (uint32_t) data[ data_offset + data_size - 1 ] << ( ( ( data_size - 1 ) % 4 ) * 8 );
+			}
+			result = calculate_function(
+			          &checksum_value,
+			          &( data[ data_offset ] ),
+			          data_size,
+			          0x12345678UL,
+			          &error );
+
+			REGF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			REGF_TEST_ASSERT_EQUAL_UINT32(
+			 "checksum_value",
+			 checksum_value,
+			 expected_value );
+
+			REGF_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	/* Test error cases
+	 */
+	result = calculate_function(
+	          NULL,
+	          data,
+	          1024,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = calculate_function(
+	          &checksum_value,
+	          NULL,
+	          1024,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = calculate_function(
+	          &checksum_value,
+	          data,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libregf_checksum_calculate_little_endian_xor32 function
  * Returns 1 if successful or 0 if not
  */
@@ -194,6 +350,220 @@ int regf_test_checksum_calculate_little_endian_xor32(
 	libcerror_error_free(
 	 &error );
 
+	result = regf_test_checksum_calculate_little_endian_xor32_function(
+	          libregf_checksum_calculate_little_endian_xor32 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_checksum_calculate_little_endian_xor32_scalar function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_checksum_calculate_little_endian_xor32_scalar(
+     void )
+{
+	return( regf_test_checksum_calculate_little_endian_xor32_function(
+	         libregf_checksum_calculate_little_endian_xor32_scalar ) );
+}
+
+#if defined( LIBREGF_CHECKSUM_HAVE_SSE2 )
+
+/* Tests the libregf_checksum_calculate_little_endian_xor32_sse2 function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_checksum_calculate_little_endian_xor32_sse2(
+     void )
+{
+	return( regf_test_checksum_calculate_little_endian_xor32_function(
+	         libregf_checksum_calculate_little_endian_xor32_sse2 ) );
+}
+
+#endif /* defined( LIBREGF_CHECKSUM_HAVE_SSE2 ) */
+
+#if defined( LIBREGF_CHECKSUM_HAVE_AVX2 )
+
+/* Tests the libregf_checksum_calculate_little_endian_xor32_avx2 function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_checksum_calculate_little_endian_xor32_avx2(
+     void )
+{
+	/* The test is skipped when the CPU does not support AVX2
+	 */
+	if( __builtin_cpu_supports( "avx2" ) == 0 )
+	{
+		return( 1 );
+	}
+	return( regf_test_checksum_calculate_little_endian_xor32_function(
+	         libregf_checksum_calculate_little_endian_xor32_avx2 ) );
+}
+
+#endif /* defined( LIBREGF_CHECKSUM_HAVE_AVX2 ) */
+
+#if defined( LIBREGF_CHECKSUM_HAVE_NEON )
+
+/* Tests the libregf_checksum_calculate_little_endian_xor32_neon function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_checksum_calculate_little_endian_xor32_neon(
+     void )
+{
+	return( regf_test_checksum_calculate_little_endian_xor32_function(
+	         libregf_checksum_calculate_little_endian_xor32_neon ) );
+}
+
+#endif /* defined( LIBREGF_CHECKSUM_HAVE_NEON ) */
+
+/* Tests the libregf_checksum_calculate_marvin32 function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_checksum_calculate_marvin32(
+     void )
+{
+	uint8_t data1[ 1 ]       = { 0xaf };
+	uint8_t data2[ 4 ]       = { 0x86, 0x42, 0xdc, 0x59 };
+	uint8_t data3[ 7 ]       = { 0xab, 0x42, 0x7e, 0xa8, 0xd1, 0x0f, 0xc7 };
+	libcerror_error_t *error = NULL;
+	uint64_t hash_value      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libregf_checksum_calculate_marvin32(
+	          &hash_value,
+	          data1,
+	          1,
+	          0x004fb61a001bdbccULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT64(
+	 "hash_value",
+	 hash_value,
+	 (uint64_t) 0x48e73fc77d75ddc1ULL );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_checksum_calculate_marvin32(
+	          &hash_value,
+	          data2,
+	          4,
+	          0x004fb61a001bdbccULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT64(
+	 "hash_value",
+	 hash_value,
+	 (uint64_t) 0x7008f2e87e9cf556ULL );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_checksum_calculate_marvin32(
+	          &hash_value,
+	          data3,
+	          7,
+	          0x004fb61a001bdbccULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT64(
+	 "hash_value",
+	 hash_value,
+	 (uint64_t) 0xe11847e4f0678c41ULL );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_checksum_calculate_marvin32(
+	          NULL,
+	          data1,
+	          1,
+	          0x004fb61a001bdbccULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_checksum_calculate_marvin32(
+	          &hash_value,
+	          NULL,
+	          1,
+	          0x004fb61a001bdbccULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_checksum_calculate_marvin32(
+	          &hash_value,
+	          data1,
+	          (size_t) SSIZE_MAX + 1,
+	          0x004fb61a001bdbccULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
 	return( 1 );
 
 on_error:
@@ -228,6 +598,38 @@ int main(
 	 "libregf_checksum_calculate_little_endian_xor32",
 	 regf_test_checksum_calculate_little_endian_xor32 );
 
+	REGF_TEST_RUN(
+	 "libregf_checksum_calculate_little_endian_xor32_scalar",
+	 regf_test_checksum_calculate_little_endian_xor32_scalar );
+
+#if defined( LIBREGF_CHECKSUM_HAVE_SSE2 )
+
+	REGF_TEST_RUN(
+	 "libregf_checksum_calculate_little_endian_xor32_sse2",
+	 regf_test_checksum_calculate_little_endian_xor32_sse2 );
+
+#endif /* defined( LIBREGF_CHECKSUM_HAVE_SSE2 ) */
+
+#if defined( LIBREGF_CHECKSUM_HAVE_AVX2 )
+
+	REGF_TEST_RUN(
+	 "libregf_checksum_calculate_little_endian_xor32_avx2",
+	 regf_test_checksum_calculate_little_endian_xor32_avx2 );
+
+#endif /* defined( LIBREGF_CHECKSUM_HAVE_AVX2 ) */
+
+#if defined( LIBREGF_CHECKSUM_HAVE_NEON )
+
+	REGF_TEST_RUN(
+	 "libregf_checksum_calculate_little_endian_xor32_neon",
+	 regf_test_checksum_calculate_little_endian_xor32_neon );
+
+#endif /* defined( LIBREGF_CHECKSUM_HAVE_NEON ) */
+
+	REGF_TEST_RUN(
+	 "libregf_checksum_calculate_marvin32",
+	 regf_test_checksum_calculate_marvin32 );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
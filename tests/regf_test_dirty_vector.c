@@ -37,6 +37,9 @@
 
 #include "../libregf/libregf_dirty_vector.h"
 
+uint8_t regf_test_dirty_vector_data1[ 8 ] = {
+	0x44, 0x49, 0x52, 0x54, 0x05, 0x80, 0x00, 0x00 };
+
 #if defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT )
 
 /* Tests the libregf_dirty_vector_initialize function
@@ -272,6 +275,433 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libregf_dirty_vector_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_dirty_vector_read_data(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libregf_dirty_vector_t *dirty_vector = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libregf_dirty_vector_initialize(
+	          &dirty_vector,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "dirty_vector",
+	 dirty_vector );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libregf_dirty_vector_read_data(
+	          dirty_vector,
+	          regf_test_dirty_vector_data1,
+	          8,
+	          2,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_SIZE(
+	 "dirty_vector->dirty_page_bitmap_size",
+	 dirty_vector->dirty_page_bitmap_size,
+	 (size_t) 2 );
+
+	REGF_TEST_ASSERT_EQUAL_SIZE(
+	 "dirty_vector->data_size",
+	 dirty_vector->data_size,
+	 (size_t) 8 );
+
+	/* Test error cases
+	 */
+	result = libregf_dirty_vector_read_data(
+	          NULL,
+	          regf_test_dirty_vector_data1,
+	          8,
+	          2,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with dirty page bitmap value already set
+	 */
+	result = libregf_dirty_vector_read_data(
+	          dirty_vector,
+	          regf_test_dirty_vector_data1,
+	          8,
+	          2,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libregf_dirty_vector_free(
+	          &dirty_vector,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "dirty_vector",
+	 dirty_vector );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = libregf_dirty_vector_initialize(
+	          &dirty_vector,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "dirty_vector",
+	 dirty_vector );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_dirty_vector_read_data(
+	          dirty_vector,
+	          NULL,
+	          8,
+	          2,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_dirty_vector_read_data(
+	          dirty_vector,
+	          regf_test_dirty_vector_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          2,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_dirty_vector_read_data(
+	          dirty_vector,
+	          regf_test_dirty_vector_data1,
+	          8,
+	          5,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with invalid signature
+	 */
+	result = libregf_dirty_vector_read_data(
+	          dirty_vector,
+	          &( regf_test_dirty_vector_data1[ 1 ] ),
+	          7,
+	          2,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libregf_dirty_vector_free(
+	          &dirty_vector,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "dirty_vector",
+	 dirty_vector );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( dirty_vector != NULL )
+	{
+		libregf_dirty_vector_free(
+		 &dirty_vector,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_dirty_vector_page_is_dirty function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_dirty_vector_page_is_dirty(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libregf_dirty_vector_t *dirty_vector = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libregf_dirty_vector_initialize(
+	          &dirty_vector,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "dirty_vector",
+	 dirty_vector );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_dirty_vector_read_data(
+	          dirty_vector,
+	          regf_test_dirty_vector_data1,
+	          8,
+	          2,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libregf_dirty_vector_page_is_dirty(
+	          dirty_vector,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_dirty_vector_page_is_dirty(
+	          dirty_vector,
+	          1,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_dirty_vector_page_is_dirty(
+	          dirty_vector,
+	          2,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_dirty_vector_page_is_dirty(
+	          dirty_vector,
+	          15,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a page beyond the dirty page bitmap
+	 */
+	result = libregf_dirty_vector_page_is_dirty(
+	          dirty_vector,
+	          16,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_dirty_vector_page_is_dirty(
+	          NULL,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libregf_dirty_vector_free(
+	          &dirty_vector,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "dirty_vector",
+	 dirty_vector );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( dirty_vector != NULL )
+	{
+		libregf_dirty_vector_free(
+		 &dirty_vector,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT ) */
 
 /* The main program
@@ -299,7 +729,13 @@ int main(
 	 "libregf_dirty_vector_free",
 	 regf_test_dirty_vector_free );
 
-	/* TODO: add tests for libregf_dirty_vector_read_data */
+	REGF_TEST_RUN(
+	 "libregf_dirty_vector_read_data",
+	 regf_test_dirty_vector_read_data );
+
+	REGF_TEST_RUN(
+	 "libregf_dirty_vector_page_is_dirty",
+	 regf_test_dirty_vector_page_is_dirty );
 
 	/* TODO: add tests for libregf_dirty_vector_read_file_io_handle */
 
@@ -1766,6 +1766,227 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libregf_file_get_key_by_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_file_get_key_by_offset(
+     libregf_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	libregf_key_t *key       = 0;
+	libregf_key_t *root_key  = 0;
+	off64_t key_offset       = 0;
+	off64_t root_key_offset  = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libregf_file_get_root_key(
+	          file,
+	          &root_key,
+	          &error );
+
+	REGF_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( result != 0 )
+	{
+		result = libregf_key_get_offset(
+		          root_key,
+		          &root_key_offset,
+		          &error );
+
+		REGF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		REGF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test regular cases
+		 */
+		result = libregf_file_get_key_by_offset(
+		          file,
+		          root_key_offset,
+		          &key,
+		          &error );
+
+		REGF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		REGF_TEST_ASSERT_IS_NOT_NULL(
+		 "key",
+		 key );
+
+		REGF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libregf_key_get_offset(
+		          key,
+		          &key_offset,
+		          &error );
+
+		REGF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		REGF_TEST_ASSERT_EQUAL_INT64(
+		 "key_offset",
+		 (int64_t) key_offset,
+		 (int64_t) root_key_offset );
+
+		REGF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libregf_key_free(
+		          &key,
+		          &error );
+
+		REGF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		REGF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Clean up
+		 */
+		result = libregf_key_free(
+		          &root_key,
+		          &error );
+
+		REGF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		REGF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test an offset outside the hive bins
+	 */
+	result = libregf_file_get_key_by_offset(
+	          file,
+	          0,
+	          &key,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "key",
+	 key );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_file_get_key_by_offset(
+	          NULL,
+	          root_key_offset,
+	          &key,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "key",
+	 key );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_file_get_key_by_offset(
+	          file,
+	          -1,
+	          &key,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "key",
+	 key );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_file_get_key_by_offset(
+	          file,
+	          root_key_offset,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( key != NULL )
+	{
+		libregf_key_free(
+		 &key,
+		 NULL );
+	}
+	if( root_key != NULL )
+	{
+		libregf_key_free(
+		 &root_key,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libregf_file_get_key_by_utf8_path function
  * Returns 1 if successful or 0 if not
  */
@@ -2072,6 +2293,286 @@ on_error:
 	return( 0 );
 }
 
+/* Callback function for the libregf_file_walk test that counts the keys
+ * Returns 1 if successful or -1 on error
+ */
+int regf_test_file_walk_callback(
+     libregf_key_t *key,
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	int *number_of_keys = (int *) callback_data;
+
+	REGF_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( ( key == NULL )
+	 || ( number_of_keys == NULL ) )
+	{
+		return( -1 );
+	}
+	*number_of_keys += 1;
+
+	return( 1 );
+}
+
+/* Tests the libregf_file_walk function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_file_walk(
+     libregf_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_keys       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libregf_file_walk(
+	          file,
+	          &regf_test_file_walk_callback,
+	          &number_of_keys,
+	          1,
+	          &error );
+
+	REGF_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( result != 0 )
+	{
+		REGF_TEST_ASSERT_GREATER_THAN_INT(
+		 "number_of_keys",
+		 number_of_keys,
+		 0 );
+	}
+	/* Test error cases
+	 */
+	result = libregf_file_walk(
+	          NULL,
+	          &regf_test_file_walk_callback,
+	          &number_of_keys,
+	          1,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_file_walk(
+	          file,
+	          NULL,
+	          &number_of_keys,
+	          1,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_file_walk(
+	          file,
+	          &regf_test_file_walk_callback,
+	          &number_of_keys,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_file_get_cell_iterator function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_file_get_cell_iterator(
+     libregf_file_t *file )
+{
+	libcerror_error_t *error               = NULL;
+	libregf_cell_iterator_t *cell_iterator = NULL;
+	int cell_type                          = 0;
+	int result                             = 0;
+
+	/* Test regular cases
+	 */
+	result = libregf_file_get_cell_iterator(
+	          file,
+	          &cell_iterator,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "cell_iterator",
+	 cell_iterator );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	do
+	{
+		result = libregf_cell_iterator_next_cell(
+		          cell_iterator,
+		          &error );
+
+		REGF_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		REGF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( result == 0 )
+		{
+			break;
+		}
+		result = libregf_cell_iterator_get_type(
+		          cell_iterator,
+		          &cell_type,
+		          &error );
+
+		REGF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		REGF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libregf_cell_iterator_is_allocated(
+		          cell_iterator,
+		          &error );
+
+		REGF_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		REGF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	while( result != -1 );
+
+	result = libregf_cell_iterator_free(
+	          &cell_iterator,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "cell_iterator",
+	 cell_iterator );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_file_get_cell_iterator(
+	          NULL,
+	          &cell_iterator,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "cell_iterator",
+	 cell_iterator );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_file_get_cell_iterator(
+	          file,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cell_iterator != NULL )
+	{
+		libregf_cell_iterator_free(
+		 &cell_iterator,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -2278,6 +2779,11 @@ int main(
 		 regf_test_file_get_root_key,
 		 file );
 
+		REGF_TEST_RUN_WITH_ARGS(
+		 "libregf_file_get_key_by_offset",
+		 regf_test_file_get_key_by_offset,
+		 file );
+
 		REGF_TEST_RUN_WITH_ARGS(
 		 "libregf_file_get_key_by_utf8_path",
 		 regf_test_file_get_key_by_utf8_path,
@@ -2288,6 +2794,16 @@ int main(
 		 regf_test_file_get_key_by_utf16_path,
 		 file );
 
+		REGF_TEST_RUN_WITH_ARGS(
+		 "libregf_file_walk",
+		 regf_test_file_walk,
+		 file );
+
+		REGF_TEST_RUN_WITH_ARGS(
+		 "libregf_file_get_cell_iterator",
+		 regf_test_file_get_cell_iterator,
+		 file );
+
 		/* Clean up
 		 */
 		result = regf_test_file_close_source(
@@ -0,0 +1,1453 @@
+/*
+ * Library hash_table type test program
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "regf_test_libcerror.h"
+#include "regf_test_libregf.h"
+#include "regf_test_macros.h"
+#include "regf_test_memory.h"
+#include "regf_test_unused.h"
+
+#include "../libregf/libregf_hash_table.h"
+
+#if defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT )
+
+/* Tests the libregf_hash_table_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_hash_table_initialize(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libregf_hash_table_t *hash_table = NULL;
+	int result                       = 0;
+
+#if defined( HAVE_REGF_TEST_MEMORY )
+	int number_of_malloc_fail_tests  = 3;
+	int number_of_memset_fail_tests  = 2;
+	int test_number                  = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libregf_hash_table_initialize(
+	          &hash_table,
+	          8,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "hash_table",
+	 hash_table );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_hash_table_free(
+	          &hash_table,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "hash_table",
+	 hash_table );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_hash_table_initialize(
+	          NULL,
+	          8,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	hash_table = (libregf_hash_table_t *) 0x12345678UL;
+
+	result = libregf_hash_table_initialize(
+	          &hash_table,
+	          8,
+	          &error );
+
+	hash_table = NULL;
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_hash_table_initialize(
+	          &hash_table,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_hash_table_initialize(
+	          &hash_table,
+	          -1,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_REGF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libregf_hash_table_initialize with malloc failing
+		 */
+		regf_test_malloc_attempts_before_fail = test_number;
+
+		result = libregf_hash_table_initialize(
+		          &hash_table,
+		          8,
+		          &error );
+
+		if( regf_test_malloc_attempts_before_fail != -1 )
+		{
+			regf_test_malloc_attempts_before_fail = -1;
+
+			if( hash_table != NULL )
+			{
+				libregf_hash_table_free(
+				 &hash_table,
+				 NULL,
+				 NULL );
+			}
+		}
+		else
+		{
+			REGF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			REGF_TEST_ASSERT_IS_NULL(
+			 "hash_table",
+			 hash_table );
+
+			REGF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libregf_hash_table_initialize with memset failing
+		 */
+		regf_test_memset_attempts_before_fail = test_number;
+
+		result = libregf_hash_table_initialize(
+		          &hash_table,
+		          8,
+		          &error );
+
+		if( regf_test_memset_attempts_before_fail != -1 )
+		{
+			regf_test_memset_attempts_before_fail = -1;
+
+			if( hash_table != NULL )
+			{
+				libregf_hash_table_free(
+				 &hash_table,
+				 NULL,
+				 NULL );
+			}
+		}
+		else
+		{
+			REGF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			REGF_TEST_ASSERT_IS_NULL(
+			 "hash_table",
+			 hash_table );
+
+			REGF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_REGF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hash_table != NULL )
+	{
+		libregf_hash_table_free(
+		 &hash_table,
+		 NULL,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_hash_table_free function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_hash_table_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libregf_hash_table_free(
+	          NULL,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_hash_table_resize_buckets function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_hash_table_resize_buckets(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libregf_hash_table_t *hash_table = NULL;
+	intptr_t value                   = 0;
+	int entry_index                  = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libregf_hash_table_initialize(
+	          &hash_table,
+	          4,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "hash_table",
+	 hash_table );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_hash_table_insert_value(
+	          hash_table,
+	          0x00001020UL,
+	          1,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_hash_table_insert_value(
+	          hash_table,
+	          0x00001020UL,
+	          2,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libregf_hash_table_resize_buckets(
+	          hash_table,
+	          64,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "hash_table->number_of_buckets",
+	 hash_table->number_of_buckets,
+	 64 );
+
+	/* The values with the same key keep their order
+	 */
+	result = libregf_hash_table_get_first_value(
+	          hash_table,
+	          0x00001020UL,
+	          &entry_index,
+	          &value,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "value",
+	 (int) value,
+	 1 );
+
+	result = libregf_hash_table_get_next_value(
+	          hash_table,
+	          0x00001020UL,
+	          &entry_index,
+	          &value,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "value",
+	 (int) value,
+	 2 );
+
+	/* Test error cases
+	 */
+	result = libregf_hash_table_resize_buckets(
+	          NULL,
+	          64,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_hash_table_resize_buckets(
+	          hash_table,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_hash_table_resize_buckets(
+	          hash_table,
+	          3,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libregf_hash_table_free(
+	          &hash_table,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "hash_table",
+	 hash_table );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hash_table != NULL )
+	{
+		libregf_hash_table_free(
+		 &hash_table,
+		 NULL,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_hash_table_get_number_of_values function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_hash_table_get_number_of_values(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libregf_hash_table_t *hash_table = NULL;
+	int number_of_values             = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libregf_hash_table_initialize(
+	          &hash_table,
+	          4,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "hash_table",
+	 hash_table );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_hash_table_insert_value(
+	          hash_table,
+	          0x00001020UL,
+	          1,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libregf_hash_table_get_number_of_values(
+	          hash_table,
+	          &number_of_values,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_values",
+	 number_of_values,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libregf_hash_table_get_number_of_values(
+	          NULL,
+	          &number_of_values,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_hash_table_get_number_of_values(
+	          hash_table,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libregf_hash_table_free(
+	          &hash_table,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "hash_table",
+	 hash_table );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hash_table != NULL )
+	{
+		libregf_hash_table_free(
+		 &hash_table,
+		 NULL,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_hash_table_insert_value function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_hash_table_insert_value(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libregf_hash_table_t *hash_table = NULL;
+	intptr_t value                   = 0;
+	uint32_t key                     = 0;
+	int entry_index                  = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libregf_hash_table_initialize(
+	          &hash_table,
+	          2,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "hash_table",
+	 hash_table );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * Insert more values than initially allocated to resize the entries and buckets
+	 */
+	for( key = 0x00000020UL;
+	     key < 0x00001020UL;
+	     key += 8 )
+	{
+		result = libregf_hash_table_insert_value(
+		          hash_table,
+		          key,
+		          (intptr_t) key,
+		          &error );
+
+		REGF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		REGF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "hash_table->number_of_values",
+	 hash_table->number_of_values,
+	 512 );
+
+	for( key = 0x00000020UL;
+	     key < 0x00001020UL;
+	     key += 8 )
+	{
+		result = libregf_hash_table_get_first_value(
+		          hash_table,
+		          key,
+		          &entry_index,
+		          &value,
+		          &error );
+
+		REGF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		REGF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		REGF_TEST_ASSERT_EQUAL_UINT32(
+		 "value",
+		 (uint32_t) value,
+		 key );
+	}
+	/* Test error cases
+	 */
+	result = libregf_hash_table_insert_value(
+	          NULL,
+	          0x00001020UL,
+	          1,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libregf_hash_table_free(
+	          &hash_table,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "hash_table",
+	 hash_table );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hash_table != NULL )
+	{
+		libregf_hash_table_free(
+		 &hash_table,
+		 NULL,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_hash_table_remove_value function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_hash_table_remove_value(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libregf_hash_table_t *hash_table = NULL;
+	intptr_t value                   = 0;
+	int entry_index                  = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libregf_hash_table_initialize(
+	          &hash_table,
+	          4,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "hash_table",
+	 hash_table );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_hash_table_insert_value(
+	          hash_table,
+	          0x00001020UL,
+	          1,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_hash_table_insert_value(
+	          hash_table,
+	          0x00001020UL,
+	          2,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libregf_hash_table_remove_value(
+	          hash_table,
+	          0x00001020UL,
+	          1,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "hash_table->number_of_values",
+	 hash_table->number_of_values,
+	 1 );
+
+	result = libregf_hash_table_get_first_value(
+	          hash_table,
+	          0x00001020UL,
+	          &entry_index,
+	          &value,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "value",
+	 (int) value,
+	 2 );
+
+	result = libregf_hash_table_remove_value(
+	          hash_table,
+	          0x00001020UL,
+	          1,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The entry of the removed value is reused
+	 */
+	result = libregf_hash_table_insert_value(
+	          hash_table,
+	          0x00002040UL,
+	          3,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "hash_table->number_of_used_entries",
+	 hash_table->number_of_used_entries,
+	 2 );
+
+	result = libregf_hash_table_get_first_value(
+	          hash_table,
+	          0x00002040UL,
+	          &entry_index,
+	          &value,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 0 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "value",
+	 (int) value,
+	 3 );
+
+	/* Test error cases
+	 */
+	result = libregf_hash_table_remove_value(
+	          NULL,
+	          0x00001020UL,
+	          2,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libregf_hash_table_free(
+	          &hash_table,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "hash_table",
+	 hash_table );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hash_table != NULL )
+	{
+		libregf_hash_table_free(
+		 &hash_table,
+		 NULL,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_hash_table_get_first_value and libregf_hash_table_get_next_value functions
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_hash_table_get_value(
+     void )
+{
+	uint32_t keys[ 5 ]               = {
+		0x0001c5e6UL, 0x00a3b2c1UL, 0x0001c5e6UL, 0x7fff0000UL, 0x0001c5e6UL };
+
+	libcerror_error_t *error         = NULL;
+	libregf_hash_table_t *hash_table = NULL;
+	intptr_t value                   = 0;
+	int entry_index                  = 0;
+	int result                       = 0;
+	int value_index                  = 0;
+
+	/* Initialize test
+	 */
+	result = libregf_hash_table_initialize(
+	          &hash_table,
+	          5,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "hash_table",
+	 hash_table );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_index = 0;
+	     value_index < 5;
+	     value_index++ )
+	{
+		result = libregf_hash_table_insert_value(
+		          hash_table,
+		          keys[ value_index ],
+		          (intptr_t) value_index,
+		          &error );
+
+		REGF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		REGF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	result = libregf_hash_table_get_first_value(
+	          hash_table,
+	          0x0001c5e6UL,
+	          &entry_index,
+	          &value,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "value",
+	 (int) value,
+	 0 );
+
+	result = libregf_hash_table_get_next_value(
+	          hash_table,
+	          0x0001c5e6UL,
+	          &entry_index,
+	          &value,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "value",
+	 (int) value,
+	 2 );
+
+	result = libregf_hash_table_get_next_value(
+	          hash_table,
+	          0x0001c5e6UL,
+	          &entry_index,
+	          &value,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "value",
+	 (int) value,
+	 4 );
+
+	result = libregf_hash_table_get_next_value(
+	          hash_table,
+	          0x0001c5e6UL,
+	          &entry_index,
+	          &value,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_hash_table_get_first_value(
+	          hash_table,
+	          0x7fff0000UL,
+	          &entry_index,
+	          &value,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "value",
+	 (int) value,
+	 3 );
+
+	result = libregf_hash_table_get_first_value(
+	          hash_table,
+	          0x00000001UL,
+	          &entry_index,
+	          &value,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_hash_table_get_first_value(
+	          NULL,
+	          0x0001c5e6UL,
+	          &entry_index,
+	          &value,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_hash_table_get_first_value(
+	          hash_table,
+	          0x0001c5e6UL,
+	          NULL,
+	          &value,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_hash_table_get_first_value(
+	          hash_table,
+	          0x0001c5e6UL,
+	          &entry_index,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	entry_index = 0;
+
+	result = libregf_hash_table_get_next_value(
+	          NULL,
+	          0x0001c5e6UL,
+	          &entry_index,
+	          &value,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_hash_table_get_next_value(
+	          hash_table,
+	          0x0001c5e6UL,
+	          NULL,
+	          &value,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_hash_table_get_next_value(
+	          hash_table,
+	          0x0001c5e6UL,
+	          &entry_index,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	entry_index = -1;
+
+	result = libregf_hash_table_get_next_value(
+	          hash_table,
+	          0x0001c5e6UL,
+	          &entry_index,
+	          &value,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libregf_hash_table_free(
+	          &hash_table,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "hash_table",
+	 hash_table );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hash_table != NULL )
+	{
+		libregf_hash_table_free(
+		 &hash_table,
+		 NULL,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc REGF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] REGF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc REGF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] REGF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	REGF_TEST_UNREFERENCED_PARAMETER( argc )
+	REGF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT )
+
+	REGF_TEST_RUN(
+	 "libregf_hash_table_initialize",
+	 regf_test_hash_table_initialize );
+
+	REGF_TEST_RUN(
+	 "libregf_hash_table_free",
+	 regf_test_hash_table_free );
+
+	REGF_TEST_RUN(
+	 "libregf_hash_table_resize_buckets",
+	 regf_test_hash_table_resize_buckets );
+
+	REGF_TEST_RUN(
+	 "libregf_hash_table_get_number_of_values",
+	 regf_test_hash_table_get_number_of_values );
+
+	REGF_TEST_RUN(
+	 "libregf_hash_table_insert_value",
+	 regf_test_hash_table_insert_value );
+
+	REGF_TEST_RUN(
+	 "libregf_hash_table_remove_value",
+	 regf_test_hash_table_remove_value );
+
+	REGF_TEST_RUN(
+	 "libregf_hash_table_get_first_value",
+	 regf_test_hash_table_get_value );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT ) */
+}
+
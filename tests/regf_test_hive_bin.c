@@ -735,8 +735,8 @@ int regf_test_hive_bin_read_cells_file_io_handle(
 	 */
 	result = regf_test_open_file_io_handle(
 	          &file_io_handle,
-	          &( regf_test_hive_bin_data1[ 32 ] ),
-	          4096 - 32,
+	          regf_test_hive_bin_data1,
+	          4096,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
@@ -757,6 +757,7 @@ int regf_test_hive_bin_read_cells_file_io_handle(
 	result = libregf_hive_bin_read_cells_file_io_handle(
 	          hive_bin,
 	          file_io_handle,
+	          0,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
@@ -773,6 +774,7 @@ int regf_test_hive_bin_read_cells_file_io_handle(
 	result = libregf_hive_bin_read_cells_file_io_handle(
 	          NULL,
 	          file_io_handle,
+	          0,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
@@ -790,6 +792,25 @@ int regf_test_hive_bin_read_cells_file_io_handle(
 	result = libregf_hive_bin_read_cells_file_io_handle(
 	          hive_bin,
 	          NULL,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_hive_bin_read_cells_file_io_handle(
+	          hive_bin,
+	          file_io_handle,
+	          -1,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
@@ -843,6 +864,7 @@ int regf_test_hive_bin_read_cells_file_io_handle(
 	result = libregf_hive_bin_read_cells_file_io_handle(
 	          hive_bin,
 	          file_io_handle,
+	          0,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
@@ -1123,6 +1145,53 @@ int regf_test_hive_bin_get_cell_at_offset(
 
 	hive_bin_cell = NULL;
 
+	result = libregf_hive_bin_get_cell_at_offset(
+	          hive_bin,
+	          4096 + 32 + 144,
+	          &hive_bin_cell,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "hive_bin_cell",
+	 hive_bin_cell );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "hive_bin_cell->offset",
+	 hive_bin_cell->offset,
+	 (uint32_t) ( 4096 + 32 + 144 ) );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	hive_bin_cell = NULL;
+
+	result = libregf_hive_bin_get_cell_at_offset(
+	          hive_bin,
+	          4096 + 40,
+	          &hive_bin_cell,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "hive_bin_cell",
+	 hive_bin_cell );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	hive_bin_cell = NULL;
+
 	result = libregf_hive_bin_get_cell_at_offset(
 	          hive_bin,
 	          0,
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -30,13 +31,13 @@
 #include "regf_test_functions.h"
 #include "regf_test_libbfio.h"
 #include "regf_test_libcerror.h"
-#include "regf_test_libfcache.h"
-#include "regf_test_libfdata.h"
 #include "regf_test_libregf.h"
 #include "regf_test_macros.h"
 #include "regf_test_memory.h"
 #include "regf_test_unused.h"
 
+#include "../libregf/libregf_hive_bin.h"
+#include "../libregf/libregf_hive_bin_header.h"
 #include "../libregf/libregf_hive_bins_list.h"
 #include "../libregf/libregf_io_handle.h"
 
@@ -996,13 +997,12 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libregf_hive_bins_list_read_file_io_handle function
+/* Tests the libregf_hive_bins_list_set_data_range function
  * Returns 1 if successful or 0 if not
  */
-int regf_test_hive_bins_list_read_file_io_handle(
+int regf_test_hive_bins_list_set_data_range(
      void )
 {
-	libbfio_handle_t *file_io_handle         = NULL;
 	libcerror_error_t *error                 = NULL;
 	libregf_hive_bins_list_t *hive_bins_list = NULL;
 	libregf_io_handle_t *io_handle           = NULL;
@@ -1045,34 +1045,12 @@ int regf_test_hive_bins_list_read_file_io_handle(
 	 "error",
 	 error );
 
-	/* Initialize file IO handle
-	 */
-	result = regf_test_open_file_io_handle(
-	          &file_io_handle,
-	          regf_test_hive_bins_list_data1,
-	          8192,
-	          &error );
-
-	REGF_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	REGF_TEST_ASSERT_IS_NOT_NULL(
-	 "file_io_handle",
-	 file_io_handle );
-
-	REGF_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
 	/* Test regular cases
 	 */
-	result = libregf_hive_bins_list_read_file_io_handle(
+	result = libregf_hive_bins_list_set_data_range(
 	          hive_bins_list,
-	          file_io_handle,
-	          4096,
 	          4096,
+	          8192,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
@@ -1084,13 +1062,22 @@ int regf_test_hive_bins_list_read_file_io_handle(
 	 "error",
 	 error );
 
+	REGF_TEST_ASSERT_EQUAL_INT64(
+	 "hive_bins_list->next_hive_bin_offset",
+	 (int64_t) hive_bins_list->next_hive_bin_offset,
+	 (int64_t) 4096 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "hive_bins_list->remaining_hive_bins_size",
+	 hive_bins_list->remaining_hive_bins_size,
+	 (uint32_t) 8192 );
+
 	/* Test error cases
 	 */
-	result = libregf_hive_bins_list_read_file_io_handle(
+	result = libregf_hive_bins_list_set_data_range(
 	          NULL,
-	          file_io_handle,
-	          4096,
 	          4096,
+	          8192,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
@@ -1105,17 +1092,12 @@ int regf_test_hive_bins_list_read_file_io_handle(
 	libcerror_error_free(
 	 &error );
 
-	hive_bins_list->io_handle = NULL;
-
-	result = libregf_hive_bins_list_read_file_io_handle(
+	result = libregf_hive_bins_list_set_data_range(
 	          hive_bins_list,
-	          file_io_handle,
-	          4096,
-	          4096,
+	          -1,
+	          8192,
 	          &error );
 
-	hive_bins_list->io_handle = io_handle;
-
 	REGF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -1128,79 +1110,119 @@ int regf_test_hive_bins_list_read_file_io_handle(
 	libcerror_error_free(
 	 &error );
 
-	result = libregf_hive_bins_list_read_file_io_handle(
-	          hive_bins_list,
-	          NULL,
-	          4096,
-	          4096,
+	/* Clean up
+	 */
+	result = libregf_hive_bins_list_free(
+	          &hive_bins_list,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	REGF_TEST_ASSERT_IS_NOT_NULL(
+	REGF_TEST_ASSERT_IS_NULL(
+	 "hive_bins_list",
+	 hive_bins_list );
+
+	REGF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-#if defined( HAVE_REGF_TEST_MEMORY )
+	result = libregf_io_handle_free(
+	          &io_handle,
+	          &error );
 
-	/* Test libregf_hive_bins_list_read_file_io_handle with malloc failing in libregf_hive_bin_header_initialize
-	 */
-	regf_test_malloc_attempts_before_fail = 0;
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	result = libregf_hive_bins_list_read_file_io_handle(
-	          hive_bins_list,
-	          file_io_handle,
-	          4096,
-	          4096,
-	          &error );
+	REGF_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
 
-	if( regf_test_malloc_attempts_before_fail != -1 )
-	{
-		regf_test_malloc_attempts_before_fail = -1;
-	}
-	else
-	{
-		REGF_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		REGF_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	return( 1 );
 
+on_error:
+	if( error != NULL )
+	{
 		libcerror_error_free(
 		 &error );
 	}
-#endif /* defined( HAVE_REGF_TEST_MEMORY ) */
+	if( hive_bins_list != NULL )
+	{
+		libregf_hive_bins_list_free(
+		 &hive_bins_list,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libregf_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
 
-	/* Clean up file IO handle
+/* Tests the libregf_hive_bins_list_read_bins_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_hive_bins_list_read_bins_file_io_handle(
+     void )
+{
+	libbfio_handle_t *file_io_handle         = NULL;
+	libcerror_error_t *error                 = NULL;
+	libregf_hive_bins_list_t *hive_bins_list = NULL;
+	libregf_io_handle_t *io_handle           = NULL;
+	int hive_bin_index                       = 0;
+	int result                               = 0;
+
+	/* Initialize test
 	 */
-	result = regf_test_close_file_io_handle(
-	          &file_io_handle,
+	result = libregf_io_handle_initialize(
+	          &io_handle,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_hive_bins_list_initialize(
+	          &hive_bins_list,
+	          io_handle,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "hive_bins_list",
+	 hive_bins_list );
 
 	REGF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test data too small
-	 */
 	result = regf_test_open_file_io_handle(
 	          &file_io_handle,
 	          regf_test_hive_bins_list_data1,
-	          4096 + 8,
+	          8192,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
@@ -1216,13 +1238,29 @@ int regf_test_hive_bins_list_read_file_io_handle(
 	 "error",
 	 error );
 
-	result = libregf_hive_bins_list_read_file_io_handle(
+	result = libregf_hive_bins_list_set_data_range(
 	          hive_bins_list,
-	          file_io_handle,
 	          4096,
 	          4096,
 	          &error );
 
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_hive_bins_list_read_bins_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          0,
+	          &error );
+
 	REGF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -1235,21 +1273,101 @@ int regf_test_hive_bins_list_read_file_io_handle(
 	libcerror_error_free(
 	 &error );
 
-	result = regf_test_close_file_io_handle(
-	          &file_io_handle,
+	result = libregf_hive_bins_list_read_bins_file_io_handle(
+	          hive_bins_list,
+	          file_io_handle,
+	          -2,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test regular cases
+	 */
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "hive_bins_list->number_of_hive_bins",
+	 hive_bins_list->number_of_hive_bins,
+	 0 );
+
+	/* Test the hive bins are read on demand
+	 */
+	result = libregf_hive_bins_list_get_index_at_offset(
+	          hive_bins_list,
+	          file_io_handle,
+	          32,
+	          &hive_bin_index,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "hive_bin_index",
+	 hive_bin_index,
 	 0 );
 
 	REGF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "hive_bins_list->number_of_hive_bins",
+	 hive_bins_list->number_of_hive_bins,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "hive_bins_list->remaining_hive_bins_size",
+	 hive_bins_list->remaining_hive_bins_size,
+	 (uint32_t) 0 );
+
+	/* Test reading when all the hive bins were read
+	 */
+	result = libregf_hive_bins_list_read_bins_file_io_handle(
+	          hive_bins_list,
+	          file_io_handle,
+	          -1,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "hive_bins_list->number_of_hive_bins",
+	 hive_bins_list->number_of_hive_bins,
+	 1 );
+
 	/* Clean up
 	 */
+	result = regf_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	result = libregf_hive_bins_list_free(
 	          &hive_bins_list,
 	          &error );
@@ -1313,15 +1431,20 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libregf_hive_bins_list_append_bin function
+/* Tests the libregf_internal_hive_bins_list_read_bin_at_offset function
  * Returns 1 if successful or 0 if not
  */
-int regf_test_hive_bins_list_append_bin(
+int regf_test_internal_hive_bins_list_read_bin_at_offset(
      void )
 {
+	uint8_t data[ 20480 ];
+
+	libbfio_handle_t *file_io_handle         = NULL;
 	libcerror_error_t *error                 = NULL;
 	libregf_hive_bins_list_t *hive_bins_list = NULL;
 	libregf_io_handle_t *io_handle           = NULL;
+	int bin_index                            = 0;
+	int hive_bin_index                       = 0;
 	int result                               = 0;
 
 	/* Initialize test
@@ -1361,12 +1484,188 @@ int regf_test_hive_bins_list_append_bin(
 	 "error",
 	 error );
 
-	/* Test regular cases
+	/* Create 4 hive bins from the hive bin in the test data, with the stored offset of each hive bin set
 	 */
-	result = libregf_hive_bins_list_append_bin(
-	          hive_bins_list,
-	          4096,
+	memory_copy(
+	 data,
+	 regf_test_hive_bins_list_data1,
+	 8192 );
+
+	for( bin_index = 1;
+	     bin_index < 4;
+	     bin_index++ )
+	{
+		memory_copy(
+		 &( data[ 4096 + ( bin_index * 4096 ) ] ),
+		 &( regf_test_hive_bins_list_data1[ 4096 ] ),
+		 4096 );
+
+		data[ 4096 + ( bin_index * 4096 ) + 5 ] = (uint8_t) ( bin_index * 0x10 );
+	}
+	result = regf_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          20480,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_hive_bins_list_set_data_range(
+	          hive_bins_list,
 	          4096,
+	          16384,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_hive_bins_list_read_bins_file_io_handle(
+	          hive_bins_list,
+	          file_io_handle,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libregf_internal_hive_bins_list_read_bin_at_offset(
+	          hive_bins_list,
+	          file_io_handle,
+	          ( 3 * 4096 ) + 32,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "hive_bins_list->number_of_hive_bins",
+	 hive_bins_list->number_of_hive_bins,
+	 2 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "hive_bins_list->number_of_sequential_hive_bins",
+	 hive_bins_list->number_of_sequential_hive_bins,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT64(
+	 "hive_bins_list->entries[ 1 ].offset",
+	 hive_bins_list->entries[ 1 ].offset,
+	 (uint64_t) ( 3 * 4096 ) );
+
+	REGF_TEST_ASSERT_EQUAL_INT64(
+	 "hive_bins_list->entries[ 1 ].file_offset",
+	 (int64_t) hive_bins_list->entries[ 1 ].file_offset,
+	 (int64_t) ( 4 * 4096 ) );
+
+	/* Test a hive bin that was read directly before is not read again
+	 */
+	result = libregf_internal_hive_bins_list_read_bin_at_offset(
+	          hive_bins_list,
+	          file_io_handle,
+	          ( 3 * 4096 ) + 64,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "hive_bins_list->number_of_hive_bins",
+	 hive_bins_list->number_of_hive_bins,
+	 2 );
+
+	/* Test a hive bin before a hive bin that was read directly before is inserted in offset order
+	 */
+	result = libregf_hive_bins_list_get_index_at_offset(
+	          hive_bins_list,
+	          file_io_handle,
+	          4096 + 32,
+	          &hive_bin_index,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "hive_bin_index",
+	 hive_bin_index,
+	 2 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "hive_bins_list->sorted_entry_indexes[ 1 ]",
+	 hive_bins_list->sorted_entry_indexes[ 1 ],
+	 2 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "hive_bins_list->sorted_entry_indexes[ 2 ]",
+	 hive_bins_list->sorted_entry_indexes[ 2 ],
+	 1 );
+
+	/* Test an offset beyond the hive bins is not read directly
+	 */
+	result = libregf_internal_hive_bins_list_read_bin_at_offset(
+	          hive_bins_list,
+	          file_io_handle,
+	          4 * 4096,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the hive bins that were read directly are not added again when read sequentially
+	 */
+	result = libregf_hive_bins_list_read_bins_file_io_handle(
+	          hive_bins_list,
+	          file_io_handle,
+	          -1,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
@@ -1378,12 +1677,65 @@ int regf_test_hive_bins_list_append_bin(
 	 "error",
 	 error );
 
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "hive_bins_list->number_of_hive_bins",
+	 hive_bins_list->number_of_hive_bins,
+	 4 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "hive_bins_list->number_of_sequential_hive_bins",
+	 hive_bins_list->number_of_sequential_hive_bins,
+	 4 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "hive_bins_list->sorted_entry_indexes[ 3 ]",
+	 hive_bins_list->sorted_entry_indexes[ 3 ],
+	 1 );
+
 	/* Test error cases
 	 */
-	result = libregf_hive_bins_list_append_bin(
+	result = libregf_internal_hive_bins_list_read_bin_at_offset(
 	          NULL,
-	          4096,
-	          4096,
+	          file_io_handle,
+	          32,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_internal_hive_bins_list_read_bin_at_offset(
+	          hive_bins_list,
+	          file_io_handle,
+	          -1,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test an offset in the hive bins read sequentially
+	 */
+	result = libregf_internal_hive_bins_list_read_bin_at_offset(
+	          hive_bins_list,
+	          file_io_handle,
+	          32,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
@@ -1400,6 +1752,19 @@ int regf_test_hive_bins_list_append_bin(
 
 	/* Clean up
 	 */
+	result = regf_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	result = libregf_hive_bins_list_free(
 	          &hive_bins_list,
 	          &error );
@@ -1442,6 +1807,12 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
 	if( hive_bins_list != NULL )
 	{
 		libregf_hive_bins_list_free(
@@ -1457,22 +1828,23 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libregf_hive_bins_list_get_index_at_offset function
+/* Tests the libregf_hive_bins_list_read_hive_bin_header function
  * Returns 1 if successful or 0 if not
  */
-int regf_test_hive_bins_list_get_index_at_offset(
-     libregf_hive_bins_list_t *hive_bins_list )
+int regf_test_hive_bins_list_read_hive_bin_header(
+     void )
 {
-	libcerror_error_t *error = NULL;
-	int hive_bin_index       = 0;
-	int result               = 0;
+	libbfio_handle_t *file_io_handle           = NULL;
+	libcerror_error_t *error                   = NULL;
+	libregf_hive_bin_header_t *hive_bin_header = NULL;
+	libregf_hive_bins_list_t *hive_bins_list   = NULL;
+	libregf_io_handle_t *io_handle             = NULL;
+	int result                                 = 0;
 
-	/* Test regular cases
+	/* Initialize test
 	 */
-	result = libregf_hive_bins_list_get_index_at_offset(
-	          hive_bins_list,
-	          32,
-	          &hive_bin_index,
+	result = libregf_io_handle_initialize(
+	          &io_handle,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
@@ -1480,104 +1852,1948 @@ int regf_test_hive_bins_list_get_index_at_offset(
 	 result,
 	 1 );
 
-	REGF_TEST_ASSERT_EQUAL_INT(
-	 "hive_bin_index",
-	 hive_bin_index,
-	 0 );
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
 
 	REGF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libregf_hive_bins_list_get_index_at_offset(
-	          NULL,
-	          32,
-	          &hive_bin_index,
+	result = libregf_hive_bins_list_initialize(
+	          &hive_bins_list,
+	          io_handle,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "hive_bins_list",
+	 hive_bins_list );
+
+	REGF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libregf_hive_bins_list_get_index_at_offset(
-	          hive_bins_list,
-	          32,
-	          NULL,
+	result = libregf_hive_bin_header_initialize(
+	          &hive_bin_header,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "hive_bin_header",
+	 hive_bin_header );
+
+	REGF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	result = regf_test_open_file_io_handle(
+	          &file_io_handle,
+	          regf_test_hive_bins_list_data1,
+	          8192,
+	          &error );
 
-	return( 1 );
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libregf_hive_bins_list_read_hive_bin_header(
+	          hive_bins_list,
+	          file_io_handle,
+	          4096,
+	          hive_bin_header,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "hive_bin_header->size",
+	 hive_bin_header->size,
+	 (uint32_t) 4096 );
+
+	/* Test reading a hive bin header without a hive bin signature
+	 */
+	result = libregf_hive_bins_list_read_hive_bin_header(
+	          hive_bins_list,
+	          file_io_handle,
+	          0,
+	          hive_bin_header,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_hive_bins_list_read_hive_bin_header(
+	          NULL,
+	          file_io_handle,
+	          4096,
+	          hive_bin_header,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_hive_bins_list_read_hive_bin_header(
+	          hive_bins_list,
+	          file_io_handle,
+	          -1,
+	          hive_bin_header,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libregf_hive_bin_header_free(
+	          &hive_bin_header,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "hive_bin_header",
+	 hive_bin_header );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = regf_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_hive_bins_list_free(
+	          &hive_bins_list,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "hive_bins_list",
+	 hive_bins_list );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( hive_bin_header != NULL )
+	{
+		libregf_hive_bin_header_free(
+		 &hive_bin_header,
+		 NULL );
+	}
+	if( hive_bins_list != NULL )
+	{
+		libregf_hive_bins_list_free(
+		 &hive_bins_list,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libregf_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_hive_bins_list_read_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_hive_bins_list_read_file_io_handle(
+     void )
+{
+	libbfio_handle_t *file_io_handle         = NULL;
+	libcerror_error_t *error                 = NULL;
+	libregf_hive_bins_list_t *hive_bins_list = NULL;
+	libregf_io_handle_t *io_handle           = NULL;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libregf_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_hive_bins_list_initialize(
+	          &hive_bins_list,
+	          io_handle,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "hive_bins_list",
+	 hive_bins_list );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize file IO handle
+	 */
+	result = regf_test_open_file_io_handle(
+	          &file_io_handle,
+	          regf_test_hive_bins_list_data1,
+	          8192,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libregf_hive_bins_list_read_file_io_handle(
+	          hive_bins_list,
+	          file_io_handle,
+	          4096,
+	          4096,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_hive_bins_list_read_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          4096,
+	          4096,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	hive_bins_list->io_handle = NULL;
+
+	result = libregf_hive_bins_list_read_file_io_handle(
+	          hive_bins_list,
+	          file_io_handle,
+	          4096,
+	          4096,
+	          &error );
+
+	hive_bins_list->io_handle = io_handle;
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_hive_bins_list_read_file_io_handle(
+	          hive_bins_list,
+	          NULL,
+	          4096,
+	          4096,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_REGF_TEST_MEMORY )
+
+	/* Test libregf_hive_bins_list_read_file_io_handle with malloc failing in libregf_hive_bin_header_initialize
+	 */
+	regf_test_malloc_attempts_before_fail = 0;
+
+	result = libregf_hive_bins_list_read_file_io_handle(
+	          hive_bins_list,
+	          file_io_handle,
+	          4096,
+	          4096,
+	          &error );
+
+	if( regf_test_malloc_attempts_before_fail != -1 )
+	{
+		regf_test_malloc_attempts_before_fail = -1;
+	}
+	else
+	{
+		REGF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		REGF_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_REGF_TEST_MEMORY ) */
+
+	/* Clean up file IO handle
+	 */
+	result = regf_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test data too small
+	 */
+	result = regf_test_open_file_io_handle(
+	          &file_io_handle,
+	          regf_test_hive_bins_list_data1,
+	          4096 + 8,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_hive_bins_list_read_file_io_handle(
+	          hive_bins_list,
+	          file_io_handle,
+	          4096,
+	          4096,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = regf_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libregf_hive_bins_list_free(
+	          &hive_bins_list,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "hive_bins_list",
+	 hive_bins_list );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( hive_bins_list != NULL )
+	{
+		libregf_hive_bins_list_free(
+		 &hive_bins_list,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libregf_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_hive_bins_list_append_bin function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_hive_bins_list_append_bin(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libregf_hive_bins_list_t *hive_bins_list = NULL;
+	libregf_io_handle_t *io_handle           = NULL;
+	int bin_index                            = 0;
+	int hive_bin_index                       = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libregf_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_hive_bins_list_initialize(
+	          &hive_bins_list,
+	          io_handle,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "hive_bins_list",
+	 hive_bins_list );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libregf_hive_bins_list_append_bin(
+	          hive_bins_list,
+	          4096,
+	          4096,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test appending more hive bins than the initial number of allocated entries
+	 */
+	for( bin_index = 1;
+	     bin_index < 100;
+	     bin_index++ )
+	{
+		result = libregf_hive_bins_list_append_bin(
+		          hive_bins_list,
+		          4096 + ( bin_index * 4096 ),
+		          4096,
+		          &error );
+
+		REGF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		REGF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "hive_bins_list->number_of_hive_bins",
+	 hive_bins_list->number_of_hive_bins,
+	 100 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT64(
+	 "hive_bins_list->entries[ 99 ].offset",
+	 hive_bins_list->entries[ 99 ].offset,
+	 (uint64_t) 405504 );
+
+	REGF_TEST_ASSERT_EQUAL_INT64(
+	 "hive_bins_list->entries[ 99 ].file_offset",
+	 (int64_t) hive_bins_list->entries[ 99 ].file_offset,
+	 (int64_t) 409600 );
+
+	/* Test looking up the hive bins by offset
+	 */
+	result = libregf_hive_bins_list_get_index_at_offset(
+	          hive_bins_list,
+	          NULL,
+	          ( 50 * 4096 ) + 32,
+	          &hive_bin_index,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "hive_bin_index",
+	 hive_bin_index,
+	 50 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_hive_bins_list_get_index_at_offset(
+	          hive_bins_list,
+	          NULL,
+	          ( 100 * 4096 ) - 1,
+	          &hive_bin_index,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "hive_bin_index",
+	 hive_bin_index,
+	 99 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_hive_bins_list_get_index_at_offset(
+	          hive_bins_list,
+	          NULL,
+	          100 * 4096,
+	          &hive_bin_index,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_hive_bins_list_append_bin(
+	          NULL,
+	          4096,
+	          4096,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libregf_hive_bins_list_free(
+	          &hive_bins_list,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "hive_bins_list",
+	 hive_bins_list );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hive_bins_list != NULL )
+	{
+		libregf_hive_bins_list_free(
+		 &hive_bins_list,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libregf_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_hive_bins_list_insert_bin function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_hive_bins_list_insert_bin(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libregf_hive_bins_list_t *hive_bins_list = NULL;
+	libregf_io_handle_t *io_handle           = NULL;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libregf_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_hive_bins_list_initialize(
+	          &hive_bins_list,
+	          io_handle,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "hive_bins_list",
+	 hive_bins_list );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libregf_hive_bins_list_insert_bin(
+	          hive_bins_list,
+	          0,
+	          8192,
+	          4096 + 8192,
+	          4096,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_hive_bins_list_insert_bin(
+	          hive_bins_list,
+	          0,
+	          0,
+	          4096,
+	          4096,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_hive_bins_list_insert_bin(
+	          hive_bins_list,
+	          1,
+	          4096,
+	          4096 + 4096,
+	          4096,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "hive_bins_list->number_of_hive_bins",
+	 hive_bins_list->number_of_hive_bins,
+	 3 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "hive_bins_list->sorted_entry_indexes[ 0 ]",
+	 hive_bins_list->sorted_entry_indexes[ 0 ],
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "hive_bins_list->sorted_entry_indexes[ 1 ]",
+	 hive_bins_list->sorted_entry_indexes[ 1 ],
+	 2 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "hive_bins_list->sorted_entry_indexes[ 2 ]",
+	 hive_bins_list->sorted_entry_indexes[ 2 ],
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libregf_hive_bins_list_insert_bin(
+	          NULL,
+	          0,
+	          0,
+	          4096,
+	          4096,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_hive_bins_list_insert_bin(
+	          hive_bins_list,
+	          -1,
+	          0,
+	          4096,
+	          4096,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_hive_bins_list_insert_bin(
+	          hive_bins_list,
+	          4,
+	          0,
+	          4096,
+	          4096,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libregf_hive_bins_list_free(
+	          &hive_bins_list,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "hive_bins_list",
+	 hive_bins_list );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hive_bins_list != NULL )
+	{
+		libregf_hive_bins_list_free(
+		 &hive_bins_list,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libregf_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_hive_bins_list_get_index_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_hive_bins_list_get_index_at_offset(
+     libregf_hive_bins_list_t *hive_bins_list,
+     libbfio_handle_t *file_io_handle )
+{
+	libcerror_error_t *error = NULL;
+	int hive_bin_index       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libregf_hive_bins_list_get_index_at_offset(
+	          hive_bins_list,
+	          file_io_handle,
+	          32,
+	          &hive_bin_index,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "hive_bin_index",
+	 hive_bin_index,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_hive_bins_list_get_index_at_offset(
+	          hive_bins_list,
+	          file_io_handle,
+	          4096,
+	          &hive_bin_index,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_hive_bins_list_get_index_at_offset(
+	          NULL,
+	          file_io_handle,
+	          32,
+	          &hive_bin_index,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_hive_bins_list_get_index_at_offset(
+	          hive_bins_list,
+	          file_io_handle,
+	          -1,
+	          &hive_bin_index,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_hive_bins_list_get_index_at_offset(
+	          hive_bins_list,
+	          file_io_handle,
+	          32,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_hive_bins_list_get_hive_bin_range_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_hive_bins_list_get_hive_bin_range_by_index(
+     libregf_hive_bins_list_t *hive_bins_list )
+{
+	libcerror_error_t *error = NULL;
+	off64_t file_offset      = 0;
+	uint32_t size            = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libregf_hive_bins_list_get_hive_bin_range_by_index(
+	          hive_bins_list,
+	          0,
+	          &file_offset,
+	          &size,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_INT64(
+	 "file_offset",
+	 (int64_t) file_offset,
+	 (int64_t) 4096 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "size",
+	 size,
+	 (uint32_t) 4096 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_hive_bins_list_get_hive_bin_range_by_index(
+	          NULL,
+	          0,
+	          &file_offset,
+	          &size,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_hive_bins_list_get_hive_bin_range_by_index(
+	          hive_bins_list,
+	          -1,
+	          &file_offset,
+	          &size,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_hive_bins_list_get_hive_bin_range_by_index(
+	          hive_bins_list,
+	          hive_bins_list->number_of_hive_bins,
+	          &file_offset,
+	          &size,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_hive_bins_list_get_hive_bin_range_by_index(
+	          hive_bins_list,
+	          0,
+	          NULL,
+	          &size,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_hive_bins_list_get_hive_bin_range_by_index(
+	          hive_bins_list,
+	          0,
+	          &file_offset,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_hive_bins_list_get_cell_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_hive_bins_list_get_cell_at_offset(
+     libregf_hive_bins_list_t *hive_bins_list,
+     libbfio_handle_t *file_io_handle )
+{
+	libcerror_error_t *error                      = NULL;
+	libregf_hive_bin_cell_t *hive_bin_cell        = NULL;
+	libregf_hive_bin_cell_t *second_hive_bin_cell = NULL;
+	int result                                    = 0;
+
+	/* Test regular cases
+	 */
+	result = libregf_hive_bins_list_get_cell_at_offset(
+	          hive_bins_list,
+	          file_io_handle,
+	          32,
+	          &hive_bin_cell,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "hive_bin_cell",
+	 hive_bin_cell );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "hive_bins_list->entries[ 0 ].hive_bin",
+	 hive_bins_list->entries[ 0 ].hive_bin );
+
+	/* Test that the hive bin that was read is reused
+	 */
+	result = libregf_hive_bins_list_get_cell_at_offset(
+	          hive_bins_list,
+	          file_io_handle,
+	          32,
+	          &second_hive_bin_cell,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_INTPTR(
+	 "second_hive_bin_cell",
+	 (intptr_t) second_hive_bin_cell,
+	 (intptr_t) hive_bin_cell );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "hive_bins_list->entries[ 0 ].reference_count",
+	 hive_bins_list->entries[ 0 ].reference_count,
+	 2 );
+
+	/* Test that a hive bin with cells that were not released is kept
+	 */
+	result = libregf_hive_bins_list_empty_cache(
+	          hive_bins_list,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "hive_bins_list->entries[ 0 ].hive_bin",
+	 hive_bins_list->entries[ 0 ].hive_bin );
+
+	result = libregf_hive_bins_list_release_cell_at_offset(
+	          hive_bins_list,
+	          file_io_handle,
+	          32,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_hive_bins_list_release_cell_at_offset(
+	          hive_bins_list,
+	          file_io_handle,
+	          32,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the hive bin is read again after the cache was emptied
+	 */
+	result = libregf_hive_bins_list_empty_cache(
+	          hive_bins_list,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "hive_bins_list->entries[ 0 ].hive_bin",
+	 hive_bins_list->entries[ 0 ].hive_bin );
+
+	second_hive_bin_cell = NULL;
+
+	result = libregf_hive_bins_list_get_cell_at_offset(
+	          hive_bins_list,
+	          file_io_handle,
+	          32,
+	          &second_hive_bin_cell,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "second_hive_bin_cell",
+	 second_hive_bin_cell );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_hive_bins_list_release_cell_at_offset(
+	          hive_bins_list,
+	          file_io_handle,
+	          32,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_hive_bins_list_get_cell_at_offset(
+	          NULL,
+	          file_io_handle,
+	          32,
+	          &hive_bin_cell,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_hive_bins_list_get_cell_at_offset(
+	          hive_bins_list,
+	          file_io_handle,
+	          4096,
+	          &hive_bin_cell,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_hive_bins_list_get_cell_at_offset(
+	          hive_bins_list,
+	          file_io_handle,
+	          32,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_hive_bins_list_release_cell_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_hive_bins_list_release_cell_at_offset(
+     libregf_hive_bins_list_t *hive_bins_list,
+     libbfio_handle_t *file_io_handle )
+{
+	libcerror_error_t *error               = NULL;
+	libregf_hive_bin_cell_t *hive_bin_cell = NULL;
+	int result                             = 0;
+
+	/* Test regular cases
+	 */
+	result = libregf_hive_bins_list_get_cell_at_offset(
+	          hive_bins_list,
+	          file_io_handle,
+	          32,
+	          &hive_bin_cell,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_hive_bins_list_release_cell_at_offset(
+	          hive_bins_list,
+	          file_io_handle,
+	          32,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "hive_bins_list->entries[ 0 ].reference_count",
+	 hive_bins_list->entries[ 0 ].reference_count,
+	 0 );
+
+	/* Test that the hive bin is kept while the number of hive bins
+	 * does not exceed the maximum
+	 */
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "hive_bins_list->entries[ 0 ].hive_bin",
+	 hive_bins_list->entries[ 0 ].hive_bin );
+
+	/* Test error cases
+	 */
+	result = libregf_hive_bins_list_release_cell_at_offset(
+	          NULL,
+	          file_io_handle,
+	          32,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test releasing a cell that was already released
+	 */
+	result = libregf_hive_bins_list_release_cell_at_offset(
+	          hive_bins_list,
+	          file_io_handle,
+	          32,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_hive_bins_list_release_cell_at_offset(
+	          hive_bins_list,
+	          file_io_handle,
+	          4096,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
 	}
 	return( 0 );
 }
 
-/* Tests the libregf_hive_bins_list_get_cell_at_offset function
+/* Tests the libregf_hive_bins_list_evict_hive_bins function
  * Returns 1 if successful or 0 if not
  */
-int regf_test_hive_bins_list_get_cell_at_offset(
+int regf_test_hive_bins_list_evict_hive_bins(
      libregf_hive_bins_list_t *hive_bins_list,
      libbfio_handle_t *file_io_handle )
 {
 	libcerror_error_t *error               = NULL;
 	libregf_hive_bin_cell_t *hive_bin_cell = NULL;
+	int maximum_number_of_cached_hive_bins = 0;
 	int result                             = 0;
 
-	/* Test regular cases
-	 */
-	result = libregf_hive_bins_list_get_cell_at_offset(
+	maximum_number_of_cached_hive_bins = hive_bins_list->maximum_number_of_cached_hive_bins;
+
+	/* Test regular cases
+	 */
+	result = libregf_hive_bins_list_get_cell_at_offset(
+	          hive_bins_list,
+	          file_io_handle,
+	          32,
+	          &hive_bin_cell,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	hive_bins_list->maximum_number_of_cached_hive_bins = 0;
+
+	/* Test that a hive bin with cells that were not released is not evicted
+	 */
+	result = libregf_hive_bins_list_evict_hive_bins(
+	          hive_bins_list,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "hive_bins_list->entries[ 0 ].hive_bin",
+	 hive_bins_list->entries[ 0 ].hive_bin );
+
+	/* Test that the hive bin is evicted when its last cell is released
+	 */
+	result = libregf_hive_bins_list_release_cell_at_offset(
+	          hive_bins_list,
+	          file_io_handle,
+	          32,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "hive_bins_list->entries[ 0 ].hive_bin",
+	 hive_bins_list->entries[ 0 ].hive_bin );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "hive_bins_list->number_of_cached_hive_bins[ 0 ]",
+	 hive_bins_list->number_of_cached_hive_bins[ 0 ],
+	 0 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "hive_bins_list->least_recently_used_entry_index[ 0 ]",
+	 hive_bins_list->least_recently_used_entry_index[ 0 ],
+	 -1 );
+
+	hive_bins_list->maximum_number_of_cached_hive_bins = maximum_number_of_cached_hive_bins;
+
+	/* Test error cases
+	 */
+	result = libregf_hive_bins_list_evict_hive_bins(
+	          NULL,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_hive_bins_list_evict_hive_bins(
+	          hive_bins_list,
+	          -1,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_hive_bins_list_evict_hive_bins(
+	          hive_bins_list,
+	          LIBREGF_NUMBER_OF_HIVE_BINS_LIST_SHARDS,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hive_bins_list != NULL )
+	{
+		hive_bins_list->maximum_number_of_cached_hive_bins = maximum_number_of_cached_hive_bins;
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_hive_bins_list_remove_entry_from_shard and
+ * libregf_hive_bins_list_prepend_entry_to_shard functions
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_hive_bins_list_prepend_entry_to_shard(
+     libregf_hive_bins_list_t *hive_bins_list )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libregf_hive_bins_list_prepend_entry_to_shard(
+	          hive_bins_list,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "hive_bins_list->most_recently_used_entry_index[ 0 ]",
+	 hive_bins_list->most_recently_used_entry_index[ 0 ],
+	 0 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "hive_bins_list->least_recently_used_entry_index[ 0 ]",
+	 hive_bins_list->least_recently_used_entry_index[ 0 ],
+	 0 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "hive_bins_list->number_of_cached_hive_bins[ 0 ]",
+	 hive_bins_list->number_of_cached_hive_bins[ 0 ],
+	 1 );
+
+	result = libregf_hive_bins_list_remove_entry_from_shard(
+	          hive_bins_list,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "hive_bins_list->most_recently_used_entry_index[ 0 ]",
+	 hive_bins_list->most_recently_used_entry_index[ 0 ],
+	 -1 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "hive_bins_list->least_recently_used_entry_index[ 0 ]",
+	 hive_bins_list->least_recently_used_entry_index[ 0 ],
+	 -1 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "hive_bins_list->number_of_cached_hive_bins[ 0 ]",
+	 hive_bins_list->number_of_cached_hive_bins[ 0 ],
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libregf_hive_bins_list_prepend_entry_to_shard(
+	          NULL,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_hive_bins_list_prepend_entry_to_shard(
 	          hive_bins_list,
-	          file_io_handle,
-	          32,
-	          &hive_bin_cell,
+	          -1,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	REGF_TEST_ASSERT_IS_NOT_NULL(
-	 "hive_bin_cell",
-	 hive_bin_cell );
-
-	REGF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libregf_hive_bins_list_get_cell_at_offset(
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_hive_bins_list_remove_entry_from_shard(
 	          NULL,
-	          file_io_handle,
-	          32,
-	          &hive_bin_cell,
+	          0,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
@@ -1592,11 +3808,28 @@ int regf_test_hive_bins_list_get_cell_at_offset(
 	libcerror_error_free(
 	 &error );
 
-	result = libregf_hive_bins_list_get_cell_at_offset(
+	result = libregf_hive_bins_list_remove_entry_from_shard(
 	          hive_bins_list,
-	          file_io_handle,
-	          32,
-	          NULL,
+	          hive_bins_list->number_of_hive_bins,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test removing an entry that is not in the shard
+	 */
+	result = libregf_hive_bins_list_remove_entry_from_shard(
+	          hive_bins_list,
+	          0,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
@@ -1622,24 +3855,25 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libregf_hive_bins_list_read_element_data function
+/* Tests the libregf_hive_bins_list_read_hive_bin function
  * Returns 1 if successful or 0 if not
  */
-int regf_test_hive_bins_list_read_element_data(
-     void )
+int regf_test_hive_bins_list_read_hive_bin(
+     libregf_hive_bins_list_t *hive_bins_list,
+     libbfio_handle_t *file_io_handle )
 {
-	libbfio_handle_t *file_io_handle      = NULL;
-	libcerror_error_t *error              = NULL;
-	libfcache_cache_t *cache              = NULL;
-	libfdata_list_element_t *list_element = NULL;
-	int result                            = 0;
+	libcerror_error_t *error     = NULL;
+	libregf_hive_bin_t *hive_bin = NULL;
+	int result                   = 0;
 
-	/* Initialize test
+	/* Test regular cases
 	 */
-	result = libfdata_list_element_initialize(
-	          &list_element,
-	          (libfdata_list_t *) 0x12345678UL,
-	          0,
+	result = libregf_hive_bins_list_read_hive_bin(
+	          hive_bins_list,
+	          file_io_handle,
+	          4096,
+	          4096,
+	          &hive_bin,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
@@ -1648,37 +3882,37 @@ int regf_test_hive_bins_list_read_element_data(
 	 1 );
 
 	REGF_TEST_ASSERT_IS_NOT_NULL(
-	 "list_element",
-	 list_element );
+	 "hive_bin",
+	 hive_bin );
 
 	REGF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfcache_cache_initialize(
-	          &cache,
-	          1,
+	/* Test error cases
+	 */
+	result = libregf_hive_bins_list_read_hive_bin(
+	          hive_bins_list,
+	          file_io_handle,
+	          4096,
+	          4096,
+	          &hive_bin,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	REGF_TEST_ASSERT_IS_NOT_NULL(
-	 "cache",
-	 cache );
-
-	REGF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Initialize file IO handle
-	 */
-	result = regf_test_open_file_io_handle(
-	          &file_io_handle,
-	          regf_test_hive_bins_list_data1,
-	          8192,
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_hive_bin_free(
+	          &hive_bin,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
@@ -1686,49 +3920,40 @@ int regf_test_hive_bins_list_read_element_data(
 	 result,
 	 1 );
 
-	REGF_TEST_ASSERT_IS_NOT_NULL(
-	 "file_io_handle",
-	 file_io_handle );
+	REGF_TEST_ASSERT_IS_NULL(
+	 "hive_bin",
+	 hive_bin );
 
 	REGF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	result = libregf_hive_bins_list_read_element_data(
+	result = libregf_hive_bins_list_read_hive_bin(
 	          NULL,
 	          file_io_handle,
-	          list_element,
-	          (libfdata_cache_t *) cache,
-	          0,
 	          4096,
 	          4096,
-	          0,
-	          0,
+	          &hive_bin,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	REGF_TEST_ASSERT_IS_NULL(
+	REGF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libregf_hive_bins_list_read_element_data(
-	          NULL,
-	          NULL,
-	          list_element,
-	          (libfdata_cache_t *) cache,
-	          0,
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_hive_bins_list_read_hive_bin(
+	          hive_bins_list,
+	          file_io_handle,
 	          4096,
 	          4096,
-	          0,
-	          0,
+	          NULL,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
@@ -1743,16 +3968,14 @@ int regf_test_hive_bins_list_read_element_data(
 	libcerror_error_free(
 	 &error );
 
-	result = libregf_hive_bins_list_read_element_data(
-	          NULL,
+	/* Test with a size that does not match the hive bin header
+	 */
+	result = libregf_hive_bins_list_read_hive_bin(
+	          hive_bins_list,
 	          file_io_handle,
-	          NULL,
-	          (libfdata_cache_t *) cache,
-	          0,
 	          4096,
-	          4096,
-	          0,
-	          0,
+	          8192,
+	          &hive_bin,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
@@ -1760,6 +3983,10 @@ int regf_test_hive_bins_list_read_element_data(
 	 result,
 	 -1 );
 
+	REGF_TEST_ASSERT_IS_NULL(
+	 "hive_bin",
+	 hive_bin );
+
 	REGF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1767,87 +3994,112 @@ int regf_test_hive_bins_list_read_element_data(
 	libcerror_error_free(
 	 &error );
 
-	result = libregf_hive_bins_list_read_element_data(
-	          NULL,
-	          file_io_handle,
-	          list_element,
-	          NULL,
-	          0,
-	          4096,
-	          4096,
-	          0,
-	          0,
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( hive_bin != NULL )
+	{
+		libregf_hive_bin_free(
+		 &hive_bin,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_hive_bins_list_clone function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_hive_bins_list_clone(
+     libregf_hive_bins_list_t *hive_bins_list )
+{
+	libcerror_error_t *error                             = NULL;
+	libregf_hive_bins_list_t *destination_hive_bins_list = NULL;
+	int result                                           = 0;
+
+	/* Test regular cases
+	 */
+	result = libregf_hive_bins_list_clone(
+	          &destination_hive_bins_list,
+	          hive_bins_list,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "destination_hive_bins_list",
+	 destination_hive_bins_list );
+
+	REGF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "destination_hive_bins_list->number_of_hive_bins",
+	 destination_hive_bins_list->number_of_hive_bins,
+	 hive_bins_list->number_of_hive_bins );
 
-#if defined( HAVE_REGF_TEST_MEMORY )
+	REGF_TEST_ASSERT_EQUAL_INT64(
+	 "destination_hive_bins_list->entries[ 0 ].file_offset",
+	 (int64_t) destination_hive_bins_list->entries[ 0 ].file_offset,
+	 (int64_t) hive_bins_list->entries[ 0 ].file_offset );
 
-	/* Test libregf_hive_bins_list_read_element_data with malloc failing in libregf_hive_bin_header_initialize
-	 */
-	regf_test_malloc_attempts_before_fail = 0;
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "destination_hive_bins_list->entries[ 0 ].size",
+	 destination_hive_bins_list->entries[ 0 ].size,
+	 hive_bins_list->entries[ 0 ].size );
 
-	result = libregf_hive_bins_list_read_element_data(
+	REGF_TEST_ASSERT_IS_NULL(
+	 "destination_hive_bins_list->entries[ 0 ].hive_bin",
+	 destination_hive_bins_list->entries[ 0 ].hive_bin );
+
+	/* Test error cases
+	 */
+	result = libregf_hive_bins_list_clone(
 	          NULL,
-	          file_io_handle,
-	          list_element,
-	          (libfdata_cache_t *) cache,
-	          0,
-	          4096,
-	          4096,
-	          0,
-	          0,
+	          hive_bins_list,
 	          &error );
 
-	if( regf_test_malloc_attempts_before_fail != -1 )
-	{
-		regf_test_malloc_attempts_before_fail = -1;
-	}
-	else
-	{
-		REGF_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		REGF_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-#endif /* defined( HAVE_REGF_TEST_MEMORY ) */
+	libcerror_error_free(
+	 &error );
 
-	/* Clean up file IO handle
-	 */
-	result = regf_test_close_file_io_handle(
-	          &file_io_handle,
+	result = libregf_hive_bins_list_clone(
+	          &destination_hive_bins_list,
+	          hive_bins_list,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 -1 );
 
-	REGF_TEST_ASSERT_IS_NULL(
+	REGF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
+	libcerror_error_free(
+	 &error );
+
 	/* Clean up
 	 */
-	result = libfcache_cache_free(
-	          &cache,
+	result = libregf_hive_bins_list_free(
+	          &destination_hive_bins_list,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
@@ -1856,30 +4108,36 @@ int regf_test_hive_bins_list_read_element_data(
 	 1 );
 
 	REGF_TEST_ASSERT_IS_NULL(
-	 "cache",
-	 cache );
+	 "destination_hive_bins_list",
+	 destination_hive_bins_list );
 
 	REGF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	result = libfdata_list_element_free(
-	          &list_element,
+	/* Test error cases
+	 */
+	result = libregf_hive_bins_list_clone(
+	          &destination_hive_bins_list,
+	          NULL,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	REGF_TEST_ASSERT_IS_NULL(
-	 "list_element",
-	 cache );
+	 "destination_hive_bins_list",
+	 destination_hive_bins_list );
 
-	REGF_TEST_ASSERT_IS_NULL(
+	REGF_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
+	libcerror_error_free(
+	 &error );
+
 	return( 1 );
 
 on_error:
@@ -1888,22 +4146,10 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( file_io_handle != NULL )
-	{
-		libbfio_handle_free(
-		 &file_io_handle,
-		 NULL );
-	}
-	if( cache != NULL )
-	{
-		libfcache_cache_free(
-		 &cache,
-		 NULL );
-	}
-	if( list_element != NULL )
+	if( destination_hive_bins_list != NULL )
 	{
-		libfdata_list_element_free(
-		 &list_element,
+		libregf_hive_bins_list_free(
+		 &destination_hive_bins_list,
 		 NULL );
 	}
 	return( 0 );
@@ -1950,6 +4196,22 @@ int main(
 	 "libregf_hive_bins_list_empty_cache",
 	 regf_test_hive_bins_list_empty_cache );
 
+	REGF_TEST_RUN(
+	 "libregf_hive_bins_list_set_data_range",
+	 regf_test_hive_bins_list_set_data_range );
+
+	REGF_TEST_RUN(
+	 "libregf_hive_bins_list_read_bins_file_io_handle",
+	 regf_test_hive_bins_list_read_bins_file_io_handle );
+
+	REGF_TEST_RUN(
+	 "libregf_internal_hive_bins_list_read_bin_at_offset",
+	 regf_test_internal_hive_bins_list_read_bin_at_offset );
+
+	REGF_TEST_RUN(
+	 "libregf_hive_bins_list_read_hive_bin_header",
+	 regf_test_hive_bins_list_read_hive_bin_header );
+
 	REGF_TEST_RUN(
 	 "libregf_hive_bins_list_read_file_io_handle",
 	 regf_test_hive_bins_list_read_file_io_handle );
@@ -1959,8 +4221,8 @@ int main(
 	 regf_test_hive_bins_list_append_bin );
 
 	REGF_TEST_RUN(
-	 "libregf_hive_bins_list_read_element_data",
-	 regf_test_hive_bins_list_read_element_data );
+	 "libregf_hive_bins_list_insert_bin",
+	 regf_test_hive_bins_list_insert_bin );
 
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 
@@ -2041,6 +4303,12 @@ int main(
 	REGF_TEST_RUN_WITH_ARGS(
 	 "libregf_hive_bins_list_get_index_at_offset",
 	 regf_test_hive_bins_list_get_index_at_offset,
+	 hive_bins_list,
+	 file_io_handle );
+
+	REGF_TEST_RUN_WITH_ARGS(
+	 "libregf_hive_bins_list_get_hive_bin_range_by_index",
+	 regf_test_hive_bins_list_get_hive_bin_range_by_index,
 	 hive_bins_list );
 
 	REGF_TEST_RUN_WITH_ARGS(
@@ -2049,6 +4317,34 @@ int main(
 	 hive_bins_list,
 	 file_io_handle );
 
+	REGF_TEST_RUN_WITH_ARGS(
+	 "libregf_hive_bins_list_release_cell_at_offset",
+	 regf_test_hive_bins_list_release_cell_at_offset,
+	 hive_bins_list,
+	 file_io_handle );
+
+	REGF_TEST_RUN_WITH_ARGS(
+	 "libregf_hive_bins_list_evict_hive_bins",
+	 regf_test_hive_bins_list_evict_hive_bins,
+	 hive_bins_list,
+	 file_io_handle );
+
+	REGF_TEST_RUN_WITH_ARGS(
+	 "libregf_hive_bins_list_prepend_entry_to_shard",
+	 regf_test_hive_bins_list_prepend_entry_to_shard,
+	 hive_bins_list );
+
+	REGF_TEST_RUN_WITH_ARGS(
+	 "libregf_hive_bins_list_read_hive_bin",
+	 regf_test_hive_bins_list_read_hive_bin,
+	 hive_bins_list,
+	 file_io_handle );
+
+	REGF_TEST_RUN_WITH_ARGS(
+	 "libregf_hive_bins_list_clone",
+	 regf_test_hive_bins_list_clone,
+	 hive_bins_list );
+
 	/* Clean up
 	 */
 	result = regf_test_close_file_io_handle(
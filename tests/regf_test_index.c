@@ -0,0 +1,1113 @@
+/*
+ * Library index type test program
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "regf_test_libcerror.h"
+#include "regf_test_libregf.h"
+#include "regf_test_macros.h"
+#include "regf_test_memory.h"
+#include "regf_test_unused.h"
+
+#include "../libregf/libregf_index.h"
+
+uint8_t regf_test_index_data1[ 136 ] = {
+	0x72, 0x65, 0x67, 0x66, 0x69, 0x64, 0x78, 0x00, 0x01, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x05, 0x00, 0x00, 0x00, 0x78, 0x56, 0x34, 0x12, 0x00, 0x10, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+	0xe4, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0x59, 0x7a, 0x64, 0x76, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x85, 0x5f, 0x93, 0x8d, 0x20, 0x01, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+	0x63, 0x14, 0xfe, 0xe9, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+	0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x53, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65,
+	0x5c, 0x43, 0x6c, 0x61, 0x73, 0x73, 0x65, 0x73 };
+
+#if defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT )
+
+/* Tests the libregf_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_index_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libregf_index_t *index          = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_REGF_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libregf_index_initialize(
+	          &index,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "index",
+	 index );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_index_free(
+	          &index,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "index",
+	 index );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_index_initialize(
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	index = (libregf_index_t *) 0x12345678UL;
+
+	result = libregf_index_initialize(
+	          &index,
+	          &error );
+
+	index = NULL;
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_REGF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libregf_index_initialize with malloc failing
+		 */
+		regf_test_malloc_attempts_before_fail = test_number;
+
+		result = libregf_index_initialize(
+		          &index,
+		          &error );
+
+		if( regf_test_malloc_attempts_before_fail != -1 )
+		{
+			regf_test_malloc_attempts_before_fail = -1;
+
+			if( index != NULL )
+			{
+				libregf_index_free(
+				 &index,
+				 NULL );
+			}
+		}
+		else
+		{
+			REGF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			REGF_TEST_ASSERT_IS_NULL(
+			 "index",
+			 index );
+
+			REGF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libregf_index_initialize with memset failing
+		 */
+		regf_test_memset_attempts_before_fail = test_number;
+
+		result = libregf_index_initialize(
+		          &index,
+		          &error );
+
+		if( regf_test_memset_attempts_before_fail != -1 )
+		{
+			regf_test_memset_attempts_before_fail = -1;
+
+			if( index != NULL )
+			{
+				libregf_index_free(
+				 &index,
+				 NULL );
+			}
+		}
+		else
+		{
+			REGF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			REGF_TEST_ASSERT_IS_NULL(
+			 "index",
+			 index );
+
+			REGF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_REGF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index != NULL )
+	{
+		libregf_index_free(
+		 &index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libregf_index_free(
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_index_get_utf8_path_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_index_get_utf8_path_hash(
+     void )
+{
+	uint16_t utf16_string[ 8 ] = { 'S', 'o', 'f', 't', 'w', 'a', 'r', 'e' };
+	libcerror_error_t *error   = NULL;
+	uint32_t path_hash         = 0;
+	uint32_t utf16_path_hash   = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = libregf_index_get_utf8_path_hash(
+	          (uint8_t *) "Software",
+	          8,
+	          &path_hash,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "path_hash",
+	 path_hash,
+	 (uint32_t) 0xe9fe1463UL );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The hash is case insensitive
+	 */
+	result = libregf_index_get_utf8_path_hash(
+	          (uint8_t *) "SOFTWARE",
+	          8,
+	          &path_hash,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "path_hash",
+	 path_hash,
+	 (uint32_t) 0xe9fe1463UL );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_index_get_utf16_path_hash(
+	          utf16_string,
+	          8,
+	          &utf16_path_hash,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "utf16_path_hash",
+	 utf16_path_hash,
+	 path_hash );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_index_get_utf8_path_hash(
+	          (uint8_t *) "",
+	          0,
+	          &path_hash,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "path_hash",
+	 path_hash,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_index_get_utf8_path_hash(
+	          NULL,
+	          8,
+	          &path_hash,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_index_get_utf8_path_hash(
+	          (uint8_t *) "Software",
+	          8,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_index_compare_path_with_string function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_index_compare_path_with_string(
+     void )
+{
+	uint16_t utf16_string[ 8 ] = { 'S', 'O', 'F', 'T', 'W', 'A', 'R', 'E' };
+	libcerror_error_t *error   = NULL;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = libregf_index_compare_path_with_string(
+	          (uint8_t *) "Software",
+	          8,
+	          (uint8_t *) "software",
+	          8,
+	          NULL,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_index_compare_path_with_string(
+	          (uint8_t *) "Software",
+	          8,
+	          NULL,
+	          0,
+	          utf16_string,
+	          8,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_index_compare_path_with_string(
+	          (uint8_t *) "Software",
+	          8,
+	          (uint8_t *) "Softwar",
+	          7,
+	          NULL,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_index_compare_path_with_string(
+	          (uint8_t *) "Software",
+	          8,
+	          (uint8_t *) "Hardware",
+	          8,
+	          NULL,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_index_compare_path_with_string(
+	          NULL,
+	          8,
+	          (uint8_t *) "software",
+	          8,
+	          NULL,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_index_compare_path_with_string(
+	          (uint8_t *) "Software",
+	          8,
+	          NULL,
+	          0,
+	          NULL,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_index_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_index_read_data(
+     void )
+{
+	uint8_t data[ 136 ];
+
+	libcerror_error_t *error = NULL;
+	libregf_index_t *index   = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libregf_index_initialize(
+	          &index,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "index",
+	 index );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libregf_index_read_data(
+	          index,
+	          regf_test_index_data1,
+	          136,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "index->root_key_offset",
+	 index->root_key_offset,
+	 32 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "index->number_of_hive_bins",
+	 index->number_of_hive_bins,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "index->number_of_keys",
+	 index->number_of_keys,
+	 3 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "index->ascii_codepage",
+	 index->ascii_codepage,
+	 1252 );
+
+	/* Test error cases
+	 */
+	result = libregf_index_read_data(
+	          NULL,
+	          regf_test_index_data1,
+	          136,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_index_read_data(
+	          index,
+	          NULL,
+	          136,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_index_read_data(
+	          index,
+	          regf_test_index_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_index_read_data(
+	          index,
+	          regf_test_index_data1,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the data size does not match the number of entries
+	 */
+	result = libregf_index_read_data(
+	          index,
+	          regf_test_index_data1,
+	          132,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the signature is invalid
+	 */
+	if( memory_copy(
+	     data,
+	     regf_test_index_data1,
+	     136 ) == NULL )
+	{
+		goto on_error;
+	}
+	data[ 0 ] = (uint8_t) 'x';
+
+	result = libregf_index_read_data(
+	          index,
+	          data,
+	          136,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the checksum does not match
+	 */
+	data[ 0 ]   = regf_test_index_data1[ 0 ];
+	data[ 135 ] = (uint8_t) 'x';
+
+	result = libregf_index_read_data(
+	          index,
+	          data,
+	          136,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libregf_index_free(
+	          &index,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "index",
+	 index );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index != NULL )
+	{
+		libregf_index_free(
+		 &index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_index_get_key_offset_by_utf8_path function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_index_get_key_offset_by_utf8_path(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libregf_index_t *index   = NULL;
+	uint32_t key_offset      = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libregf_index_initialize(
+	          &index,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "index",
+	 index );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_index_read_data(
+	          index,
+	          regf_test_index_data1,
+	          136,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libregf_index_get_key_offset_by_utf8_path(
+	          index,
+	          (uint8_t *) "\\SOFTWARE\\classes\\",
+	          18,
+	          &key_offset,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "key_offset",
+	 key_offset,
+	 0x120 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_index_get_key_offset_by_utf8_path(
+	          index,
+	          (uint8_t *) "Software",
+	          8,
+	          &key_offset,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "key_offset",
+	 key_offset,
+	 0x80 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_index_get_key_offset_by_utf8_path(
+	          index,
+	          (uint8_t *) "\\",
+	          1,
+	          &key_offset,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "key_offset",
+	 key_offset,
+	 0x20 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_index_get_key_offset_by_utf8_path(
+	          index,
+	          (uint8_t *) "Software\\Policies",
+	          17,
+	          &key_offset,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_index_get_key_offset_by_utf8_path(
+	          NULL,
+	          (uint8_t *) "Software",
+	          8,
+	          &key_offset,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_index_get_key_offset_by_utf8_path(
+	          index,
+	          NULL,
+	          8,
+	          &key_offset,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_index_get_key_offset_by_utf8_path(
+	          index,
+	          (uint8_t *) "Software",
+	          (size_t) SSIZE_MAX + 1,
+	          &key_offset,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_index_get_key_offset_by_utf8_path(
+	          index,
+	          (uint8_t *) "Software",
+	          8,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libregf_index_free(
+	          &index,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "index",
+	 index );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index != NULL )
+	{
+		libregf_index_free(
+		 &index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc REGF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] REGF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc REGF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] REGF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	REGF_TEST_UNREFERENCED_PARAMETER( argc )
+	REGF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT )
+
+	REGF_TEST_RUN(
+	 "libregf_index_initialize",
+	 regf_test_index_initialize );
+
+	REGF_TEST_RUN(
+	 "libregf_index_free",
+	 regf_test_index_free );
+
+	REGF_TEST_RUN(
+	 "libregf_index_get_utf8_path_hash",
+	 regf_test_index_get_utf8_path_hash );
+
+	REGF_TEST_RUN(
+	 "libregf_index_compare_path_with_string",
+	 regf_test_index_compare_path_with_string );
+
+	REGF_TEST_RUN(
+	 "libregf_index_read_data",
+	 regf_test_index_read_data );
+
+	REGF_TEST_RUN(
+	 "libregf_index_get_key_offset_by_utf8_path",
+	 regf_test_index_get_key_offset_by_utf8_path );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT ) */
+}
+
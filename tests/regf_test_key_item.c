@@ -35,9 +35,12 @@
 #include "regf_test_memory.h"
 #include "regf_test_unused.h"
 
+#include "../libregf/libregf_definitions.h"
 #include "../libregf/libregf_hive_bins_list.h"
 #include "../libregf/libregf_io_handle.h"
+#include "../libregf/libregf_key_descriptor.h"
 #include "../libregf/libregf_key_item.h"
+#include "../libregf/libregf_libcdata.h"
 #include "../libregf/libregf_named_key.h"
 
 uint8_t regf_test_key_item_data1[ 8192 ] = {
@@ -1931,6 +1934,80 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libregf_key_item_read_parts function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_key_item_read_parts(
+     libregf_key_item_t *key_item )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libregf_key_item_read_parts(
+	          key_item,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_key_item_read_parts(
+	          NULL,
+	          LIBREGF_KEY_ITEM_READ_FLAG_SUB_KEYS_LIST,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libregf_key_item_read_parts with a key item without a named key
+	 */
+	result = libregf_key_item_read_parts(
+	          key_item,
+	          LIBREGF_KEY_ITEM_READ_FLAG_SUB_KEYS_LIST,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libregf_key_item_get_number_of_values function
  * Returns 1 if successful or 0 if not
  */
@@ -1943,27 +2020,607 @@ int regf_test_key_item_get_number_of_values(
 
 	/* Test regular cases
 	 */
-#ifdef TODO
-	result = libregf_key_item_get_number_of_values(
+#ifdef TODO
+	result = libregf_key_item_get_number_of_values(
+	          key_item,
+	          &number_of_values,
+	          &error );
+
+	REGF_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+#endif
+
+	/* Test error cases
+	 */
+	result = libregf_key_item_get_number_of_values(
+	          NULL,
+	          &number_of_values,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_key_item_get_number_of_values(
+	          key_item,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_key_item_get_values_name_hash_table function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_key_item_get_values_name_hash_table(
+     libregf_key_item_t *key_item )
+{
+	libcerror_error_t *error              = NULL;
+	libregf_hash_table_t *name_hash_table = NULL;
+	int result                            = 0;
+
+	/* Test error cases
+	 */
+	result = libregf_key_item_get_values_name_hash_table(
+	          NULL,
+	          NULL,
+	          &name_hash_table,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_key_item_get_values_name_hash_table(
+	          key_item,
+	          NULL,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_key_item_get_utf8_upper_case_ascii_name function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_key_item_get_utf8_upper_case_ascii_name(
+     void )
+{
+	uint8_t ascii_name[ 16 ];
+
+	uint8_t utf8_string[ 8 ]   = { 'C', 'l', 's', 'i', 'd', '_', '1', 0xc3 };
+	libcerror_error_t *error   = NULL;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = libregf_key_item_get_utf8_upper_case_ascii_name(
+	          utf8_string,
+	          7,
+	          ascii_name,
+	          16,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          ascii_name,
+	          "CLSID_1",
+	          7 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test with a non-ASCII character
+	 */
+	result = libregf_key_item_get_utf8_upper_case_ascii_name(
+	          utf8_string,
+	          8,
+	          ascii_name,
+	          16,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a name that does not fit
+	 */
+	result = libregf_key_item_get_utf8_upper_case_ascii_name(
+	          utf8_string,
+	          7,
+	          ascii_name,
+	          6,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_key_item_get_utf8_upper_case_ascii_name(
+	          NULL,
+	          7,
+	          ascii_name,
+	          16,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_key_item_get_utf8_upper_case_ascii_name(
+	          utf8_string,
+	          (size_t) SSIZE_MAX + 1,
+	          ascii_name,
+	          16,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_key_item_get_utf8_upper_case_ascii_name(
+	          utf8_string,
+	          7,
+	          NULL,
+	          16,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_key_item_get_utf16_upper_case_ascii_name function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_key_item_get_utf16_upper_case_ascii_name(
+     void )
+{
+	uint8_t ascii_name[ 16 ];
+
+	uint16_t utf16_string[ 8 ] = { 'C', 'l', 's', 'i', 'd', '_', '1', 0x00e9 };
+	libcerror_error_t *error   = NULL;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = libregf_key_item_get_utf16_upper_case_ascii_name(
+	          utf16_string,
+	          7,
+	          ascii_name,
+	          16,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          ascii_name,
+	          "CLSID_1",
+	          7 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test with a non-ASCII character
+	 */
+	result = libregf_key_item_get_utf16_upper_case_ascii_name(
+	          utf16_string,
+	          8,
+	          ascii_name,
+	          16,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_key_item_get_utf16_upper_case_ascii_name(
+	          NULL,
+	          7,
+	          ascii_name,
+	          16,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_key_item_get_utf16_upper_case_ascii_name(
+	          utf16_string,
+	          7,
+	          NULL,
+	          16,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_key_item_check_sub_key_descriptors_order function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_key_item_check_sub_key_descriptors_order(
+     void )
+{
+	uint8_t hive_data[ 8192 ];
+
+	libregf_key_descriptor_t sub_key_descriptors[ 2 ];
+
+	libbfio_handle_t *file_io_handle         = NULL;
+	libcerror_error_t *error                 = NULL;
+	libregf_hive_bins_list_t *hive_bins_list = NULL;
+	libregf_io_handle_t *io_handle           = NULL;
+	libregf_key_item_t *key_item             = NULL;
+	int entry_index                          = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libregf_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_hive_bins_list_initialize(
+	          &hive_bins_list,
+	          io_handle,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "hive_bins_list",
+	 hive_bins_list );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Add a copy of the named key "TestKey" at offset 32 named "AestKey"
+	 * at offset 944 followed by a free cell that fills the rest of the hive bin
+	 */
+	memory_copy(
+	 hive_data,
+	 regf_test_key_item_data1,
+	 8192 );
+
+	memory_copy(
+	 &( hive_data[ 4096 + 944 ] ),
+	 &( regf_test_key_item_data1[ 4096 + 32 ] ),
+	 88 );
+
+	hive_data[ 4096 + 944 + 4 + 76 ] = 'A';
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( hive_data[ 4096 + 944 + 88 ] ),
+	 4096 - 32 - 944 - 88 );
+
+	result = regf_test_open_file_io_handle(
+	          &file_io_handle,
+	          hive_data,
+	          8192,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_hive_bins_list_read_file_io_handle(
+	          hive_bins_list,
+	          file_io_handle,
+	          4096,
+	          4096,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_key_item_initialize(
+	          &key_item,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "key_item",
+	 key_item );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	sub_key_descriptors[ 0 ].key_offset = 944;
+	sub_key_descriptors[ 0 ].hash_value = 0;
+	sub_key_descriptors[ 0 ].name_hash  = 0;
+
+	sub_key_descriptors[ 1 ].key_offset = 32;
+	sub_key_descriptors[ 1 ].hash_value = 0;
+	sub_key_descriptors[ 1 ].name_hash  = 0;
+
+	/* Test regular cases
+	 */
+	result = libcdata_array_append_entry(
+	          key_item->sub_key_descriptors,
+	          &entry_index,
+	          (intptr_t *) &( sub_key_descriptors[ 0 ] ),
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_append_entry(
+	          key_item->sub_key_descriptors,
+	          &entry_index,
+	          (intptr_t *) &( sub_key_descriptors[ 1 ] ),
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_key_item_check_sub_key_descriptors_order(
 	          key_item,
-	          &number_of_values,
+	          file_io_handle,
+	          hive_bins_list,
 	          &error );
 
-	REGF_TEST_ASSERT_NOT_EQUAL_INT(
+	REGF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	REGF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
-#endif
+
+	REGF_TEST_ASSERT_EQUAL_UINT8(
+	 "key_item->sub_key_descriptors_order_is_checked",
+	 key_item->sub_key_descriptors_order_is_checked,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT8(
+	 "key_item->sub_key_descriptors_are_unordered",
+	 key_item->sub_key_descriptors_are_unordered,
+	 0 );
+
+	/* Test with sub key descriptors that are out of order
+	 */
+	sub_key_descriptors[ 0 ].key_offset = 32;
+	sub_key_descriptors[ 1 ].key_offset = 944;
+
+	key_item->sub_key_descriptors_order_is_checked = 0;
+
+	result = libregf_key_item_check_sub_key_descriptors_order(
+	          key_item,
+	          file_io_handle,
+	          hive_bins_list,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_UINT8(
+	 "key_item->sub_key_descriptors_are_unordered",
+	 key_item->sub_key_descriptors_are_unordered,
+	 1 );
 
 	/* Test error cases
 	 */
-	result = libregf_key_item_get_number_of_values(
+	result = libregf_key_item_check_sub_key_descriptors_order(
 	          NULL,
-	          &number_of_values,
+	          file_io_handle,
+	          hive_bins_list,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
@@ -1978,22 +2635,73 @@ int regf_test_key_item_get_number_of_values(
 	libcerror_error_free(
 	 &error );
 
-	result = libregf_key_item_get_number_of_values(
-	          key_item,
-	          NULL,
+	/* Clean up
+	 */
+	result = libregf_key_item_free(
+	          &key_item,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	REGF_TEST_ASSERT_IS_NOT_NULL(
+	REGF_TEST_ASSERT_IS_NULL(
+	 "key_item",
+	 key_item );
+
+	REGF_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	/* Clean up file IO handle
+	 */
+	result = regf_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_hive_bins_list_free(
+	          &hive_bins_list,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "hive_bins_list",
+	 hive_bins_list );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	return( 1 );
 
@@ -2003,6 +2711,30 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( key_item != NULL )
+	{
+		libregf_key_item_free(
+		 &key_item,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( hive_bins_list != NULL )
+	{
+		libregf_hive_bins_list_free(
+		 &hive_bins_list,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libregf_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
 	return( 0 );
 }
 
@@ -2067,6 +2799,18 @@ int main(
 
 	/* TODO: add tests for libregf_key_item_read_sub_nodes */
 
+	REGF_TEST_RUN(
+	 "libregf_key_item_get_utf8_upper_case_ascii_name",
+	 regf_test_key_item_get_utf8_upper_case_ascii_name );
+
+	REGF_TEST_RUN(
+	 "libregf_key_item_get_utf16_upper_case_ascii_name",
+	 regf_test_key_item_get_utf16_upper_case_ascii_name );
+
+	REGF_TEST_RUN(
+	 "libregf_key_item_check_sub_key_descriptors_order",
+	 regf_test_key_item_check_sub_key_descriptors_order );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 
 	/* Initialize test
@@ -2090,11 +2834,21 @@ int main(
 
 	/* Run tests
 	 */
+	REGF_TEST_RUN_WITH_ARGS(
+	 "libregf_key_item_read_parts",
+	 regf_test_key_item_read_parts,
+	 key_item );
+
 	REGF_TEST_RUN_WITH_ARGS(
 	 "libregf_key_item_get_number_of_values",
 	 regf_test_key_item_get_number_of_values,
 	 key_item );
 
+	REGF_TEST_RUN_WITH_ARGS(
+	 "libregf_key_item_get_values_name_hash_table",
+	 regf_test_key_item_get_values_name_hash_table,
+	 key_item );
+
 	/* TODO add tests for libregf_key_item_get_name_size */
 
 	/* TODO add tests for libregf_key_item_get_name */
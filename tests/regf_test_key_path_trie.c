@@ -0,0 +1,812 @@
+/*
+ * Library key_path_trie type test program
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "regf_test_libcerror.h"
+#include "regf_test_libregf.h"
+#include "regf_test_macros.h"
+#include "regf_test_memory.h"
+#include "regf_test_unused.h"
+
+#include "../libregf/libregf_key_path_trie.h"
+
+#if defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT )
+
+/* Tests the libregf_key_path_trie_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_key_path_trie_initialize(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libregf_key_path_trie_t *key_path_trie = NULL;
+	int result                             = 0;
+
+#if defined( HAVE_REGF_TEST_MEMORY )
+	int number_of_malloc_fail_tests        = 3;
+	int number_of_memset_fail_tests        = 2;
+	int test_number                        = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libregf_key_path_trie_initialize(
+	          &key_path_trie,
+	          4,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "key_path_trie",
+	 key_path_trie );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "key_path_trie->number_of_nodes",
+	 key_path_trie->number_of_nodes,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "key_path_trie->root_node->path_index",
+	 key_path_trie->root_node->path_index,
+	 -1 );
+
+	result = libregf_key_path_trie_free(
+	          &key_path_trie,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "key_path_trie",
+	 key_path_trie );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_key_path_trie_initialize(
+	          NULL,
+	          4,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	key_path_trie = (libregf_key_path_trie_t *) 0x12345678UL;
+
+	result = libregf_key_path_trie_initialize(
+	          &key_path_trie,
+	          4,
+	          &error );
+
+	key_path_trie = NULL;
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_key_path_trie_initialize(
+	          &key_path_trie,
+	          -1,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_REGF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libregf_key_path_trie_initialize with malloc failing
+		 */
+		regf_test_malloc_attempts_before_fail = test_number;
+
+		result = libregf_key_path_trie_initialize(
+		          &key_path_trie,
+		          4,
+		          &error );
+
+		if( regf_test_malloc_attempts_before_fail != -1 )
+		{
+			regf_test_malloc_attempts_before_fail = -1;
+
+			if( key_path_trie != NULL )
+			{
+				libregf_key_path_trie_free(
+				 &key_path_trie,
+				 NULL );
+			}
+		}
+		else
+		{
+			REGF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			REGF_TEST_ASSERT_IS_NULL(
+			 "key_path_trie",
+			 key_path_trie );
+
+			REGF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libregf_key_path_trie_initialize with memset failing
+		 */
+		regf_test_memset_attempts_before_fail = test_number;
+
+		result = libregf_key_path_trie_initialize(
+		          &key_path_trie,
+		          4,
+		          &error );
+
+		if( regf_test_memset_attempts_before_fail != -1 )
+		{
+			regf_test_memset_attempts_before_fail = -1;
+
+			if( key_path_trie != NULL )
+			{
+				libregf_key_path_trie_free(
+				 &key_path_trie,
+				 NULL );
+			}
+		}
+		else
+		{
+			REGF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			REGF_TEST_ASSERT_IS_NULL(
+			 "key_path_trie",
+			 key_path_trie );
+
+			REGF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_REGF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( key_path_trie != NULL )
+	{
+		libregf_key_path_trie_free(
+		 &key_path_trie,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_key_path_trie_free function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_key_path_trie_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libregf_key_path_trie_free(
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_key_path_trie_insert_utf8_path function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_key_path_trie_insert_utf8_path(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libregf_key_path_trie_node_t *node     = NULL;
+	libregf_key_path_trie_t *key_path_trie = NULL;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libregf_key_path_trie_initialize(
+	          &key_path_trie,
+	          5,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "key_path_trie",
+	 key_path_trie );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libregf_key_path_trie_insert_utf8_path(
+	          key_path_trie,
+	          0,
+	          (uint8_t *) "\\Software\\Classes",
+	          17,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "key_path_trie->number_of_nodes",
+	 key_path_trie->number_of_nodes,
+	 3 );
+
+	/* A path with a shared prefix only adds the nodes of the remaining segments
+	 */
+	result = libregf_key_path_trie_insert_utf8_path(
+	          key_path_trie,
+	          1,
+	          (uint8_t *) "SOFTWARE\\Microsoft",
+	          18,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "key_path_trie->number_of_nodes",
+	 key_path_trie->number_of_nodes,
+	 4 );
+
+	/* A path that ends at an existing node does not add nodes
+	 */
+	result = libregf_key_path_trie_insert_utf8_path(
+	          key_path_trie,
+	          2,
+	          (uint8_t *) "software\\classes\\",
+	          17,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "key_path_trie->number_of_nodes",
+	 key_path_trie->number_of_nodes,
+	 4 );
+
+	node = key_path_trie->root_node->first_sub_node;
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "node",
+	 node );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "node->next_node",
+	 node->next_node );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "node->path_index",
+	 node->path_index,
+	 -1 );
+
+	node = node->first_sub_node;
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "node",
+	 node );
+
+	/* Sub nodes are prepended hence Microsoft precedes Classes
+	 */
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "node->path_index",
+	 node->path_index,
+	 1 );
+
+	node = node->next_node;
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "node",
+	 node );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "node->path_index",
+	 node->path_index,
+	 2 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "key_path_trie->next_path_indexes[ 2 ]",
+	 key_path_trie->next_path_indexes[ 2 ],
+	 0 );
+
+	/* An empty path refers to the root key
+	 */
+	result = libregf_key_path_trie_insert_utf8_path(
+	          key_path_trie,
+	          3,
+	          (uint8_t *) "\\",
+	          1,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "key_path_trie->root_node->path_index",
+	 key_path_trie->root_node->path_index,
+	 3 );
+
+	/* A path with an empty segment cannot refer to a key
+	 */
+	result = libregf_key_path_trie_insert_utf8_path(
+	          key_path_trie,
+	          4,
+	          (uint8_t *) "Software\\\\Classes",
+	          17,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "key_path_trie->number_of_nodes",
+	 key_path_trie->number_of_nodes,
+	 4 );
+
+	/* Test error cases
+	 */
+	result = libregf_key_path_trie_insert_utf8_path(
+	          NULL,
+	          4,
+	          (uint8_t *) "Software",
+	          8,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_key_path_trie_insert_utf8_path(
+	          key_path_trie,
+	          5,
+	          (uint8_t *) "Software",
+	          8,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_key_path_trie_insert_utf8_path(
+	          key_path_trie,
+	          4,
+	          NULL,
+	          8,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_key_path_trie_insert_utf8_path(
+	          key_path_trie,
+	          4,
+	          (uint8_t *) "Software",
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libregf_key_path_trie_free(
+	          &key_path_trie,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "key_path_trie",
+	 key_path_trie );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( key_path_trie != NULL )
+	{
+		libregf_key_path_trie_free(
+		 &key_path_trie,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_key_path_trie_insert_utf16_path function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_key_path_trie_insert_utf16_path(
+     void )
+{
+	uint16_t utf16_path1[ 10 ]             = { 'S', 'Y', 'S', 'T', 'E', 'M', '\\', 'S', 'e', 't' };
+	uint16_t utf16_path2[ 7 ]              = { 'S', 'y', 's', 't', 'e', 'm', '\\' };
+
+	libcerror_error_t *error               = NULL;
+	libregf_key_path_trie_t *key_path_trie = NULL;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libregf_key_path_trie_initialize(
+	          &key_path_trie,
+	          2,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "key_path_trie",
+	 key_path_trie );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libregf_key_path_trie_insert_utf16_path(
+	          key_path_trie,
+	          0,
+	          utf16_path1,
+	          10,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_key_path_trie_insert_utf16_path(
+	          key_path_trie,
+	          1,
+	          utf16_path2,
+	          7,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "key_path_trie->number_of_nodes",
+	 key_path_trie->number_of_nodes,
+	 3 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "key_path_trie->root_node->first_sub_node",
+	 key_path_trie->root_node->first_sub_node );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "key_path_trie->root_node->first_sub_node->path_index",
+	 key_path_trie->root_node->first_sub_node->path_index,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libregf_key_path_trie_insert_utf16_path(
+	          key_path_trie,
+	          -1,
+	          utf16_path1,
+	          10,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_key_path_trie_insert_utf16_path(
+	          key_path_trie,
+	          0,
+	          NULL,
+	          10,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libregf_key_path_trie_free(
+	          &key_path_trie,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "key_path_trie",
+	 key_path_trie );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( key_path_trie != NULL )
+	{
+		libregf_key_path_trie_free(
+		 &key_path_trie,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc REGF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] REGF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc REGF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] REGF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	REGF_TEST_UNREFERENCED_PARAMETER( argc )
+	REGF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT )
+
+	REGF_TEST_RUN(
+	 "libregf_key_path_trie_initialize",
+	 regf_test_key_path_trie_initialize );
+
+	REGF_TEST_RUN(
+	 "libregf_key_path_trie_free",
+	 regf_test_key_path_trie_free );
+
+	REGF_TEST_RUN(
+	 "libregf_key_path_trie_insert_utf8_path",
+	 regf_test_key_path_trie_insert_utf8_path );
+
+	REGF_TEST_RUN(
+	 "libregf_key_path_trie_insert_utf16_path",
+	 regf_test_key_path_trie_insert_utf16_path );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,572 @@
+/*
+ * Library security_key_cache type test program
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "regf_test_libcerror.h"
+#include "regf_test_libregf.h"
+#include "regf_test_macros.h"
+#include "regf_test_memory.h"
+#include "regf_test_unused.h"
+
+#include "../libregf/libregf_security_key.h"
+#include "../libregf/libregf_security_key_cache.h"
+
+#if defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT )
+
+/* Tests the libregf_security_key_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_security_key_cache_initialize(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libregf_security_key_cache_t *security_key_cache = NULL;
+	int result                               = 0;
+
+#if defined( HAVE_REGF_TEST_MEMORY )
+	int number_of_malloc_fail_tests          = 4;
+	int number_of_memset_fail_tests          = 3;
+	int test_number                          = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libregf_security_key_cache_initialize(
+	          &security_key_cache,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "security_key_cache",
+	 security_key_cache );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_security_key_cache_free(
+	          &security_key_cache,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "security_key_cache",
+	 security_key_cache );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_security_key_cache_initialize(
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	security_key_cache = (libregf_security_key_cache_t *) 0x12345678UL;
+
+	result = libregf_security_key_cache_initialize(
+	          &security_key_cache,
+	          &error );
+
+	security_key_cache = NULL;
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_REGF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libregf_security_key_cache_initialize with malloc failing
+		 */
+		regf_test_malloc_attempts_before_fail = test_number;
+
+		result = libregf_security_key_cache_initialize(
+		          &security_key_cache,
+		          &error );
+
+		if( regf_test_malloc_attempts_before_fail != -1 )
+		{
+			regf_test_malloc_attempts_before_fail = -1;
+
+			if( security_key_cache != NULL )
+			{
+				libregf_security_key_cache_free(
+				 &security_key_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			REGF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			REGF_TEST_ASSERT_IS_NULL(
+			 "security_key_cache",
+			 security_key_cache );
+
+			REGF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libregf_security_key_cache_initialize with memset failing
+		 */
+		regf_test_memset_attempts_before_fail = test_number;
+
+		result = libregf_security_key_cache_initialize(
+		          &security_key_cache,
+		          &error );
+
+		if( regf_test_memset_attempts_before_fail != -1 )
+		{
+			regf_test_memset_attempts_before_fail = -1;
+
+			if( security_key_cache != NULL )
+			{
+				libregf_security_key_cache_free(
+				 &security_key_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			REGF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			REGF_TEST_ASSERT_IS_NULL(
+			 "security_key_cache",
+			 security_key_cache );
+
+			REGF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_REGF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( security_key_cache != NULL )
+	{
+		libregf_security_key_cache_free(
+		 &security_key_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_security_key_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_security_key_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libregf_security_key_cache_free(
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_security_key_cache_entry_free function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_security_key_cache_entry_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libregf_security_key_cache_entry_free(
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_security_key_cache_get_security_key function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_security_key_cache_get_security_key(
+     void )
+{
+	libcerror_error_t *error                         = NULL;
+	libregf_security_key_cache_entry_t *entry        = NULL;
+	libregf_security_key_cache_t *security_key_cache = NULL;
+	libregf_security_key_t *cached_security_key      = NULL;
+	libregf_security_key_t *security_key             = NULL;
+	int result                                       = 0;
+
+	/* Initialize test
+	 */
+	result = libregf_security_key_cache_initialize(
+	          &security_key_cache,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "security_key_cache",
+	 security_key_cache );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_security_key_initialize(
+	          &security_key,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "security_key",
+	 security_key );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	entry = memory_allocate_structure(
+	         libregf_security_key_cache_entry_t );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "entry",
+	 entry );
+
+	memory_set(
+	 entry,
+	 0,
+	 sizeof( libregf_security_key_cache_entry_t ) );
+
+	entry->security_key_offset = 32;
+	entry->security_key        = security_key;
+
+	result = libregf_security_key_cache_insert_entry(
+	          security_key_cache,
+	          entry,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	entry = NULL;
+
+	/* Test regular cases
+	 */
+	result = libregf_security_key_cache_get_security_key(
+	          security_key_cache,
+	          NULL,
+	          (libregf_hive_bins_list_t *) 0x12345678UL,
+	          32,
+	          &cached_security_key,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_INTPTR(
+	 "cached_security_key",
+	 (intptr_t) cached_security_key,
+	 (intptr_t) security_key );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_security_key_cache_get_security_key(
+	          NULL,
+	          NULL,
+	          (libregf_hive_bins_list_t *) 0x12345678UL,
+	          32,
+	          &cached_security_key,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_security_key_cache_get_security_key(
+	          security_key_cache,
+	          NULL,
+	          NULL,
+	          32,
+	          &cached_security_key,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_security_key_cache_get_security_key(
+	          security_key_cache,
+	          NULL,
+	          (libregf_hive_bins_list_t *) 0x12345678UL,
+	          32,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libregf_security_key_cache_free(
+	          &security_key_cache,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "security_key_cache",
+	 security_key_cache );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( entry != NULL )
+	{
+		memory_free(
+		 entry );
+	}
+	if( security_key_cache != NULL )
+	{
+		libregf_security_key_cache_free(
+		 &security_key_cache,
+		 NULL );
+	}
+	else if( security_key != NULL )
+	{
+		libregf_security_key_free(
+		 &security_key,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc REGF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] REGF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc REGF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] REGF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	REGF_TEST_UNREFERENCED_PARAMETER( argc )
+	REGF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT )
+
+	REGF_TEST_RUN(
+	 "libregf_security_key_cache_initialize",
+	 regf_test_security_key_cache_initialize );
+
+	REGF_TEST_RUN(
+	 "libregf_security_key_cache_free",
+	 regf_test_security_key_cache_free );
+
+	REGF_TEST_RUN(
+	 "libregf_security_key_cache_entry_free",
+	 regf_test_security_key_cache_entry_free );
+
+	REGF_TEST_RUN(
+	 "libregf_security_key_cache_get_security_key",
+	 regf_test_security_key_cache_get_security_key );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT ) */
+}
+
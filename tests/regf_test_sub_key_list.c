@@ -34,6 +34,7 @@
 #include "regf_test_memory.h"
 #include "regf_test_unused.h"
 
+#include "../libregf/libregf_arena.h"
 #include "../libregf/libregf_io_handle.h"
 #include "../libregf/libregf_sub_key_list.h"
 
@@ -66,6 +67,7 @@ int regf_test_sub_key_list_initialize(
 	 */
 	result = libregf_sub_key_list_initialize(
 	          &sub_key_list,
+	          NULL,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
@@ -101,6 +103,7 @@ int regf_test_sub_key_list_initialize(
 	/* Test error cases
 	 */
 	result = libregf_sub_key_list_initialize(
+	          NULL,
 	          NULL,
 	          &error );
 
@@ -120,6 +123,7 @@ int regf_test_sub_key_list_initialize(
 
 	result = libregf_sub_key_list_initialize(
 	          &sub_key_list,
+	          NULL,
 	          &error );
 
 	sub_key_list = NULL;
@@ -148,6 +152,7 @@ int regf_test_sub_key_list_initialize(
 
 		result = libregf_sub_key_list_initialize(
 		          &sub_key_list,
+		          NULL,
 		          &error );
 
 		if( regf_test_malloc_attempts_before_fail != -1 )
@@ -190,6 +195,7 @@ int regf_test_sub_key_list_initialize(
 
 		result = libregf_sub_key_list_initialize(
 		          &sub_key_list,
+		          NULL,
 		          &error );
 
 		if( regf_test_memset_attempts_before_fail != -1 )
@@ -286,6 +292,7 @@ int regf_test_sub_key_list_read_data(
      void )
 {
 	libcerror_error_t *error             = NULL;
+	libregf_arena_t *arena               = NULL;
 	libregf_io_handle_t *io_handle       = NULL;
 	libregf_sub_key_list_t *sub_key_list = NULL;
 	int result                           = 0;
@@ -315,6 +322,7 @@ int regf_test_sub_key_list_read_data(
 
 	result = libregf_sub_key_list_initialize(
 	          &sub_key_list,
+	          NULL,
 	          &error );
 
 	REGF_TEST_ASSERT_EQUAL_INT(
@@ -493,6 +501,99 @@ int regf_test_sub_key_list_read_data(
 	 "error",
 	 error );
 
+	/* Test regular cases with the sub key descriptors allocated from an arena
+	 */
+	result = libregf_arena_initialize(
+	          &arena,
+	          256,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_sub_key_list_initialize(
+	          &sub_key_list,
+	          arena,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "sub_key_list",
+	 sub_key_list );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_sub_key_list_read_data(
+	          sub_key_list,
+	          io_handle,
+	          regf_test_sub_key_list_data1,
+	          68,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_NOT_EQUAL_SSIZE(
+	 "arena->current_offset",
+	 (ssize_t) arena->current_offset,
+	 (ssize_t) 0 );
+
+	result = libregf_sub_key_list_free(
+	          &sub_key_list,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "sub_key_list",
+	 sub_key_list );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_arena_free(
+	          &arena,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	result = libregf_io_handle_free(
 	          &io_handle,
 	          &error );
@@ -524,6 +625,12 @@ on_error:
 		 &sub_key_list,
 		 NULL );
 	}
+	if( arena != NULL )
+	{
+		libregf_arena_free(
+		 &arena,
+		 NULL );
+	}
 	if( io_handle != NULL )
 	{
 		libregf_io_handle_free(
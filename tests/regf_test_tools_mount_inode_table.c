@@ -0,0 +1,792 @@
+/*
+ * Tools mount_inode_table functions test program
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "regf_test_libcerror.h"
+#include "regf_test_libcpath.h"
+#include "regf_test_macros.h"
+#include "regf_test_unused.h"
+
+#include "../regftools/mount_inode_table.h"
+
+/* Tests the mount_inode_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_tools_mount_inode_initialize(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	mount_inode_t *inode     = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = mount_inode_initialize(
+	          &inode,
+	          _SYSTEM_STRING( "/Software/Microsoft" ),
+	          19,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "inode",
+	 inode );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_SIZE(
+	 "inode->path_length",
+	 inode->path_length,
+	 (size_t) 19 );
+
+	REGF_TEST_ASSERT_EQUAL_SIZE(
+	 "inode->name_index",
+	 inode->name_index,
+	 (size_t) 10 );
+
+	result = mount_inode_free(
+	          &inode,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "inode",
+	 inode );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the root
+	 */
+	result = mount_inode_initialize(
+	          &inode,
+	          _SYSTEM_STRING( "/" ),
+	          1,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "inode",
+	 inode );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_SIZE(
+	 "inode->name_index",
+	 inode->name_index,
+	 (size_t) 1 );
+
+	result = mount_inode_free(
+	          &inode,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = mount_inode_initialize(
+	          NULL,
+	          _SYSTEM_STRING( "/" ),
+	          1,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	inode = (mount_inode_t *) 0x12345678UL;
+
+	result = mount_inode_initialize(
+	          &inode,
+	          _SYSTEM_STRING( "/" ),
+	          1,
+	          &error );
+
+	inode = NULL;
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mount_inode_initialize(
+	          &inode,
+	          NULL,
+	          1,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mount_inode_initialize(
+	          &inode,
+	          _SYSTEM_STRING( "/" ),
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mount_inode_free(
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( inode != NULL )
+	{
+		mount_inode_free(
+		 &inode,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the mount_inode_table_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_tools_mount_inode_table_initialize(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	mount_inode_table_t *inode_table = NULL;
+	int result                       = 0;
+
+	/* Test regular cases
+	 */
+	result = mount_inode_table_initialize(
+	          &inode_table,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "inode_table",
+	 inode_table );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "inode_table->number_of_buckets",
+	 inode_table->number_of_buckets,
+	 (uint32_t) MOUNT_INODE_TABLE_INITIAL_NUMBER_OF_BUCKETS );
+
+	result = mount_inode_table_free(
+	          &inode_table,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "inode_table",
+	 inode_table );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = mount_inode_table_initialize(
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	inode_table = (mount_inode_table_t *) 0x12345678UL;
+
+	result = mount_inode_table_initialize(
+	          &inode_table,
+	          &error );
+
+	inode_table = NULL;
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mount_inode_table_free(
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( inode_table != NULL )
+	{
+		mount_inode_table_free(
+		 &inode_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the mount_inode_table_insert_inode and mount_inode_table_get_inode_by_path functions
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_tools_mount_inode_table_insert_inode(
+     void )
+{
+	system_character_t path[ 32 ];
+
+	libcerror_error_t *error         = NULL;
+	mount_inode_t *inode             = NULL;
+	mount_inode_t *root_inode        = NULL;
+	mount_inode_t **sub_inodes       = NULL;
+	mount_inode_table_t *inode_table = NULL;
+	int inode_index                  = 0;
+	int number_of_inodes             = 4 * MOUNT_INODE_TABLE_INITIAL_NUMBER_OF_BUCKETS;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = mount_inode_table_initialize(
+	          &inode_table,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "inode_table",
+	 inode_table );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = mount_inode_initialize(
+	          &root_inode,
+	          _SYSTEM_STRING( "/" ),
+	          1,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mount_inode_table_insert_inode(
+	          inode_table,
+	          root_inode,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_UINT64(
+	 "root_inode->inode_number",
+	 root_inode->inode_number,
+	 (uint64_t) 1 );
+
+	/* Insert enough inodes to resize the buckets
+	 */
+	sub_inodes = (mount_inode_t **) memory_allocate(
+	                                 sizeof( mount_inode_t * ) * number_of_inodes );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "sub_inodes",
+	 sub_inodes );
+
+	for( inode_index = 0;
+	     inode_index < number_of_inodes;
+	     inode_index++ )
+	{
+		result = system_string_sprintf(
+		          path,
+		          32,
+		          _SYSTEM_STRING( "/key%d" ),
+		          inode_index );
+
+		REGF_TEST_ASSERT_GREATER_THAN_INT(
+		 "result",
+		 result,
+		 0 );
+
+		result = mount_inode_initialize(
+		          &inode,
+		          path,
+		          system_string_length(
+		           path ),
+		          &error );
+
+		REGF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		REGF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = mount_inode_table_insert_inode(
+		          inode_table,
+		          inode,
+		          root_inode,
+		          &error );
+
+		REGF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		REGF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		sub_inodes[ inode_index ] = inode;
+
+		inode = NULL;
+	}
+	REGF_TEST_ASSERT_EQUAL_UINT64(
+	 "inode_table->number_of_inodes",
+	 inode_table->number_of_inodes,
+	 (uint64_t) number_of_inodes + 1 );
+
+	REGF_TEST_ASSERT_GREATER_THAN_INT(
+	 "inode_table->number_of_buckets",
+	 (int) inode_table->number_of_buckets,
+	 MOUNT_INODE_TABLE_INITIAL_NUMBER_OF_BUCKETS );
+
+	result = mount_inode_set_sub_inodes(
+	          root_inode,
+	          sub_inodes,
+	          number_of_inodes,
+	          &error );
+
+	sub_inodes = NULL;
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = mount_inode_table_get_inode_by_path(
+	          inode_table,
+	          _SYSTEM_STRING( "/key1234" ),
+	          8,
+	          &inode,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "inode",
+	 inode );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_UINT64(
+	 "inode->inode_number",
+	 inode->inode_number,
+	 (uint64_t) 1236 );
+
+	REGF_TEST_ASSERT_EQUAL_INTPTR(
+	 "inode->parent_inode",
+	 (intptr_t) inode->parent_inode,
+	 (intptr_t) root_inode );
+
+	REGF_TEST_ASSERT_EQUAL_INTPTR(
+	 "root_inode->sub_inodes[ 1234 ]",
+	 (intptr_t) root_inode->sub_inodes[ 1234 ],
+	 (intptr_t) inode );
+
+	inode = NULL;
+
+	result = mount_inode_table_get_inode_by_path(
+	          inode_table,
+	          _SYSTEM_STRING( "/key99999" ),
+	          9,
+	          &inode,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "inode",
+	 inode );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = mount_inode_table_get_inode_by_path(
+	          NULL,
+	          _SYSTEM_STRING( "/" ),
+	          1,
+	          &inode,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mount_inode_table_get_inode_by_path(
+	          inode_table,
+	          NULL,
+	          1,
+	          &inode,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mount_inode_table_get_inode_by_path(
+	          inode_table,
+	          _SYSTEM_STRING( "/" ),
+	          1,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mount_inode_table_insert_inode(
+	          NULL,
+	          root_inode,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = mount_inode_table_insert_inode(
+	          inode_table,
+	          NULL,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the inode was already inserted
+	 */
+	result = mount_inode_table_insert_inode(
+	          inode_table,
+	          root_inode,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the sub inodes were already set
+	 */
+	result = mount_inode_set_sub_inodes(
+	          root_inode,
+	          NULL,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = mount_inode_table_free(
+	          &inode_table,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "inode_table",
+	 inode_table );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( sub_inodes != NULL )
+	{
+		memory_free(
+		 sub_inodes );
+	}
+	if( inode_table != NULL )
+	{
+		mount_inode_table_free(
+		 &inode_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc REGF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] REGF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc REGF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] REGF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	REGF_TEST_UNREFERENCED_PARAMETER( argc )
+	REGF_TEST_UNREFERENCED_PARAMETER( argv )
+
+	REGF_TEST_RUN(
+	 "mount_inode_initialize",
+	 regf_test_tools_mount_inode_initialize )
+
+	REGF_TEST_RUN(
+	 "mount_inode_table_initialize",
+	 regf_test_tools_mount_inode_table_initialize )
+
+	REGF_TEST_RUN(
+	 "mount_inode_table_insert_inode",
+	 regf_test_tools_mount_inode_table_insert_inode )
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #include <stdio.h>
@@ -72,6 +73,1970 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the regftools_output_buffer_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_tools_output_buffer_initialize(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	regftools_output_buffer_t *output_buffer = NULL;
+	int result                               = 0;
+
+	/* Test regular cases
+	 */
+	result = regftools_output_buffer_initialize(
+	          &output_buffer,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = regftools_output_buffer_free(
+	          &output_buffer,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = regftools_output_buffer_initialize(
+	          NULL,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	output_buffer = (regftools_output_buffer_t *) 0x12345678UL;
+
+	result = regftools_output_buffer_initialize(
+	          &output_buffer,
+	          NULL,
+	          &error );
+
+	output_buffer = NULL;
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( output_buffer != NULL )
+	{
+		regftools_output_buffer_free(
+		 &output_buffer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the regftools_output_buffer_free function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_tools_output_buffer_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = regftools_output_buffer_free(
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the regftools_output_buffer_resize function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_tools_output_buffer_resize(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	regftools_output_buffer_t *output_buffer = NULL;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = regftools_output_buffer_initialize(
+	          &output_buffer,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = regftools_output_buffer_resize(
+	          output_buffer,
+	          100,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "output_buffer->data",
+	 output_buffer->data );
+
+	REGF_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer->allocated_data_size",
+	 output_buffer->allocated_data_size,
+	 (size_t) 4096 );
+
+	REGF_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer->data_size",
+	 output_buffer->data_size,
+	 (size_t) 0 );
+
+	result = regftools_output_buffer_append_data(
+	          output_buffer,
+	          (uint8_t *) "ABC",
+	          3,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the buffer grows exponentially and retains its data
+	 */
+	result = regftools_output_buffer_resize(
+	          output_buffer,
+	          20000,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer->allocated_data_size",
+	 output_buffer->allocated_data_size,
+	 (size_t) 32768 );
+
+	REGF_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer->data_size",
+	 output_buffer->data_size,
+	 (size_t) 3 );
+
+	result = memory_compare(
+	          output_buffer->data,
+	          "ABC",
+	          3 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test if the buffer does not shrink
+	 */
+	result = regftools_output_buffer_resize(
+	          output_buffer,
+	          10,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer->allocated_data_size",
+	 output_buffer->allocated_data_size,
+	 (size_t) 32768 );
+
+	/* Test error cases
+	 */
+	result = regftools_output_buffer_resize(
+	          NULL,
+	          100,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = regftools_output_buffer_resize(
+	          output_buffer,
+	          (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE + 1,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = regftools_output_buffer_free(
+	          &output_buffer,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( output_buffer != NULL )
+	{
+		regftools_output_buffer_free(
+		 &output_buffer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the regftools_output_buffer_append_data function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_tools_output_buffer_append_data(
+     void )
+{
+	uint8_t data[ 5000 ];
+
+	libcerror_error_t *error                 = NULL;
+	regftools_output_buffer_t *output_buffer = NULL;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = regftools_output_buffer_initialize(
+	          &output_buffer,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_set(
+	 data,
+	 'A',
+	 5000 );
+
+	/* Test regular cases
+	 */
+	result = regftools_output_buffer_append_data(
+	          output_buffer,
+	          data,
+	          5000,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer->data_size",
+	 output_buffer->data_size,
+	 (size_t) 5000 );
+
+	result = regftools_output_buffer_append_data(
+	          output_buffer,
+	          data,
+	          5000,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer->data_size",
+	 output_buffer->data_size,
+	 (size_t) 10000 );
+
+	/* Test error cases
+	 */
+	result = regftools_output_buffer_append_data(
+	          NULL,
+	          data,
+	          5000,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = regftools_output_buffer_append_data(
+	          output_buffer,
+	          NULL,
+	          5000,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = regftools_output_buffer_free(
+	          &output_buffer,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( output_buffer != NULL )
+	{
+		regftools_output_buffer_free(
+		 &output_buffer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the regftools_output_buffer_append_hexadecimal function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_tools_output_buffer_append_hexadecimal(
+     void )
+{
+	uint8_t data[ 4 ] = {
+		0x00, 0x1f, 0xa0, 0xff };
+
+	libcerror_error_t *error                 = NULL;
+	regftools_output_buffer_t *output_buffer = NULL;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = regftools_output_buffer_initialize(
+	          &output_buffer,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = regftools_output_buffer_append_hexadecimal(
+	          output_buffer,
+	          data,
+	          4,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer->data_size",
+	 output_buffer->data_size,
+	 (size_t) 8 );
+
+	result = memory_compare(
+	          output_buffer->data,
+	          "001fa0ff",
+	          8 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = regftools_output_buffer_append_hexadecimal(
+	          NULL,
+	          data,
+	          4,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = regftools_output_buffer_append_hexadecimal(
+	          output_buffer,
+	          NULL,
+	          4,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = regftools_output_buffer_free(
+	          &output_buffer,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( output_buffer != NULL )
+	{
+		regftools_output_buffer_free(
+		 &output_buffer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the regftools_output_buffer_append_string function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_tools_output_buffer_append_string(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	regftools_output_buffer_t *output_buffer = NULL;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = regftools_output_buffer_initialize(
+	          &output_buffer,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = regftools_output_buffer_append_string(
+	          output_buffer,
+	          "0|",
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer->data_size",
+	 output_buffer->data_size,
+	 (size_t) 2 );
+
+	result = memory_compare(
+	          output_buffer->data,
+	          "0|",
+	          2 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	output_buffer->data_size = 0;
+
+	result = regftools_output_buffer_append_string(
+	          output_buffer,
+	          "",
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer->data_size",
+	 output_buffer->data_size,
+	 (size_t) 0 );
+
+	result = memory_compare(
+	          output_buffer->data,
+	          "",
+	          0 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	output_buffer->data_size = 0;
+
+	/* Test error cases
+	 */
+	result = regftools_output_buffer_append_string(
+	          NULL,
+	          "0|",
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = regftools_output_buffer_append_string(
+	          output_buffer,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = regftools_output_buffer_free(
+	          &output_buffer,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( output_buffer != NULL )
+	{
+		regftools_output_buffer_free(
+		 &output_buffer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the regftools_output_buffer_append_unsigned_decimal function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_tools_output_buffer_append_unsigned_decimal(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	regftools_output_buffer_t *output_buffer = NULL;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = regftools_output_buffer_initialize(
+	          &output_buffer,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = regftools_output_buffer_append_unsigned_decimal(
+	          output_buffer,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer->data_size",
+	 output_buffer->data_size,
+	 (size_t) 1 );
+
+	result = memory_compare(
+	          output_buffer->data,
+	          "0",
+	          1 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	output_buffer->data_size = 0;
+
+	result = regftools_output_buffer_append_unsigned_decimal(
+	          output_buffer,
+	          1234567890,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer->data_size",
+	 output_buffer->data_size,
+	 (size_t) 10 );
+
+	result = memory_compare(
+	          output_buffer->data,
+	          "1234567890",
+	          10 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	output_buffer->data_size = 0;
+
+	result = regftools_output_buffer_append_unsigned_decimal(
+	          output_buffer,
+	          0xffffffffffffffffUL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer->data_size",
+	 output_buffer->data_size,
+	 (size_t) 20 );
+
+	result = memory_compare(
+	          output_buffer->data,
+	          "18446744073709551615",
+	          20 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	output_buffer->data_size = 0;
+
+	/* Test error cases
+	 */
+	result = regftools_output_buffer_append_unsigned_decimal(
+	          NULL,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = regftools_output_buffer_free(
+	          &output_buffer,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( output_buffer != NULL )
+	{
+		regftools_output_buffer_free(
+		 &output_buffer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the regftools_output_buffer_append_signed_decimal function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_tools_output_buffer_append_signed_decimal(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	regftools_output_buffer_t *output_buffer = NULL;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = regftools_output_buffer_initialize(
+	          &output_buffer,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = regftools_output_buffer_append_signed_decimal(
+	          output_buffer,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer->data_size",
+	 output_buffer->data_size,
+	 (size_t) 1 );
+
+	result = memory_compare(
+	          output_buffer->data,
+	          "0",
+	          1 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	output_buffer->data_size = 0;
+
+	result = regftools_output_buffer_append_signed_decimal(
+	          output_buffer,
+	          -1234567890,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer->data_size",
+	 output_buffer->data_size,
+	 (size_t) 11 );
+
+	result = memory_compare(
+	          output_buffer->data,
+	          "-1234567890",
+	          11 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	output_buffer->data_size = 0;
+
+	result = regftools_output_buffer_append_signed_decimal(
+	          output_buffer,
+	          (int64_t) 0x7fffffffffffffffL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer->data_size",
+	 output_buffer->data_size,
+	 (size_t) 19 );
+
+	result = memory_compare(
+	          output_buffer->data,
+	          "9223372036854775807",
+	          19 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	output_buffer->data_size = 0;
+
+	result = regftools_output_buffer_append_signed_decimal(
+	          output_buffer,
+	          (int64_t) -0x7fffffffffffffffL - 1,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer->data_size",
+	 output_buffer->data_size,
+	 (size_t) 20 );
+
+	result = memory_compare(
+	          output_buffer->data,
+	          "-9223372036854775808",
+	          20 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	output_buffer->data_size = 0;
+
+	/* Test error cases
+	 */
+	result = regftools_output_buffer_append_signed_decimal(
+	          NULL,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = regftools_output_buffer_free(
+	          &output_buffer,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( output_buffer != NULL )
+	{
+		regftools_output_buffer_free(
+		 &output_buffer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the regftools_output_buffer_append_hexadecimal_integer function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_tools_output_buffer_append_hexadecimal_integer(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	regftools_output_buffer_t *output_buffer = NULL;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = regftools_output_buffer_initialize(
+	          &output_buffer,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = regftools_output_buffer_append_hexadecimal_integer(
+	          output_buffer,
+	          0,
+	          8,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer->data_size",
+	 output_buffer->data_size,
+	 (size_t) 8 );
+
+	result = memory_compare(
+	          output_buffer->data,
+	          "00000000",
+	          8 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	output_buffer->data_size = 0;
+
+	result = regftools_output_buffer_append_hexadecimal_integer(
+	          output_buffer,
+	          0x1f,
+	          2,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer->data_size",
+	 output_buffer->data_size,
+	 (size_t) 2 );
+
+	result = memory_compare(
+	          output_buffer->data,
+	          "1f",
+	          2 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	output_buffer->data_size = 0;
+
+	result = regftools_output_buffer_append_hexadecimal_integer(
+	          output_buffer,
+	          0x123456789aUL,
+	          8,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer->data_size",
+	 output_buffer->data_size,
+	 (size_t) 10 );
+
+	result = memory_compare(
+	          output_buffer->data,
+	          "123456789a",
+	          10 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	output_buffer->data_size = 0;
+
+	result = regftools_output_buffer_append_hexadecimal_integer(
+	          output_buffer,
+	          0xffffffffffffffffUL,
+	          1,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer->data_size",
+	 output_buffer->data_size,
+	 (size_t) 16 );
+
+	result = memory_compare(
+	          output_buffer->data,
+	          "ffffffffffffffff",
+	          16 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	output_buffer->data_size = 0;
+
+	/* Test error cases
+	 */
+	result = regftools_output_buffer_append_hexadecimal_integer(
+	          NULL,
+	          0,
+	          8,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = regftools_output_buffer_append_hexadecimal_integer(
+	          output_buffer,
+	          0,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = regftools_output_buffer_append_hexadecimal_integer(
+	          output_buffer,
+	          0,
+	          17,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = regftools_output_buffer_free(
+	          &output_buffer,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( output_buffer != NULL )
+	{
+		regftools_output_buffer_free(
+		 &output_buffer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the regftools_output_buffer_append_filetime_as_posix_time function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_tools_output_buffer_append_filetime_as_posix_time(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	regftools_output_buffer_t *output_buffer = NULL;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = regftools_output_buffer_initialize(
+	          &output_buffer,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = regftools_output_buffer_append_filetime_as_posix_time(
+	          output_buffer,
+	          116444736000000000UL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer->data_size",
+	 output_buffer->data_size,
+	 (size_t) 11 );
+
+	result = memory_compare(
+	          output_buffer->data,
+	          "0.000000000",
+	          11 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	output_buffer->data_size = 0;
+
+	result = regftools_output_buffer_append_filetime_as_posix_time(
+	          output_buffer,
+	          0x01d5b9a7c6a4e3b1UL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer->data_size",
+	 output_buffer->data_size,
+	 (size_t) 20 );
+
+	result = memory_compare(
+	          output_buffer->data,
+	          "1577115832.066961700",
+	          20 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	output_buffer->data_size = 0;
+
+	result = regftools_output_buffer_append_filetime_as_posix_time(
+	          output_buffer,
+	          116444735999999995UL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer->data_size",
+	 output_buffer->data_size,
+	 (size_t) 12 );
+
+	result = memory_compare(
+	          output_buffer->data,
+	          "-0.000000500",
+	          12 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	output_buffer->data_size = 0;
+
+	result = regftools_output_buffer_append_filetime_as_posix_time(
+	          output_buffer,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer->data_size",
+	 output_buffer->data_size,
+	 (size_t) 22 );
+
+	result = memory_compare(
+	          output_buffer->data,
+	          "-11644473600.000000000",
+	          22 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	output_buffer->data_size = 0;
+
+	/* Test error cases
+	 */
+	result = regftools_output_buffer_append_filetime_as_posix_time(
+	          NULL,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = regftools_output_buffer_free(
+	          &output_buffer,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( output_buffer != NULL )
+	{
+		regftools_output_buffer_free(
+		 &output_buffer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the regftools_output_buffer_printf function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_tools_output_buffer_printf(
+     void )
+{
+	char long_string[ 1024 ];
+
+	libcerror_error_t *error                 = NULL;
+	regftools_output_buffer_t *output_buffer = NULL;
+	int print_count                          = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = regftools_output_buffer_initialize(
+	          &output_buffer,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_set(
+	 long_string,
+	 'B',
+	 1023 );
+
+	long_string[ 1023 ] = 0;
+
+	/* Test regular cases
+	 */
+	print_count = regftools_output_buffer_printf(
+	               output_buffer,
+	               "Key path: %s %d\n",
+	               "Software",
+	               1 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "print_count",
+	 print_count,
+	 21 );
+
+	REGF_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer->data_size",
+	 output_buffer->data_size,
+	 (size_t) 21 );
+
+	result = memory_compare(
+	          output_buffer->data,
+	          "Key path: Software 1\n",
+	          21 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a formatted string that exceeds the initial buffer size
+	 */
+	print_count = regftools_output_buffer_printf(
+	               output_buffer,
+	               "%s%s%s%s%s",
+	               long_string,
+	               long_string,
+	               long_string,
+	               long_string,
+	               long_string );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "print_count",
+	 print_count,
+	 5115 );
+
+	REGF_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer->data_size",
+	 output_buffer->data_size,
+	 (size_t) 5136 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT8(
+	 "output_buffer->data[ 5135 ]",
+	 output_buffer->data[ 5135 ],
+	 (uint8_t) 'B' );
+
+	/* Test error cases
+	 */
+	print_count = regftools_output_buffer_printf(
+	               NULL,
+	               "%d",
+	               1 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "print_count",
+	 print_count,
+	 -1 );
+
+	print_count = regftools_output_buffer_printf(
+	               output_buffer,
+	               NULL );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "print_count",
+	 print_count,
+	 -1 );
+
+	/* Clean up
+	 */
+	result = regftools_output_buffer_free(
+	          &output_buffer,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( output_buffer != NULL )
+	{
+		regftools_output_buffer_free(
+		 &output_buffer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the regftools_output_buffer_flush function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_tools_output_buffer_flush(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	regftools_output_buffer_t *output_buffer = NULL;
+	FILE *stream                             = NULL;
+	int print_count                          = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	stream = tmpfile();
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	result = regftools_output_buffer_initialize(
+	          &output_buffer,
+	          stream,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	print_count = regftools_output_buffer_printf(
+	               output_buffer,
+	               "Value: %s\n",
+	               "test" );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "print_count",
+	 print_count,
+	 12 );
+
+	/* Test regular cases
+	 */
+	result = regftools_output_buffer_flush(
+	          output_buffer,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer->data_size",
+	 output_buffer->data_size,
+	 (size_t) 0 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "ftell( stream )",
+	 (int) ftell( stream ),
+	 12 );
+
+	/* Test error cases
+	 */
+	result = regftools_output_buffer_flush(
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	output_buffer->stream = NULL;
+
+	result = regftools_output_buffer_flush(
+	          output_buffer,
+	          &error );
+
+	output_buffer->stream = stream;
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = regftools_output_buffer_free(
+	          &output_buffer,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	fclose(
+	 stream );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( output_buffer != NULL )
+	{
+		regftools_output_buffer_free(
+		 &output_buffer,
+		 NULL );
+	}
+	if( stream != NULL )
+	{
+		fclose(
+		 stream );
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -91,6 +2056,54 @@ int main(
 	 "regftools_output_initialize",
 	 regf_test_tools_output_initialize )
 
+	REGF_TEST_RUN(
+	 "regftools_output_buffer_initialize",
+	 regf_test_tools_output_buffer_initialize )
+
+	REGF_TEST_RUN(
+	 "regftools_output_buffer_free",
+	 regf_test_tools_output_buffer_free )
+
+	REGF_TEST_RUN(
+	 "regftools_output_buffer_resize",
+	 regf_test_tools_output_buffer_resize )
+
+	REGF_TEST_RUN(
+	 "regftools_output_buffer_append_data",
+	 regf_test_tools_output_buffer_append_data )
+
+	REGF_TEST_RUN(
+	 "regftools_output_buffer_append_hexadecimal",
+	 regf_test_tools_output_buffer_append_hexadecimal )
+
+	REGF_TEST_RUN(
+	 "regftools_output_buffer_append_string",
+	 regf_test_tools_output_buffer_append_string )
+
+	REGF_TEST_RUN(
+	 "regftools_output_buffer_append_unsigned_decimal",
+	 regf_test_tools_output_buffer_append_unsigned_decimal )
+
+	REGF_TEST_RUN(
+	 "regftools_output_buffer_append_signed_decimal",
+	 regf_test_tools_output_buffer_append_signed_decimal )
+
+	REGF_TEST_RUN(
+	 "regftools_output_buffer_append_hexadecimal_integer",
+	 regf_test_tools_output_buffer_append_hexadecimal_integer )
+
+	REGF_TEST_RUN(
+	 "regftools_output_buffer_append_filetime_as_posix_time",
+	 regf_test_tools_output_buffer_append_filetime_as_posix_time )
+
+	REGF_TEST_RUN(
+	 "regftools_output_buffer_printf",
+	 regf_test_tools_output_buffer_printf )
+
+	REGF_TEST_RUN(
+	 "regftools_output_buffer_flush",
+	 regf_test_tools_output_buffer_flush )
+
 	/* TODO add tests for regftools_output_copyright_fprint */
 
 	/* TODO add tests for regftools_output_version_fprint */
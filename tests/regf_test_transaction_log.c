@@ -0,0 +1,1166 @@
+/*
+ * Library transaction_log type test program
+ *
+ * Copyright (C) 2009-2025, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "regf_test_functions.h"
+#include "regf_test_libbfio.h"
+#include "regf_test_libcerror.h"
+#include "regf_test_libregf.h"
+#include "regf_test_macros.h"
+#include "regf_test_memory.h"
+#include "regf_test_unused.h"
+
+#include "../libregf/libregf_dirty_pages.h"
+#include "../libregf/libregf_transaction_log.h"
+
+uint8_t regf_test_transaction_log_file_header_data1[ 512 ] = {
+	0x72, 0x65, 0x67, 0x66, 0x05, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x56, 0x1b, 0x0b, 0x4c,
+	0xa5, 0x98, 0xd6, 0x01, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x8c, 0xd7, 0xbd, 0x34, 0x97, 0x04, 0xeb, 0x11, 0xa1, 0x80, 0x52, 0x54, 0x00, 0xee, 0xb6, 0x05,
+	0x8c, 0xd7, 0xbd, 0x34, 0x97, 0x04, 0xeb, 0x11, 0xa1, 0x80, 0x52, 0x54, 0x00, 0xee, 0xb6, 0x05,
+	0x00, 0x00, 0x00, 0x00, 0x8d, 0xd7, 0xbd, 0x34, 0x97, 0x04, 0xeb, 0x11, 0xa1, 0x80, 0x52, 0x54,
+	0x00, 0xee, 0xb6, 0x05, 0x72, 0x6d, 0x74, 0x6d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x26, 0x7c, 0x32 };
+
+uint8_t regf_test_transaction_log_entry_data1[ 1024 ] = {
+	0x48, 0x76, 0x4c, 0x45, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x00, 0x10, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x99, 0xea, 0xed, 0x0e, 0xe1, 0xcd, 0x92, 0x1c,
+	0xab, 0x52, 0x79, 0xa1, 0x40, 0x64, 0xec, 0x1e, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+	0x05, 0x12, 0x1f, 0x2c, 0x39, 0x46, 0x53, 0x60, 0x6d, 0x7a, 0x87, 0x94, 0xa1, 0xae, 0xbb, 0xc8,
+	0xd5, 0xe2, 0xef, 0xfc, 0x09, 0x16, 0x23, 0x30, 0x3d, 0x4a, 0x57, 0x64, 0x71, 0x7e, 0x8b, 0x98,
+	0xa5, 0xb2, 0xbf, 0xcc, 0xd9, 0xe6, 0xf3, 0x00, 0x0d, 0x1a, 0x27, 0x34, 0x41, 0x4e, 0x5b, 0x68,
+	0x75, 0x82, 0x8f, 0x9c, 0xa9, 0xb6, 0xc3, 0xd0, 0xdd, 0xea, 0xf7, 0x04, 0x11, 0x1e, 0x2b, 0x38,
+	0x45, 0x52, 0x5f, 0x6c, 0x79, 0x86, 0x93, 0xa0, 0xad, 0xba, 0xc7, 0xd4, 0xe1, 0xee, 0xfb, 0x08,
+	0x15, 0x22, 0x2f, 0x3c, 0x49, 0x56, 0x63, 0x70, 0x7d, 0x8a, 0x97, 0xa4, 0xb1, 0xbe, 0xcb, 0xd8,
+	0xe5, 0xf2, 0xff, 0x0c, 0x19, 0x26, 0x33, 0x40, 0x4d, 0x5a, 0x67, 0x74, 0x81, 0x8e, 0x9b, 0xa8,
+	0xb5, 0xc2, 0xcf, 0xdc, 0xe9, 0xf6, 0x03, 0x10, 0x1d, 0x2a, 0x37, 0x44, 0x51, 0x5e, 0x6b, 0x78,
+	0x85, 0x92, 0x9f, 0xac, 0xb9, 0xc6, 0xd3, 0xe0, 0xed, 0xfa, 0x07, 0x14, 0x21, 0x2e, 0x3b, 0x48,
+	0x55, 0x62, 0x6f, 0x7c, 0x89, 0x96, 0xa3, 0xb0, 0xbd, 0xca, 0xd7, 0xe4, 0xf1, 0xfe, 0x0b, 0x18,
+	0x25, 0x32, 0x3f, 0x4c, 0x59, 0x66, 0x73, 0x80, 0x8d, 0x9a, 0xa7, 0xb4, 0xc1, 0xce, 0xdb, 0xe8,
+	0xf5, 0x02, 0x0f, 0x1c, 0x29, 0x36, 0x43, 0x50, 0x5d, 0x6a, 0x77, 0x84, 0x91, 0x9e, 0xab, 0xb8,
+	0xc5, 0xd2, 0xdf, 0xec, 0xf9, 0x06, 0x13, 0x20, 0x2d, 0x3a, 0x47, 0x54, 0x61, 0x6e, 0x7b, 0x88,
+	0x95, 0xa2, 0xaf, 0xbc, 0xc9, 0xd6, 0xe3, 0xf0, 0xfd, 0x0a, 0x17, 0x24, 0x31, 0x3e, 0x4b, 0x58,
+	0x65, 0x72, 0x7f, 0x8c, 0x99, 0xa6, 0xb3, 0xc0, 0xcd, 0xda, 0xe7, 0xf4, 0x01, 0x0e, 0x1b, 0x28,
+	0x35, 0x42, 0x4f, 0x5c, 0x69, 0x76, 0x83, 0x90, 0x9d, 0xaa, 0xb7, 0xc4, 0xd1, 0xde, 0xeb, 0xf8,
+	0x05, 0x12, 0x1f, 0x2c, 0x39, 0x46, 0x53, 0x60, 0x6d, 0x7a, 0x87, 0x94, 0xa1, 0xae, 0xbb, 0xc8,
+	0xd5, 0xe2, 0xef, 0xfc, 0x09, 0x16, 0x23, 0x30, 0x3d, 0x4a, 0x57, 0x64, 0x71, 0x7e, 0x8b, 0x98,
+	0xa5, 0xb2, 0xbf, 0xcc, 0xd9, 0xe6, 0xf3, 0x00, 0x0d, 0x1a, 0x27, 0x34, 0x41, 0x4e, 0x5b, 0x68,
+	0x75, 0x82, 0x8f, 0x9c, 0xa9, 0xb6, 0xc3, 0xd0, 0xdd, 0xea, 0xf7, 0x04, 0x11, 0x1e, 0x2b, 0x38,
+	0x45, 0x52, 0x5f, 0x6c, 0x79, 0x86, 0x93, 0xa0, 0xad, 0xba, 0xc7, 0xd4, 0xe1, 0xee, 0xfb, 0x08,
+	0x15, 0x22, 0x2f, 0x3c, 0x49, 0x56, 0x63, 0x70, 0x7d, 0x8a, 0x97, 0xa4, 0xb1, 0xbe, 0xcb, 0xd8,
+	0xe5, 0xf2, 0xff, 0x0c, 0x19, 0x26, 0x33, 0x40, 0x4d, 0x5a, 0x67, 0x74, 0x81, 0x8e, 0x9b, 0xa8,
+	0xb5, 0xc2, 0xcf, 0xdc, 0xe9, 0xf6, 0x03, 0x10, 0x1d, 0x2a, 0x37, 0x44, 0x51, 0x5e, 0x6b, 0x78,
+	0x85, 0x92, 0x9f, 0xac, 0xb9, 0xc6, 0xd3, 0xe0, 0xed, 0xfa, 0x07, 0x14, 0x21, 0x2e, 0x3b, 0x48,
+	0x55, 0x62, 0x6f, 0x7c, 0x89, 0x96, 0xa3, 0xb0, 0xbd, 0xca, 0xd7, 0xe4, 0xf1, 0xfe, 0x0b, 0x18,
+	0x25, 0x32, 0x3f, 0x4c, 0x59, 0x66, 0x73, 0x80, 0x8d, 0x9a, 0xa7, 0xb4, 0xc1, 0xce, 0xdb, 0xe8,
+	0xf5, 0x02, 0x0f, 0x1c, 0x29, 0x36, 0x43, 0x50, 0x5d, 0x6a, 0x77, 0x84, 0x91, 0x9e, 0xab, 0xb8,
+	0xc5, 0xd2, 0xdf, 0xec, 0xf9, 0x06, 0x13, 0x20, 0x2d, 0x3a, 0x47, 0x54, 0x61, 0x6e, 0x7b, 0x88,
+	0x95, 0xa2, 0xaf, 0xbc, 0xc9, 0xd6, 0xe3, 0xf0, 0xfd, 0x0a, 0x17, 0x24, 0x31, 0x3e, 0x4b, 0x58,
+	0x65, 0x72, 0x7f, 0x8c, 0x99, 0xa6, 0xb3, 0xc0, 0xcd, 0xda, 0xe7, 0xf4, 0x01, 0x0e, 0x1b, 0x28,
+	0x35, 0x42, 0x4f, 0x5c, 0x69, 0x76, 0x83, 0x90, 0x9d, 0xaa, 0xb7, 0xc4, 0xd1, 0xde, 0xeb, 0xf8,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT )
+
+/* Tests the libregf_transaction_log_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_transaction_log_initialize(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libregf_transaction_log_t *transaction_log = NULL;
+	int result                                 = 0;
+
+#if defined( HAVE_REGF_TEST_MEMORY )
+	int number_of_malloc_fail_tests            = 1;
+	int number_of_memset_fail_tests            = 1;
+	int test_number                            = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libregf_transaction_log_initialize(
+	          &transaction_log,
+	          5,
+	          4096,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "transaction_log",
+	 transaction_log );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_transaction_log_free(
+	          &transaction_log,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "transaction_log",
+	 transaction_log );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_transaction_log_initialize(
+	          NULL,
+	          5,
+	          4096,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	transaction_log = (libregf_transaction_log_t *) 0x12345678UL;
+
+	result = libregf_transaction_log_initialize(
+	          &transaction_log,
+	          5,
+	          4096,
+	          &error );
+
+	transaction_log = NULL;
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_REGF_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libregf_transaction_log_initialize with malloc failing
+		 */
+		regf_test_malloc_attempts_before_fail = test_number;
+
+		result = libregf_transaction_log_initialize(
+		          &transaction_log,
+		          5,
+		          4096,
+		          &error );
+
+		if( regf_test_malloc_attempts_before_fail != -1 )
+		{
+			regf_test_malloc_attempts_before_fail = -1;
+
+			if( transaction_log != NULL )
+			{
+				libregf_transaction_log_free(
+				 &transaction_log,
+				 NULL );
+			}
+		}
+		else
+		{
+			REGF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			REGF_TEST_ASSERT_IS_NULL(
+			 "transaction_log",
+			 transaction_log );
+
+			REGF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libregf_transaction_log_initialize with memset failing
+		 */
+		regf_test_memset_attempts_before_fail = test_number;
+
+		result = libregf_transaction_log_initialize(
+		          &transaction_log,
+		          5,
+		          4096,
+		          &error );
+
+		if( regf_test_memset_attempts_before_fail != -1 )
+		{
+			regf_test_memset_attempts_before_fail = -1;
+
+			if( transaction_log != NULL )
+			{
+				libregf_transaction_log_free(
+				 &transaction_log,
+				 NULL );
+			}
+		}
+		else
+		{
+			REGF_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			REGF_TEST_ASSERT_IS_NULL(
+			 "transaction_log",
+			 transaction_log );
+
+			REGF_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_REGF_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( transaction_log != NULL )
+	{
+		libregf_transaction_log_free(
+		 &transaction_log,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_transaction_log_free function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_transaction_log_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libregf_transaction_log_free(
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_transaction_log_read_entry_data function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_transaction_log_read_entry_data(
+     void )
+{
+	libcerror_error_t *error                   = NULL;
+	libregf_dirty_pages_t *dirty_pages         = NULL;
+	libregf_transaction_log_t *transaction_log = NULL;
+	int result                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libregf_dirty_pages_initialize(
+	          &dirty_pages,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "dirty_pages",
+	 dirty_pages );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_transaction_log_initialize(
+	          &transaction_log,
+	          5,
+	          2048,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "transaction_log",
+	 transaction_log );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libregf_transaction_log_read_entry_data(
+	          transaction_log,
+	          dirty_pages,
+	          regf_test_transaction_log_entry_data1,
+	          1024,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "transaction_log->sequence_number",
+	 transaction_log->sequence_number,
+	 (uint32_t) 6 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "transaction_log->hive_bins_size",
+	 transaction_log->hive_bins_size,
+	 (uint32_t) 4096 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "transaction_log->number_of_applied_entries",
+	 transaction_log->number_of_applied_entries,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "dirty_pages->hive_bins_size",
+	 dirty_pages->hive_bins_size,
+	 (uint32_t) 4096 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "dirty_pages->number_of_dirty_pages",
+	 dirty_pages->number_of_dirty_pages,
+	 (uint32_t) 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "dirty_pages->pages[ 1 ]",
+	 dirty_pages->pages[ 1 ] );
+
+	result = memory_compare(
+	          dirty_pages->pages[ 1 ],
+	          &( regf_test_transaction_log_entry_data1[ 48 ] ),
+	          512 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that a log entry that was already applied is skipped
+	 */
+	result = libregf_transaction_log_read_entry_data(
+	          transaction_log,
+	          dirty_pages,
+	          regf_test_transaction_log_entry_data1,
+	          1024,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "transaction_log->sequence_number",
+	 transaction_log->sequence_number,
+	 (uint32_t) 6 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "transaction_log->number_of_applied_entries",
+	 transaction_log->number_of_applied_entries,
+	 1 );
+
+	/* Test that a log entry after a missing log entry is not applied
+	 */
+	transaction_log->sequence_number = 4;
+
+	result = libregf_transaction_log_read_entry_data(
+	          transaction_log,
+	          dirty_pages,
+	          regf_test_transaction_log_entry_data1,
+	          1024,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a log entry with a size that does not match is not applied
+	 */
+	transaction_log->sequence_number = 5;
+
+	result = libregf_transaction_log_read_entry_data(
+	          transaction_log,
+	          dirty_pages,
+	          regf_test_transaction_log_entry_data1,
+	          512,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a log entry with an invalid signature is not applied
+	 */
+	result = libregf_transaction_log_read_entry_data(
+	          transaction_log,
+	          dirty_pages,
+	          &( regf_test_transaction_log_entry_data1[ 512 ] ),
+	          512,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_transaction_log_read_entry_data(
+	          NULL,
+	          dirty_pages,
+	          regf_test_transaction_log_entry_data1,
+	          1024,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_transaction_log_read_entry_data(
+	          transaction_log,
+	          NULL,
+	          regf_test_transaction_log_entry_data1,
+	          1024,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_transaction_log_read_entry_data(
+	          transaction_log,
+	          dirty_pages,
+	          NULL,
+	          1024,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_transaction_log_read_entry_data(
+	          transaction_log,
+	          dirty_pages,
+	          regf_test_transaction_log_entry_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_transaction_log_read_entry_data(
+	          transaction_log,
+	          dirty_pages,
+	          regf_test_transaction_log_entry_data1,
+	          0,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libregf_transaction_log_free(
+	          &transaction_log,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "transaction_log",
+	 transaction_log );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_dirty_pages_free(
+	          &dirty_pages,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "dirty_pages",
+	 dirty_pages );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( transaction_log != NULL )
+	{
+		libregf_transaction_log_free(
+		 &transaction_log,
+		 NULL );
+	}
+	if( dirty_pages != NULL )
+	{
+		libregf_dirty_pages_free(
+		 &dirty_pages,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_transaction_log_read_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_transaction_log_read_file_io_handle(
+     void )
+{
+	uint8_t log_data[ 2560 ];
+
+	libbfio_handle_t *file_io_handle           = NULL;
+	libcerror_error_t *error                   = NULL;
+	libregf_dirty_pages_t *dirty_pages         = NULL;
+	libregf_transaction_log_t *transaction_log = NULL;
+	int result                                 = 0;
+
+	/* Initialize test
+	 * The log contains a file header, a log entry with sequence number 5
+	 * and a log entry with sequence number 6 that has a stale header hash
+	 */
+	memory_copy(
+	 log_data,
+	 regf_test_transaction_log_file_header_data1,
+	 512 );
+
+	memory_copy(
+	 &( log_data[ 512 ] ),
+	 regf_test_transaction_log_entry_data1,
+	 1024 );
+
+	memory_copy(
+	 &( log_data[ 1536 ] ),
+	 regf_test_transaction_log_entry_data1,
+	 1024 );
+
+	log_data[ 1536 + 12 ] = 6;
+
+	result = libregf_dirty_pages_initialize(
+	          &dirty_pages,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "dirty_pages",
+	 dirty_pages );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_transaction_log_initialize(
+	          &transaction_log,
+	          5,
+	          2048,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "transaction_log",
+	 transaction_log );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = regf_test_open_file_io_handle(
+	          &file_io_handle,
+	          log_data,
+	          2560,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libregf_transaction_log_read_file_io_handle(
+	          transaction_log,
+	          dirty_pages,
+	          file_io_handle,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "transaction_log->file_header",
+	 transaction_log->file_header );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "transaction_log->file_header->file_type",
+	 transaction_log->file_header->file_type,
+	 (uint32_t) 6 );
+
+	/* The log entry with the stale header hash is not applied
+	 */
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "transaction_log->number_of_applied_entries",
+	 transaction_log->number_of_applied_entries,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "transaction_log->sequence_number",
+	 transaction_log->sequence_number,
+	 (uint32_t) 6 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "dirty_pages->number_of_dirty_pages",
+	 dirty_pages->number_of_dirty_pages,
+	 (uint32_t) 1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "dirty_pages->pages[ 1 ]",
+	 dirty_pages->pages[ 1 ] );
+
+	result = memory_compare(
+	          dirty_pages->pages[ 1 ],
+	          &( regf_test_transaction_log_entry_data1[ 48 ] ),
+	          512 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libregf_transaction_log_read_file_io_handle(
+	          NULL,
+	          dirty_pages,
+	          file_io_handle,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_transaction_log_read_file_io_handle(
+	          transaction_log,
+	          dirty_pages,
+	          file_io_handle,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = regf_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_transaction_log_free(
+	          &transaction_log,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "transaction_log",
+	 transaction_log );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_dirty_pages_free(
+	          &dirty_pages,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "dirty_pages",
+	 dirty_pages );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 * The log contains a single log entry with a corrupted dirty page
+	 * that no longer matches the data hash
+	 */
+	log_data[ 512 + 48 ] ^= 0xff;
+
+	result = libregf_dirty_pages_initialize(
+	          &dirty_pages,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_transaction_log_initialize(
+	          &transaction_log,
+	          5,
+	          2048,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = regf_test_open_file_io_handle(
+	          &file_io_handle,
+	          log_data,
+	          1536,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that a log entry with a data hash mismatch is not applied
+	 */
+	result = libregf_transaction_log_read_file_io_handle(
+	          transaction_log,
+	          dirty_pages,
+	          file_io_handle,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "transaction_log->number_of_applied_entries",
+	 transaction_log->number_of_applied_entries,
+	 0 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "transaction_log->sequence_number",
+	 transaction_log->sequence_number,
+	 (uint32_t) 5 );
+
+	REGF_TEST_ASSERT_EQUAL_UINT32(
+	 "dirty_pages->number_of_dirty_pages",
+	 dirty_pages->number_of_dirty_pages,
+	 (uint32_t) 0 );
+
+	/* Clean up
+	 */
+	result = regf_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_transaction_log_free(
+	          &transaction_log,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_dirty_pages_free(
+	          &dirty_pages,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( transaction_log != NULL )
+	{
+		libregf_transaction_log_free(
+		 &transaction_log,
+		 NULL );
+	}
+	if( dirty_pages != NULL )
+	{
+		libregf_dirty_pages_free(
+		 &dirty_pages,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc REGF_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] REGF_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc REGF_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] REGF_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	REGF_TEST_UNREFERENCED_PARAMETER( argc )
+	REGF_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT )
+
+	REGF_TEST_RUN(
+	 "libregf_transaction_log_initialize",
+	 regf_test_transaction_log_initialize );
+
+	REGF_TEST_RUN(
+	 "libregf_transaction_log_free",
+	 regf_test_transaction_log_free );
+
+	REGF_TEST_RUN(
+	 "libregf_transaction_log_read_entry_data",
+	 regf_test_transaction_log_read_entry_data );
+
+	REGF_TEST_RUN(
+	 "libregf_transaction_log_read_file_io_handle",
+	 regf_test_transaction_log_read_file_io_handle );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT ) */
+}
+
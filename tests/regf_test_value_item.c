@@ -2594,6 +2594,567 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libregf_value_item_read_data_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_value_item_read_data_at_offset(
+     libregf_value_item_t *value_item,
+     libbfio_handle_t *file_io_handle )
+{
+	uint8_t buffer[ 16 ];
+
+	libcerror_error_t *error = NULL;
+	size_t data_size         = 0;
+	ssize_t read_count       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libregf_value_item_get_data_size(
+	          value_item,
+	          &data_size,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libregf_value_item_read_data_at_offset(
+	              value_item,
+	              file_io_handle,
+	              buffer,
+	              16,
+	              0,
+	              &error );
+
+	REGF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) ( ( data_size < 16 ) ? data_size : 16 ) );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libregf_value_item_read_data_at_offset(
+	              value_item,
+	              file_io_handle,
+	              buffer,
+	              16,
+	              (off64_t) data_size,
+	              &error );
+
+	REGF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libregf_value_item_read_data_at_offset(
+	              NULL,
+	              file_io_handle,
+	              buffer,
+	              16,
+	              0,
+	              &error );
+
+	REGF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libregf_value_item_read_data_at_offset(
+	              value_item,
+	              file_io_handle,
+	              NULL,
+	              16,
+	              0,
+	              &error );
+
+	REGF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libregf_value_item_read_data_at_offset(
+	              value_item,
+	              file_io_handle,
+	              buffer,
+	              (size_t) SSIZE_MAX + 1,
+	              0,
+	              &error );
+
+	REGF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libregf_value_item_read_data_at_offset(
+	              value_item,
+	              file_io_handle,
+	              buffer,
+	              16,
+	              -1,
+	              &error );
+
+	REGF_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_value_item_get_data_pointer function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_value_item_get_data_pointer(
+     libregf_value_item_t *value_item )
+{
+	libcerror_error_t *error = NULL;
+	const uint8_t *data      = NULL;
+	size_t data_size         = 0;
+	size_t expected_size     = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libregf_value_item_get_data_size(
+	          value_item,
+	          &expected_size,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libregf_value_item_get_data_pointer(
+	          value_item,
+	          &data,
+	          &data_size,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 expected_size );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_value_item_get_data_pointer(
+	          NULL,
+	          &data,
+	          &data_size,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_value_item_get_data_pointer(
+	          value_item,
+	          NULL,
+	          &data_size,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_value_item_get_data_pointer(
+	          value_item,
+	          &data,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_value_item_get_number_of_data_segments function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_value_item_get_number_of_data_segments(
+     libregf_value_item_t *value_item )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_segments   = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libregf_value_item_get_number_of_data_segments(
+	          value_item,
+	          &number_of_segments,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "number_of_segments",
+	 number_of_segments,
+	 ( value_item->data_buffer_size > 0 ) ? 1 : 0 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libregf_value_item_get_number_of_data_segments(
+	          NULL,
+	          &number_of_segments,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_value_item_get_number_of_data_segments(
+	          value_item,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libregf_value_item_get_data_segment_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int regf_test_value_item_get_data_segment_by_index(
+     libregf_value_item_t *value_item,
+     libregf_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle )
+{
+	libcerror_error_t *error    = NULL;
+	const uint8_t *data         = NULL;
+	const uint8_t *segment_data = NULL;
+	size_t data_size            = 0;
+	size_t segment_data_size    = 0;
+	int number_of_segments      = 0;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	result = libregf_value_item_get_number_of_data_segments(
+	          value_item,
+	          &number_of_segments,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	REGF_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_segments > 0 )
+	{
+		result = libregf_value_item_get_data_pointer(
+		          value_item,
+		          &data,
+		          &data_size,
+		          &error );
+
+		REGF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		REGF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libregf_value_item_get_data_segment_by_index(
+		          value_item,
+		          io_handle,
+		          file_io_handle,
+		          0,
+		          &segment_data,
+		          &segment_data_size,
+		          &error );
+
+		REGF_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		REGF_TEST_ASSERT_EQUAL_SIZE(
+		 "segment_data_size",
+		 segment_data_size,
+		 data_size );
+
+		REGF_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libregf_value_item_get_data_segment_by_index(
+	          NULL,
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          &segment_data,
+	          &segment_data_size,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_value_item_get_data_segment_by_index(
+	          value_item,
+	          NULL,
+	          file_io_handle,
+	          0,
+	          &segment_data,
+	          &segment_data_size,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_value_item_get_data_segment_by_index(
+	          value_item,
+	          io_handle,
+	          file_io_handle,
+	          -1,
+	          &segment_data,
+	          &segment_data_size,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_value_item_get_data_segment_by_index(
+	          value_item,
+	          io_handle,
+	          file_io_handle,
+	          number_of_segments,
+	          &segment_data,
+	          &segment_data_size,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_value_item_get_data_segment_by_index(
+	          value_item,
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          NULL,
+	          &segment_data_size,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libregf_value_item_get_data_segment_by_index(
+	          value_item,
+	          io_handle,
+	          file_io_handle,
+	          0,
+	          &segment_data,
+	          NULL,
+	          &error );
+
+	REGF_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	REGF_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBREGF_DLL_IMPORT ) */
 
 /* The main program
@@ -2821,6 +3382,29 @@ int main(
 	 value_item,
 	 file_io_handle );
 
+	REGF_TEST_RUN_WITH_ARGS(
+	 "libregf_value_item_read_data_at_offset",
+	 regf_test_value_item_read_data_at_offset,
+	 value_item,
+	 file_io_handle );
+
+	REGF_TEST_RUN_WITH_ARGS(
+	 "libregf_value_item_get_data_pointer",
+	 regf_test_value_item_get_data_pointer,
+	 value_item );
+
+	REGF_TEST_RUN_WITH_ARGS(
+	 "libregf_value_item_get_number_of_data_segments",
+	 regf_test_value_item_get_number_of_data_segments,
+	 value_item );
+
+	REGF_TEST_RUN_WITH_ARGS(
+	 "libregf_value_item_get_data_segment_by_index",
+	 regf_test_value_item_get_data_segment_by_index,
+	 value_item,
+	 io_handle,
+	 file_io_handle );
+
 	/* TODO: add tests for libregf_value_item_get_value_32bit */
 
 	/* TODO: add tests for libregf_value_item_get_value_64bit */
@@ -6,7 +6,7 @@ $ExitSuccess = 0
 $ExitFailure = 1
 $ExitIgnore = 77
 
-$LibraryTests = "checksum data_block_key data_block_stream data_type dirty_vector error file_header hive_bin hive_bin_cell hive_bin_header hive_bins_list io_handle key key_descriptor key_item multi_string named_key notify security_key sub_key_list value value_item value_key"
+$LibraryTests = "arena cell_iterator checksum data_block_key data_block_stream data_type dirty_pages dirty_vector error file_header file_mapping hash_table hive_bin hive_bin_cell hive_bin_header hive_bins_list index io_handle key key_descriptor key_item key_item_cache key_path_trie key_walker multi_string named_key notify security_key security_key_cache sub_key_list transaction_log value value_item value_key"
 $LibraryTestsWithInput = "file support"
 $OptionSets = ""
 
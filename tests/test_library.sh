@@ -7,7 +7,7 @@ EXIT_SUCCESS=0;
 EXIT_FAILURE=1;
 EXIT_IGNORE=77;
 
-LIBRARY_TESTS="checksum data_block_key data_block_stream data_type dirty_vector error file_header hive_bin hive_bin_cell hive_bin_header hive_bins_list io_handle key key_descriptor key_item multi_string named_key notify security_key sub_key_list value value_item value_key";
+LIBRARY_TESTS="arena cell_iterator checksum data_block_key data_block_stream data_type dirty_pages dirty_vector error file_header file_mapping hash_table hive_bin hive_bin_cell hive_bin_header hive_bins_list index io_handle key key_descriptor key_item key_item_cache key_path_trie key_walker multi_string named_key notify security_key security_key_cache sub_key_list transaction_log value value_item value_key";
 LIBRARY_TESTS_WITH_INPUT="file support";
 OPTION_SETS=();
 